@@ -135,6 +135,8 @@ if (CMAKE_PROJECT_NAME STREQUAL Urho3D)
     # On Windows platform Direct3D11 can be optionally chosen
     # Using Direct3D11 on non-MSVC compiler may require copying and renaming Microsoft official libraries (.lib to .a), else link failures or non-functioning graphics may result
     cmake_dependent_option (URHO3D_D3D11 "Use Direct3D11 instead of Direct3D9 (Windows platform only); overrides URHO3D_OPENGL option" FALSE "WIN32" FALSE)
+    # The Null graphics backend renders nothing and needs no window or GPU, for measuring the CPU cost of the rendering pipeline on any platform
+    option (URHO3D_NULL_GRAPHICS "Use the Null graphics backend, which issues no GPU calls; overrides URHO3D_OPENGL and URHO3D_D3D11 options" FALSE)
     if (NOT ARM)
         # It is not possible to turn SSE off on 64-bit MSVC and it appears it is also not able to do so safely on 64-bit GCC
         cmake_dependent_option (URHO3D_SSE "Enable SSE/SSE2 instruction set (32-bit Web and Intel platforms only, including Android on Intel Atom); default to true on Intel and false on Web platform; the effective SSE level could be higher, see also URHO3D_DEPLOYMENT_TARGET and CMAKE_OSX_DEPLOYMENT_TARGET build options" ${HAVE_SSE2} "NOT URHO3D_64BIT" TRUE)
@@ -387,6 +389,12 @@ if (EMSCRIPTEN)
     add_definitions (-DNO_POPEN)
 endif ()
 
+# URHO3D_NULL_GRAPHICS overrides URHO3D_OPENGL and URHO3D_D3D11 options
+if (URHO3D_NULL_GRAPHICS)
+    set (URHO3D_OPENGL 0)
+    set (URHO3D_D3D11 0)
+endif ()
+
 # URHO3D_D3D11 overrides URHO3D_OPENGL option
 if (URHO3D_D3D11)
     set (URHO3D_OPENGL 0)
@@ -472,7 +480,7 @@ endif ()
 if (WIN32 AND NOT CMAKE_PROJECT_NAME MATCHES ^Urho3D-ExternalProject-)
     set (DIRECTX_REQUIRED_COMPONENTS)
     set (DIRECTX_OPTIONAL_COMPONENTS DInput DSound XAudio2 XInput)
-    if (NOT URHO3D_OPENGL)
+    if (NOT URHO3D_OPENGL AND NOT URHO3D_NULL_GRAPHICS)
         if (URHO3D_D3D11)
             list (APPEND DIRECTX_REQUIRED_COMPONENTS D3D11)
         else ()
@@ -171,7 +171,8 @@ void HugeObjectCount::CreateInstructions()
     instructionText->SetText(
         "Use WASD keys and mouse/touch to move\n"
         "Space to toggle animation\n"
-        "G to toggle object group optimization"
+        "G to toggle object group optimization\n"
+        "T to toggle linear transform update"
     );
     instructionText->SetFont(cache->GetResource<Font>("Fonts/Anonymous Pro.ttf"), 15);
     // The text has multiple rows. Center them in relation to each other
@@ -262,6 +263,10 @@ void HugeObjectCount::HandleUpdate(StringHash eventType, VariantMap& eventData)
         CreateScene();
     }
 
+    // Toggle updating world transforms in one linear pass instead of lazily on access
+    if (input->GetKeyPress(KEY_T))
+        scene_->SetLinearTransformUpdate(!scene_->GetLinearTransformUpdate());
+
     // Move the camera, scale movement with time step
     MoveCamera(timeStep);
 
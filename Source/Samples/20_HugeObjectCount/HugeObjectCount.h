@@ -39,6 +39,7 @@ class Scene;
 ///     - Allowing examination of performance hotspots in the rendering code
 ///     - Using the profiler to measure the time taken to animate the scene
 ///     - Optionally speeding up rendering by grouping objects with the StaticModelGroup component
+///     - Optionally updating world transforms in one linear pass over the flattened node hierarchy
 class HugeObjectCount : public Sample
 {
     URHO3D_OBJECT(HugeObjectCount, Sample);
@@ -32,6 +32,7 @@
 #include <Urho3D/Graphics/IndexBuffer.h>
 #include <Urho3D/Graphics/Light.h>
 #include <Urho3D/Graphics/Material.h>
+#include <Urho3D/Graphics/MeshOptimization.h>
 #include <Urho3D/Graphics/Octree.h>
 #include <Urho3D/Graphics/VertexBuffer.h>
 #include <Urho3D/Graphics/Zone.h>
@@ -171,6 +172,10 @@ bool noOverwriteNewerTexture_ = false;
 bool checkUniqueModel_ = true;
 bool moveToBindPose_ = false;
 unsigned maxBones_ = 64;
+PODVector<float> lodRatios_;
+PODVector<float> lodDistances_;
+float lodMaxError_ = 0.05f;
+bool optimizeVertices_ = false;
 Vector<String> nonSkinningBoneIncludes_;
 Vector<String> nonSkinningBoneExcludes_;
 
@@ -222,9 +227,8 @@ String GetMaterialTextureName(const String& nameIn);
 String GenerateMaterialName(aiMaterial* material);
 String GenerateTextureName(unsigned texIndex);
 unsigned GetNumValidFaces(aiMesh* mesh);
+void BuildLodIndices(aiMesh* mesh, Vector<PODVector<unsigned> >& lodIndices);
 
-void WriteShortIndices(unsigned short*& dest, aiMesh* mesh, unsigned index, unsigned offset);
-void WriteLargeIndices(unsigned*& dest, aiMesh* mesh, unsigned index, unsigned offset);
 void WriteVertex(float*& dest, aiMesh* mesh, unsigned index, bool isSkinned, BoundingBox& box,
     const Matrix3x4& vertexTransform, const Matrix3& normalTransform, Vector<PODVector<unsigned char> >& blendIndices,
     Vector<PODVector<float> >& blendWeights);
@@ -313,6 +317,11 @@ void Run(const Vector<String>& arguments)
             "-split <start> <end> (animation model only)\n"
             "            Split animation, will only import from start frame to end frame\n"
             "-np         Do not suppress $fbx pivot nodes (FBX files only)\n"
+            "-lod <ratio> <dist> Generate a simplified LOD level with the given triangle ratio\n"
+            "            and LOD distance. Can be repeated for more levels\n"
+            "-lode <x>   Maximum LOD simplification error relative to mesh size. Default 0.05\n"
+            "-ov         Optimize triangle order for the vertex cache and vertex order for\n"
+            "            fetching, and weld identical vertices\n"
         );
     }
 
@@ -463,6 +472,23 @@ void Run(const Vector<String>& arguments)
                 checkUniqueModel_ = false;
             else if (argument == "bp")
                 moveToBindPose_ = true;
+            else if (argument == "lod")
+            {
+                String value2 = i + 2 < arguments.Size() ? arguments[i + 2] : String::EMPTY;
+                if (value.Length() && value2.Length() && (value[0] != '-') && (value2[0] != '-'))
+                {
+                    lodRatios_.Push(Clamp(ToFloat(value), 0.0f, 1.0f));
+                    lodDistances_.Push(ToFloat(value2));
+                    i += 2;
+                }
+            }
+            else if (argument == "ov")
+                optimizeVertices_ = true;
+            else if (argument == "lode" && !value.Empty())
+            {
+                lodMaxError_ = Max(ToFloat(value), 0.0f);
+                ++i;
+            }
             else if (argument == "split")
             {
                 String value2 = i + 2 < arguments.Size() ? arguments[i + 2] : String::EMPTY;
@@ -1011,14 +1037,20 @@ void BuildAndSaveModel(OutModel& model)
     BoundingBox box;
 
     unsigned numValidGeometries = 0;
+    unsigned totalIndices = 0;
 
     bool combineBuffers = true;
     // Check if buffers can be combined (same vertex elements, under 65535 vertices)
+    // Also build the index data of each LOD level
     PODVector<VertexElement> elements = GetVertexElements(model.meshes_[0], model.bones_.Size() > 0);
+    Vector<Vector<PODVector<unsigned> > > allLodIndices(model.meshes_.Size());
     for (unsigned i = 0; i < model.meshes_.Size(); ++i)
     {
         if (GetNumValidFaces(model.meshes_[i]))
         {
+            BuildLodIndices(model.meshes_[i], allLodIndices[i]);
+            for (unsigned j = 0; j < allLodIndices[i].Size(); ++j)
+                totalIndices += allLodIndices[i][j].Size();
             ++numValidGeometries;
             if (i > 0 && GetVertexElements(model.meshes_[i], model.bones_.Size() > 0) != elements)
                 combineBuffers = false;
@@ -1060,9 +1092,14 @@ void BuildAndSaveModel(OutModel& model)
         if (!validFaces)
             continue;
 
+        const Vector<PODVector<unsigned> >& lodIndices = allLodIndices[i];
+        unsigned meshIndices = 0;
+        for (unsigned j = 0; j < lodIndices.Size(); ++j)
+            meshIndices += lodIndices[j].Size();
+
         bool largeIndices;
         if (combineBuffers)
-            largeIndices = model.totalIndices_ > 65535;
+            largeIndices = totalIndices > 65535;
         else
             largeIndices = mesh->mNumVertices > 65535;
 
@@ -1074,12 +1111,12 @@ void BuildAndSaveModel(OutModel& model)
 
             if (combineBuffers)
             {
-                ib->SetSize(model.totalIndices_, largeIndices);
+                ib->SetSize(totalIndices, largeIndices);
                 vb->SetSize(model.totalVertices_, elements);
             }
             else
             {
-                ib->SetSize(validFaces * 3, largeIndices);
+                ib->SetSize(meshIndices, largeIndices);
                 vb->SetSize(mesh->mNumVertices, elements);
             }
 
@@ -1098,8 +1135,6 @@ void BuildAndSaveModel(OutModel& model)
         vertexTransform = Matrix3x4(pos, rot, scale);
         normalTransform = rot.RotationMatrix();
 
-        SharedPtr<Geometry> geom(new Geometry(context_));
-
         PrintLine("Writing geometry " + String(i) + " with " + String(mesh->mNumVertices) + " vertices " +
             String(validFaces * 3) + " indices");
 
@@ -1109,18 +1144,24 @@ void BuildAndSaveModel(OutModel& model)
         unsigned char* vertexData = vb->GetShadowData();
         unsigned char* indexData = ib->GetShadowData();
 
-        // Build the index data
+        // Build the index data of all LOD levels
         if (!largeIndices)
         {
             unsigned short* dest = (unsigned short*)indexData + startIndexOffset;
-            for (unsigned j = 0; j < mesh->mNumFaces; ++j)
-                WriteShortIndices(dest, mesh, j, startVertexOffset);
+            for (unsigned j = 0; j < lodIndices.Size(); ++j)
+            {
+                for (unsigned k = 0; k < lodIndices[j].Size(); ++k)
+                    *dest++ = (unsigned short)(lodIndices[j][k] + startVertexOffset);
+            }
         }
         else
         {
             unsigned* dest = (unsigned*)indexData + startIndexOffset;
-            for (unsigned j = 0; j < mesh->mNumFaces; ++j)
-                WriteLargeIndices(dest, mesh, j, startVertexOffset);
+            for (unsigned j = 0; j < lodIndices.Size(); ++j)
+            {
+                for (unsigned k = 0; k < lodIndices[j].Size(); ++k)
+                    *dest++ = lodIndices[j][k] + startVertexOffset;
+            }
         }
 
         // Build the vertex data
@@ -1152,18 +1193,25 @@ void BuildAndSaveModel(OutModel& model)
             center /= (float)validFaces * 3;
         }
 
-        // Define the geometry
-        geom->SetIndexBuffer(ib);
-        geom->SetVertexBuffer(0, vb);
-        geom->SetDrawRange(TRIANGLE_LIST, startIndexOffset, validFaces * 3, true);
-        outModel->SetNumGeometryLodLevels(destGeomIndex, 1);
-        outModel->SetGeometry(destGeomIndex, 0, geom);
+        // Define the geometry LOD levels
+        outModel->SetNumGeometryLodLevels(destGeomIndex, lodIndices.Size());
+        unsigned lodIndexOffset = startIndexOffset;
+        for (unsigned j = 0; j < lodIndices.Size(); ++j)
+        {
+            SharedPtr<Geometry> geom(new Geometry(context_));
+            geom->SetIndexBuffer(ib);
+            geom->SetVertexBuffer(0, vb);
+            geom->SetDrawRange(TRIANGLE_LIST, lodIndexOffset, lodIndices[j].Size(), true);
+            geom->SetLodDistance(j ? lodDistances_[j - 1] : 0.0f);
+            outModel->SetGeometry(destGeomIndex, j, geom);
+            lodIndexOffset += lodIndices[j].Size();
+        }
         outModel->SetGeometryCenter(destGeomIndex, center);
         if (model.bones_.Size() > maxBones_)
             allBoneMappings.Push(boneMappings);
 
         startVertexOffset += mesh->mNumVertices;
-        startIndexOffset += validFaces * 3;
+        startIndexOffset += meshIndices;
         ++destGeomIndex;
     }
 
@@ -1173,6 +1221,22 @@ void BuildAndSaveModel(OutModel& model)
     outModel->SetIndexBuffers(ibVector);
     outModel->SetBoundingBox(box);
 
+    if (optimizeVertices_)
+    {
+        unsigned oldVertices = 0;
+        unsigned newVertices = 0;
+        for (unsigned i = 0; i < vbVector.Size(); ++i)
+            oldVertices += vbVector[i]->GetVertexCount();
+        float oldMissRatio = outModel->GetVertexCacheMissRatio();
+
+        outModel->OptimizeGeometry();
+
+        for (unsigned i = 0; i < vbVector.Size(); ++i)
+            newVertices += vbVector[i]->GetVertexCount();
+        PrintLine("Optimized vertex cache miss ratio from " + String(oldMissRatio) + " to " +
+            String(outModel->GetVertexCacheMissRatio()) + ", vertices from " + String(oldVertices) + " to " + String(newVertices));
+    }
+
     // Build skeleton if necessary
     if (model.bones_.Size() && model.rootBone_)
     {
@@ -2402,23 +2466,38 @@ unsigned GetNumValidFaces(aiMesh* mesh)
     return ret;
 }
 
-void WriteShortIndices(unsigned short*& dest, aiMesh* mesh, unsigned index, unsigned offset)
+void BuildLodIndices(aiMesh* mesh, Vector<PODVector<unsigned> >& lodIndices)
 {
-    if (mesh->mFaces[index].mNumIndices == 3)
+    PODVector<unsigned> indices;
+    for (unsigned i = 0; i < mesh->mNumFaces; ++i)
     {
-        *dest++ = mesh->mFaces[index].mIndices[0] + offset;
-        *dest++ = mesh->mFaces[index].mIndices[1] + offset;
-        *dest++ = mesh->mFaces[index].mIndices[2] + offset;
+        if (mesh->mFaces[i].mNumIndices == 3)
+        {
+            indices.Push(mesh->mFaces[i].mIndices[0]);
+            indices.Push(mesh->mFaces[i].mIndices[1]);
+            indices.Push(mesh->mFaces[i].mIndices[2]);
+        }
     }
-}
 
-void WriteLargeIndices(unsigned*& dest, aiMesh* mesh, unsigned index, unsigned offset)
-{
-    if (mesh->mFaces[index].mNumIndices == 3)
+    lodIndices.Clear();
+    lodIndices.Push(indices);
+
+    // Simplify each LOD level from the original triangles. The LOD levels share the original vertices
+    for (unsigned i = 0; i < lodRatios_.Size(); ++i)
     {
-        *dest++ = mesh->mFaces[index].mIndices[0] + offset;
-        *dest++ = mesh->mFaces[index].mIndices[1] + offset;
-        *dest++ = mesh->mFaces[index].mIndices[2] + offset;
+        PODVector<unsigned> lod;
+        float error = SimplifyMesh(lod, &indices[0], indices.Size(), mesh->mVertices, sizeof(aiVector3D), mesh->mNumVertices, 0,
+            (unsigned)(indices.Size() * lodRatios_[i]), lodMaxError_);
+        if (lod.Empty() || lod.Size() >= lodIndices.Back().Size())
+        {
+            PrintLine("Simplification error limit reached, skipping LOD level " + String(i + 1) + " and above");
+            break;
+        }
+
+        OptimizeVertexCache(&lod[0], lod.Size(), mesh->mNumVertices);
+        OptimizeOverdraw(&lod[0], lod.Size(), mesh->mVertices, sizeof(aiVector3D), mesh->mNumVertices, 0);
+        PrintLine("Generated LOD level " + String(i + 1) + " with " + String(lod.Size()) + " indices, error " + String(error));
+        lodIndices.Push(lod);
     }
 }
 
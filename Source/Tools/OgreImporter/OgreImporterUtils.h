@@ -31,13 +31,6 @@
 
 using namespace Urho3D;
 
-struct Triangle
-{
-    unsigned v0_;
-    unsigned v1_;
-    unsigned v2_;
-};
-
 struct ModelBone
 {
     String name_;
@@ -96,10 +89,6 @@ struct ModelVertex
     float blendWeights_[4];
     unsigned char blendIndices_[4];
     bool hasBlendWeights_;
-    
-    unsigned useCount_;
-    int cachePosition_;
-    float score_;
 };
 
 struct ModelVertexBuffer
@@ -0,0 +1,779 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include <Urho3D/Core/CoreEvents.h>
+#include <Urho3D/Core/Main.h>
+#include <Urho3D/Core/ProcessUtils.h>
+#include <Urho3D/Core/Profiler.h>
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Core/WorkQueue.h>
+#include <Urho3D/Engine/Engine.h>
+#include <Urho3D/Graphics/Batch.h>
+#include <Urho3D/Graphics/Camera.h>
+#include <Urho3D/Graphics/Graphics.h>
+#include <Urho3D/Graphics/GraphicsImpl.h>
+#include <Urho3D/Graphics/Light.h>
+#include <Urho3D/Graphics/Material.h>
+#include <Urho3D/Graphics/Model.h>
+#include <Urho3D/Graphics/OcclusionBuffer.h>
+#include <Urho3D/Graphics/Octree.h>
+#include <Urho3D/Graphics/ParticleEffect.h>
+#include <Urho3D/Graphics/ParticleEmitter.h>
+#include <Urho3D/Graphics/Renderer.h>
+#include <Urho3D/Graphics/View.h>
+#include <Urho3D/Graphics/StaticModel.h>
+#include <Urho3D/Graphics/StaticModelGroup.h>
+#include <Urho3D/Graphics/Viewport.h>
+#include <Urho3D/Graphics/Zone.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/VectorBuffer.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/Resource/XMLFile.h>
+#include <Urho3D/Scene/Scene.h>
+
+#include "RenderBenchmark.h"
+
+#include <cstdarg>
+#include <cstdio>
+
+#include <Urho3D/DebugNew.h>
+
+URHO3D_DEFINE_APPLICATION_MAIN(RenderBenchmark);
+
+/// Format a string with printf-style fixed point precision, which ToString() does not support.
+static String Format(const char* format, ...)
+{
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof buffer, format, args);
+    va_end(args);
+    return String(buffer);
+}
+
+RenderBenchmark::RenderBenchmark(Context* context) :
+    Application(context),
+    numFrames_(300),
+    numWarmupFrames_(30),
+    numObjects_(10000),
+    numLights_(16),
+    numSpotLights_(0),
+    numLoadNodes_(100000),
+    numTransformNodes_(100000),
+    numOcclusionTriangles_(20000),
+    numSortBatches_(100000),
+    numThreads_(M_MAX_UNSIGNED),
+    numMovingObjects_(0),
+    numParticles_(0),
+    numInstances_(0),
+    instanceGroupSize_(0),
+    staticCamera_(false),
+    visibilityCaching_(false),
+    shadowOcclusion_(false),
+    batchCaching_(false),
+    clusteredLighting_(false),
+    shadowMapCaching_(false),
+    instanceCulling_(true),
+    linearTransformUpdate_(false),
+    frameNumber_(0),
+    totalFrameTime_(0),
+    minFrameTime_(M_MAX_INT),
+    maxFrameTime_(0),
+    totalBatches_(0),
+    totalPrimitives_(0),
+    totalStateChanges_(0),
+    totalParameterUpdates_(0),
+    totalUploadBytes_(0),
+    totalUpdatedDrawables_(0),
+    totalReinsertedDrawables_(0),
+    totalCacheHits_(0),
+    totalCacheMisses_(0),
+    totalOccludedShadowCasters_(0),
+    totalClusteredLights_(0),
+    totalReusedShadowMaps_(0)
+{
+}
+
+void RenderBenchmark::Setup()
+{
+    const Vector<String>& arguments = GetArguments();
+    for (unsigned i = 0; i < arguments.Size(); ++i)
+    {
+        if (arguments[i].Length() < 2 || arguments[i][0] != '-')
+            continue;
+
+        String argument = arguments[i].Substring(1).ToLower();
+        String value = i + 1 < arguments.Size() ? arguments[i + 1] : String::EMPTY;
+
+        if (argument == "frames" && !value.Empty())
+            numFrames_ = Max(ToUInt(value), 1U);
+        else if (argument == "warmup" && !value.Empty())
+            numWarmupFrames_ = ToUInt(value);
+        else if (argument == "objects" && !value.Empty())
+            numObjects_ = ToUInt(value);
+        else if (argument == "lights" && !value.Empty())
+            numLights_ = ToUInt(value);
+        else if (argument == "spots" && !value.Empty())
+            numSpotLights_ = ToUInt(value);
+        else if (argument == "loadnodes" && !value.Empty())
+            numLoadNodes_ = ToUInt(value);
+        else if (argument == "transformnodes" && !value.Empty())
+            numTransformNodes_ = ToUInt(value);
+        else if (argument == "occlusion" && !value.Empty())
+            numOcclusionTriangles_ = ToUInt(value);
+        else if (argument == "sort" && !value.Empty())
+            numSortBatches_ = ToUInt(value);
+        else if (argument == "precache" && !value.Empty())
+            precacheFileName_ = value;
+        else if (argument == "threads" && !value.Empty())
+            numThreads_ = ToUInt(value);
+        else if (argument == "moving" && !value.Empty())
+            numMovingObjects_ = ToUInt(value);
+        else if (argument == "particles" && !value.Empty())
+            numParticles_ = ToUInt(value);
+        else if (argument == "instances" && !value.Empty())
+            numInstances_ = ToUInt(value);
+        else if (argument == "groupsize" && !value.Empty())
+            instanceGroupSize_ = ToUInt(value);
+        else if (argument == "staticcamera")
+            staticCamera_ = true;
+        else if (argument == "viscache")
+            visibilityCaching_ = true;
+        else if (argument == "shadowocclusion")
+            shadowOcclusion_ = true;
+        else if (argument == "batchcache")
+            batchCaching_ = true;
+        else if (argument == "clustered")
+            clusteredLighting_ = true;
+        else if (argument == "shadowcache")
+            shadowMapCaching_ = true;
+        else if (argument == "noinstanceculling")
+            instanceCulling_ = false;
+        else if (argument == "lineartransforms")
+            linearTransformUpdate_ = true;
+        else if (argument == "help")
+        {
+            ErrorExit("Usage: RenderBenchmark [options]\n\n"
+                "Builds synthetic scenes and reports CPU timings of scene loading and of the rendering pipeline stages.\n"
+                "Build the engine with URHO3D_NULL_GRAPHICS to measure without a GPU driver; with -headless only the scene load\n"
+                "benchmark is run. The engine command line options are also accepted.\n\n"
+                "Options:\n"
+                "-frames <num>    Number of measured frames, default 300\n"
+                "-warmup <num>    Number of frames run before measuring, default 30\n"
+                "-objects <num>   Number of objects in the rendering scene, default 10000\n"
+                "-lights <num>    Number of point lights in the rendering scene, default 16\n"
+                "-spots <num>     Number of shadowed spot lights in the rendering scene, default 0\n"
+                "-moving <num>    Number of objects, and of group instances, moving every frame, default 0\n"
+                "-particles <num> Number of particles simulated every frame, in emitters of 1000 particles, default 0\n"
+                "-instances <num> Number of small boxes in static model groups as in the HugeObjectCount sample, default 0\n"
+                "-groupsize <num> Number of boxes per static model group, 0 for a single group, default 0\n"
+                "-loadnodes <num> Number of nodes in the scene load benchmark, 0 to skip, default 100000\n"
+                "-transformnodes <num> Number of nodes in the transform update benchmark, 0 to skip, default 100000\n"
+                "-occlusion <num> Number of occluder triangles in the occlusion benchmark, 0 to skip, default 20000\n"
+                "-sort <num>      Number of batches in the batch sorting benchmark, 0 to skip, default 100000\n"
+                "-precache <file> Time precaching the shader combinations listed in an XML file, which can be dumped with -ds\n"
+                "-threads <num>   Number of worker threads, default is one less than the number of CPU cores\n"
+                "-staticcamera    Do not move the camera\n"
+                "-viscache        Enable visibility caching in the renderer\n"
+                "-shadowocclusion Make the boxes occluders and enable shadow caster occlusion in the renderer\n"
+                "-batchcache      Enable base pass batch caching in the renderer\n"
+                "-clustered       Use the clustered forward render path for the point lights\n"
+                "-shadowcache     Enable shadow map caching in the renderer\n"
+                "-noinstanceculling Draw all instances of the static model groups instead of culling them\n"
+                "-lineartransforms Use the linear transform update in the rendering scene\n"
+            );
+            return;
+        }
+    }
+
+    engineParameters_["WindowTitle"] = "RenderBenchmark";
+    engineParameters_["FullScreen"] = false;
+    engineParameters_["FrameLimiter"] = false;
+    engineParameters_["Sound"] = false;
+    // The worker threads are created in Start() if their number is given explicitly
+    if (numThreads_ != M_MAX_UNSIGNED)
+        engineParameters_["WorkerThreads"] = false;
+    if (!engineParameters_.Contains("WindowWidth"))
+    {
+        engineParameters_["WindowWidth"] = 1280;
+        engineParameters_["WindowHeight"] = 720;
+    }
+
+    // Use the same resource search paths as Urho3DPlayer
+    if (!engineParameters_.Contains("ResourcePrefixPaths"))
+        engineParameters_["ResourcePrefixPaths"] = ";../share/Resources;../share/Urho3D/Resources";
+}
+
+void RenderBenchmark::Start()
+{
+    // Use a fixed seed so that runs are comparable
+    SetRandomSeed(1);
+
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+    if (numThreads_ != M_MAX_UNSIGNED && numThreads_ > 0)
+        queue->CreateThreads(numThreads_);
+
+    if (numLoadNodes_)
+        RunLoadBenchmark();
+    if (numTransformNodes_)
+        RunTransformBenchmark();
+    if (numOcclusionTriangles_)
+        RunOcclusionBenchmark();
+    if (numSortBatches_)
+        RunSortBenchmark();
+
+    // Without a renderer only the scene load benchmark can be run
+    if (!GetSubsystem<Renderer>())
+    {
+        engine_->Exit();
+        return;
+    }
+
+    if (!precacheFileName_.Empty())
+        RunPrecacheBenchmark();
+
+    CreateRenderScene();
+    GetSubsystem<Renderer>()->SetVisibilityCaching(visibilityCaching_);
+    GetSubsystem<Renderer>()->SetShadowCasterOcclusion(shadowOcclusion_);
+    GetSubsystem<Renderer>()->SetBatchCaching(batchCaching_);
+    GetSubsystem<Renderer>()->SetShadowMapCaching(shadowMapCaching_);
+
+    PrintLine(Format("Rendering %u objects, %u group instances, %u point lights, %u spot lights and %u particles with %s graphics and %u worker "
+        "threads, %u warmup and %u measured frames", numObjects_, numInstances_, numLights_, numSpotLights_, numParticles_,
+        GetSubsystem<Graphics>()->GetApiName().CString(), queue->GetNumThreads(), numWarmupFrames_, numFrames_));
+
+    SubscribeToEvent(E_BEGINFRAME, URHO3D_HANDLER(RenderBenchmark, HandleBeginFrame));
+    SubscribeToEvent(E_UPDATE, URHO3D_HANDLER(RenderBenchmark, HandleUpdate));
+    SubscribeToEvent(E_ENDFRAME, URHO3D_HANDLER(RenderBenchmark, HandleEndFrame));
+}
+
+void RenderBenchmark::RunLoadBenchmark()
+{
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    Model* model = cache->GetResource<Model>("Models/Box.mdl");
+    Material* material = cache->GetResource<Material>("Materials/Stone.xml");
+
+    // Build the nodes in groups of a hundred to get a two-level hierarchy like in a typical level
+    SharedPtr<Scene> sourceScene(new Scene(context_));
+    sourceScene->CreateComponent<Octree>();
+    unsigned numNodes = 0;
+    while (numNodes < numLoadNodes_)
+    {
+        Node* groupNode = sourceScene->CreateChild("Group");
+        groupNode->SetPosition(Vector3(Random(1000.0f), 0.0f, Random(1000.0f)));
+        ++numNodes;
+
+        for (unsigned i = 0; i < 99 && numNodes < numLoadNodes_; ++i, ++numNodes)
+        {
+            Node* objectNode = groupNode->CreateChild("Object");
+            objectNode->SetPosition(Vector3(Random(20.0f), 0.0f, Random(20.0f)));
+            objectNode->SetRotation(Quaternion(0.0f, Random(360.0f), 0.0f));
+            StaticModel* object = objectNode->CreateComponent<StaticModel>();
+            object->SetModel(model);
+            object->SetMaterial(material);
+        }
+    }
+
+    VectorBuffer buffer;
+    HiresTimer timer;
+    sourceScene->Save(buffer);
+    long long saveTime = timer.GetUSec(true);
+    sourceScene.Reset();
+
+    SharedPtr<Scene> loadScene(new Scene(context_));
+    buffer.Seek(0);
+    timer.Reset();
+    bool success = loadScene->Load(buffer);
+    long long loadTime = timer.GetUSec(false);
+
+    timer.Reset();
+    loadScene.Reset();
+    long long destroyTime = timer.GetUSec(false);
+
+    if (!success)
+    {
+        PrintLine("Scene load benchmark failed", true);
+        return;
+    }
+
+    PrintLine(Format("Scene load: %u nodes, %u bytes, save %.3f ms, load %.3f ms, destroy %.3f ms", numNodes, buffer.GetSize(),
+        saveTime / 1000.0f, loadTime / 1000.0f, destroyTime / 1000.0f));
+}
+
+void RenderBenchmark::RunTransformBenchmark()
+{
+    static const unsigned NUM_ITERATIONS = 20;
+
+    // Build the nodes in groups of a hundred as in the scene load benchmark. All of them rotate on every iteration, as the
+    // boxes of the HugeObjectCount sample do
+    SharedPtr<Scene> scene(new Scene(context_));
+    PODVector<Node*> nodes;
+    while (nodes.Size() < numTransformNodes_)
+    {
+        Node* groupNode = scene->CreateChild("Group");
+        groupNode->SetPosition(Vector3(Random(1000.0f), 0.0f, Random(1000.0f)));
+        nodes.Push(groupNode);
+
+        for (unsigned i = 0; i < 99 && nodes.Size() < numTransformNodes_; ++i)
+        {
+            Node* objectNode = groupNode->CreateChild("Object");
+            objectNode->SetPosition(Vector3(Random(20.0f), 0.0f, Random(20.0f)));
+            nodes.Push(objectNode);
+        }
+    }
+
+    // Drawables access their nodes in octree order, which is unrelated to the node creation order
+    PODVector<Node*> accessOrder = nodes;
+    for (unsigned i = accessOrder.Size() - 1; i > 0; --i)
+        Swap(accessOrder[i], accessOrder[Rand() % (i + 1)]);
+
+    long long updateTimes[2];
+    for (unsigned linear = 0; linear < 2; ++linear)
+    {
+        scene->SetLinearTransformUpdate(linear != 0);
+
+        HiresTimer timer;
+        long long updateTime = 0;
+        for (unsigned i = 0; i < NUM_ITERATIONS; ++i)
+        {
+            for (unsigned j = 0; j < nodes.Size(); ++j)
+                nodes[j]->Yaw(1.0f);
+
+            timer.Reset();
+            if (linear)
+                scene->UpdateTransforms();
+            for (unsigned j = 0; j < accessOrder.Size(); ++j)
+                accessOrder[j]->GetWorldTransform();
+            updateTime += timer.GetUSec(false);
+        }
+        updateTimes[linear] = Max(updateTime, 1LL);
+    }
+
+    PrintLine(Format("Transform update: %u nodes, lazy %.3f ms, linear %.3f ms", nodes.Size(),
+        updateTimes[0] / 1000.0f / NUM_ITERATIONS, updateTimes[1] / 1000.0f / NUM_ITERATIONS));
+}
+
+void RenderBenchmark::RunOcclusionBenchmark()
+{
+    static const unsigned NUM_ITERATIONS = 50;
+    static const unsigned NUM_VISIBILITY_TESTS = 10000;
+    static const int BUFFER_WIDTH = 256;
+    static const int BUFFER_HEIGHT = 144;
+
+    // Build a unit cube as a non-indexed triangle list
+    static const unsigned cubeIndices[] = {
+        0, 2, 1, 1, 2, 3, 4, 5, 6, 5, 7, 6, 0, 1, 4, 1, 5, 4, 2, 6, 3, 3, 6, 7, 0, 4, 2, 2, 4, 6, 1, 3, 5, 3, 7, 5
+    };
+    Vector3 cubeVertices[36];
+    for (unsigned i = 0; i < 36; ++i)
+    {
+        unsigned corner = cubeIndices[i];
+        cubeVertices[i] = Vector3(corner & 1 ? 0.5f : -0.5f, corner & 2 ? 0.5f : -0.5f, corner & 4 ? 0.5f : -0.5f);
+    }
+
+    // Scatter the cubes in front of the camera
+    unsigned numCubes = (numOcclusionTriangles_ + 11) / 12;
+    PODVector<Matrix3x4> transforms(numCubes);
+    for (unsigned i = 0; i < numCubes; ++i)
+    {
+        float distance = 10.0f + Random(90.0f);
+        Vector3 position(Random(distance) - 0.5f * distance, Random(0.5f * distance) - 0.25f * distance, distance);
+        transforms[i] = Matrix3x4(position, Quaternion(Random(360.0f), Random(360.0f), 0.0f), 2.0f + Random(10.0f));
+    }
+
+    PODVector<BoundingBox> testBoxes(NUM_VISIBILITY_TESTS);
+    for (unsigned i = 0; i < NUM_VISIBILITY_TESTS; ++i)
+    {
+        Vector3 center(Random(100.0f) - 50.0f, Random(50.0f) - 25.0f, 20.0f + Random(100.0f));
+        testBoxes[i] = BoundingBox(center - Vector3::ONE, center + Vector3::ONE);
+    }
+
+    SharedPtr<Node> cameraNode(new Node(context_));
+    Camera* camera = cameraNode->CreateComponent<Camera>();
+    camera->SetFarClip(200.0f);
+    camera->SetAspectRatio((float)BUFFER_WIDTH / (float)BUFFER_HEIGHT);
+
+    // Measure rendering without and with threading
+    for (unsigned threaded = 0; threaded < 2; ++threaded)
+    {
+        SharedPtr<OcclusionBuffer> buffer(new OcclusionBuffer(context_));
+        buffer->SetSize(BUFFER_WIDTH, BUFFER_HEIGHT, threaded != 0);
+        buffer->SetView(camera);
+        buffer->SetMaxTriangles(M_MAX_UNSIGNED);
+
+        HiresTimer timer;
+        long long drawTime = 0;
+        long long hierarchyTime = 0;
+        for (unsigned i = 0; i < NUM_ITERATIONS; ++i)
+        {
+            timer.Reset();
+            buffer->Clear();
+            for (unsigned j = 0; j < numCubes; ++j)
+                buffer->AddTriangles(transforms[j], cubeVertices, sizeof(Vector3), 0, 36);
+            buffer->DrawTriangles();
+            drawTime += timer.GetUSec(true);
+            buffer->BuildDepthHierarchy();
+            hierarchyTime += timer.GetUSec(false);
+        }
+
+        unsigned numVisible = 0;
+        timer.Reset();
+        for (unsigned i = 0; i < NUM_VISIBILITY_TESTS; ++i)
+        {
+            if (buffer->IsVisible(testBoxes[i]))
+                ++numVisible;
+        }
+        long long testTime = timer.GetUSec(false);
+
+        PrintLine(Format("Occlusion %s: %u triangles, %.1f triangles/ms, depth hierarchy %.3f ms, %.1f visibility tests/ms "
+            "(%u of %u visible)", threaded ? "threaded" : "serial", numCubes * 12, (float)numCubes * 12 * NUM_ITERATIONS /
+            Max(drawTime / 1000.0f, 0.001f), hierarchyTime / 1000.0f / NUM_ITERATIONS, NUM_VISIBILITY_TESTS /
+            Max(testTime / 1000.0f, 0.001f), numVisible, NUM_VISIBILITY_TESTS));
+    }
+}
+
+void RenderBenchmark::RunSortBenchmark()
+{
+    static const unsigned NUM_ITERATIONS = 20;
+    static const unsigned NUM_SHADERS = 32;
+    static const unsigned NUM_MATERIALS = 256;
+    static const unsigned NUM_GEOMETRIES = 512;
+
+    // Build batches with random distances and state sorting keys, and a few render orders
+    BatchQueue queue;
+    queue.batches_.Resize(numSortBatches_);
+    for (unsigned i = 0; i < numSortBatches_; ++i)
+    {
+        Batch& batch = queue.batches_[i];
+        batch.distance_ = Random(500.0f);
+        batch.renderOrder_ = (unsigned char)(DEFAULT_RENDER_ORDER + (Rand() % 8 == 0 ? 1 : 0));
+        batch.sortKey_ = ((unsigned long long)(Rand() % NUM_SHADERS) << 48) | ((unsigned long long)(Rand() % NUM_MATERIALS) << 16) |
+            (Rand() % NUM_GEOMETRIES);
+    }
+
+    PODVector<Batch*> batches(numSortBatches_);
+    static const char* orderNames[] = { "state", "front to back", "back to front" };
+
+    for (unsigned order = BSO_STATE; order <= BSO_BACKTOFRONT; ++order)
+    {
+        long long sortTimes[2];
+        for (unsigned radix = 0; radix < 2; ++radix)
+        {
+            HiresTimer timer;
+            long long sortTime = 0;
+            for (unsigned i = 0; i < NUM_ITERATIONS; ++i)
+            {
+                for (unsigned j = 0; j < numSortBatches_; ++j)
+                    batches[j] = &queue.batches_[j];
+
+                timer.Reset();
+                queue.SortBatches(batches, (BatchSortOrder)order, radix != 0);
+                sortTime += timer.GetUSec(false);
+            }
+            sortTimes[radix] = Max(sortTime, 1LL);
+        }
+
+        PrintLine(Format("Batch sort by %s: %u batches, comparison sort %.1f batches/ms, radix sort %.1f batches/ms",
+            orderNames[order], numSortBatches_, (float)numSortBatches_ * NUM_ITERATIONS * 1000.0f / sortTimes[0],
+            (float)numSortBatches_ * NUM_ITERATIONS * 1000.0f / sortTimes[1]));
+    }
+}
+
+void RenderBenchmark::RunPrecacheBenchmark()
+{
+    File file(context_);
+    if (!file.Open(precacheFileName_))
+    {
+        PrintLine("Could not open shader precache file " + precacheFileName_);
+        return;
+    }
+
+    // Precaching also loads the shader source files, so that their include processing is included in the time
+    HiresTimer timer;
+    GetSubsystem<Graphics>()->PrecacheShaders(file);
+    PrintLine(Format("Shader precache: %.3f ms", timer.GetUSec(false) / 1000.0f));
+}
+
+void RenderBenchmark::CreateRenderScene()
+{
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+
+    scene_ = new Scene(context_);
+    scene_->CreateComponent<Octree>();
+    scene_->SetLinearTransformUpdate(linearTransformUpdate_);
+
+    Node* zoneNode = scene_->CreateChild("Zone");
+    Zone* zone = zoneNode->CreateComponent<Zone>();
+    zone->SetBoundingBox(BoundingBox(-1000.0f, 1000.0f));
+    zone->SetAmbientColor(Color(0.15f, 0.15f, 0.15f));
+    zone->SetFogColor(Color(0.5f, 0.5f, 0.7f));
+    zone->SetFogStart(100.0f);
+    zone->SetFogEnd(300.0f);
+
+    Node* lightNode = scene_->CreateChild("DirectionalLight");
+    lightNode->SetDirection(Vector3(0.6f, -1.0f, 0.8f));
+    Light* light = lightNode->CreateComponent<Light>();
+    light->SetLightType(LIGHT_DIRECTIONAL);
+    light->SetCastShadows(true);
+    light->SetShadowBias(BiasParameters(0.00025f, 0.5f));
+    light->SetShadowCascade(CascadeParameters(10.0f, 50.0f, 200.0f, 0.0f, 0.8f));
+
+    // Place the objects on a square grid
+    unsigned gridSize = (unsigned)ceilf(sqrtf((float)numObjects_));
+    float spacing = 3.0f;
+    float halfExtent = gridSize * spacing * 0.5f;
+
+    Node* floorNode = scene_->CreateChild("Floor");
+    floorNode->SetScale(Vector3(halfExtent * 2.0f + 10.0f, 1.0f, halfExtent * 2.0f + 10.0f));
+    StaticModel* floor = floorNode->CreateComponent<StaticModel>();
+    floor->SetModel(cache->GetResource<Model>("Models/Plane.mdl"));
+    floor->SetMaterial(cache->GetResource<Material>("Materials/StoneTiled.xml"));
+
+    Model* boxModel = cache->GetResource<Model>("Models/Box.mdl");
+    Material* boxMaterial = cache->GetResource<Material>("Materials/Stone.xml");
+    Model* mushroomModel = cache->GetResource<Model>("Models/Mushroom.mdl");
+    Material* mushroomMaterial = cache->GetResource<Material>("Materials/Mushroom.xml");
+
+    for (unsigned i = 0; i < numObjects_; ++i)
+    {
+        Node* objectNode = scene_->CreateChild("Object");
+        objectNode->SetPosition(Vector3((i % gridSize) * spacing - halfExtent, 0.5f, (i / gridSize) * spacing - halfExtent));
+        objectNode->SetRotation(Quaternion(0.0f, Random(360.0f), 0.0f));
+        StaticModel* object = objectNode->CreateComponent<StaticModel>();
+        // Mix two models so that the batches are not all instanced together
+        if (i & 1)
+        {
+            object->SetModel(mushroomModel);
+            object->SetMaterial(mushroomMaterial);
+        }
+        else
+        {
+            object->SetModel(boxModel);
+            object->SetMaterial(boxMaterial);
+            object->SetOccluder(shadowOcclusion_);
+        }
+        object->SetCastShadows(true);
+
+        if (i < numMovingObjects_)
+        {
+            movingNodes_.Push(objectNode);
+            movingBasePositions_.Push(objectNode->GetPosition());
+        }
+    }
+
+    for (unsigned i = 0; i < numLights_; ++i)
+    {
+        Node* pointLightNode = scene_->CreateChild("PointLight");
+        pointLightNode->SetPosition(Vector3(Random(halfExtent * 2.0f) - halfExtent, 3.0f, Random(halfExtent * 2.0f) - halfExtent));
+        Light* pointLight = pointLightNode->CreateComponent<Light>();
+        pointLight->SetLightType(LIGHT_POINT);
+        pointLight->SetRange(20.0f);
+        pointLight->SetColor(Color(0.5f + Random(0.5f), 0.5f + Random(0.5f), 0.5f + Random(0.5f)));
+    }
+
+    for (unsigned i = 0; i < numSpotLights_; ++i)
+    {
+        Node* spotLightNode = scene_->CreateChild("SpotLight");
+        spotLightNode->SetPosition(Vector3(Random(halfExtent * 2.0f) - halfExtent, 8.0f, Random(halfExtent * 2.0f) - halfExtent));
+        spotLightNode->SetDirection(Vector3(Random(1.0f) - 0.5f, -1.0f, Random(1.0f) - 0.5f));
+        Light* spotLight = spotLightNode->CreateComponent<Light>();
+        spotLight->SetLightType(LIGHT_SPOT);
+        spotLight->SetRange(25.0f);
+        spotLight->SetFov(60.0f);
+        spotLight->SetCastShadows(true);
+        spotLight->SetShadowResolution(0.5f);
+        spotLight->SetColor(Color(0.5f + Random(0.5f), 0.5f + Random(0.5f), 0.5f + Random(0.5f)));
+    }
+
+    if (numParticles_)
+    {
+        // Emit fast enough to keep every emitter at its particle limit, and update the emitters also when not in view so that
+        // the simulated particle count stays constant regardless of the camera
+        static const unsigned PARTICLES_PER_EMITTER = 1000;
+        SharedPtr<ParticleEffect> effect = cache->GetResource<ParticleEffect>("Particle/SmokeStack.xml")->Clone();
+        effect->SetNumParticles(PARTICLES_PER_EMITTER);
+        effect->SetMinEmissionRate(PARTICLES_PER_EMITTER / effect->GetMinTimeToLive());
+        effect->SetMaxEmissionRate(PARTICLES_PER_EMITTER / effect->GetMinTimeToLive());
+        effect->SetUpdateInvisible(true);
+
+        unsigned numEmitters = (numParticles_ + PARTICLES_PER_EMITTER - 1) / PARTICLES_PER_EMITTER;
+        for (unsigned i = 0; i < numEmitters; ++i)
+        {
+            Node* emitterNode = scene_->CreateChild("ParticleEmitter");
+            emitterNode->SetPosition(Vector3(Random(halfExtent * 2.0f) - halfExtent, 1.0f, Random(halfExtent * 2.0f) - halfExtent));
+            ParticleEmitter* emitter = emitterNode->CreateComponent<ParticleEmitter>();
+            emitter->SetEffect(effect);
+        }
+    }
+
+    if (numInstances_)
+    {
+        // Place small boxes densely on a square grid like the HugeObjectCount sample, and add them to static model groups
+        unsigned instanceGridSize = (unsigned)ceilf(sqrtf((float)numInstances_));
+        float instanceSpacing = 0.3f;
+        float instanceHalfExtent = instanceGridSize * instanceSpacing * 0.5f;
+        StaticModelGroup* group = 0;
+
+        for (unsigned i = 0; i < numInstances_; ++i)
+        {
+            if (!group || (instanceGroupSize_ && group->GetNumInstanceNodes() >= instanceGroupSize_))
+            {
+                Node* groupNode = scene_->CreateChild("BoxGroup");
+                group = groupNode->CreateComponent<StaticModelGroup>();
+                group->SetModel(boxModel);
+                group->SetMaterial(boxMaterial);
+                group->SetCastShadows(true);
+                group->SetInstanceCulling(instanceCulling_);
+            }
+
+            Node* boxNode = scene_->CreateChild("Box");
+            boxNode->SetPosition(Vector3((i % instanceGridSize) * instanceSpacing - instanceHalfExtent, 0.125f,
+                (i / instanceGridSize) * instanceSpacing - instanceHalfExtent));
+            boxNode->SetScale(0.25f);
+            group->AddInstanceNode(boxNode);
+
+            if (i < numMovingObjects_)
+            {
+                movingNodes_.Push(boxNode);
+                movingBasePositions_.Push(boxNode->GetPosition());
+            }
+        }
+    }
+
+    cameraNode_ = scene_->CreateChild("Camera");
+    Camera* camera = cameraNode_->CreateComponent<Camera>();
+    camera->SetFarClip(300.0f);
+
+    Viewport* viewport = new Viewport(context_, scene_, camera);
+    if (clusteredLighting_)
+        viewport->SetRenderPath(cache->GetResource<XMLFile>("RenderPaths/ForwardClustered.xml"));
+    GetSubsystem<Renderer>()->SetViewport(0, viewport);
+}
+
+void RenderBenchmark::HandleBeginFrame(StringHash eventType, VariantMap& eventData)
+{
+    // The profiler has already ended the previous frame, so the interval begins cleanly here
+    if (frameNumber_ == numWarmupFrames_)
+    {
+        Profiler* profiler = GetSubsystem<Profiler>();
+        if (profiler)
+            profiler->BeginInterval();
+    }
+    else if (frameNumber_ == numWarmupFrames_ + numFrames_)
+    {
+        PrintResults();
+        engine_->Exit();
+        return;
+    }
+
+    frameTimer_.Reset();
+}
+
+void RenderBenchmark::HandleUpdate(StringHash eventType, VariantMap& eventData)
+{
+    // Orbit the camera by a fixed amount per frame, so that the views are the same on every run regardless of the frame rate
+    float angle = frameNumber_ * 0.5f;
+    float cameraAngle = staticCamera_ ? 0.0f : angle;
+    cameraNode_->SetPosition(Vector3(Cos(cameraAngle) * 60.0f, 25.0f, Sin(cameraAngle) * 60.0f));
+    cameraNode_->LookAt(Vector3::ZERO);
+
+    // Move the objects on small circles of different phase
+    for (unsigned i = 0; i < movingNodes_.Size(); ++i)
+    {
+        float objectAngle = angle * 4.0f + i * 37.0f;
+        movingNodes_[i]->SetPosition(movingBasePositions_[i] + Vector3(Cos(objectAngle) * 5.0f, 0.0f, Sin(objectAngle) * 5.0f));
+    }
+}
+
+void RenderBenchmark::HandleEndFrame(StringHash eventType, VariantMap& eventData)
+{
+    long long frameTime = frameTimer_.GetUSec(false);
+
+    if (frameNumber_ >= numWarmupFrames_)
+    {
+        Graphics* graphics = GetSubsystem<Graphics>();
+
+        totalFrameTime_ += frameTime;
+        minFrameTime_ = Min(minFrameTime_, frameTime);
+        maxFrameTime_ = Max(maxFrameTime_, frameTime);
+        totalBatches_ += graphics->GetNumBatches();
+        totalPrimitives_ += graphics->GetNumPrimitives();
+        Octree* octree = scene_->GetComponent<Octree>();
+        totalUpdatedDrawables_ += octree->GetNumUpdatedDrawables();
+        totalReinsertedDrawables_ += octree->GetNumReinsertedDrawables();
+        View* view = GetSubsystem<Renderer>()->GetViewport(0)->GetView();
+        if (view)
+        {
+            const OctreeQueryCache& cache = view->GetVisibilityCache();
+            totalCacheHits_ += cache.GetNumHits();
+            totalCacheMisses_ += cache.GetNumMisses();
+            totalOccludedShadowCasters_ += view->GetNumOccludedShadowCasters();
+            totalClusteredLights_ += view->GetClusteredLights().Size();
+            totalReusedShadowMaps_ += view->GetNumReusedShadowMaps();
+        }
+#ifdef URHO3D_NULL_GRAPHICS
+        GraphicsImpl* impl = graphics->GetImpl();
+        totalStateChanges_ += impl->GetNumStateChanges() + impl->GetNumShaderChanges() + impl->GetNumTextureChanges();
+        totalParameterUpdates_ += impl->GetNumParameterUpdates();
+        totalUploadBytes_ += impl->GetUploadBytes();
+#endif
+    }
+
+    ++frameNumber_;
+}
+
+void RenderBenchmark::PrintResults()
+{
+    Renderer* renderer = GetSubsystem<Renderer>();
+
+    PrintLine(Format("Frame time: average %.3f ms, min %.3f ms, max %.3f ms", totalFrameTime_ / 1000.0f / numFrames_,
+        minFrameTime_ / 1000.0f, maxFrameTime_ / 1000.0f));
+    PrintLine(Format("Per frame: %.1f batches, %.1f primitives, %u geometries, %u lights, %u shadowmaps",
+        (float)totalBatches_ / numFrames_, (float)totalPrimitives_ / numFrames_, renderer->GetNumGeometries(true),
+        renderer->GetNumLights(true), renderer->GetNumShadowMaps(true)));
+    PrintLine(Format("Per frame: %.1f drawables updated, %.1f reinserted in the octree", (float)totalUpdatedDrawables_ / numFrames_,
+        (float)totalReinsertedDrawables_ / numFrames_));
+    if (renderer->GetVisibilityCaching())
+    {
+        PrintLine(Format("Per frame: %.1f octants culled from the visibility cache, %.1f culled again", (float)totalCacheHits_ / numFrames_,
+            (float)totalCacheMisses_ / numFrames_));
+    }
+    if (renderer->GetShadowCasterOcclusion())
+        PrintLine(Format("Per frame: %.1f shadow casters occlusion culled", (float)totalOccludedShadowCasters_ / numFrames_));
+    if (clusteredLighting_)
+        PrintLine(Format("Per frame: %.1f lights assigned to light clusters", (float)totalClusteredLights_ / numFrames_));
+    if (shadowMapCaching_)
+        PrintLine(Format("Per frame: %.1f cached shadow maps reused", (float)totalReusedShadowMaps_ / numFrames_));
+#ifdef URHO3D_NULL_GRAPHICS
+    PrintLine(Format("Per frame: %.1f state changes, %.1f shader parameter updates, %.1f KB uploaded",
+        (float)totalStateChanges_ / numFrames_, (float)totalParameterUpdates_ / numFrames_, totalUploadBytes_ / 1024.0f / numFrames_));
+#endif
+
+    // Print the per-stage timings collected by the profiler over the measured frames
+    Profiler* profiler = GetSubsystem<Profiler>();
+    if (profiler)
+    {
+        PrintLine("\nProfiler blocks: count, average ms, max ms, ms per frame, total ms");
+        PrintLine(profiler->PrintData());
+    }
+}
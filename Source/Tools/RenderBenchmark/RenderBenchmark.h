@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#pragma once
+
+#include <Urho3D/Core/Timer.h>
+#include <Urho3D/Engine/Application.h>
+
+namespace Urho3D
+{
+
+class Node;
+class Scene;
+
+}
+
+using namespace Urho3D;
+
+/// RenderBenchmark application builds synthetic scenes and reports CPU timings of scene loading and of the rendering pipeline stages. Most useful with the Null graphics backend, where the measured cost excludes the GPU driver.
+class RenderBenchmark : public Application
+{
+    URHO3D_OBJECT(RenderBenchmark, Application);
+
+public:
+    /// Construct.
+    RenderBenchmark(Context* context);
+
+    /// Setup before engine initialization. Parse the benchmark options.
+    virtual void Setup();
+    /// Setup after engine initialization. Run the scene load benchmark and create the rendering benchmark scene.
+    virtual void Start();
+
+private:
+    /// Time loading a scene of many nodes from binary data.
+    void RunLoadBenchmark();
+    /// Time updating the world transforms of many moving nodes lazily and with the linear transform update.
+    void RunTransformBenchmark();
+    /// Time software occlusion rendering and visibility testing without and with threading.
+    void RunOcclusionBenchmark();
+    /// Time batch sorting with comparison sort and radix sort.
+    void RunSortBenchmark();
+    /// Time precaching the shader combinations listed in an XML file.
+    void RunPrecacheBenchmark();
+    /// Create the rendering benchmark scene and viewport.
+    void CreateRenderScene();
+    /// Handle frame begin event.
+    void HandleBeginFrame(StringHash eventType, VariantMap& eventData);
+    /// Handle scene update event. Moves the camera.
+    void HandleUpdate(StringHash eventType, VariantMap& eventData);
+    /// Handle frame end event. Accumulate the frame statistics and print the results after the last frame.
+    void HandleEndFrame(StringHash eventType, VariantMap& eventData);
+    /// Print the rendering benchmark results.
+    void PrintResults();
+
+    /// Rendering benchmark scene.
+    SharedPtr<Scene> scene_;
+    /// Camera node.
+    SharedPtr<Node> cameraNode_;
+    /// Frame timer.
+    HiresTimer frameTimer_;
+    /// Number of frames to measure.
+    unsigned numFrames_;
+    /// Number of frames to run before measuring.
+    unsigned numWarmupFrames_;
+    /// Number of objects in the rendering benchmark scene.
+    unsigned numObjects_;
+    /// Number of point lights in the rendering benchmark scene.
+    unsigned numLights_;
+    /// Number of shadowed spot lights in the rendering benchmark scene.
+    unsigned numSpotLights_;
+    /// Number of nodes in the scene load benchmark.
+    unsigned numLoadNodes_;
+    /// Number of nodes in the transform update benchmark.
+    unsigned numTransformNodes_;
+    /// Number of occluder triangles in the occlusion benchmark.
+    unsigned numOcclusionTriangles_;
+    /// Number of batches in the batch sorting benchmark.
+    unsigned numSortBatches_;
+    /// Shader combination XML file for the precache benchmark.
+    String precacheFileName_;
+    /// Number of worker threads to create, or M_MAX_UNSIGNED to let the engine decide.
+    unsigned numThreads_;
+    /// Number of objects moving every frame.
+    unsigned numMovingObjects_;
+    /// Number of particles in the rendering benchmark scene.
+    unsigned numParticles_;
+    /// Number of static model group instances in the rendering benchmark scene.
+    unsigned numInstances_;
+    /// Number of instances per static model group, or 0 for a single group.
+    unsigned instanceGroupSize_;
+    /// Whether the camera stays still.
+    bool staticCamera_;
+    /// Whether visibility caching is enabled.
+    bool visibilityCaching_;
+    /// Whether the boxes are occluders and shadow caster occlusion is enabled.
+    bool shadowOcclusion_;
+    /// Whether base pass batch caching is enabled.
+    bool batchCaching_;
+    /// Whether the point lights use clustered lighting.
+    bool clusteredLighting_;
+    /// Whether shadow map caching is enabled.
+    bool shadowMapCaching_;
+    /// Whether static model group instance culling is enabled.
+    bool instanceCulling_;
+    /// Whether the rendering benchmark scene uses the linear transform update.
+    bool linearTransformUpdate_;
+    /// Moving object nodes.
+    PODVector<Node*> movingNodes_;
+    /// Initial positions of the moving objects.
+    PODVector<Vector3> movingBasePositions_;
+    /// Frames run so far.
+    unsigned frameNumber_;
+    /// Accumulated frame time in microseconds.
+    long long totalFrameTime_;
+    /// Shortest frame time in microseconds.
+    long long minFrameTime_;
+    /// Longest frame time in microseconds.
+    long long maxFrameTime_;
+    /// Accumulated draw calls.
+    unsigned long long totalBatches_;
+    /// Accumulated primitives.
+    unsigned long long totalPrimitives_;
+    /// Accumulated graphics state changes. Only counted with the Null graphics backend.
+    unsigned long long totalStateChanges_;
+    /// Accumulated shader parameter updates. Only counted with the Null graphics backend.
+    unsigned long long totalParameterUpdates_;
+    /// Accumulated buffer and texture upload bytes. Only counted with the Null graphics backend.
+    unsigned long long totalUploadBytes_;
+    /// Accumulated number of drawables updated in the octree.
+    unsigned long long totalUpdatedDrawables_;
+    /// Accumulated number of drawables reinserted in the octree.
+    unsigned long long totalReinsertedDrawables_;
+    /// Accumulated octants culled from the visibility cache.
+    unsigned long long totalCacheHits_;
+    /// Accumulated octants culled again despite visibility caching.
+    unsigned long long totalCacheMisses_;
+    /// Accumulated shadow casters culled by shadow camera occlusion.
+    unsigned long long totalOccludedShadowCasters_;
+    /// Accumulated lights assigned to light clusters.
+    unsigned long long totalClusteredLights_;
+    /// Accumulated lights that reused a cached shadow map.
+    unsigned long long totalReusedShadowMaps_;
+};
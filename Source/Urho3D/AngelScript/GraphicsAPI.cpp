@@ -33,6 +33,7 @@
 #include "../Graphics/DecalSet.h"
 #include "../Graphics/Geometry.h"
 #include "../Graphics/Graphics.h"
+#include "../Graphics/ImpostorSet.h"
 #include "../Graphics/IndexBuffer.h"
 #include "../Graphics/Light.h"
 #include "../Graphics/Material.h"
@@ -408,6 +409,7 @@ static void RegisterRenderPath(asIScriptEngine* engine)
     engine->RegisterObjectProperty("RenderPathCommand", "bool useFogColor", offsetof(RenderPathCommand, useFogColor_));
     engine->RegisterObjectProperty("RenderPathCommand", "bool markToStencil", offsetof(RenderPathCommand, markToStencil_));
     engine->RegisterObjectProperty("RenderPathCommand", "bool vertexLights", offsetof(RenderPathCommand, vertexLights_));
+    engine->RegisterObjectProperty("RenderPathCommand", "bool clustered", offsetof(RenderPathCommand, clustered_));
     engine->RegisterObjectProperty("RenderPathCommand", "bool useLitBase", offsetof(RenderPathCommand, useLitBase_));
     engine->RegisterObjectProperty("RenderPathCommand", "String vertexShaderName", offsetof(RenderPathCommand, vertexShaderName_));
     engine->RegisterObjectProperty("RenderPathCommand", "String pixelShaderName", offsetof(RenderPathCommand, pixelShaderName_));
@@ -901,6 +903,8 @@ static void RegisterMaterial(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Pass", "bool get_depthWrite() const", asMETHOD(Pass, GetDepthWrite), asCALL_THISCALL);
     engine->RegisterObjectMethod("Pass", "void set_alphaToCoverage(bool)", asMETHOD(Pass, SetAlphaToCoverage), asCALL_THISCALL);
     engine->RegisterObjectMethod("Pass", "bool get_alphaToCoverage() const", asMETHOD(Pass, GetAlphaToCoverage), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Pass", "void set_clusteredSupport(bool)", asMETHOD(Pass, SetClusteredSupport), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Pass", "bool get_clusteredSupport() const", asMETHOD(Pass, GetClusteredSupport), asCALL_THISCALL);
     engine->RegisterObjectMethod("Pass", "void set_desktop(bool)", asMETHOD(Technique, SetIsDesktop), asCALL_THISCALL);
     engine->RegisterObjectMethod("Pass", "bool get_desktop() const", asMETHOD(Technique, IsDesktop), asCALL_THISCALL);
     engine->RegisterObjectMethod("Pass", "void set_vertexShader(const String&in)", asMETHOD(Pass, SetVertexShader), asCALL_THISCALL);
@@ -1016,6 +1020,8 @@ static void RegisterModel(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Model", "bool set_geometryCenters(uint, const Vector3&in)", asMETHOD(Model, SetGeometryCenter), asCALL_THISCALL);
     engine->RegisterObjectMethod("Model", "const Vector3& get_geometryCenters(uint) const", asMETHOD(Model, GetGeometryCenter), asCALL_THISCALL);
     engine->RegisterObjectMethod("Model", "uint get_numMorphs() const", asMETHOD(Model, GetNumMorphs), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Model", "bool OptimizeGeometry(bool weldVertices = true)", asMETHOD(Model, OptimizeGeometry), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Model", "float get_vertexCacheMissRatio() const", asMETHOD(Model, GetVertexCacheMissRatio), asCALL_THISCALL);
 }
 
 static void ConstructAnimationKeyFrame(AnimationKeyFrame* ptr)
@@ -1317,6 +1323,8 @@ static void RegisterStaticModelGroup(asIScriptEngine* engine)
     engine->RegisterObjectMethod("StaticModelGroup", "void AddInstanceNode(Node@+)", asMETHOD(StaticModelGroup, AddInstanceNode), asCALL_THISCALL);
     engine->RegisterObjectMethod("StaticModelGroup", "void RemoveInstanceNode(Node@+)", asMETHOD(StaticModelGroup, RemoveInstanceNode), asCALL_THISCALL);
     engine->RegisterObjectMethod("StaticModelGroup", "void RemoveAllInstanceNodes()", asMETHOD(StaticModelGroup, RemoveAllInstanceNodes), asCALL_THISCALL);
+    engine->RegisterObjectMethod("StaticModelGroup", "void set_instanceCulling(bool)", asMETHOD(StaticModelGroup, SetInstanceCulling), asCALL_THISCALL);
+    engine->RegisterObjectMethod("StaticModelGroup", "bool get_instanceCulling() const", asMETHOD(StaticModelGroup, GetInstanceCulling), asCALL_THISCALL);
     engine->RegisterObjectMethod("StaticModelGroup", "uint get_numInstanceNodes() const", asMETHOD(StaticModelGroup, GetNumInstanceNodes), asCALL_THISCALL);
     engine->RegisterObjectMethod("StaticModelGroup", "Node@+ get_instanceNodes(uint) const", asMETHOD(StaticModelGroup, GetInstanceNode), asCALL_THISCALL);
 }
@@ -1650,6 +1658,33 @@ static void RegisterParticleEmitter(asIScriptEngine* engine)
     engine->RegisterObjectMethod("ParticleEmitter", "void ApplyEffect()", asMETHOD(ParticleEmitter, ApplyEffect), asCALL_THISCALL);
 }
 
+static void RegisterImpostorSet(asIScriptEngine* engine)
+{
+    RegisterDrawable<ImpostorSet>(engine, "ImpostorSet");
+    // Copy from BillboardSet
+    engine->RegisterObjectMethod("ImpostorSet", "void set_material(Material@+)", asMETHOD(ImpostorSet, SetMaterial), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "Material@+ get_material() const", asMETHOD(ImpostorSet, GetMaterial), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "uint get_numBillboards() const", asMETHOD(ImpostorSet, GetNumBillboards), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "Billboard@+ get_billboards(uint)", asMETHOD(ImpostorSet, GetBillboard), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "Zone@+ get_zone() const", asMETHOD(ImpostorSet, GetZone), asCALL_THISCALL);
+
+    engine->RegisterObjectMethod("ImpostorSet", "void set_model(Model@+)", asMETHOD(ImpostorSet, SetModel), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "Model@+ get_model() const", asMETHOD(ImpostorSet, GetModel), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "void set_impostorDistance(float)", asMETHOD(ImpostorSet, SetImpostorDistance), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "float get_impostorDistance() const", asMETHOD(ImpostorSet, GetImpostorDistance), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "void set_numAngles(uint)", asMETHOD(ImpostorSet, SetNumAngles), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "uint get_numAngles() const", asMETHOD(ImpostorSet, GetNumAngles), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "void AddInstanceNode(Node@+)", asMETHOD(ImpostorSet, AddInstanceNode), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "void RemoveInstanceNode(Node@+)", asMETHOD(ImpostorSet, RemoveInstanceNode), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "void RemoveAllInstanceNodes()", asMETHOD(ImpostorSet, RemoveAllInstanceNodes), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "uint get_numInstanceNodes() const", asMETHOD(ImpostorSet, GetNumInstanceNodes), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "Node@+ get_instanceNodes(uint) const", asMETHOD(ImpostorSet, GetInstanceNode), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "bool Bake(int cellSize = 128)", asMETHOD(ImpostorSet, Bake), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "bool SaveImpostorTexture(const String&in) const", asMETHOD(ImpostorSet, SaveImpostorTexture), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "Texture2D@+ get_impostorTexture() const", asMETHOD(ImpostorSet, GetImpostorTexture), asCALL_THISCALL);
+    engine->RegisterObjectMethod("ImpostorSet", "int get_bakeCellSize() const", asMETHOD(ImpostorSet, GetBakeCellSize), asCALL_THISCALL);
+}
+
 static void RegisterRibbonTrail(asIScriptEngine* engine)
 {
     engine->RegisterEnum("TrailType");
@@ -1894,6 +1929,16 @@ static void RendererSetVSMShadowParameters(const Vector2& parameters, Renderer*
     ptr->SetVSMShadowParameters(parameters.x_, parameters.y_);
 }
 
+static void RendererSetExtraInstancingBufferElements(CScriptArray* arr, Renderer* ptr)
+{
+    ptr->SetExtraInstancingBufferElements(ArrayToPODVector<VertexElement>(arr));
+}
+
+static CScriptArray* RendererGetExtraInstancingBufferElements(Renderer* ptr)
+{
+    return VectorToArray<VertexElement>(ptr->GetExtraInstancingBufferElements(), "Array<VertexElement>");
+}
+
 static void RegisterRenderer(asIScriptEngine* engine)
 {
     engine->RegisterGlobalProperty("const int QUALITY_LOW", (void*)&QUALITY_LOW);
@@ -1960,6 +2005,8 @@ static void RegisterRenderer(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Renderer", "int get_minInstances() const", asMETHOD(Renderer, GetMinInstances), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "void set_numExtraInstancingBufferElements(int)", asMETHOD(Renderer, SetNumExtraInstancingBufferElements), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "int get_numExtraInstancingBufferElements() const", asMETHOD(Renderer, GetNumExtraInstancingBufferElements), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "void set_extraInstancingBufferElements(Array<VertexElement>@+)", asFUNCTION(RendererSetExtraInstancingBufferElements), asCALL_CDECL_OBJLAST);
+    engine->RegisterObjectMethod("Renderer", "Array<VertexElement>@ get_extraInstancingBufferElements() const", asFUNCTION(RendererGetExtraInstancingBufferElements), asCALL_CDECL_OBJLAST);
     engine->RegisterObjectMethod("Renderer", "void set_maxSortedInstances(int)", asMETHOD(Renderer, SetMaxSortedInstances), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "int get_maxSortedInstances() const", asMETHOD(Renderer, GetMaxSortedInstances), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "void set_maxOccluderTriangles(int)", asMETHOD(Renderer, SetMaxOccluderTriangles), asCALL_THISCALL);
@@ -1970,6 +2017,17 @@ static void RegisterRenderer(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Renderer", "float get_occluderSizeThreshold() const", asMETHOD(Renderer, GetOccluderSizeThreshold), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "void set_threadedOcclusion(bool)", asMETHOD(Renderer, SetThreadedOcclusion), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "bool get_threadedOcclusion() const", asMETHOD(Renderer, GetThreadedOcclusion), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "void set_visibilityCaching(bool)", asMETHOD(Renderer, SetVisibilityCaching), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "bool get_visibilityCaching() const", asMETHOD(Renderer, GetVisibilityCaching), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "void set_shadowCasterOcclusion(bool)", asMETHOD(Renderer, SetShadowCasterOcclusion), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "bool get_shadowCasterOcclusion() const", asMETHOD(Renderer, GetShadowCasterOcclusion), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "void set_batchCaching(bool)", asMETHOD(Renderer, SetBatchCaching), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "bool get_batchCaching() const", asMETHOD(Renderer, GetBatchCaching), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "void set_shadowMapCaching(bool)", asMETHOD(Renderer, SetShadowMapCaching), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "bool get_shadowMapCaching() const", asMETHOD(Renderer, GetShadowMapCaching), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "void set_shadowAtlasSize(int)", asMETHOD(Renderer, SetShadowAtlasSize), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "int get_shadowAtlasSize() const", asMETHOD(Renderer, GetShadowAtlasSize), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Renderer", "void ResetCachedShadowMaps()", asMETHOD(Renderer, ResetCachedShadowMaps), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "void set_mobileShadowBiasMul(float)", asMETHOD(Renderer, SetMobileShadowBiasMul), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "float get_mobileShadowBiasMul() const", asMETHOD(Renderer, GetMobileShadowBiasMul), asCALL_THISCALL);
     engine->RegisterObjectMethod("Renderer", "void set_mobileShadowBiasAdd(float)", asMETHOD(Renderer, SetMobileShadowBiasAdd), asCALL_THISCALL);
@@ -2182,6 +2240,7 @@ void RegisterGraphicsAPI(asIScriptEngine* engine)
     RegisterBillboardSet(engine);
     RegisterParticleEffect(engine);
     RegisterParticleEmitter(engine);
+    RegisterImpostorSet(engine);
     RegisterRibbonTrail(engine);
     RegisterCustomGeometry(engine);
     RegisterDecalSet(engine);
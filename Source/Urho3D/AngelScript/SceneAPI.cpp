@@ -26,6 +26,8 @@
 #include "../Graphics/DebugRenderer.h"
 #include "../IO/PackageFile.h"
 #include "../Scene/ObjectAnimation.h"
+#include "../Scene/Prefab.h"
+#include "../Scene/SceneStreamer.h"
 #include "../Scene/Scene.h"
 #include "../Scene/SmoothedTransform.h"
 #include "../Scene/SplinePath.h"
@@ -248,6 +250,37 @@ static Node* SceneInstantiateJSONFile(JSONFile* json, const Vector3& position, c
     return json ? ptr->InstantiateJSON(json->GetRoot(), position, rotation, mode) : 0;
 }
 
+static CScriptArray* SceneInstantiateBatchPrefab(Prefab* prefab, CScriptArray* positions, CScriptArray* rotations, CreateMode mode, Scene* ptr)
+{
+    PODVector<Node*> nodes;
+    ptr->InstantiateBatch(prefab, ArrayToPODVector<Vector3>(positions), ArrayToPODVector<Quaternion>(rotations), nodes, mode);
+    return VectorToHandleArray<Node>(nodes, "Array<Node@>");
+}
+
+static CScriptArray* SceneInstantiateBatch(File* file, CScriptArray* positions, CScriptArray* rotations, CreateMode mode, Scene* ptr)
+{
+    PODVector<Node*> nodes;
+    if (file)
+        ptr->InstantiateBatch(*file, ArrayToPODVector<Vector3>(positions), ArrayToPODVector<Quaternion>(rotations), nodes, mode);
+    return VectorToHandleArray<Node>(nodes, "Array<Node@>");
+}
+
+static CScriptArray* SceneInstantiateBatchXMLFile(XMLFile* xml, CScriptArray* positions, CScriptArray* rotations, CreateMode mode, Scene* ptr)
+{
+    PODVector<Node*> nodes;
+    if (xml)
+        ptr->InstantiateBatchXML(xml->GetRoot(), ArrayToPODVector<Vector3>(positions), ArrayToPODVector<Quaternion>(rotations), nodes, mode);
+    return VectorToHandleArray<Node>(nodes, "Array<Node@>");
+}
+
+static CScriptArray* SceneInstantiateBatchJSONFile(JSONFile* json, CScriptArray* positions, CScriptArray* rotations, CreateMode mode, Scene* ptr)
+{
+    PODVector<Node*> nodes;
+    if (json)
+        ptr->InstantiateBatchJSON(json->GetRoot(), ArrayToPODVector<Vector3>(positions), ArrayToPODVector<Quaternion>(rotations), nodes, mode);
+    return VectorToHandleArray<Node>(nodes, "Array<Node@>");
+}
+
 static CScriptArray* SceneGetRequiredPackageFiles(Scene* ptr)
 {
     return VectorToHandleArray<PackageFile>(ptr->GetRequiredPackageFiles(), "Array<PackageFile@>");
@@ -284,6 +317,12 @@ static CScriptArray* GetObjectsByCategory(const String& category)
     return VectorToArray<String>(components, "Array<String>");
 }
 
+static void RegisterPrefab(asIScriptEngine* engine)
+{
+    RegisterResource<Prefab>(engine, "Prefab");
+    engine->RegisterObjectMethod("Prefab", "bool SetNode(Node@+)", asMETHOD(Prefab, SetNode), asCALL_THISCALL);
+}
+
 static void RegisterSmoothedTransform(asIScriptEngine* engine)
 {
     RegisterComponent<SmoothedTransform>(engine, "SmoothedTransform");
@@ -359,6 +398,12 @@ static void RegisterScene(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Scene", "Node@+ InstantiateJSON(JSONFile@+, const Vector3&in, const Quaternion&in, CreateMode mode = REPLICATED)", asFUNCTION(SceneInstantiateJSONFile), asCALL_CDECL_OBJLAST);
     engine->RegisterObjectMethod("Scene", "Node@+ InstantiateJSON(const JSONValue&in, const Vector3&in, const Quaternion&in, CreateMode mode = REPLICATED)", asMETHODPR(Scene, InstantiateJSON, (const JSONValue&, const Vector3&, const Quaternion&, CreateMode), Node*), asCALL_THISCALL);
 
+    engine->RegisterObjectMethod("Scene", "Node@+ Instantiate(Prefab@+, const Vector3&in, const Quaternion&in, CreateMode mode = REPLICATED)", asMETHODPR(Scene, Instantiate, (Prefab*, const Vector3&, const Quaternion&, CreateMode), Node*), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Scene", "Array<Node@>@ InstantiateBatch(Prefab@+, Array<Vector3>@+, Array<Quaternion>@+, CreateMode mode = REPLICATED)", asFUNCTION(SceneInstantiateBatchPrefab), asCALL_CDECL_OBJLAST);
+    engine->RegisterObjectMethod("Scene", "Array<Node@>@ InstantiateBatch(File@+, Array<Vector3>@+, Array<Quaternion>@+, CreateMode mode = REPLICATED)", asFUNCTION(SceneInstantiateBatch), asCALL_CDECL_OBJLAST);
+    engine->RegisterObjectMethod("Scene", "Array<Node@>@ InstantiateBatchXML(XMLFile@+, Array<Vector3>@+, Array<Quaternion>@+, CreateMode mode = REPLICATED)", asFUNCTION(SceneInstantiateBatchXMLFile), asCALL_CDECL_OBJLAST);
+    engine->RegisterObjectMethod("Scene", "Array<Node@>@ InstantiateBatchJSON(JSONFile@+, Array<Vector3>@+, Array<Quaternion>@+, CreateMode mode = REPLICATED)", asFUNCTION(SceneInstantiateBatchJSONFile), asCALL_CDECL_OBJLAST);
+
     engine->RegisterObjectMethod("Scene", "void Clear(bool clearReplicated = true, bool clearLocal = true)", asMETHOD(Scene, Clear), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "void AddRequiredPackageFile(PackageFile@+)", asMETHOD(Scene, AddRequiredPackageFile), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "void ClearRequiredPackageFiles()", asMETHOD(Scene, ClearRequiredPackageFiles), asCALL_THISCALL);
@@ -373,6 +418,7 @@ static void RegisterScene(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Scene", "Node@+ GetNode(uint) const", asMETHOD(Scene, GetNode), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "const String& GetVarName(StringHash) const", asMETHOD(Scene, GetVarName), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "void Update(float)", asMETHOD(Scene, Update), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Scene", "void UpdateTransforms()", asMETHOD(Scene, UpdateTransforms), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "void set_updateEnabled(bool)", asMETHOD(Scene, SetUpdateEnabled), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "bool get_updateEnabled() const", asMETHOD(Scene, IsUpdateEnabled), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "void set_timeScale(float)", asMETHOD(Scene, SetTimeScale), asCALL_THISCALL);
@@ -388,16 +434,51 @@ static void RegisterScene(asIScriptEngine* engine)
     engine->RegisterObjectMethod("Scene", "LoadMode get_asyncLoadMode() const", asMETHOD(Scene, GetAsyncLoadMode), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "void set_asyncLoadingMs(int)", asMETHOD(Scene, SetAsyncLoadingMs), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "int get_asyncLoadingMs() const", asMETHOD(Scene, GetAsyncLoadingMs), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Scene", "void set_linearTransformUpdate(bool)", asMETHOD(Scene, SetLinearTransformUpdate), asCALL_THISCALL);
+    engine->RegisterObjectMethod("Scene", "bool get_linearTransformUpdate() const", asMETHOD(Scene, GetLinearTransformUpdate), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "uint get_checksum() const", asMETHOD(Scene, GetChecksum), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "const String& get_fileName() const", asMETHOD(Scene, GetFileName), asCALL_THISCALL);
     engine->RegisterObjectMethod("Scene", "Array<PackageFile@>@ get_requiredPackageFiles() const", asFUNCTION(SceneGetRequiredPackageFiles), asCALL_CDECL_OBJLAST);
     engine->RegisterObjectMethod("Node", "Scene@+ get_scene() const", asMETHOD(Node, GetScene), asCALL_THISCALL);
     engine->RegisterGlobalFunction("Scene@+ get_scene()", asFUNCTION(GetScriptContextScene), asCALL_CDECL);
+    engine->RegisterObjectMethod("Prefab", "Node@+ Instantiate(Scene@+, const Vector3&in, const Quaternion&in, CreateMode mode = REPLICATED)", asMETHOD(Prefab, Instantiate), asCALL_THISCALL);
 
     engine->RegisterGlobalFunction("Array<String>@ GetObjectCategories()", asFUNCTION(GetObjectCategories), asCALL_CDECL);
     engine->RegisterGlobalFunction("Array<String>@ GetObjectsByCategory(const String&in)", asFUNCTION(GetObjectsByCategory), asCALL_CDECL);
 }
 
+static bool SceneStreamerSaveCells(CScriptArray* nodes, const String& filePrefix, SceneStreamer* ptr)
+{
+    return ptr->SaveCells(ArrayToPODVector<Node*>(nodes), filePrefix);
+}
+
+static void RegisterSceneStreamer(asIScriptEngine* engine)
+{
+    RegisterComponent<SceneStreamer>(engine, "SceneStreamer");
+    engine->RegisterObjectMethod("SceneStreamer", "void AddObserver(Node@+)", asMETHOD(SceneStreamer, AddObserver), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "void RemoveObserver(Node@+)", asMETHOD(SceneStreamer, RemoveObserver), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "void RemoveAllObservers()", asMETHOD(SceneStreamer, RemoveAllObservers), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "void UnloadAllCells()", asMETHOD(SceneStreamer, UnloadAllCells), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "bool SaveCells(Array<Node@>@+, const String&in)", asFUNCTION(SceneStreamerSaveCells), asCALL_CDECL_OBJLAST);
+    engine->RegisterObjectMethod("SceneStreamer", "bool IsCellLoaded(const IntVector2&in) const", asMETHOD(SceneStreamer, IsCellLoaded), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "Node@+ GetCellNode(const IntVector2&in) const", asMETHOD(SceneStreamer, GetCellNode), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "IntVector2 GetCellCoords(const Vector3&in) const", asMETHOD(SceneStreamer, GetCellCoords), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "String GetCellName(const IntVector2&in) const", asMETHOD(SceneStreamer, GetCellName), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "void set_cellPrefix(const String&in)", asMETHOD(SceneStreamer, SetCellPrefix), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "const String& get_cellPrefix() const", asMETHOD(SceneStreamer, GetCellPrefix), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "void set_cellSize(float)", asMETHOD(SceneStreamer, SetCellSize), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "float get_cellSize() const", asMETHOD(SceneStreamer, GetCellSize), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "void set_loadDistance(float)", asMETHOD(SceneStreamer, SetLoadDistance), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "float get_loadDistance() const", asMETHOD(SceneStreamer, GetLoadDistance), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "void set_unloadDistance(float)", asMETHOD(SceneStreamer, SetUnloadDistance), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "float get_unloadDistance() const", asMETHOD(SceneStreamer, GetUnloadDistance), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "void set_memoryBudget(uint)", asMETHOD(SceneStreamer, SetMemoryBudget), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "uint get_memoryBudget() const", asMETHOD(SceneStreamer, GetMemoryBudget), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "uint get_memoryUse() const", asMETHOD(SceneStreamer, GetMemoryUse), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "uint get_numObservers() const", asMETHOD(SceneStreamer, GetNumObservers), asCALL_THISCALL);
+    engine->RegisterObjectMethod("SceneStreamer", "uint get_numLoadedCells() const", asMETHOD(SceneStreamer, GetNumLoadedCells), asCALL_THISCALL);
+}
+
 void RegisterSceneAPI(asIScriptEngine* engine)
 {
     RegisterSerializable(engine);
@@ -405,8 +486,10 @@ void RegisterSceneAPI(asIScriptEngine* engine)
     RegisterObjectAnimation(engine);
     RegisterAnimatable(engine);
     RegisterNode(engine);
+    RegisterPrefab(engine);
     RegisterSmoothedTransform(engine);
     RegisterSplinePath(engine);
+    RegisterSceneStreamer(engine);
     RegisterScene(engine);
 }
 
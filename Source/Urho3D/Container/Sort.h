@@ -25,6 +25,8 @@
 #include "../Container/Swap.h"
 #include "../Container/VectorBase.h"
 
+#include <cstring>
+
 namespace Urho3D
 {
 
@@ -141,4 +143,48 @@ template <class T, class U> void Sort(RandomAccessIterator<T> begin, RandomAcces
     InsertionSort(begin, end, compare);
 }
 
+/// Return a 64-bit integer as its own radix sort key.
+inline unsigned long long GetRadixSortKey(unsigned long long key) { return key; }
+
+/// Sort in ascending order by bytes of the 64-bit keys returned by a key function, using a stable LSD radix sort from the first byte upward. Passes over bytes that are the same in all keys are skipped. The elements are moved back and forth between the array and the temporary array of the same size; return the one holding the result.
+template <class T, class U> T* RadixSort(T* items, T* temp, unsigned numItems, U getKey, unsigned firstByte, unsigned numBytes)
+{
+    if (!numItems)
+        return items;
+
+    unsigned counts[8][256];
+    memset(counts, 0, numBytes * sizeof counts[0]);
+    for (unsigned i = 0; i < numItems; ++i)
+    {
+        unsigned long long key = getKey(items[i]) >> (firstByte * 8);
+        for (unsigned j = 0; j < numBytes; ++j)
+            ++counts[j][(key >> (j * 8)) & 0xff];
+    }
+
+    T* src = items;
+    T* dest = temp;
+    for (unsigned j = 0; j < numBytes; ++j)
+    {
+        unsigned shift = (firstByte + j) * 8;
+        unsigned* count = counts[j];
+        if (count[(getKey(src[0]) >> shift) & 0xff] == numItems)
+            continue;
+
+        unsigned offset = 0;
+        for (unsigned k = 0; k < 256; ++k)
+        {
+            unsigned bucketSize = count[k];
+            count[k] = offset;
+            offset += bucketSize;
+        }
+
+        for (unsigned i = 0; i < numItems; ++i)
+            dest[count[(getKey(src[i]) >> shift) & 0xff]++] = src[i];
+
+        Swap(src, dest);
+    }
+
+    return src;
+}
+
 }
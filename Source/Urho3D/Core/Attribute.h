@@ -47,7 +47,10 @@ static const unsigned AM_COMPONENTID = 0x20;
 /// Attribute is a node ID vector where first element is the amount of nodes.
 static const unsigned AM_NODEIDVECTOR = 0x40;
 
+class Deserializer;
 class Serializable;
+class Serializer;
+struct AttributeInfo;
 
 /// Abstract base class for invoking attribute accessors.
 class URHO3D_API AttributeAccessor : public RefCounted
@@ -57,6 +60,10 @@ public:
     virtual void Get(const Serializable* ptr, Variant& dest) const = 0;
     /// Set the attribute.
     virtual void Set(Serializable* ptr, const Variant& src) = 0;
+    /// Read the attribute from binary data and set it. The default implementation goes through a Variant.
+    virtual void Read(Serializable* ptr, const AttributeInfo& attr, Deserializer& source);
+    /// Get the attribute and write it as binary data. Return true if successful. The default implementation goes through a Variant.
+    virtual bool Write(const Serializable* ptr, const AttributeInfo& attr, Serializer& dest) const;
 };
 
 /// Description of an automatically serializable variable.
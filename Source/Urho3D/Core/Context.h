@@ -99,6 +99,9 @@ public:
     /// Return all object factories.
     const HashMap<StringHash, SharedPtr<ObjectFactory> >& GetObjectFactories() const { return factories_; }
 
+    /// Return whether an object type overrides OnSetAttribute() or OnGetAttribute(), so that attributes must not be accessed bypassing them.
+    bool HasAttributeOverrides(StringHash type) const { return attributeOverrideTypes_.Contains(type); }
+
     /// Return all object categories.
     const HashMap<String, Vector<StringHash> >& GetObjectCategories() const { return objectCategories_; }
 
@@ -172,6 +175,8 @@ private:
 
     /// Set current event handler. Called by Object.
     void SetEventHandler(EventHandler* handler) { eventHandler_ = handler; }
+    /// Check whether an object type overrides OnSetAttribute() or OnGetAttribute() when attributes are registered for it.
+    template <class T> void CheckAttributeOverrides();
 
     /// Object factories.
     HashMap<StringHash, SharedPtr<ObjectFactory> > factories_;
@@ -181,6 +186,8 @@ private:
     HashMap<StringHash, Vector<AttributeInfo> > attributes_;
     /// Network replication attribute descriptions per object type.
     HashMap<StringHash, Vector<AttributeInfo> > networkAttributes_;
+    /// Object types which override OnSetAttribute() or OnGetAttribute().
+    HashSet<StringHash> attributeOverrideTypes_;
     /// Event receivers for non-specific events.
     HashMap<StringHash, HashSet<Object*> > eventReceivers_;
     /// Event receivers for specific senders' events.
@@ -197,6 +204,22 @@ private:
     VariantMap globalVars_;
 };
 
+/// Return true for an attribute set handler declared by a subclass of Serializable.
+template <class T> inline bool IsAttributeOverride(void (T::*)(const AttributeInfo&, const Variant&)) { return true; }
+/// Return false for the Serializable attribute set handler.
+inline bool IsAttributeOverride(void (Serializable::*)(const AttributeInfo&, const Variant&)) { return false; }
+/// Return true for an attribute get handler declared by a subclass of Serializable.
+template <class T> inline bool IsAttributeOverride(void (T::*)(const AttributeInfo&, Variant&) const) { return true; }
+/// Return false for the Serializable attribute get handler.
+inline bool IsAttributeOverride(void (Serializable::*)(const AttributeInfo&, Variant&) const) { return false; }
+
+template <class T> void Context::CheckAttributeOverrides()
+{
+    // Taking the address of an inherited member function gives a pointer to member of the class which declares it
+    if (IsAttributeOverride(&T::OnSetAttribute) || IsAttributeOverride(&T::OnGetAttribute))
+        attributeOverrideTypes_.Insert(T::GetTypeStatic());
+}
+
 template <class T> void Context::RegisterFactory() { RegisterFactory(new ObjectFactoryImpl<T>(this)); }
 
 template <class T> void Context::RegisterFactory(const char* category)
@@ -206,11 +229,19 @@ template <class T> void Context::RegisterFactory(const char* category)
 
 template <class T> void Context::RemoveSubsystem() { RemoveSubsystem(T::GetTypeStatic()); }
 
-template <class T> void Context::RegisterAttribute(const AttributeInfo& attr) { RegisterAttribute(T::GetTypeStatic(), attr); }
+template <class T> void Context::RegisterAttribute(const AttributeInfo& attr)
+{
+    RegisterAttribute(T::GetTypeStatic(), attr);
+    CheckAttributeOverrides<T>();
+}
 
 template <class T> void Context::RemoveAttribute(const char* name) { RemoveAttribute(T::GetTypeStatic(), name); }
 
-template <class T, class U> void Context::CopyBaseAttributes() { CopyBaseAttributes(T::GetTypeStatic(), U::GetTypeStatic()); }
+template <class T, class U> void Context::CopyBaseAttributes()
+{
+    CopyBaseAttributes(T::GetTypeStatic(), U::GetTypeStatic());
+    CheckAttributeOverrides<U>();
+}
 
 template <class T> T* Context::GetSubsystem() const { return static_cast<T*>(GetSubsystem(T::GetTypeStatic())); }
 
@@ -80,6 +80,21 @@ inline bool CompareBatchGroupOrder(BatchGroup* lhs, BatchGroup* rhs)
     return lhs->renderOrder_ < rhs->renderOrder_;
 }
 
+/// Return the radix sort key of a batch sort item.
+inline unsigned long long GetBatchSortItemKey(const BatchSortItem& item)
+{
+    return item.key_;
+}
+
+/// Sort items by the lowest key bytes.
+static void RadixSortItems(PODVector<BatchSortItem>& items, PODVector<BatchSortItem>& temp, unsigned keyBytes)
+{
+    temp.Resize(items.Size());
+    // Make sure the result ends up in the original vector
+    if (RadixSort(items.Buffer(), temp.Buffer(), items.Size(), GetBatchSortItemKey, 0, keyBytes) != items.Buffer())
+        items.Swap(temp);
+}
+
 void CalculateShadowMatrix(Matrix4& dest, LightBatchQueue* queue, unsigned split, Renderer* renderer)
 {
     Camera* shadowCamera = queue->shadowSplits_[split].shadowCamera_;
@@ -626,6 +641,17 @@ void Batch::Prepare(View* view, Camera* camera, bool setModelTransform, bool all
             graphics->SetTexture(TU_LIGHTSHAPE, shapeTexture);
         }
     }
+
+#ifdef DESKTOP_GRAPHICS
+    // Set the light cluster texture and the default light ramp for the clustered lights
+    if (clustered_)
+    {
+        if (graphics->HasTextureUnit(TU_CLUSTERBUFFER))
+            graphics->SetTexture(TU_CLUSTERBUFFER, view->GetClusterTexture());
+        if (graphics->HasTextureUnit(TU_LIGHTRAMP))
+            graphics->SetTexture(TU_LIGHTRAMP, renderer->GetDefaultLightRamp());
+    }
+#endif
 }
 
 void Batch::Draw(View* view, Camera* camera, bool allowDepthWrite) const
@@ -637,14 +663,45 @@ void Batch::Draw(View* view, Camera* camera, bool allowDepthWrite) const
     }
 }
 
-void BatchGroup::SetInstancingData(void* lockedData, unsigned stride, unsigned& freeIndex)
+bool BatchGroup::ReuseInstancingData(const KeptInstancingData& kept, unsigned stride)
+{
+    if (kept.data_.Size() != instances_.Size() * stride)
+        return false;
+
+    const unsigned char* data = kept.data_.Buffer();
+    for (unsigned i = 0; i < instances_.Size(); ++i)
+    {
+        const InstanceData& instance = instances_[i];
+
+        if (memcmp(data, instance.worldTransform_, sizeof(Matrix3x4)))
+            return false;
+        if (instance.instancingData_ && memcmp(data + sizeof(Matrix3x4), instance.instancingData_, stride - sizeof(Matrix3x4)))
+            return false;
+
+        data += stride;
+    }
+
+    startIndex_ = kept.startIndex_;
+    return true;
+}
+
+void BatchGroup::SetInstancingData(void* lockedData, unsigned lockStart, unsigned stride, unsigned& freeIndex, KeptInstancingData* kept)
 {
     // Do not use up buffer space if not going to draw as instanced
     if (geometryType_ != GEOM_INSTANCED)
         return;
 
-    startIndex_ = freeIndex;
-    unsigned char* buffer = static_cast<unsigned char*>(lockedData) + startIndex_ * stride;
+    startIndex_ = lockStart + freeIndex;
+    unsigned char* dest = static_cast<unsigned char*>(lockedData) + freeIndex * stride;
+
+    // When keeping the data, write it to the copy first and then to the buffer in one go
+    unsigned char* buffer = dest;
+    if (kept)
+    {
+        kept->data_.Resize(instances_.Size() * stride);
+        kept->startIndex_ = startIndex_;
+        buffer = kept->data_.Buffer();
+    }
 
     for (unsigned i = 0; i < instances_.Size(); ++i)
     {
@@ -657,6 +714,9 @@ void BatchGroup::SetInstancingData(void* lockedData, unsigned stride, unsigned&
         buffer += stride;
     }
 
+    if (kept)
+        memcpy(dest, kept->data_.Buffer(), kept->data_.Size());
+
     freeIndex += instances_.Size();
 }
 
@@ -718,6 +778,44 @@ void BatchQueue::Clear(int maxSortedInstances)
     sortedBatches_.Clear();
     batchGroups_.Clear();
     maxSortedInstances_ = (unsigned)maxSortedInstances;
+    ++groupVersion_;
+}
+
+void BatchQueue::ClearKeepGroups(int maxSortedInstances)
+{
+    batches_.Clear();
+    sortedBatches_.Clear();
+    maxSortedInstances_ = (unsigned)maxSortedInstances;
+
+    // Light queues are rebuilt each frame, so groups referring to them can not be kept
+    for (HashMap<BatchGroupKey, BatchGroup>::Iterator i = batchGroups_.Begin(); i != batchGroups_.End();)
+    {
+        if (i->second_.lightQueue_)
+        {
+            i = batchGroups_.Erase(i);
+            ++groupVersion_;
+        }
+        else
+        {
+            i->second_.instances_.Clear();
+            i->second_.startIndex_ = M_MAX_UNSIGNED;
+            ++i;
+        }
+    }
+}
+
+void BatchQueue::RemoveEmptyGroups()
+{
+    for (HashMap<BatchGroupKey, BatchGroup>::Iterator i = batchGroups_.Begin(); i != batchGroups_.End();)
+    {
+        if (i->second_.instances_.Empty())
+        {
+            i = batchGroups_.Erase(i);
+            ++groupVersion_;
+        }
+        else
+            ++i;
+    }
 }
 
 void BatchQueue::SortBackToFront()
@@ -727,7 +825,7 @@ void BatchQueue::SortBackToFront()
     for (unsigned i = 0; i < batches_.Size(); ++i)
         sortedBatches_[i] = &batches_[i];
 
-    Sort(sortedBatches_.Begin(), sortedBatches_.End(), CompareBatchesBackToFront);
+    SortBatches(sortedBatches_, BSO_BACKTOFRONT);
 
     sortedBatchGroups_.Resize(batchGroups_.Size());
     
@@ -779,10 +877,10 @@ void BatchQueue::SortFrontToBack2Pass(PODVector<Batch*>& batches)
     // Mobile devices likely use a tiled deferred approach, with which front-to-back sorting is irrelevant. The 2-pass
     // method is also time consuming, so just sort with state having priority
 #ifdef GL_ES_VERSION_2_0
-    Sort(batches.Begin(), batches.End(), CompareBatchesState);
+    SortBatches(batches, BSO_STATE);
 #else
     // For desktop, first sort by distance and remap shader/material/geometry IDs in the sort key
-    Sort(batches.Begin(), batches.End(), CompareBatchesFrontToBack);
+    SortBatches(batches, BSO_FRONTTOBACK);
 
     unsigned freeShaderID = 0;
     unsigned short freeMaterialID = 0;
@@ -802,7 +900,7 @@ void BatchQueue::SortFrontToBack2Pass(PODVector<Batch*>& batches)
             ++freeShaderID;
         }
 
-        unsigned short materialID = (unsigned short)(batch->sortKey_ & 0xffff0000);
+        unsigned short materialID = (unsigned short)((batch->sortKey_ & 0xffff0000) >> 16);
         HashMap<unsigned short, unsigned short>::ConstIterator k = materialRemapping_.Find(materialID);
         if (k != materialRemapping_.End())
             materialID = k->second_;
@@ -830,14 +928,138 @@ void BatchQueue::SortFrontToBack2Pass(PODVector<Batch*>& batches)
     geometryRemapping_.Clear();
 
     // Finally sort again with the rewritten ID's
-    Sort(batches.Begin(), batches.End(), CompareBatchesState);
+    SortBatches(batches, BSO_STATE);
 #endif
 }
 
-void BatchQueue::SetInstancingData(void* lockedData, unsigned stride, unsigned& freeIndex)
+void BatchQueue::SortBatches(PODVector<Batch*>& batches, BatchSortOrder order, bool allowRadixSort)
 {
+    unsigned numBatches = batches.Size();
+    if (!allowRadixSort || numBatches < MIN_RADIX_SORT_BATCHES)
+    {
+        switch (order)
+        {
+        case BSO_STATE:
+            Sort(batches.Begin(), batches.End(), CompareBatchesState);
+            break;
+
+        case BSO_FRONTTOBACK:
+            Sort(batches.Begin(), batches.End(), CompareBatchesFrontToBack);
+            break;
+
+        case BSO_BACKTOFRONT:
+            Sort(batches.Begin(), batches.End(), CompareBatchesBackToFront);
+            break;
+        }
+        return;
+    }
+
+    // The render order, sort key and distance do not fit in one 64-bit key. As the radix sort is stable, sort by the least
+    // significant key first, then by the more significant ones
+    sortItems_.Resize(numBatches);
+    for (unsigned i = 0; i < numBatches; ++i)
+    {
+        Batch* batch = batches[i];
+        BatchSortItem& item = sortItems_[i];
+        item.index_ = i;
+        item.key_ = order == BSO_STATE ? FloatToSortKey(batch->distance_) : batch->sortKey_;
+    }
+    RadixSortItems(sortItems_, tempSortItems_, order == BSO_STATE ? 4 : 8);
+
+    for (unsigned i = 0; i < numBatches; ++i)
+    {
+        BatchSortItem& item = sortItems_[i];
+        Batch* batch = batches[item.index_];
+        switch (order)
+        {
+        case BSO_STATE:
+            item.key_ = batch->sortKey_;
+            break;
+
+        case BSO_FRONTTOBACK:
+            item.key_ = ((unsigned long long)batch->renderOrder_ << 32) | FloatToSortKey(batch->distance_);
+            break;
+
+        case BSO_BACKTOFRONT:
+            item.key_ = ((unsigned long long)batch->renderOrder_ << 32) | ~FloatToSortKey(batch->distance_);
+            break;
+        }
+    }
+    RadixSortItems(sortItems_, tempSortItems_, order == BSO_STATE ? 8 : 5);
+
+    if (order == BSO_STATE)
+    {
+        for (unsigned i = 0; i < numBatches; ++i)
+            sortItems_[i].key_ = batches[sortItems_[i].index_]->renderOrder_;
+        RadixSortItems(sortItems_, tempSortItems_, 1);
+    }
+
+    tempSortBatches_ = batches;
+    for (unsigned i = 0; i < numBatches; ++i)
+        batches[i] = tempSortBatches_[sortItems_[i].index_];
+}
+
+unsigned BatchQueue::ReuseInstancingData(unsigned bufferGeneration, unsigned stride, bool keepData)
+{
+    unsigned numInstances = 0;
+
+    if (!keepData)
+        keptInstancingData_.Clear();
+
     for (HashMap<BatchGroupKey, BatchGroup>::Iterator i = batchGroups_.Begin(); i != batchGroups_.End(); ++i)
-        i->second_.SetInstancingData(lockedData, stride, freeIndex);
+    {
+        BatchGroup& group = i->second_;
+        group.startIndex_ = M_MAX_UNSIGNED;
+        if (group.geometryType_ != GEOM_INSTANCED)
+            continue;
+
+        if (keepData)
+        {
+            HashMap<BatchGroupKey, KeptInstancingData>::Iterator j = keptInstancingData_.Find(i->first_);
+            if (j != keptInstancingData_.End())
+            {
+                j->second_.used_ = true;
+                if (j->second_.generation_ == bufferGeneration && group.ReuseInstancingData(j->second_, stride))
+                    continue;
+            }
+        }
+
+        numInstances += group.instances_.Size();
+    }
+
+    // Forget the data of groups that no longer exist, or that has been lost from the buffer
+    for (HashMap<BatchGroupKey, KeptInstancingData>::Iterator i = keptInstancingData_.Begin(); i != keptInstancingData_.End();)
+    {
+        if (!i->second_.used_ || i->second_.generation_ != bufferGeneration)
+            i = keptInstancingData_.Erase(i);
+        else
+        {
+            i->second_.used_ = false;
+            ++i;
+        }
+    }
+
+    return numInstances;
+}
+
+void BatchQueue::SetInstancingData(void* lockedData, unsigned lockStart, unsigned stride, unsigned& freeIndex,
+    unsigned bufferGeneration, bool keepData)
+{
+    for (HashMap<BatchGroupKey, BatchGroup>::Iterator i = batchGroups_.Begin(); i != batchGroups_.End(); ++i)
+    {
+        BatchGroup& group = i->second_;
+        if (group.geometryType_ != GEOM_INSTANCED || group.startIndex_ != M_MAX_UNSIGNED)
+            continue;
+
+        if (keepData)
+        {
+            KeptInstancingData& kept = keptInstancingData_[i->first_];
+            group.SetInstancingData(lockedData, lockStart, stride, freeIndex, &kept);
+            kept.generation_ = bufferGeneration;
+        }
+        else
+            group.SetInstancingData(lockedData, lockStart, stride, freeIndex);
+    }
 }
 
 void BatchQueue::Draw(View* view, Camera* camera, bool markToStencil, bool usingLightOptimization, bool allowDepthWrite) const
@@ -52,6 +52,7 @@ struct Batch
     /// Construct with defaults.
     Batch() :
         isBase_(false),
+        clustered_(false),
         lightQueue_(0)
     {
     }
@@ -61,6 +62,7 @@ struct Batch
         distance_(rhs.distance_),
         renderOrder_(rhs.material_ ? rhs.material_->GetRenderOrder() : DEFAULT_RENDER_ORDER),
         isBase_(false),
+        clustered_(false),
         geometry_(rhs.geometry_),
         material_(rhs.material_),
         worldTransform_(rhs.worldTransform_),
@@ -88,6 +90,8 @@ struct Batch
     unsigned char lightMask_;
     /// Base batch flag. This tells to draw the object fully without light optimizations.
     bool isBase_;
+    /// Clustered lighting flag. This tells to add the lights of the view's light clusters in the base pass pixel shader.
+    bool clustered_;
     /// Geometry.
     Geometry* geometry_;
     /// Material.
@@ -136,6 +140,27 @@ struct InstanceData
     float distance_;
 };
 
+/// Instance data of a batch group kept in the instancing buffer between frames.
+struct KeptInstancingData
+{
+    /// Construct.
+    KeptInstancingData() :
+        startIndex_(M_MAX_UNSIGNED),
+        generation_(M_MAX_UNSIGNED),
+        used_(false)
+    {
+    }
+
+    /// Copy of the data written to the instancing buffer.
+    PODVector<unsigned char> data_;
+    /// Instance stream start index.
+    unsigned startIndex_;
+    /// Instancing buffer generation when written.
+    unsigned generation_;
+    /// Whether a batch group used the data on the current frame.
+    bool used_;
+};
+
 /// Instanced 3D geometry draw call.
 struct BatchGroup : public Batch
 {
@@ -157,8 +182,8 @@ struct BatchGroup : public Batch
     {
     }
 
-    /// Add world transform(s) from a batch.
-    void AddTransforms(const Batch& batch)
+    /// Add world transform(s) from a batch or a source batch.
+    template <class T> void AddTransforms(const T& batch)
     {
         InstanceData newInstance;
         newInstance.distance_ = batch.distance_;
@@ -171,8 +196,10 @@ struct BatchGroup : public Batch
         }
     }
 
-    /// Pre-set the instance data. Buffer must be big enough to hold all data.
-    void SetInstancingData(void* lockedData, unsigned stride, unsigned& freeIndex);
+    /// Reuse instance data written to the instancing buffer on an earlier frame if it equals the current instances. Return true if reused.
+    bool ReuseInstancingData(const KeptInstancingData& kept, unsigned stride);
+    /// Pre-set the instance data at the free index, which is counted from the start of the locked range. Buffer must be big enough to hold all data. Optionally keep a copy of the data for reuse on later frames.
+    void SetInstancingData(void* lockedData, unsigned lockStart, unsigned stride, unsigned& freeIndex, KeptInstancingData* kept = 0);
     /// Prepare and draw.
     void Draw(View* view, Camera* camera, bool allowDepthWrite) const;
 
@@ -232,20 +259,55 @@ struct BatchGroupKey
     unsigned ToHash() const;
 };
 
+/// Batch sorting order. Batches are always sorted by render order first.
+enum BatchSortOrder
+{
+    BSO_STATE = 0,
+    BSO_FRONTTOBACK,
+    BSO_BACKTOFRONT
+};
+
+/// Minimum number of batches to use radix sort for. Smaller amounts are faster to sort by comparison.
+static const unsigned MIN_RADIX_SORT_BATCHES = 1000;
+
+/// Batch sorting key and index for radix sort.
+struct BatchSortItem
+{
+    /// Sorting key.
+    unsigned long long key_;
+    /// Index of the batch.
+    unsigned index_;
+};
+
 /// Queue that contains both instanced and non-instanced draw calls.
 struct BatchQueue
 {
 public:
+    /// Construct.
+    BatchQueue() :
+        maxSortedInstances_(0),
+        groupVersion_(0)
+    {
+    }
+
     /// Clear for new frame by clearing all groups and batches.
     void Clear(int maxSortedInstances);
+    /// Clear for new frame, but keep the batch groups without a light queue, only clearing their instances.
+    void ClearKeepGroups(int maxSortedInstances);
+    /// Remove batch groups that received no instances.
+    void RemoveEmptyGroups();
     /// Sort non-instanced draw calls back to front.
     void SortBackToFront();
     /// Sort instanced and non-instanced draw calls front to back.
     void SortFrontToBack();
     /// Sort batches front to back while also maintaining state sorting.
     void SortFrontToBack2Pass(PODVector<Batch*>& batches);
-    /// Pre-set instance data of all groups. The vertex buffer must be big enough to hold all data.
-    void SetInstancingData(void* lockedData, unsigned stride, unsigned& freeIndex);
+    /// Sort batches by render order, then by the given order with state sorting key or distance breaking ties. Uses a stable radix sort when allowed and there are enough batches.
+    void SortBatches(PODVector<Batch*>& batches, BatchSortOrder order, bool allowRadixSort = true);
+    /// Reuse the instance data kept from earlier frames for the groups whose instances are unchanged. Return the number of instances that still need to be written.
+    unsigned ReuseInstancingData(unsigned bufferGeneration, unsigned stride, bool keepData);
+    /// Pre-set instance data of the groups that did not reuse their data. The locked range must be big enough to hold all data. Optionally keep a copy of the data for reuse on later frames.
+    void SetInstancingData(void* lockedData, unsigned lockStart, unsigned stride, unsigned& freeIndex, unsigned bufferGeneration, bool keepData);
     /// Draw.
     void Draw(View* view, Camera* camera, bool markToStencil, bool usingLightOptimization, bool allowDepthWrite) const;
     /// Return the combined amount of instances.
@@ -271,6 +333,16 @@ public:
     PODVector<BatchGroup*> sortedBatchGroups_;
     /// Maximum sorted instances.
     unsigned maxSortedInstances_;
+    /// Batch group version. Incremented whenever groups are removed, so that pointers to groups can be cached.
+    unsigned groupVersion_;
+    /// Instance data written on earlier frames by groups. Survives clearing the queue.
+    HashMap<BatchGroupKey, KeptInstancingData> keptInstancingData_;
+    /// Radix sort keys.
+    PODVector<BatchSortItem> sortItems_;
+    /// Radix sort temporary keys.
+    PODVector<BatchSortItem> tempSortItems_;
+    /// Radix sort temporary batch pointers.
+    PODVector<Batch*> tempSortBatches_;
 };
 
 /// Queue for shadow map draw calls
@@ -297,6 +369,12 @@ struct LightBatchQueue
     bool negative_;
     /// Shadow map depth texture.
     Texture2D* shadowMap_;
+    /// Region of the shadow map used by the light. Less than the whole texture when the shadow map is in the shadow atlas.
+    IntRect shadowMapRegion_;
+    /// Whether the shadow map was cached on an earlier frame and need not be rendered.
+    bool shadowMapCached_;
+    /// Whether rendering the shadow map fills the light's cached shadow map for later frames.
+    bool cacheShadowMap_;
     /// Lit geometry draw calls, base (replace blend mode)
     BatchQueue litBaseBatches_;
     /// Lit geometry draw calls, non-base (additive)
@@ -24,6 +24,7 @@
 
 #include "../Core/Context.h"
 #include "../Core/Profiler.h"
+#include "../Core/Thread.h"
 #include "../Graphics/Batch.h"
 #include "../Graphics/BillboardSet.h"
 #include "../Graphics/Camera.h"
@@ -57,10 +58,10 @@ const char* faceCameraModeNames[] =
     0
 };
 
-inline bool CompareBillboards(Billboard* lhs, Billboard* rhs)
-{
-    return lhs->sortDistance_ > rhs->sortDistance_;
-}
+/// Billboard count below which the insertion sort is always run to completion.
+static const unsigned MIN_RADIX_SORT_BILLBOARDS = 256;
+/// Average element moves per billboard allowed in the insertion sort before falling back to radix sort.
+static const unsigned MAX_SORT_MOVES_PER_BILLBOARD = 8;
 
 BillboardSet::BillboardSet(Context* context) :
     Drawable(context, DRAWABLE_GEOMETRY),
@@ -81,6 +82,7 @@ BillboardSet::BillboardSet(Context* context) :
     geometryTypeUpdate_(false),
     sortThisFrame_(false),
     hasOrthoCamera_(false),
+    vertexDataPending_(false),
     sortFrameNumber_(0),
     previousOffset_(Vector3::ZERO)
 {
@@ -228,16 +230,22 @@ void BillboardSet::UpdateGeometry(const FrameInfo& frame)
     if (bufferSizeDirty_ || indexBuffer_->IsDataLost())
         UpdateBufferSize();
 
-    if (bufferDirty_ || sortThisFrame_ || vertexBuffer_->IsDataLost())
-        UpdateVertexBuffer(frame);
+    // Vertex data generated by the worker thread update is only uploaded by the main thread update that follows it for the same view
+    if (!vertexDataPending_ && (bufferDirty_ || sortThisFrame_ || vertexBuffer_->IsDataLost()))
+        UpdateVertexData(frame);
+
+    if (vertexDataPending_ && Thread::IsMainThread())
+        UploadVertexData();
 }
 
 UpdateGeometryType BillboardSet::GetUpdateGeometryType()
 {
+    // Resizing the buffers and uploading the vertex data need the main thread, while generating the vertex data can be threaded.
     // If using camera facing, always need some kind of geometry update, in case the billboard set is rendered from several views
-    if (bufferDirty_ || bufferSizeDirty_ || vertexBuffer_->IsDataLost() || indexBuffer_->IsDataLost() || sortThisFrame_ ||
-        faceCameraMode_ != FC_NONE || fixedScreenSize_)
+    if (bufferSizeDirty_ || vertexBuffer_->IsDataLost() || indexBuffer_->IsDataLost() || vertexDataPending_)
         return UPDATE_MAIN_THREAD;
+    else if (bufferDirty_ || sortThisFrame_ || faceCameraMode_ != FC_NONE || fixedScreenSize_)
+        return UPDATE_WORKER_THREAD;
     else
         return UPDATE_NONE;
 }
@@ -542,7 +550,7 @@ void BillboardSet::UpdateBufferSize()
     indexBuffer_->ClearDataLost();
 }
 
-void BillboardSet::UpdateVertexBuffer(const FrameInfo& frame)
+void BillboardSet::UpdateVertexData(const FrameInfo& frame)
 {
     // If using animation LOD, accumulate time and see if it is time to update
     if (animationLodBias_ > 0.0f && lodDistance_ > 0.0f)
@@ -571,18 +579,24 @@ void BillboardSet::UpdateVertexBuffer(const FrameInfo& frame)
             ++enabledBillboards;
     }
 
-    sortedBillboards_.Resize(enabledBillboards);
-    unsigned index = 0;
-
-    // Then set initial sort order and distances
-    for (unsigned i = 0; i < numBillboards; ++i)
+    // Then set sort distances, or the order of the enabled billboards if not sorting
+    if (sorted_)
     {
-        Billboard& billboard = billboards_[i];
-        if (billboard.enabled_)
+        for (unsigned i = 0; i < numBillboards; ++i)
         {
-            sortedBillboards_[index++] = &billboard;
-            if (sorted_)
-                billboard.sortDistance_ = frame.camera_->GetDistanceSquared(billboardTransform * billboards_[i].position_);
+            Billboard& billboard = billboards_[i];
+            if (billboard.enabled_)
+                billboard.sortDistance_ = frame.camera_->GetDistanceSquared(billboardTransform * billboard.position_);
+        }
+    }
+    else
+    {
+        sortedBillboards_.Resize(enabledBillboards);
+        unsigned index = 0;
+        for (unsigned i = 0; i < numBillboards; ++i)
+        {
+            if (billboards_[i].enabled_)
+                sortedBillboards_[index++] = i;
         }
     }
 
@@ -595,21 +609,21 @@ void BillboardSet::UpdateVertexBuffer(const FrameInfo& frame)
 
     if (sorted_)
     {
-        Sort(sortedBillboards_.Begin(), sortedBillboards_.End(), CompareBillboards);
+        SortBillboards();
         Vector3 worldPos = node_->GetWorldPosition();
         // Store the "last sorted position" now
         previousOffset_ = (worldPos - frame.camera_->GetNode()->GetWorldPosition());
     }
 
-    float* dest = (float*)vertexBuffer_->Lock(0, enabledBillboards * 4, true);
-    if (!dest)
-        return;
+    // Write to a CPU-side copy, as this may run in a worker thread
+    vertexData_.Resize(enabledBillboards * 4 * vertexBuffer_->GetVertexSize() / sizeof(float));
+    float* dest = &vertexData_[0];
 
     if (faceCameraMode_ != FC_DIRECTION)
     {
         for (unsigned i = 0; i < enabledBillboards; ++i)
         {
-            Billboard& billboard = *sortedBillboards_[i];
+            Billboard& billboard = billboards_[sortedBillboards_[i]];
 
             Vector2 size(billboard.size_.x_ * billboardScale.x_, billboard.size_.y_ * billboardScale.y_);
             unsigned color = billboard.color_.ToUInt();
@@ -664,7 +678,7 @@ void BillboardSet::UpdateVertexBuffer(const FrameInfo& frame)
     {
         for (unsigned i = 0; i < enabledBillboards; ++i)
         {
-            Billboard& billboard = *sortedBillboards_[i];
+            Billboard& billboard = billboards_[sortedBillboards_[i]];
 
             Vector2 size(billboard.size_.x_ * billboardScale.x_, billboard.size_.y_ * billboardScale.y_);
             unsigned color = billboard.color_.ToUInt();
@@ -728,8 +742,16 @@ void BillboardSet::UpdateVertexBuffer(const FrameInfo& frame)
         }
     }
 
-    vertexBuffer_->Unlock();
+    vertexDataPending_ = true;
+}
+
+void BillboardSet::UploadVertexData()
+{
+    if (!vertexData_.Empty())
+        vertexBuffer_->SetDataRange(&vertexData_[0], 0, vertexData_.Size() * sizeof(float) / vertexBuffer_->GetVertexSize(), true);
+
     vertexBuffer_->ClearDataLost();
+    vertexDataPending_ = false;
 }
 
 void BillboardSet::MarkPositionsDirty()
@@ -763,7 +785,66 @@ void BillboardSet::CalculateFixedScreenSize(const FrameInfo& frame)
 
     bufferDirty_ = true;
     forceUpdate_ = true;
-    worldBoundingBoxDirty_ = true;
+    MarkWorldBoundingBoxDirty();
+}
+
+void BillboardSet::SortBillboards()
+{
+    // Start from the previous order: keep the billboards that are still enabled in it, and append the newly enabled ones
+    unsigned numBillboards = billboards_.Size();
+    sortMarks_.Resize(numBillboards);
+    if (numBillboards)
+        memset(&sortMarks_[0], 0, numBillboards);
+
+    unsigned enabledBillboards = 0;
+    for (unsigned i = 0; i < sortedBillboards_.Size(); ++i)
+    {
+        unsigned index = sortedBillboards_[i];
+        if (index < numBillboards && billboards_[index].enabled_ && !sortMarks_[index])
+        {
+            sortedBillboards_[enabledBillboards++] = index;
+            sortMarks_[index] = 1;
+        }
+    }
+    sortedBillboards_.Resize(enabledBillboards);
+    for (unsigned i = 0; i < numBillboards; ++i)
+    {
+        if (billboards_[i].enabled_ && !sortMarks_[i])
+            sortedBillboards_.Push(i);
+    }
+
+    // Between frames the order usually changes little, so insertion sort is close to linear time. If too many moves are
+    // needed, as after a large camera movement or a burst of new particles, give up and radix sort instead
+    unsigned numSorted = sortedBillboards_.Size();
+    unsigned* indices = &sortedBillboards_[0];
+    unsigned maxMoves = numSorted < MIN_RADIX_SORT_BILLBOARDS ? M_MAX_UNSIGNED : numSorted * MAX_SORT_MOVES_PER_BILLBOARD;
+    unsigned moves = 0;
+    unsigned i = 1;
+    for (; i < numSorted && moves <= maxMoves; ++i)
+    {
+        unsigned index = indices[i];
+        float distance = billboards_[index].sortDistance_;
+        unsigned j = i;
+        while (j > 0 && billboards_[indices[j - 1]].sortDistance_ < distance)
+        {
+            indices[j] = indices[j - 1];
+            --j;
+        }
+        indices[j] = index;
+        moves += i - j;
+    }
+    if (i == numSorted)
+        return;
+
+    // Sort back to front by inverting the key. Sort distances are non-negative, so their key bytes are rarely all in use
+    sortKeys_.Resize(numSorted);
+    tempSortKeys_.Resize(numSorted);
+    for (unsigned k = 0; k < numSorted; ++k)
+        sortKeys_[k] = ((unsigned long long)~FloatToSortKey(billboards_[indices[k]].sortDistance_) << 32) | indices[k];
+
+    const unsigned long long* src = RadixSort(&sortKeys_[0], &tempSortKeys_[0], numSorted, GetRadixSortKey, 4, 4);
+    for (unsigned k = 0; k < numSorted; ++k)
+        indices[k] = (unsigned)src[k];
 }
 
 }
@@ -76,7 +76,7 @@ public:
     virtual void ProcessRayQuery(const RayOctreeQuery& query, PODVector<RayQueryResult>& results);
     /// Calculate distance and prepare batches for rendering. May be called from worker thread(s), possibly re-entrantly.
     virtual void UpdateBatches(const FrameInfo& frame);
-    /// Prepare geometry for rendering. Called from a worker thread if possible (no GPU update.)
+    /// Prepare geometry for rendering. The vertex data is generated in a worker thread if possible, and uploaded in a following main thread update.
     virtual void UpdateGeometry(const FrameInfo& frame);
     /// Return whether a geometry update is necessary, and if it can happen in a worker thread.
     virtual UpdateGeometryType GetUpdateGeometryType();
@@ -153,6 +153,8 @@ protected:
     virtual void OnWorldBoundingBoxUpdate();
     /// Mark billboard vertex buffer to need an update.
     void MarkPositionsDirty();
+    /// Mark billboard vertex buffer to need a rewrite without recalculating the bounding box.
+    void MarkBufferDirty() { bufferDirty_ = true; }
 
     /// Billboards.
     PODVector<Billboard> billboards_;
@@ -176,10 +178,14 @@ protected:
 private:
     /// Resize billboard vertex and index buffers.
     void UpdateBufferSize();
-    /// Rewrite billboard vertex buffer.
-    void UpdateVertexBuffer(const FrameInfo& frame);
+    /// Generate the billboard vertex data. May be called from a worker thread.
+    void UpdateVertexData(const FrameInfo& frame);
+    /// Upload the generated vertex data to the vertex buffer.
+    void UploadVertexData();
     /// Calculate billboard scale factors in fixed screen size mode.
     void CalculateFixedScreenSize(const FrameInfo& frame);
+    /// Sort the enabled billboards back to front, starting from the previous order.
+    void SortBillboards();
 
     /// Geometry.
     SharedPtr<Geometry> geometry_;
@@ -201,12 +207,22 @@ private:
     bool sortThisFrame_;
     /// Whether was last rendered from an ortho camera.
     bool hasOrthoCamera_;
+    /// Generated vertex data waiting for upload flag.
+    bool vertexDataPending_;
     /// Frame number on which was last sorted.
     unsigned sortFrameNumber_;
     /// Previous offset to camera for determining whether sorting is necessary.
     Vector3 previousOffset_;
-    /// Billboard pointers for sorting.
-    Vector<Billboard*> sortedBillboards_;
+    /// Indices of the enabled billboards in sorted order. Kept between updates so that sorting can start from the previous order.
+    PODVector<unsigned> sortedBillboards_;
+    /// Marks of the billboards already in the previous sort order. Used internally.
+    PODVector<unsigned char> sortMarks_;
+    /// Radix sort keys with the billboard index in the low bits. Used internally.
+    PODVector<unsigned long long> sortKeys_;
+    /// Radix sort temporary buffer.
+    PODVector<unsigned long long> tempSortKeys_;
+    /// Generated vertex data.
+    PODVector<float> vertexData_;
     /// Attribute buffer for network replication.
     mutable VectorBuffer attrBuffer_;
 };
@@ -159,7 +159,7 @@ bool IndexBuffer::SetDataRange(const void* data, unsigned start, unsigned count,
     return true;
 }
 
-void* IndexBuffer::Lock(unsigned start, unsigned count, bool discard)
+void* IndexBuffer::Lock(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     if (lockState_ != LOCK_NONE)
     {
@@ -187,7 +187,7 @@ void* IndexBuffer::Lock(unsigned start, unsigned count, bool discard)
 
     // Because shadow data must be kept in sync, can only lock hardware buffer if not shadowed
     if (object_.ptr_ && !shadowData_ && dynamic_)
-        return MapBuffer(start, count, discard);
+        return MapBuffer(start, count, discard, noOverwrite);
     else if (shadowData_)
     {
         lockState_ = LOCK_SHADOW;
@@ -264,7 +264,7 @@ bool IndexBuffer::UpdateToGPU()
         return false;
 }
 
-void* IndexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
+void* IndexBuffer::MapBuffer(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     void* hwData = 0;
 
@@ -273,13 +273,15 @@ void* IndexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
         D3D11_MAPPED_SUBRESOURCE mappedData;
         mappedData.pData = 0;
 
+        // Dynamic buffers can only be mapped with discard or no overwrite. Without discard, the caller must not overwrite data in use by the GPU
         HRESULT hr = graphics_->GetImpl()->GetDeviceContext()->Map((ID3D11Buffer*)object_.ptr_, 0, discard ? D3D11_MAP_WRITE_DISCARD :
-            D3D11_MAP_WRITE, 0, &mappedData);
+            D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mappedData);
         if (FAILED(hr) || !mappedData.pData)
             URHO3D_LOGD3DERROR("Failed to map index buffer", hr);
         else
         {
-            hwData = mappedData.pData;
+            // The whole buffer is mapped, so offset to the start of the range
+            hwData = (unsigned char*)mappedData.pData + start * indexSize_;
             lockState_ = LOCK_HARDWARE;
         }
     }
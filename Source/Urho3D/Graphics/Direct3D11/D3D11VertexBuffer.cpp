@@ -164,7 +164,7 @@ bool VertexBuffer::SetDataRange(const void* data, unsigned start, unsigned count
     return true;
 }
 
-void* VertexBuffer::Lock(unsigned start, unsigned count, bool discard)
+void* VertexBuffer::Lock(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     if (lockState_ != LOCK_NONE)
     {
@@ -192,7 +192,7 @@ void* VertexBuffer::Lock(unsigned start, unsigned count, bool discard)
 
     // Because shadow data must be kept in sync, can only lock hardware buffer if not shadowed
     if (object_.ptr_ && !shadowData_ && dynamic_)
-        return MapBuffer(start, count, discard);
+        return MapBuffer(start, count, discard, noOverwrite);
     else if (shadowData_)
     {
         lockState_ = LOCK_SHADOW;
@@ -269,7 +269,7 @@ bool VertexBuffer::UpdateToGPU()
         return false;
 }
 
-void* VertexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
+void* VertexBuffer::MapBuffer(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     void* hwData = 0;
 
@@ -278,13 +278,15 @@ void* VertexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
         D3D11_MAPPED_SUBRESOURCE mappedData;
         mappedData.pData = 0;
 
+        // Dynamic buffers can only be mapped with discard or no overwrite. Without discard, the caller must not overwrite data in use by the GPU
         HRESULT hr = graphics_->GetImpl()->GetDeviceContext()->Map((ID3D11Buffer*)object_.ptr_, 0, discard ? D3D11_MAP_WRITE_DISCARD :
-            D3D11_MAP_WRITE, 0, &mappedData);
+            D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mappedData);
         if (FAILED(hr) || !mappedData.pData)
             URHO3D_LOGD3DERROR("Failed to map vertex buffer", hr);
         else
         {
-            hwData = mappedData.pData;
+            // The whole buffer is mapped, so offset to the start of the range
+            hwData = (unsigned char*)mappedData.pData + start * vertexSize_;
             lockState_ = LOCK_HARDWARE;
         }
     }
@@ -155,7 +155,7 @@ bool IndexBuffer::SetDataRange(const void* data, unsigned start, unsigned count,
     return true;
 }
 
-void* IndexBuffer::Lock(unsigned start, unsigned count, bool discard)
+void* IndexBuffer::Lock(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     if (lockState_ != LOCK_NONE)
     {
@@ -183,7 +183,7 @@ void* IndexBuffer::Lock(unsigned start, unsigned count, bool discard)
 
     // Because shadow data must be kept in sync, can only lock hardware buffer if not shadowed
     if (object_.ptr_ && !shadowData_ && !graphics_->IsDeviceLost())
-        return MapBuffer(start, count, discard);
+        return MapBuffer(start, count, discard, noOverwrite);
     else if (shadowData_)
     {
         lockState_ = LOCK_SHADOW;
@@ -269,7 +269,7 @@ bool IndexBuffer::UpdateToGPU()
         return false;
 }
 
-void* IndexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
+void* IndexBuffer::MapBuffer(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     void* hwData = 0;
 
@@ -279,6 +279,8 @@ void* IndexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
 
         if (discard && dynamic_)
             flags = D3DLOCK_DISCARD;
+        else if (noOverwrite && dynamic_)
+            flags = D3DLOCK_NOOVERWRITE;
 
         HRESULT hr = ((IDirect3DIndexBuffer9*)object_.ptr_)->Lock(start * indexSize_, count * indexSize_, &hwData, flags);
         if (FAILED(hr))
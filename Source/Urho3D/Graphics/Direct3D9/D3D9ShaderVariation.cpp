@@ -76,32 +76,13 @@ void ShaderVariation::OnDeviceLost()
 
 bool ShaderVariation::Create()
 {
-    Release();
-
-    if (!graphics_)
-        return false;
-
-    if (!owner_)
+    // The bytecode may have been prepared on a worker thread already
+    if (object_.ptr_ || byteCode_.Empty())
     {
-        compilerOutput_ = "Owner shader has expired";
-        return false;
-    }
-
-    // Check for up-to-date bytecode on disk
-    String path, name, extension;
-    SplitPath(owner_->GetName(), path, name, extension);
-    extension = type_ == VS ? ".vs3" : ".ps3";
+        Release();
 
-    String binaryShaderName = graphics_->GetShaderCacheDir() + name + "_" + StringHash(defines_).ToString() + extension;
-
-    if (!LoadByteCode(binaryShaderName))
-    {
-        // Compile shader if don't have valid bytecode
-        if (!Compile())
+        if (!Prepare())
             return false;
-        // Save the bytecode after successful compile, but not if the source is from a package
-        if (owner_->GetTimeStamp())
-            SaveByteCode(binaryShaderName);
     }
 
     // Then create shader from the bytecode
@@ -136,6 +117,37 @@ bool ShaderVariation::Create()
     return object_.ptr_ != 0;
 }
 
+bool ShaderVariation::Prepare()
+{
+    if (!graphics_)
+        return false;
+
+    if (!owner_)
+    {
+        compilerOutput_ = "Owner shader has expired";
+        return false;
+    }
+
+    // Check for up-to-date bytecode on disk
+    String path, name, extension;
+    SplitPath(owner_->GetName(), path, name, extension);
+    extension = type_ == VS ? ".vs3" : ".ps3";
+
+    String binaryShaderName = graphics_->GetShaderCacheDir() + name + "_" + StringHash(defines_).ToString() + extension;
+
+    if (!LoadByteCode(binaryShaderName))
+    {
+        // Compile shader if don't have valid bytecode
+        if (!Compile())
+            return false;
+        // Save the bytecode after successful compile, but not if the source is from a package
+        if (owner_->GetTimeStamp())
+            SaveByteCode(binaryShaderName);
+    }
+
+    return true;
+}
+
 void ShaderVariation::Release()
 {
     if (object_.ptr_ && graphics_)
@@ -161,6 +173,7 @@ void ShaderVariation::Release()
     for (unsigned i = 0; i < MAX_TEXTURE_UNITS; ++i)
         useTextureUnit_[i] = false;
     parameters_.Clear();
+    byteCode_.Clear();
 }
 
 void ShaderVariation::SetDefines(const String& defines)
@@ -160,7 +160,7 @@ bool VertexBuffer::SetDataRange(const void* data, unsigned start, unsigned count
     return true;
 }
 
-void* VertexBuffer::Lock(unsigned start, unsigned count, bool discard)
+void* VertexBuffer::Lock(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     if (lockState_ != LOCK_NONE)
     {
@@ -188,7 +188,7 @@ void* VertexBuffer::Lock(unsigned start, unsigned count, bool discard)
 
     // Because shadow data must be kept in sync, can only lock hardware buffer if not shadowed
     if (object_.ptr_ && !shadowData_ && !graphics_->IsDeviceLost())
-        return MapBuffer(start, count, discard);
+        return MapBuffer(start, count, discard, noOverwrite);
     else if (shadowData_)
     {
         lockState_ = LOCK_SHADOW;
@@ -274,7 +274,7 @@ bool VertexBuffer::UpdateToGPU()
         return false;
 }
 
-void* VertexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
+void* VertexBuffer::MapBuffer(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     void* hwData = 0;
 
@@ -284,6 +284,8 @@ void* VertexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
 
         if (discard && dynamic_)
             flags = D3DLOCK_DISCARD;
+        else if (noOverwrite && dynamic_)
+            flags = D3DLOCK_NOOVERWRITE;
 
         HRESULT hr = ((IDirect3DVertexBuffer9*)object_.ptr_)->Lock(start * vertexSize_, count * vertexSize_, &hwData, flags);
         if (FAILED(hr))
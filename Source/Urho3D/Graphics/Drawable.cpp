@@ -32,6 +32,7 @@
 #include "../Graphics/Octree.h"
 #include "../Graphics/Renderer.h"
 #include "../Graphics/VertexBuffer.h"
+#include "../Graphics/View.h"
 #include "../Graphics/Zone.h"
 #include "../IO/Log.h"
 #include "../Scene/Scene.h"
@@ -91,6 +92,7 @@ Drawable::Drawable(Context* context, unsigned char drawableFlags) :
     updateQueued_(false),
     zoneDirty_(false),
     octant_(0),
+    octantIndex_(0),
     zone_(0),
     viewMask_(DEFAULT_VIEWMASK),
     lightMask_(DEFAULT_LIGHTMASK),
@@ -107,7 +109,9 @@ Drawable::Drawable(Context* context, unsigned char drawableFlags) :
     lodBias_(1.0f),
     basePassFlags_(0),
     maxLights_(0),
-    firstLight_(0)
+    firstLight_(0),
+    batchCacheIndex_(0),
+    batchCacheFrameNumber_(0)
 {
 }
 
@@ -184,6 +188,13 @@ bool Drawable::DrawOcclusion(OcclusionBuffer* buffer)
     return true;
 }
 
+const Matrix3x4* Drawable::GetShadowWorldTransforms(unsigned batchIndex, unsigned& numWorldTransforms) const
+{
+    const SourceBatch& batch = batches_[batchIndex];
+    numWorldTransforms = batch.numWorldTransforms_;
+    return batch.worldTransform_;
+}
+
 void Drawable::DrawDebugGeometry(DebugRenderer* debug, bool depthTest)
 {
     if (debug && IsEnabledEffective())
@@ -308,6 +319,13 @@ void Drawable::SetZone(Zone* zone, bool temporary)
     zoneDirty_ = temporary;
 }
 
+void Drawable::SetBatchCacheSlot(View* view, unsigned index, unsigned frameNumber)
+{
+    batchCacheView_ = view;
+    batchCacheIndex_ = index;
+    batchCacheFrameNumber_ = frameNumber;
+}
+
 void Drawable::SetSortValue(float value)
 {
     sortValue_ = value;
@@ -393,7 +411,7 @@ void Drawable::OnSceneSet(Scene* scene)
 
 void Drawable::OnMarkedDirty(Node* node)
 {
-    worldBoundingBoxDirty_ = true;
+    MarkWorldBoundingBoxDirty();
     if (!updateQueued_ && octant_)
         octant_->GetRoot()->QueueUpdate(this);
 
@@ -402,6 +420,20 @@ void Drawable::OnMarkedDirty(Node* node)
         zoneDirty_ = true;
 }
 
+void Drawable::MarkWorldBoundingBoxDirty()
+{
+    worldBoundingBoxDirty_ = true;
+
+    // During threaded update the octant's box data is shared between threads. The drawable has been queued for update then,
+    // so the box is refreshed from the main thread before the octree is queried again
+    if (octant_)
+    {
+        Scene* scene = GetScene();
+        if (!scene || !scene->IsThreadedUpdate())
+            octant_->InvalidateDrawableBox(this);
+    }
+}
+
 void Drawable::AddToOctree()
 {
     // Do not add to octree when disabled
@@ -413,7 +445,18 @@ void Drawable::AddToOctree()
     {
         Octree* octree = scene->GetComponent<Octree>();
         if (octree)
-            octree->InsertDrawable(this);
+        {
+            // During batch instantiation the final transform is not known yet, so only add to the root octant and let
+            // the next octree update reinsert to the proper octant
+            if (scene->IsBatchInstantiating() && !octant_)
+            {
+                octree->AddDrawable(this);
+                if (!updateQueued_)
+                    octree->QueueUpdate(this);
+            }
+            else
+                octree->InsertDrawable(this);
+        }
         else
             URHO3D_LOGERROR("No Octree component in scene, drawable will not render");
     }
@@ -49,6 +49,7 @@ class Material;
 class OcclusionBuffer;
 class Octant;
 class RayOctreeQuery;
+class View;
 class Zone;
 struct RayQueryResult;
 struct WorkItem;
@@ -142,6 +143,8 @@ public:
 
     /// Draw to occlusion buffer. Return true if did not run out of triangles.
     virtual bool DrawOcclusion(OcclusionBuffer* buffer);
+    /// Return world transforms of a source batch for rendering to shadow maps. By default the same as for the view.
+    virtual const Matrix3x4* GetShadowWorldTransforms(unsigned batchIndex, unsigned& numWorldTransforms) const;
     /// Visualize the component as debug geometry.
     virtual void DrawDebugGeometry(DebugRenderer* debug, bool depthTest);
 
@@ -243,6 +246,8 @@ public:
 
     /// Set base pass flag for a batch.
     void SetBasePass(unsigned batchIndex) { basePassFlags_ |= (1 << batchIndex); }
+    /// Set the view and index of the cached base pass batches. Called by View.
+    void SetBatchCacheSlot(View* view, unsigned index, unsigned frameNumber);
 
     /// Return octree octant.
     Octant* GetOctant() const { return octant_; }
@@ -268,6 +273,18 @@ public:
     /// Return whether has a base pass.
     bool HasBasePass(unsigned batchIndex) const { return (basePassFlags_ & (1 << batchIndex)) != 0; }
 
+    /// Return base pass flags of all batches.
+    unsigned GetBasePassFlags() const { return basePassFlags_; }
+
+    /// Return the view that has cached the base pass batches, or null if none or it has been destroyed.
+    View* GetBatchCacheView() const { return batchCacheView_; }
+
+    /// Return the index of the cached base pass batches in the view.
+    unsigned GetBatchCacheIndex() const { return batchCacheIndex_; }
+
+    /// Return the frame number on which the cached base pass batches were last used.
+    unsigned GetBatchCacheFrameNumber() const { return batchCacheFrameNumber_; }
+
     /// Return per-pixel lights.
     const PODVector<Light*>& GetLights() const { return lights_; }
 
@@ -321,6 +338,8 @@ protected:
 
     /// Move into another octree octant.
     void SetOctant(Octant* octant) { octant_ = octant; }
+    /// Mark world-space bounding box dirty. Also invalidates the bounding box copy used for octree culling.
+    void MarkWorldBoundingBoxDirty();
 
     /// World-space bounding box.
     BoundingBox worldBoundingBox_;
@@ -344,6 +363,8 @@ protected:
     bool zoneDirty_;
     /// Octree octant.
     Octant* octant_;
+    /// Index in the octree octant's drawable list.
+    unsigned octantIndex_;
     /// Current zone.
     Zone* zone_;
     /// View mask.
@@ -384,6 +405,12 @@ protected:
     PODVector<Light*> lights_;
     /// Per-vertex lights affecting this drawable.
     PODVector<Light*> vertexLights_;
+    /// View that has cached the base pass batches.
+    WeakPtr<View> batchCacheView_;
+    /// Index of the cached base pass batches in the view.
+    unsigned batchCacheIndex_;
+    /// Frame number on which the cached base pass batches were last used.
+    unsigned batchCacheFrameNumber_;
 };
 
 inline bool CompareDrawables(Drawable* lhs, Drawable* rhs)
@@ -32,6 +32,7 @@
 #include "../Graphics/DecalSet.h"
 #include "../Graphics/Graphics.h"
 #include "../Graphics/GraphicsImpl.h"
+#include "../Graphics/ImpostorSet.h"
 #include "../Graphics/Material.h"
 #include "../Graphics/Octree.h"
 #include "../Graphics/ParticleEffect.h"
@@ -257,6 +258,30 @@ void Graphics::SetShaderCacheDir(const String& path)
         shaderCacheDir_ = AddTrailingSlash(trimmedPath);
 }
 
+bool Graphics::GetShaderInclude(const String& name, ShaderInclude& dest)
+{
+    MutexLock lock(shaderIncludeMutex_);
+
+    HashMap<String, ShaderInclude>::ConstIterator i = shaderIncludes_.Find(name);
+    if (i == shaderIncludes_.End())
+        return false;
+
+    dest = i->second_;
+    return true;
+}
+
+void Graphics::StoreShaderInclude(const String& name, const ShaderInclude& include)
+{
+    MutexLock lock(shaderIncludeMutex_);
+    shaderIncludes_[name] = include;
+}
+
+void Graphics::ClearShaderIncludes()
+{
+    MutexLock lock(shaderIncludeMutex_);
+    shaderIncludes_.Clear();
+}
+
 void Graphics::AddGPUObject(GPUObject* object)
 {
     MutexLock lock(gpuObjectMutex_);
@@ -383,6 +408,7 @@ void RegisterGraphicsLibrary(Context* context)
     BillboardSet::RegisterObject(context);
     ParticleEffect::RegisterObject(context);
     ParticleEmitter::RegisterObject(context);
+    ImpostorSet::RegisterObject(context);
     RibbonTrail::RegisterObject(context);
     CustomGeometry::RegisterObject(context);
     DecalSet::RegisterObject(context);
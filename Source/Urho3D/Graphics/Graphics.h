@@ -27,6 +27,7 @@
 #include "../Core/Mutex.h"
 #include "../Core/Object.h"
 #include "../Graphics/GraphicsDefs.h"
+#include "../Graphics/Shader.h"
 #include "../Graphics/ShaderVariation.h"
 #include "../Math/Color.h"
 #include "../Math/Plane.h"
@@ -247,7 +248,7 @@ public:
     void EndDumpShaders();
     /// Precache shader variations from an XML file generated with BeginDumpShaders().
     void PrecacheShaders(Deserializer& source);
-    /// Set shader cache directory, Direct3D only. This can either be an absolute path or a path within the resource system.
+    /// Set shader cache directory for Direct3D shader bytecode and OpenGL shader program binaries. This can either be an absolute path or a path within the resource system.
     void SetShaderCacheDir(const String& path);
 
     /// Return whether rendering initialized.
@@ -464,7 +465,7 @@ public:
     /// Return whether a custom clipping plane is in use.
     bool GetUseClipPlane() const { return useClipPlane_; }
 
-    /// Return shader cache directory, Direct3D only.
+    /// Return shader cache directory.
     const String& GetShaderCacheDir() const { return shaderCacheDir_; }
 
     /// Return current rendertarget width and height.
@@ -492,6 +493,12 @@ public:
     void CleanupScratchBuffers();
     /// Clean up shader parameters when a shader variation is released or destroyed.
     void CleanupShaderPrograms(ShaderVariation* variation);
+    /// Copy an expanded shader include file from the cache. Return false if not cached. Called by Shader, may be called from a worker thread.
+    bool GetShaderInclude(const String& name, ShaderInclude& dest);
+    /// Store an expanded shader include file to the cache. Called by Shader, may be called from a worker thread.
+    void StoreShaderInclude(const String& name, const ShaderInclude& include);
+    /// Clear the expanded shader include file cache. Called by Shader when reloaded.
+    void ClearShaderIncludes();
     /// Clean up a render surface from all FBOs. Used only on OpenGL.
     void CleanupRenderSurface(RenderSurface* surface);
     /// Get or create a constant buffer. Will be shared between shaders if possible.
@@ -758,6 +765,10 @@ private:
     mutable String lastShaderName_;
     /// Shader precache utility.
     SharedPtr<ShaderPrecache> shaderPrecache_;
+    /// Expanded shader include files by name. Shared between the shaders, as most include the same common files.
+    HashMap<String, ShaderInclude> shaderIncludes_;
+    /// Mutex for the expanded shader include files, as shaders may be loaded from worker threads.
+    Mutex shaderIncludeMutex_;
     /// Allowed screen orientations.
     String orientations_;
     /// Graphics API name.
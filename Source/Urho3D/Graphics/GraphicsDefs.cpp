@@ -85,6 +85,11 @@ extern URHO3D_API const StringHash PSP_LIGHTMATRICES("LightMatricesPS");
 extern URHO3D_API const StringHash PSP_VSMSHADOWPARAMS("VSMShadowParams");
 extern URHO3D_API const StringHash PSP_ROUGHNESS("Roughness");
 extern URHO3D_API const StringHash PSP_METALLIC("Metallic");
+extern URHO3D_API const StringHash PSP_CLUSTERVIEW("ClusterView");
+extern URHO3D_API const StringHash PSP_CLUSTERPROJ("ClusterProj");
+extern URHO3D_API const StringHash PSP_CLUSTERGRID("ClusterGrid");
+extern URHO3D_API const StringHash PSP_CLUSTERDEPTH("ClusterDepth");
+extern URHO3D_API const StringHash PSP_CLUSTERTEXSIZE("ClusterTexSize");
 
 extern URHO3D_API const Vector3 DOT_SCALE(1 / 3.0f, 1 / 3.0f, 1 / 3.0f);
 
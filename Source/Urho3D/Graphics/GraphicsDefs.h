@@ -332,6 +332,7 @@ enum TextureUnit
     TU_INDIRECTION = 12,
     TU_DEPTHBUFFER = 13,
     TU_LIGHTBUFFER = 14,
+    TU_CLUSTERBUFFER = 14,
     TU_ZONE = 15,
     MAX_MATERIAL_TEXTURE_UNITS = 8,
     MAX_TEXTURE_UNITS = 16
@@ -420,6 +421,11 @@ extern URHO3D_API const StringHash PSP_LIGHTMATRICES;
 extern URHO3D_API const StringHash PSP_VSMSHADOWPARAMS;
 extern URHO3D_API const StringHash PSP_ROUGHNESS;
 extern URHO3D_API const StringHash PSP_METALLIC;
+extern URHO3D_API const StringHash PSP_CLUSTERVIEW;
+extern URHO3D_API const StringHash PSP_CLUSTERPROJ;
+extern URHO3D_API const StringHash PSP_CLUSTERGRID;
+extern URHO3D_API const StringHash PSP_CLUSTERDEPTH;
+extern URHO3D_API const StringHash PSP_CLUSTERTEXSIZE;
 
 // Scale calculation from bounding box diagonal.
 extern URHO3D_API const Vector3 DOT_SCALE;
@@ -25,7 +25,9 @@
 // Note: GraphicsImpl class is purposefully API-specific. It should not be used by Urho3D client applications,
 // unless required for e.g. integration of 3rd party libraries that interface directly with the graphics device.
 
-#if defined(URHO3D_OPENGL)
+#if defined(URHO3D_NULL_GRAPHICS)
+#include "Null/NullGraphicsImpl.h"
+#elif defined(URHO3D_OPENGL)
 #include "OpenGL/OGLGraphicsImpl.h"
 #elif defined(URHO3D_D3D11)
 #include "Direct3D11/D3D11GraphicsImpl.h"
@@ -0,0 +1,561 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "../Precompiled.h"
+
+#include "../Core/Context.h"
+#include "../Graphics/Camera.h"
+#include "../Graphics/Graphics.h"
+#include "../Graphics/GraphicsEvents.h"
+#include "../Graphics/ImpostorSet.h"
+#include "../Graphics/Light.h"
+#include "../Graphics/Material.h"
+#include "../Graphics/Model.h"
+#include "../Graphics/Octree.h"
+#include "../Graphics/RenderSurface.h"
+#include "../Graphics/StaticModel.h"
+#include "../Graphics/Technique.h"
+#include "../Graphics/Texture2D.h"
+#include "../Graphics/Zone.h"
+#include "../IO/Log.h"
+#include "../Resource/Image.h"
+#include "../Resource/ResourceCache.h"
+#include "../Scene/Scene.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+extern const char* GEOMETRY_CATEGORY;
+
+static const float DEFAULT_IMPOSTOR_DISTANCE = 100.0f;
+static const unsigned DEFAULT_NUM_ANGLES = 8;
+static const unsigned MAX_ANGLES = 64;
+
+ImpostorSet::ImpostorSet(Context* context) :
+    BillboardSet(context),
+    impostorDistance_(DEFAULT_IMPOSTOR_DISTANCE),
+    numAngles_(DEFAULT_NUM_ANGLES),
+    bakeCellSize_(0),
+    updateCamera_(0),
+    instancesDirty_(true),
+    nodesDirty_(false),
+    nodeIDsDirty_(false)
+{
+    // The billboards are positioned in world space and rotate only around the vertical axis like the baking cameras
+    relative_ = false;
+    scaled_ = false;
+    faceCameraMode_ = FC_ROTATE_Y;
+
+    // Initialize the default node IDs attribute
+    UpdateNodeIDs();
+}
+
+ImpostorSet::~ImpostorSet()
+{
+}
+
+void ImpostorSet::RegisterObject(Context* context)
+{
+    context->RegisterFactory<ImpostorSet>(GEOMETRY_CATEGORY);
+
+    URHO3D_COPY_BASE_ATTRIBUTES(BillboardSet);
+    // The billboards are regenerated from the instance nodes and should not be serialized
+    URHO3D_REMOVE_ATTRIBUTE("Billboards");
+    URHO3D_REMOVE_ATTRIBUTE("Network Billboards");
+    URHO3D_UPDATE_ATTRIBUTE_DEFAULT_VALUE("Relative Position", false);
+    URHO3D_UPDATE_ATTRIBUTE_DEFAULT_VALUE("Relative Scale", false);
+    URHO3D_UPDATE_ATTRIBUTE_DEFAULT_VALUE("Face Camera Mode", (int)FC_ROTATE_Y);
+    URHO3D_MIXED_ACCESSOR_ATTRIBUTE("Model", GetModelAttr, SetModelAttr, ResourceRef, ResourceRef(Model::GetTypeStatic()), AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Impostor Distance", GetImpostorDistance, SetImpostorDistance, float, DEFAULT_IMPOSTOR_DISTANCE,
+        AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Num Angles", GetNumAngles, SetNumAngles, unsigned, DEFAULT_NUM_ANGLES, AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Instance Nodes", GetNodeIDsAttr, SetNodeIDsAttr, VariantVector, Variant::emptyVariantVector,
+        AM_DEFAULT | AM_NODEIDVECTOR);
+    URHO3D_ATTRIBUTE("Bake Cell Size", int, bakeCellSize_, 0, AM_DEFAULT);
+}
+
+void ImpostorSet::ApplyAttributes()
+{
+    if (nodesDirty_)
+    {
+        // Remove all old instance nodes before searching for new
+        for (unsigned i = 0; i < instanceNodes_.Size(); ++i)
+        {
+            Node* node = instanceNodes_[i];
+            if (node)
+                node->RemoveListener(this);
+        }
+
+        instanceNodes_.Clear();
+
+        Scene* scene = GetScene();
+        if (scene)
+        {
+            // The first index stores the number of IDs redundantly. This is for editing
+            for (unsigned i = 1; i < nodeIDsAttr_.Size(); ++i)
+            {
+                Node* node = scene->GetNode(nodeIDsAttr_[i].GetUInt());
+                if (node)
+                {
+                    WeakPtr<Node> instanceWeak(node);
+                    node->AddListener(this);
+                    instanceNodes_.Push(instanceWeak);
+                    ApplyDrawDistance(node);
+                }
+            }
+        }
+
+        nodesDirty_ = false;
+        UpdateNumInstances();
+        nodeIDsDirty_ = false;
+    }
+
+    // The baked material is not a resource and is not saved with the scene, so bake again if no material was assigned
+    if (bakeCellSize_ > 0 && !GetMaterial() && !bakeScene_ && GetSubsystem<Graphics>())
+        Bake(bakeCellSize_);
+}
+
+void ImpostorSet::ProcessRayQuery(const RayOctreeQuery&, PODVector<RayQueryResult>&)
+{
+    // Raycasts are handled by the instances' own StaticModel components, which remain in the octree at all distances
+}
+
+void ImpostorSet::UpdateGeometry(const FrameInfo& frame)
+{
+    // Choose the impostors again only if the instances or the camera have changed. With several views, this happens when
+    // the view changes, as the billboards are shared
+    Camera* camera = frame.camera_;
+    const Matrix3x4& cameraTransform = camera->GetNode()->GetWorldTransform();
+
+    if (model_ && (instancesDirty_ || camera != updateCamera_ || cameraTransform != updateCameraTransform_))
+    {
+        updateCamera_ = camera;
+        updateCameraTransform_ = cameraTransform;
+        instancesDirty_ = false;
+
+        const BoundingBox& box = model_->GetBoundingBox();
+        Vector3 boxCenter = box.Center();
+        Vector3 boxSize = box.Size();
+        // The baking cameras frame the model with a square that fits it from every angle around the vertical axis
+        float halfSize = 0.5f * Max(boxSize.y_, Vector2(boxSize.x_, boxSize.z_).Length());
+        Vector3 cameraPos = cameraTransform.Translation();
+        float angleStep = 360.0f / numAngles_;
+        float uvStep = 1.0f / numAngles_;
+        bool changed = false;
+
+        for (unsigned i = 0; i < instanceNodes_.Size() && i < billboards_.Size(); ++i)
+        {
+            Node* node = instanceNodes_[i];
+            Billboard& billboard = billboards_[i];
+
+            if (!node || !node->IsEnabled())
+            {
+                changed |= billboard.enabled_;
+                billboard.enabled_ = false;
+                continue;
+            }
+
+            const Matrix3x4& worldTransform = node->GetWorldTransform();
+            Vector3 center = worldTransform * boxCenter;
+            // Use the same distance as the view uses for the instance's draw distance, so that the switch is seamless
+            bool enabled = camera->GetDistance(center) > impostorDistance_;
+
+            if (enabled)
+            {
+                // Choose the baked angle closest to the direction of the camera in the instance's local space
+                Vector3 localDir = node->GetWorldRotation().Inverse() * (cameraPos - center);
+                float angle = Atan2(-localDir.x_, -localDir.z_);
+                if (angle < 0.0f)
+                    angle += 360.0f;
+                unsigned cell = (unsigned)(angle / angleStep + 0.5f) % numAngles_;
+
+                Vector3 scale = worldTransform.Scale();
+                Vector2 size(halfSize * scale.x_, halfSize * scale.y_);
+                Rect uv(cell * uvStep, 0.0f, (cell + 1) * uvStep, 1.0f);
+
+                if (!billboard.enabled_ || billboard.position_ != center || billboard.size_ != size || billboard.uv_ != uv)
+                {
+                    billboard.position_ = center;
+                    billboard.size_ = size;
+                    billboard.uv_ = uv;
+                    changed = true;
+                }
+            }
+            else
+                changed |= billboard.enabled_;
+
+            billboard.enabled_ = enabled;
+        }
+
+        // The bounding box covers all instances regardless of distance, so only the vertex buffer needs rewriting
+        if (changed)
+            MarkBufferDirty();
+    }
+
+    BillboardSet::UpdateGeometry(frame);
+}
+
+void ImpostorSet::SetModel(Model* model)
+{
+    if (model == model_)
+        return;
+
+    model_ = model;
+    instancesDirty_ = true;
+    OnMarkedDirty(node_);
+    MarkNetworkUpdate();
+}
+
+void ImpostorSet::SetImpostorDistance(float distance)
+{
+    impostorDistance_ = Max(distance, 0.0f);
+    instancesDirty_ = true;
+
+    for (unsigned i = 0; i < instanceNodes_.Size(); ++i)
+        ApplyDrawDistance(instanceNodes_[i]);
+
+    MarkNetworkUpdate();
+}
+
+void ImpostorSet::SetNumAngles(unsigned num)
+{
+    numAngles_ = Clamp(num, 1U, MAX_ANGLES);
+    instancesDirty_ = true;
+    MarkBufferDirty();
+    MarkNetworkUpdate();
+}
+
+void ImpostorSet::AddInstanceNode(Node* node)
+{
+    if (!node)
+        return;
+
+    WeakPtr<Node> instanceWeak(node);
+    if (instanceNodes_.Contains(instanceWeak))
+        return;
+
+    // Add as a listener for the instance node, so that we know to dirty the bounding box when the node moves or is enabled/disabled
+    node->AddListener(this);
+    instanceNodes_.Push(instanceWeak);
+
+    if (!model_)
+    {
+        StaticModel* staticModel = node->GetComponent<StaticModel>();
+        if (staticModel)
+            model_ = staticModel->GetModel();
+    }
+
+    ApplyDrawDistance(node);
+    UpdateNumInstances();
+}
+
+void ImpostorSet::RemoveInstanceNode(Node* node)
+{
+    if (!node)
+        return;
+
+    WeakPtr<Node> instanceWeak(node);
+    Vector<WeakPtr<Node> >::Iterator i = instanceNodes_.Find(instanceWeak);
+    if (i == instanceNodes_.End())
+        return;
+
+    node->RemoveListener(this);
+    instanceNodes_.Erase(i);
+    UpdateNumInstances();
+}
+
+void ImpostorSet::RemoveAllInstanceNodes()
+{
+    for (unsigned i = 0; i < instanceNodes_.Size(); ++i)
+    {
+        Node* node = instanceNodes_[i];
+        if (node)
+            node->RemoveListener(this);
+    }
+
+    instanceNodes_.Clear();
+    UpdateNumInstances();
+}
+
+bool ImpostorSet::Bake(int cellSize)
+{
+    if (!model_)
+    {
+        URHO3D_LOGERROR("No model to bake impostors of");
+        return false;
+    }
+    if (cellSize <= 0)
+    {
+        URHO3D_LOGERROR("Invalid impostor cell size " + String(cellSize));
+        return false;
+    }
+
+    // Use the materials of the close range representation
+    StaticModel* sourceModel = 0;
+    for (unsigned i = 0; i < instanceNodes_.Size() && !sourceModel; ++i)
+    {
+        Node* node = instanceNodes_[i];
+        if (node)
+            sourceModel = node->GetComponent<StaticModel>();
+    }
+
+    impostorTexture_ = new Texture2D(context_);
+    impostorTexture_->SetNumLevels(1);
+    if (!impostorTexture_->SetSize(cellSize * numAngles_, cellSize, Graphics::GetRGBAFormat(), TEXTURE_RENDERTARGET))
+    {
+        URHO3D_LOGERROR("Failed to create impostor texture");
+        impostorTexture_.Reset();
+        return false;
+    }
+
+    // Build a private scene with only the model, lit from above. Fog color with zero alpha clears the background transparent
+    bakeScene_ = new Scene(context_);
+    bakeScene_->CreateComponent<Octree>();
+    Zone* zone = bakeScene_->CreateComponent<Zone>();
+    zone->SetBoundingBox(BoundingBox(-M_LARGE_VALUE, M_LARGE_VALUE));
+    zone->SetAmbientColor(Color(0.5f, 0.5f, 0.5f));
+    zone->SetFogColor(Color(0.0f, 0.0f, 0.0f, 0.0f));
+    zone->SetFogStart(0.5f * M_LARGE_VALUE);
+    zone->SetFogEnd(M_LARGE_VALUE);
+
+    Node* lightNode = bakeScene_->CreateChild();
+    lightNode->SetDirection(Vector3(0.5f, -1.0f, 0.5f));
+    Light* light = lightNode->CreateComponent<Light>();
+    light->SetLightType(LIGHT_DIRECTIONAL);
+
+    Node* modelNode = bakeScene_->CreateChild();
+    StaticModel* bakeModel = modelNode->CreateComponent<StaticModel>();
+    bakeModel->SetModel(model_);
+    if (sourceModel)
+    {
+        for (unsigned i = 0; i < model_->GetNumGeometries(); ++i)
+            bakeModel->SetMaterial(i, sourceModel->GetMaterial(i));
+    }
+
+    const BoundingBox& box = model_->GetBoundingBox();
+    Vector3 boxCenter = box.Center();
+    Vector3 boxSize = box.Size();
+    float orthoSize = Max(boxSize.y_, Vector2(boxSize.x_, boxSize.z_).Length());
+    float radius = 0.5f * boxSize.Length() + 1.0f;
+
+    RenderSurface* surface = impostorTexture_->GetRenderSurface();
+    surface->SetNumViewports(numAngles_);
+    surface->SetUpdateMode(SURFACE_MANUALUPDATE);
+
+    for (unsigned i = 0; i < numAngles_; ++i)
+    {
+        // Look at the model horizontally from the angle that UpdateGeometry() associates with this cell
+        Vector3 direction = Quaternion(360.0f * i / numAngles_, Vector3::UP) * Vector3::BACK;
+        Node* cameraNode = bakeScene_->CreateChild();
+        cameraNode->SetPosition(boxCenter + direction * radius);
+        cameraNode->LookAt(boxCenter);
+        Camera* camera = cameraNode->CreateComponent<Camera>();
+        camera->SetOrthographic(true);
+        camera->SetOrthoSize(orthoSize);
+        camera->SetNearClip(0.0f);
+        camera->SetFarClip(2.0f * radius);
+
+        IntRect rect(i * cellSize, 0, (i + 1) * cellSize, cellSize);
+        surface->SetViewport(i, new Viewport(context_, bakeScene_, camera, rect));
+    }
+
+    surface->QueueUpdate();
+    SubscribeToEvent(E_ENDRENDERING, URHO3D_HANDLER(ImpostorSet, HandleEndRendering));
+
+    // Alpha masking cuts the transparent background away without needing depth sorting
+    SharedPtr<Material> material(new Material(context_));
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    material->SetTechnique(0, cache->GetResource<Technique>("Techniques/DiffUnlit.xml"));
+    material->SetPixelShaderDefines("ALPHAMASK");
+    material->SetTexture(TU_DIFFUSE, impostorTexture_);
+    SetMaterial(material);
+
+    bakeCellSize_ = cellSize;
+    MarkNetworkUpdate();
+
+    return true;
+}
+
+bool ImpostorSet::SaveImpostorTexture(const String& fileName) const
+{
+    if (!impostorTexture_)
+    {
+        URHO3D_LOGERROR("No impostor texture to save");
+        return false;
+    }
+
+    Image image(context_);
+    image.SetSize(impostorTexture_->GetWidth(), impostorTexture_->GetHeight(), 4);
+    if (!impostorTexture_->GetData(0, image.GetData()))
+        return false;
+
+    return image.SavePNG(fileName);
+}
+
+Node* ImpostorSet::GetInstanceNode(unsigned index) const
+{
+    return index < instanceNodes_.Size() ? instanceNodes_[index] : (Node*)0;
+}
+
+void ImpostorSet::SetModelAttr(const ResourceRef& value)
+{
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    SetModel(cache->GetResource<Model>(value.name_));
+}
+
+void ImpostorSet::SetNodeIDsAttr(const VariantVector& value)
+{
+    // Just remember the node IDs. They need to go through the SceneResolver, and we actually find the nodes during
+    // ApplyAttributes()
+    if (value.Size())
+    {
+        nodeIDsAttr_.Clear();
+
+        unsigned index = 0;
+        unsigned numInstances = value[index++].GetUInt();
+        // Prevent crash on entering negative value in the editor
+        if (numInstances > M_MAX_INT)
+            numInstances = 0;
+
+        nodeIDsAttr_.Push(numInstances);
+        while (numInstances--)
+        {
+            // If vector contains less IDs than should, fill the rest with zeroes
+            if (index < value.Size())
+                nodeIDsAttr_.Push(value[index++].GetUInt());
+            else
+                nodeIDsAttr_.Push(0);
+        }
+    }
+    else
+    {
+        nodeIDsAttr_.Clear();
+        nodeIDsAttr_.Push(0);
+    }
+
+    nodesDirty_ = true;
+    nodeIDsDirty_ = false;
+}
+
+ResourceRef ImpostorSet::GetModelAttr() const
+{
+    return GetResourceRef(model_, Model::GetTypeStatic());
+}
+
+const VariantVector& ImpostorSet::GetNodeIDsAttr() const
+{
+    if (nodeIDsDirty_)
+        UpdateNodeIDs();
+
+    return nodeIDsAttr_;
+}
+
+void ImpostorSet::OnMarkedDirty(Node* node)
+{
+    instancesDirty_ = true;
+    Drawable::OnMarkedDirty(node);
+}
+
+void ImpostorSet::OnNodeSetEnabled(Node* node)
+{
+    instancesDirty_ = true;
+    Drawable::OnMarkedDirty(node);
+}
+
+void ImpostorSet::OnNodeDestroyed(Node* node)
+{
+    // The billboard of the destroyed instance must be hidden, and the bounding box no longer includes it
+    OnMarkedDirty(node_);
+}
+
+void ImpostorSet::OnWorldBoundingBoxUpdate()
+{
+    BoundingBox worldBox;
+
+    if (model_)
+    {
+        const BoundingBox& box = model_->GetBoundingBox();
+
+        for (unsigned i = 0; i < instanceNodes_.Size(); ++i)
+        {
+            Node* node = instanceNodes_[i];
+            if (node && node->IsEnabled())
+                worldBox.Merge(box.Transformed(node->GetWorldTransform()));
+        }
+    }
+
+    // Always merge the node's own position so that the box is valid without instances
+    worldBox.Merge(node_->GetWorldPosition());
+
+    worldBoundingBox_ = worldBox;
+}
+
+void ImpostorSet::UpdateNumInstances()
+{
+    SetNumBillboards(instanceNodes_.Size());
+    nodeIDsDirty_ = true;
+
+    OnMarkedDirty(GetNode());
+    MarkNetworkUpdate();
+}
+
+void ImpostorSet::ApplyDrawDistance(Node* node)
+{
+    StaticModel* staticModel = node ? node->GetComponent<StaticModel>() : (StaticModel*)0;
+    if (staticModel)
+        staticModel->SetDrawDistance(impostorDistance_);
+}
+
+void ImpostorSet::UpdateNodeIDs() const
+{
+    unsigned numInstances = instanceNodes_.Size();
+
+    nodeIDsAttr_.Clear();
+    nodeIDsAttr_.Push(numInstances);
+
+    for (unsigned i = 0; i < numInstances; ++i)
+    {
+        Node* node = instanceNodes_[i];
+        nodeIDsAttr_.Push(node ? node->GetID() : 0);
+    }
+
+    nodeIDsDirty_ = false;
+}
+
+void ImpostorSet::HandleEndRendering(StringHash eventType, VariantMap& eventData)
+{
+    // If the bake was requested after this frame's rendering update, the viewports are rendered on the next frame
+    RenderSurface* surface = impostorTexture_ ? impostorTexture_->GetRenderSurface() : (RenderSurface*)0;
+    if (surface && surface->IsUpdateQueued())
+        return;
+
+    // The bake viewports have been rendered, so the scene is no longer needed
+    if (surface)
+        surface->SetNumViewports(0);
+    bakeScene_.Reset();
+    UnsubscribeFromEvent(E_ENDRENDERING);
+}
+
+}
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#pragma once
+
+#include "../Graphics/BillboardSet.h"
+
+namespace Urho3D
+{
+
+class Camera;
+class Model;
+class Scene;
+class Texture2D;
+
+/// Draws distant instances of a static model as camera-facing billboards using textures rendered from several angles around the model. The instance scene nodes keep their own StaticModel components for close range; their draw distance is set to the impostor distance so that exactly one of the representations is shown.
+class URHO3D_API ImpostorSet : public BillboardSet
+{
+    URHO3D_OBJECT(ImpostorSet, BillboardSet);
+
+public:
+    /// Construct.
+    ImpostorSet(Context* context);
+    /// Destruct.
+    virtual ~ImpostorSet();
+    /// Register object factory. BillboardSet must be registered first.
+    static void RegisterObject(Context* context);
+
+    /// Apply attribute changes that can not be applied immediately. Called after scene load or a network update.
+    void ApplyAttributes();
+    /// Process octree raycast. May be called from a worker thread.
+    virtual void ProcessRayQuery(const RayOctreeQuery& query, PODVector<RayQueryResult>& results);
+    /// Prepare geometry for rendering. Choose the instances and viewing angles shown as impostors for the current view.
+    virtual void UpdateGeometry(const FrameInfo& frame);
+
+    /// Set model to render impostors of. Defaults to the model of the first instance node added.
+    void SetModel(Model* model);
+    /// Set distance from the camera beyond which instances are drawn as impostors. Also sets the draw distance of the instances' StaticModel components.
+    void SetImpostorDistance(float distance);
+    /// Set number of viewing angles around the vertical axis in the impostor texture. Must match the texture in use.
+    void SetNumAngles(unsigned num);
+    /// Add an instance scene node. Should have a StaticModel component for close range rendering.
+    void AddInstanceNode(Node* node);
+    /// Remove an instance scene node.
+    void RemoveInstanceNode(Node* node);
+    /// Remove all instance scene nodes.
+    void RemoveAllInstanceNodes();
+    /// Render the impostor texture of the model using the first instance node's materials, and create a material to use it. Each angle occupies a square cell of the given size. The rendering happens during the next frame's rendering update. The cell size is serialized, so that a loaded set without a material bakes again. Return true if queued successfully.
+    bool Bake(int cellSize = 128);
+    /// Save the impostor texture to a PNG file after baking. Return true if successful.
+    bool SaveImpostorTexture(const String& fileName) const;
+
+    /// Return model.
+    Model* GetModel() const { return model_; }
+
+    /// Return impostor distance.
+    float GetImpostorDistance() const { return impostorDistance_; }
+
+    /// Return number of viewing angles.
+    unsigned GetNumAngles() const { return numAngles_; }
+
+    /// Return number of instance nodes.
+    unsigned GetNumInstanceNodes() const { return instanceNodes_.Size(); }
+
+    /// Return instance node by index.
+    Node* GetInstanceNode(unsigned index) const;
+
+    /// Return the texture rendered by the last bake, or null if not baked.
+    Texture2D* GetImpostorTexture() const { return impostorTexture_; }
+
+    /// Return cell size of the last bake, or zero if not baked.
+    int GetBakeCellSize() const { return bakeCellSize_; }
+
+    /// Set model attribute.
+    void SetModelAttr(const ResourceRef& value);
+    /// Set node IDs attribute.
+    void SetNodeIDsAttr(const VariantVector& value);
+    /// Return model attribute.
+    ResourceRef GetModelAttr() const;
+    /// Return node IDs attribute.
+    const VariantVector& GetNodeIDsAttr() const;
+
+protected:
+    /// Handle node transform being dirtied.
+    virtual void OnMarkedDirty(Node* node);
+    /// Handle scene node enabled status changing.
+    virtual void OnNodeSetEnabled(Node* node);
+    /// Handle an instance node being destroyed.
+    virtual void OnNodeDestroyed(Node* node);
+    /// Recalculate the world-space bounding box.
+    virtual void OnWorldBoundingBoxUpdate();
+
+private:
+    /// Resize the billboards to match the instances.
+    void UpdateNumInstances();
+    /// Apply the impostor distance to the draw distance of an instance node's StaticModel.
+    void ApplyDrawDistance(Node* node);
+    /// Update node IDs attribute from the actual nodes.
+    void UpdateNodeIDs() const;
+    /// Handle end of rendering. Release the bake scene.
+    void HandleEndRendering(StringHash eventType, VariantMap& eventData);
+
+    /// Model.
+    SharedPtr<Model> model_;
+    /// Instance nodes.
+    Vector<WeakPtr<Node> > instanceNodes_;
+    /// Impostor distance.
+    float impostorDistance_;
+    /// Number of viewing angles.
+    unsigned numAngles_;
+    /// Texture rendered by the last bake.
+    SharedPtr<Texture2D> impostorTexture_;
+    /// Scene used for rendering the impostor texture. Held until the rendering has happened.
+    SharedPtr<Scene> bakeScene_;
+    /// Cell size of the last bake.
+    int bakeCellSize_;
+    /// Camera the billboards were last updated for. Only compared, never dereferenced.
+    Camera* updateCamera_;
+    /// World transform of the camera the billboards were last updated for.
+    Matrix3x4 updateCameraTransform_;
+    /// Whether the instances or the impostor parameters have changed since the billboards were last updated.
+    bool instancesDirty_;
+    /// IDs of instance nodes for serialization.
+    mutable VariantVector nodeIDsAttr_;
+    /// Whether node IDs have been set and nodes should be searched for during ApplyAttributes.
+    bool nodesDirty_;
+    /// Whether nodes have been manipulated by the API and node ID attribute should be refreshed.
+    mutable bool nodeIDsDirty_;
+};
+
+}
@@ -56,8 +56,8 @@ public:
     bool SetData(const void* data);
     /// Set a data range in the buffer. Optionally discard data outside the range.
     bool SetDataRange(const void* data, unsigned start, unsigned count, bool discard = false);
-    /// Lock the buffer for write-only editing. Return data pointer if successful. Optionally discard data outside the range.
-    void* Lock(unsigned start, unsigned count, bool discard = false);
+    /// Lock the buffer for write-only editing. Return data pointer if successful. Optionally discard data outside the range. With no overwrite, the caller guarantees that the locked range of a dynamic buffer is not in use by pending draw calls, so that the lock does not need to wait for them.
+    void* Lock(unsigned start, unsigned count, bool discard = false, bool noOverwrite = false);
     /// Unlock the buffer and apply changes to the GPU buffer.
     void Unlock();
 
@@ -91,7 +91,7 @@ private:
     /// Update the shadow data to the GPU buffer.
     bool UpdateToGPU();
     /// Map the GPU buffer into CPU memory. Not used on OpenGL.
-    void* MapBuffer(unsigned start, unsigned count, bool discard);
+    void* MapBuffer(unsigned start, unsigned count, bool discard, bool noOverwrite = false);
     /// Unmap the GPU buffer. Not used on OpenGL.
     void UnmapBuffer();
 
@@ -0,0 +1,713 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "../Precompiled.h"
+
+#include "../Container/Sort.h"
+#include "../Graphics/MeshOptimization.h"
+#include "../Math/BoundingBox.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+static const unsigned VERTEX_CACHE_SIZE = 32;
+static const float CACHE_DECAY_POWER = 1.5f;
+static const float LAST_TRIANGLE_SCORE = 0.75f;
+static const float VALENCE_BOOST_SCALE = 2.0f;
+static const float VALENCE_BOOST_POWER = 0.5f;
+static const float MIN_NORMAL_DOT = 0.25f;
+
+/// Quadric of squared distances to triangle planes, weighted by triangle area.
+struct Quadric
+{
+    /// Construct zero.
+    Quadric() :
+        a00_(0.0f), a01_(0.0f), a02_(0.0f), a11_(0.0f), a12_(0.0f), a22_(0.0f),
+        b0_(0.0f), b1_(0.0f), b2_(0.0f), c_(0.0f), weight_(0.0f)
+    {
+    }
+
+    /// Add the plane of a triangle.
+    void AddTriangle(const Vector3& v0, const Vector3& v1, const Vector3& v2)
+    {
+        Vector3 normal = (v1 - v0).CrossProduct(v2 - v0);
+        float area = normal.Length();
+        if (area < M_EPSILON)
+            return;
+        normal /= area;
+        float d = -normal.DotProduct(v0);
+
+        a00_ += area * normal.x_ * normal.x_;
+        a01_ += area * normal.x_ * normal.y_;
+        a02_ += area * normal.x_ * normal.z_;
+        a11_ += area * normal.y_ * normal.y_;
+        a12_ += area * normal.y_ * normal.z_;
+        a22_ += area * normal.z_ * normal.z_;
+        b0_ += area * d * normal.x_;
+        b1_ += area * d * normal.y_;
+        b2_ += area * d * normal.z_;
+        c_ += area * d * d;
+        weight_ += area;
+    }
+
+    /// Add another quadric.
+    Quadric& operator +=(const Quadric& rhs)
+    {
+        a00_ += rhs.a00_;
+        a01_ += rhs.a01_;
+        a02_ += rhs.a02_;
+        a11_ += rhs.a11_;
+        a12_ += rhs.a12_;
+        a22_ += rhs.a22_;
+        b0_ += rhs.b0_;
+        b1_ += rhs.b1_;
+        b2_ += rhs.b2_;
+        c_ += rhs.c_;
+        weight_ += rhs.weight_;
+        return *this;
+    }
+
+    /// Return the area weighted sum of squared plane distances of a point.
+    float Evaluate(const Vector3& p) const
+    {
+        float rx = a00_ * p.x_ + a01_ * p.y_ + a02_ * p.z_;
+        float ry = a01_ * p.x_ + a11_ * p.y_ + a12_ * p.z_;
+        float rz = a02_ * p.x_ + a12_ * p.y_ + a22_ * p.z_;
+        return Abs(p.x_ * rx + p.y_ * ry + p.z_ * rz + 2.0f * (b0_ * p.x_ + b1_ * p.y_ + b2_ * p.z_) + c_);
+    }
+
+    float a00_, a01_, a02_, a11_, a12_, a22_;
+    float b0_, b1_, b2_;
+    float c_;
+    float weight_;
+};
+
+/// Edge collapse candidate.
+struct EdgeCollapse
+{
+    /// Vertex to remove.
+    unsigned from_;
+    /// Vertex to collapse to.
+    unsigned to_;
+    /// Mean squared distance error.
+    float error_;
+};
+
+/// Triangle cluster sort key for overdraw optimization.
+struct TriangleCluster
+{
+    /// First triangle.
+    unsigned start_;
+    /// Number of triangles.
+    unsigned count_;
+    /// Outward facing sort key.
+    float key_;
+};
+
+/// Compare vertex indices by position.
+struct PositionCompare
+{
+    PositionCompare(const PODVector<Vector3>& positions) :
+        positions_(positions)
+    {
+    }
+
+    bool operator ()(unsigned lhs, unsigned rhs) const
+    {
+        const Vector3& l = positions_[lhs];
+        const Vector3& r = positions_[rhs];
+        if (l.x_ != r.x_)
+            return l.x_ < r.x_;
+        if (l.y_ != r.y_)
+            return l.y_ < r.y_;
+        if (l.z_ != r.z_)
+            return l.z_ < r.z_;
+        return lhs < rhs;
+    }
+
+    const PODVector<Vector3>& positions_;
+};
+
+/// Compare vertex indices by vertex data.
+struct VertexDataCompare
+{
+    VertexDataCompare(const unsigned char* vertexData, unsigned vertexSize) :
+        vertexData_(vertexData),
+        vertexSize_(vertexSize)
+    {
+    }
+
+    bool operator ()(unsigned lhs, unsigned rhs) const
+    {
+        int result = memcmp(vertexData_ + lhs * vertexSize_, vertexData_ + rhs * vertexSize_, vertexSize_);
+        return result ? result < 0 : lhs < rhs;
+    }
+
+    const unsigned char* vertexData_;
+    unsigned vertexSize_;
+};
+
+static bool CompareEdgeCollapses(const EdgeCollapse& lhs, const EdgeCollapse& rhs)
+{
+    return lhs.error_ < rhs.error_;
+}
+
+static bool CompareTriangleClusters(const TriangleCluster& lhs, const TriangleCluster& rhs)
+{
+    return lhs.key_ > rhs.key_;
+}
+
+/// Build the lists of triangles using each vertex.
+static void BuildTriangleAdjacency(PODVector<unsigned>& offsets, PODVector<unsigned>& triangles, const unsigned* indices,
+    unsigned indexCount, unsigned vertexCount)
+{
+    offsets.Resize(vertexCount + 1);
+    for (unsigned i = 0; i <= vertexCount; ++i)
+        offsets[i] = 0;
+    for (unsigned i = 0; i < indexCount; ++i)
+        ++offsets[indices[i] + 1];
+    for (unsigned i = 0; i < vertexCount; ++i)
+        offsets[i + 1] += offsets[i];
+
+    triangles.Resize(indexCount);
+    PODVector<unsigned> fill(&offsets[0], vertexCount);
+    for (unsigned i = 0; i < indexCount; ++i)
+        triangles[fill[indices[i]]++] = i / 3;
+}
+
+static float GetVertexScore(int cachePosition, unsigned remainingTriangles)
+{
+    if (!remainingTriangles)
+        return -1.0f;
+
+    float score = 0.0f;
+    if (cachePosition >= 0)
+    {
+        if (cachePosition < 3)
+            score = LAST_TRIANGLE_SCORE;
+        else
+            score = powf(1.0f - (float)(cachePosition - 3) / (VERTEX_CACHE_SIZE - 3), CACHE_DECAY_POWER);
+    }
+
+    return score + VALENCE_BOOST_SCALE * powf((float)remainingTriangles, -VALENCE_BOOST_POWER);
+}
+
+static unsigned GetNumCacheMisses(const unsigned* indices, unsigned indexCount, unsigned vertexCount)
+{
+    // Simulate a FIFO cache by vertex timestamps
+    PODVector<unsigned> timestamps(vertexCount, 0);
+    unsigned time = VERTEX_CACHE_SIZE + 1;
+    unsigned misses = 0;
+
+    for (unsigned i = 0; i < indexCount; ++i)
+    {
+        unsigned v = indices[i];
+        if (time - timestamps[v] > VERTEX_CACHE_SIZE)
+        {
+            timestamps[v] = time++;
+            ++misses;
+        }
+    }
+
+    return misses;
+}
+
+float SimplifyMesh(PODVector<unsigned>& dest, const unsigned* indices, unsigned indexCount, const void* vertexData,
+    unsigned vertexSize, unsigned vertexCount, unsigned positionOffset, unsigned targetIndexCount, float maxError)
+{
+    dest.Resize(indexCount);
+    if (indexCount)
+        memcpy(&dest[0], indices, indexCount * sizeof(unsigned));
+    if (indexCount <= targetIndexCount || !vertexCount)
+        return 0.0f;
+
+    // Normalize the positions so that the error is relative to the mesh size
+    const unsigned char* vertices = (const unsigned char*)vertexData + positionOffset;
+    PODVector<Vector3> positions(vertexCount);
+    BoundingBox box;
+    for (unsigned i = 0; i < vertexCount; ++i)
+    {
+        positions[i] = *((const Vector3*)(vertices + i * vertexSize));
+        box.Merge(positions[i]);
+    }
+    Vector3 size = box.Size();
+    float scale = Max(size.x_, Max(size.y_, size.z_));
+    scale = scale > 0.0f ? 1.0f / scale : 1.0f;
+    for (unsigned i = 0; i < vertexCount; ++i)
+        positions[i] = (positions[i] - box.min_) * scale;
+
+    // Find the vertices sharing a position. They are seams in the vertex attributes and are kept in place, as are vertices
+    // on open borders
+    PODVector<unsigned> sorted(vertexCount);
+    for (unsigned i = 0; i < vertexCount; ++i)
+        sorted[i] = i;
+    Sort(sorted.Begin(), sorted.End(), PositionCompare(positions));
+
+    PODVector<unsigned> canonical(vertexCount);
+    PODVector<unsigned char> locked(vertexCount, 0);
+    for (unsigned i = 0; i < vertexCount;)
+    {
+        unsigned j = i + 1;
+        while (j < vertexCount && positions[sorted[j]] == positions[sorted[i]])
+            ++j;
+        for (unsigned k = i; k < j; ++k)
+        {
+            canonical[sorted[k]] = sorted[i];
+            locked[sorted[k]] = (unsigned char)(j - i > 1);
+        }
+        i = j;
+    }
+
+    PODVector<unsigned> canonicalIndices(indexCount);
+    for (unsigned i = 0; i < indexCount; ++i)
+        canonicalIndices[i] = canonical[indices[i]];
+
+    PODVector<unsigned> offsets;
+    PODVector<unsigned> adjacency;
+    BuildTriangleAdjacency(offsets, adjacency, &canonicalIndices[0], indexCount, vertexCount);
+
+    for (unsigned i = 0; i < indexCount; ++i)
+    {
+        // An edge is on an open border if only one triangle uses it
+        unsigned v0 = canonicalIndices[i];
+        unsigned v1 = canonicalIndices[i - i % 3 + (i + 1) % 3];
+        unsigned edgeTriangles = 0;
+        for (unsigned j = offsets[v0]; j < offsets[v0 + 1]; ++j)
+        {
+            unsigned t = adjacency[j] * 3;
+            if (canonicalIndices[t] == v1 || canonicalIndices[t + 1] == v1 || canonicalIndices[t + 2] == v1)
+                ++edgeTriangles;
+        }
+        if (edgeTriangles < 2)
+            locked[v0] = locked[v1] = 1;
+    }
+
+    // Accumulate the triangle planes to the vertex positions
+    Vector<Quadric> quadrics(vertexCount);
+    for (unsigned i = 0; i < indexCount; i += 3)
+    {
+        Quadric quadric;
+        quadric.AddTriangle(positions[indices[i]], positions[indices[i + 1]], positions[indices[i + 2]]);
+        quadrics[canonicalIndices[i]] += quadric;
+        quadrics[canonicalIndices[i + 1]] += quadric;
+        quadrics[canonicalIndices[i + 2]] += quadric;
+    }
+
+    float maxErrorSquared = maxError * maxError;
+    float resultError = 0.0f;
+    PODVector<EdgeCollapse> collapses;
+    PODVector<unsigned> remap(vertexCount);
+    PODVector<unsigned char> touched(vertexCount);
+
+    while (indexCount > targetIndexCount)
+    {
+        BuildTriangleAdjacency(offsets, adjacency, &dest[0], indexCount, vertexCount);
+
+        // Find the collapse candidates of the current triangles, cheapest first
+        collapses.Clear();
+        for (unsigned i = 0; i < indexCount; ++i)
+        {
+            unsigned v0 = dest[i];
+            unsigned v1 = dest[i - i % 3 + (i + 1) % 3];
+
+            for (unsigned j = 0; j < 2; ++j)
+            {
+                EdgeCollapse collapse;
+                collapse.from_ = j ? v1 : v0;
+                collapse.to_ = j ? v0 : v1;
+                if (locked[collapse.from_])
+                    continue;
+
+                const Quadric& q0 = quadrics[canonical[collapse.from_]];
+                const Quadric& q1 = quadrics[canonical[collapse.to_]];
+                const Vector3& position = positions[collapse.to_];
+                float weight = q0.weight_ + q1.weight_;
+                collapse.error_ = weight > 0.0f ? (q0.Evaluate(position) + q1.Evaluate(position)) / weight : 0.0f;
+                if (collapse.error_ <= maxErrorSquared)
+                    collapses.Push(collapse);
+            }
+        }
+        Sort(collapses.Begin(), collapses.End(), CompareEdgeCollapses);
+
+        // Apply the collapses that do not share vertices with each other during this pass
+        for (unsigned i = 0; i < vertexCount; ++i)
+        {
+            remap[i] = i;
+            touched[i] = 0;
+        }
+
+        unsigned triangleBudget = (indexCount - targetIndexCount + 2) / 3;
+        unsigned removedTriangles = 0;
+        unsigned numCollapses = 0;
+
+        for (unsigned i = 0; i < collapses.Size() && removedTriangles < triangleBudget; ++i)
+        {
+            const EdgeCollapse& collapse = collapses[i];
+            unsigned from = collapse.from_;
+            unsigned to = collapse.to_;
+            if (touched[from] || touched[to])
+                continue;
+
+            // Reject the collapse if any remaining triangle would flip or degenerate
+            bool flips = false;
+            for (unsigned j = offsets[from]; j < offsets[from + 1] && !flips; ++j)
+            {
+                unsigned t = adjacency[j] * 3;
+                if (dest[t] == to || dest[t + 1] == to || dest[t + 2] == to)
+                    continue;
+
+                unsigned k = dest[t] == from ? 0 : (dest[t + 1] == from ? 1 : 2);
+                const Vector3& p1 = positions[dest[t + (k + 1) % 3]];
+                const Vector3& p2 = positions[dest[t + (k + 2) % 3]];
+                Vector3 oldNormal = (p1 - positions[from]).CrossProduct(p2 - positions[from]);
+                Vector3 newNormal = (p1 - positions[to]).CrossProduct(p2 - positions[to]);
+                float oldLength = oldNormal.Length();
+                if (oldLength > 0.0f && oldNormal.DotProduct(newNormal) <= MIN_NORMAL_DOT * oldLength * newNormal.Length())
+                    flips = true;
+            }
+            if (flips)
+                continue;
+
+            remap[from] = to;
+            quadrics[canonical[to]] += quadrics[canonical[from]];
+            resultError = Max(resultError, collapse.error_);
+            ++numCollapses;
+
+            for (unsigned j = offsets[from]; j < offsets[from + 1]; ++j)
+            {
+                unsigned t = adjacency[j] * 3;
+                if (dest[t] == to || dest[t + 1] == to || dest[t + 2] == to)
+                    ++removedTriangles;
+                touched[dest[t]] = touched[dest[t + 1]] = touched[dest[t + 2]] = 1;
+            }
+        }
+
+        if (!numCollapses)
+            break;
+
+        // Remap the triangles and remove the degenerate ones
+        unsigned newIndexCount = 0;
+        for (unsigned i = 0; i < indexCount; i += 3)
+        {
+            unsigned v0 = remap[dest[i]];
+            unsigned v1 = remap[dest[i + 1]];
+            unsigned v2 = remap[dest[i + 2]];
+            if (v0 != v1 && v0 != v2 && v1 != v2)
+            {
+                dest[newIndexCount++] = v0;
+                dest[newIndexCount++] = v1;
+                dest[newIndexCount++] = v2;
+            }
+        }
+        indexCount = newIndexCount;
+    }
+
+    dest.Resize(indexCount);
+    return sqrtf(resultError);
+}
+
+void OptimizeVertexCache(unsigned* indices, unsigned indexCount, unsigned vertexCount)
+{
+    // Linear-speed vertex cache optimization from
+    // https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+    unsigned triangleCount = indexCount / 3;
+    if (triangleCount < 2)
+        return;
+
+    PODVector<unsigned> offsets;
+    PODVector<unsigned> adjacency;
+    BuildTriangleAdjacency(offsets, adjacency, indices, triangleCount * 3, vertexCount);
+
+    PODVector<unsigned> remaining(vertexCount);
+    PODVector<int> cachePositions(vertexCount, -1);
+    PODVector<float> vertexScores(vertexCount);
+    for (unsigned i = 0; i < vertexCount; ++i)
+    {
+        remaining[i] = offsets[i + 1] - offsets[i];
+        vertexScores[i] = GetVertexScore(-1, remaining[i]);
+    }
+
+    PODVector<float> triangleScores(triangleCount);
+    PODVector<unsigned char> emitted(triangleCount, 0);
+    unsigned bestTriangle = 0;
+    float bestScore = -M_INFINITY;
+    for (unsigned i = 0; i < triangleCount; ++i)
+    {
+        triangleScores[i] = vertexScores[indices[i * 3]] + vertexScores[indices[i * 3 + 1]] + vertexScores[indices[i * 3 + 2]];
+        if (triangleScores[i] > bestScore)
+        {
+            bestScore = triangleScores[i];
+            bestTriangle = i;
+        }
+    }
+
+    PODVector<unsigned> result(triangleCount * 3);
+    unsigned cache[VERTEX_CACHE_SIZE + 3];
+    unsigned newCache[VERTEX_CACHE_SIZE + 3];
+    unsigned cacheSize = 0;
+    unsigned nextTriangle = 0;
+
+    for (unsigned i = 0; i < triangleCount; ++i)
+    {
+        // When no triangle touches the cache, continue from the next unemitted triangle
+        if (bestTriangle == M_MAX_UNSIGNED)
+        {
+            while (emitted[nextTriangle])
+                ++nextTriangle;
+            bestTriangle = nextTriangle;
+        }
+
+        const unsigned* triangle = &indices[bestTriangle * 3];
+        result[i * 3] = triangle[0];
+        result[i * 3 + 1] = triangle[1];
+        result[i * 3 + 2] = triangle[2];
+        emitted[bestTriangle] = 1;
+
+        unsigned newCacheSize = 0;
+        for (unsigned j = 0; j < 3; ++j)
+        {
+            unsigned v = triangle[j];
+            newCache[newCacheSize++] = v;
+
+            // Remove the emitted triangle from the vertex's remaining triangles
+            unsigned* begin = &adjacency[offsets[v]];
+            for (unsigned k = 0; k < remaining[v]; ++k)
+            {
+                if (begin[k] == bestTriangle)
+                {
+                    begin[k] = begin[remaining[v] - 1];
+                    break;
+                }
+            }
+            --remaining[v];
+        }
+
+        for (unsigned j = 0; j < cacheSize; ++j)
+        {
+            unsigned v = cache[j];
+            if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+                newCache[newCacheSize++] = v;
+        }
+
+        // Update the scores of the vertices in the cache, including those just evicted
+        for (unsigned j = 0; j < newCacheSize; ++j)
+        {
+            unsigned v = newCache[j];
+            cachePositions[v] = j < VERTEX_CACHE_SIZE ? (int)j : -1;
+            vertexScores[v] = GetVertexScore(cachePositions[v], remaining[v]);
+        }
+
+        bestTriangle = M_MAX_UNSIGNED;
+        bestScore = -M_INFINITY;
+        for (unsigned j = 0; j < newCacheSize; ++j)
+        {
+            unsigned v = newCache[j];
+            for (unsigned k = offsets[v]; k < offsets[v] + remaining[v]; ++k)
+            {
+                unsigned t = adjacency[k];
+                float score = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+                triangleScores[t] = score;
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    bestTriangle = t;
+                }
+            }
+        }
+
+        cacheSize = Min(newCacheSize, VERTEX_CACHE_SIZE);
+        for (unsigned j = 0; j < cacheSize; ++j)
+            cache[j] = newCache[j];
+    }
+
+    memcpy(indices, &result[0], triangleCount * 3 * sizeof(unsigned));
+}
+
+void OptimizeOverdraw(unsigned* indices, unsigned indexCount, const void* vertexData, unsigned vertexSize,
+    unsigned vertexCount, unsigned positionOffset, float threshold)
+{
+    // Cluster sorting approach from Sander et al., Fast Triangle Reordering for Vertex Locality and Reduced Overdraw
+    unsigned triangleCount = indexCount / 3;
+    if (triangleCount < 2)
+        return;
+
+    const unsigned char* vertices = (const unsigned char*)vertexData + positionOffset;
+
+    // Split the triangles into clusters at the triangles that miss the cache on all vertices, so that the clusters can be
+    // reordered with little effect on the cache
+    PODVector<TriangleCluster> clusters;
+    PODVector<unsigned> timestamps(vertexCount, 0);
+    unsigned time = VERTEX_CACHE_SIZE + 1;
+    unsigned originalMisses = 0;
+
+    for (unsigned i = 0; i < triangleCount; ++i)
+    {
+        unsigned misses = 0;
+        for (unsigned j = 0; j < 3; ++j)
+        {
+            unsigned v = indices[i * 3 + j];
+            if (time - timestamps[v] > VERTEX_CACHE_SIZE)
+            {
+                timestamps[v] = time++;
+                ++misses;
+            }
+        }
+        originalMisses += misses;
+
+        if (!i || misses == 3)
+        {
+            TriangleCluster cluster;
+            cluster.start_ = i;
+            cluster.count_ = 0;
+            cluster.key_ = 0.0f;
+            clusters.Push(cluster);
+        }
+        ++clusters.Back().count_;
+    }
+
+    if (clusters.Size() < 2)
+        return;
+
+    // Sort the clusters facing away from the mesh center first, as they are likely to occlude the rest
+    Vector3 meshCenter = Vector3::ZERO;
+    float meshArea = 0.0f;
+    PODVector<Vector3> clusterCenters(clusters.Size());
+    PODVector<Vector3> clusterNormals(clusters.Size());
+
+    for (unsigned i = 0; i < clusters.Size(); ++i)
+    {
+        Vector3 center = Vector3::ZERO;
+        Vector3 normal = Vector3::ZERO;
+        float area = 0.0f;
+
+        for (unsigned j = clusters[i].start_; j < clusters[i].start_ + clusters[i].count_; ++j)
+        {
+            const Vector3& v0 = *((const Vector3*)(vertices + indices[j * 3] * vertexSize));
+            const Vector3& v1 = *((const Vector3*)(vertices + indices[j * 3 + 1] * vertexSize));
+            const Vector3& v2 = *((const Vector3*)(vertices + indices[j * 3 + 2] * vertexSize));
+            Vector3 triangleNormal = (v1 - v0).CrossProduct(v2 - v0);
+            float triangleArea = triangleNormal.Length();
+            center += (v0 + v1 + v2) * (triangleArea / 3.0f);
+            normal += triangleNormal;
+            area += triangleArea;
+        }
+
+        meshCenter += center;
+        meshArea += area;
+        clusterCenters[i] = area > 0.0f ? center / area : center;
+        clusterNormals[i] = normal.Normalized();
+    }
+
+    if (meshArea > 0.0f)
+        meshCenter /= meshArea;
+
+    for (unsigned i = 0; i < clusters.Size(); ++i)
+        clusters[i].key_ = (clusterCenters[i] - meshCenter).DotProduct(clusterNormals[i]);
+
+    Sort(clusters.Begin(), clusters.End(), CompareTriangleClusters);
+
+    PODVector<unsigned> result(triangleCount * 3);
+    unsigned destIndex = 0;
+    for (unsigned i = 0; i < clusters.Size(); ++i)
+    {
+        memcpy(&result[destIndex], &indices[clusters[i].start_ * 3], clusters[i].count_ * 3 * sizeof(unsigned));
+        destIndex += clusters[i].count_ * 3;
+    }
+
+    // Keep the original order if the vertex cache efficiency suffers too much
+    if (GetNumCacheMisses(&result[0], triangleCount * 3, vertexCount) > originalMisses * threshold)
+        return;
+
+    memcpy(indices, &result[0], triangleCount * 3 * sizeof(unsigned));
+}
+
+unsigned WeldVertices(PODVector<unsigned>& remap, const void* vertexData, unsigned vertexSize, unsigned vertexCount)
+{
+    const unsigned char* vertices = (const unsigned char*)vertexData;
+
+    // Sort the vertices by their data so that identical vertices become adjacent, lowest index first
+    PODVector<unsigned> sorted(vertexCount);
+    for (unsigned i = 0; i < vertexCount; ++i)
+        sorted[i] = i;
+    Sort(sorted.Begin(), sorted.End(), VertexDataCompare(vertices, vertexSize));
+
+    remap.Resize(vertexCount);
+    unsigned uniqueVertices = 0;
+    for (unsigned i = 0; i < vertexCount; ++i)
+    {
+        if (i && !memcmp(vertices + sorted[i] * vertexSize, vertices + sorted[i - 1] * vertexSize, vertexSize))
+            remap[sorted[i]] = remap[sorted[i - 1]];
+        else
+        {
+            remap[sorted[i]] = sorted[i];
+            ++uniqueVertices;
+        }
+    }
+
+    return uniqueVertices;
+}
+
+unsigned OptimizeVertexFetch(PODVector<unsigned>& remap, const unsigned* indices, unsigned indexCount, unsigned vertexCount)
+{
+    remap.Resize(vertexCount);
+    for (unsigned i = 0; i < vertexCount; ++i)
+        remap[i] = M_MAX_UNSIGNED;
+
+    unsigned usedVertices = 0;
+    for (unsigned i = 0; i < indexCount; ++i)
+    {
+        unsigned v = indices[i];
+        if (remap[v] == M_MAX_UNSIGNED)
+            remap[v] = usedVertices++;
+    }
+
+    return usedVertices;
+}
+
+void RemapIndices(unsigned* indices, unsigned indexCount, const PODVector<unsigned>& remap)
+{
+    for (unsigned i = 0; i < indexCount; ++i)
+        indices[i] = remap[indices[i]];
+}
+
+void RemapVertices(void* dest, const void* vertexData, unsigned vertexSize, unsigned vertexCount, const PODVector<unsigned>& remap)
+{
+    unsigned char* destVertices = (unsigned char*)dest;
+    const unsigned char* vertices = (const unsigned char*)vertexData;
+
+    for (unsigned i = 0; i < vertexCount; ++i)
+    {
+        if (remap[i] != M_MAX_UNSIGNED)
+            memcpy(destVertices + remap[i] * vertexSize, vertices + i * vertexSize, vertexSize);
+    }
+}
+
+float GetVertexCacheMissRatio(const unsigned* indices, unsigned indexCount, unsigned vertexCount)
+{
+    unsigned triangleCount = indexCount / 3;
+    return triangleCount ? (float)GetNumCacheMisses(indices, triangleCount * 3, vertexCount) / triangleCount : 0.0f;
+}
+
+}
@@ -0,0 +1,59 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#pragma once
+
+#ifdef URHO3D_IS_BUILDING
+#include "Urho3D.h"
+#else
+#include <Urho3D/Urho3D.h>
+#endif
+
+#include "../Container/Vector.h"
+
+namespace Urho3D
+{
+
+/// Simplify an indexed triangle list by quadric error edge collapses until the index count drops to the target or the error would exceed maxError. The error is relative to the mesh size. Vertices are not moved or added, so the result can share the original vertex buffer. Vertices on open borders and on attribute seams are kept in place. Return the resulting relative error.
+URHO3D_API float SimplifyMesh
+    (PODVector<unsigned>& dest, const unsigned* indices, unsigned indexCount, const void* vertexData, unsigned vertexSize,
+        unsigned vertexCount, unsigned positionOffset, unsigned targetIndexCount, float maxError);
+/// Reorder the triangles of an indexed triangle list for the post-transform vertex cache.
+URHO3D_API void OptimizeVertexCache(unsigned* indices, unsigned indexCount, unsigned vertexCount);
+/// Reorder the vertex cache optimized triangle clusters of an indexed triangle list front to back from the outside to reduce overdraw. The reordering is rejected if it raises the vertex cache miss ratio by more than the threshold factor.
+URHO3D_API void OptimizeOverdraw
+    (unsigned* indices, unsigned indexCount, const void* vertexData, unsigned vertexSize, unsigned vertexCount,
+        unsigned positionOffset, float threshold = 1.05f);
+/// Build a remap table that maps each vertex to the first vertex with identical data. Return the number of unique vertices.
+URHO3D_API unsigned WeldVertices(PODVector<unsigned>& remap, const void* vertexData, unsigned vertexSize, unsigned vertexCount);
+/// Build a remap table that orders the vertices by their first use in the index data. Unused vertices are remapped to M_MAX_UNSIGNED. Return the number of used vertices.
+URHO3D_API unsigned OptimizeVertexFetch(PODVector<unsigned>& remap, const unsigned* indices, unsigned indexCount, unsigned vertexCount);
+/// Remap the vertex indices of index data.
+URHO3D_API void RemapIndices(unsigned* indices, unsigned indexCount, const PODVector<unsigned>& remap);
+/// Copy vertex data to the remapped positions in the destination. Vertices remapped to M_MAX_UNSIGNED are dropped.
+URHO3D_API void RemapVertices
+    (void* dest, const void* vertexData, unsigned vertexSize, unsigned vertexCount, const PODVector<unsigned>& remap);
+/// Return the average number of post-transform vertex cache misses per triangle (ACMR) of an indexed triangle list. The ideal is 0.5 for large regular meshes, and 3 is the worst case.
+URHO3D_API float GetVertexCacheMissRatio(const unsigned* indices, unsigned indexCount, unsigned vertexCount);
+
+}
@@ -28,6 +28,7 @@
 #include "../Graphics/IndexBuffer.h"
 #include "../Graphics/Model.h"
 #include "../Graphics/Graphics.h"
+#include "../Graphics/MeshOptimization.h"
 #include "../Graphics/VertexBuffer.h"
 #include "../IO/Log.h"
 #include "../IO/File.h"
@@ -57,6 +58,52 @@ unsigned LookupIndexBuffer(IndexBuffer* buffer, const Vector<SharedPtr<IndexBuff
     return 0;
 }
 
+/// Index range of a model geometry.
+struct GeometryIndexRange
+{
+    /// Index buffer.
+    IndexBuffer* indexBuffer_;
+    /// Vertex buffer.
+    VertexBuffer* vertexBuffer_;
+    /// Primitive type.
+    PrimitiveType type_;
+    /// Index start.
+    unsigned indexStart_;
+    /// Index count.
+    unsigned indexCount_;
+};
+
+static void GetIndices(PODVector<unsigned>& dest, IndexBuffer* buffer, unsigned start, unsigned count)
+{
+    dest.Resize(count);
+    const unsigned char* data = buffer->GetShadowData();
+    if (buffer->GetIndexSize() == sizeof(unsigned))
+    {
+        const unsigned* indices = (const unsigned*)data + start;
+        for (unsigned i = 0; i < count; ++i)
+            dest[i] = indices[i];
+    }
+    else
+    {
+        const unsigned short* indices = (const unsigned short*)data + start;
+        for (unsigned i = 0; i < count; ++i)
+            dest[i] = indices[i];
+    }
+}
+
+static void SetIndices(IndexBuffer* buffer, unsigned start, unsigned count, const unsigned* src)
+{
+    if (buffer->GetIndexSize() == sizeof(unsigned))
+        buffer->SetDataRange(src, start, count);
+    else
+    {
+        PODVector<unsigned short> indices(count);
+        for (unsigned i = 0; i < count; ++i)
+            indices[i] = (unsigned short)src[i];
+        buffer->SetDataRange(&indices[0], start, count);
+    }
+}
+
 Model::Model(Context* context) :
     Resource(context)
 {
@@ -706,6 +753,169 @@ SharedPtr<Model> Model::Clone(const String& cloneName) const
     return ret;
 }
 
+bool Model::OptimizeGeometry(bool weldVertices)
+{
+    URHO3D_PROFILE(OptimizeModelGeometry);
+
+    // Collect the unique index ranges. Vertex buffers used without index data or together with other vertex buffers keep
+    // their vertex order
+    PODVector<GeometryIndexRange> ranges;
+    HashSet<VertexBuffer*> fixedBuffers;
+
+    for (unsigned i = 0; i < geometries_.Size(); ++i)
+    {
+        for (unsigned j = 0; j < geometries_[i].Size(); ++j)
+        {
+            Geometry* geometry = geometries_[i][j];
+            if (!geometry || !geometry->GetVertexBuffer(0))
+                continue;
+
+            IndexBuffer* indexBuffer = geometry->GetIndexBuffer();
+            bool indexed = indexBuffer && geometry->GetIndexCount();
+            for (unsigned k = 0; k < geometry->GetNumVertexBuffers(); ++k)
+            {
+                VertexBuffer* vertexBuffer = geometry->GetVertexBuffer(k);
+                if (!vertexBuffer)
+                    continue;
+                if (!vertexBuffer->GetShadowData())
+                {
+                    URHO3D_LOGERROR("Can not optimize model " + GetName() + " without vertex buffer shadow data");
+                    return false;
+                }
+                if (!indexed || geometry->GetNumVertexBuffers() > 1)
+                    fixedBuffers.Insert(vertexBuffer);
+            }
+
+            if (!indexed)
+                continue;
+            if (!indexBuffer->GetShadowData())
+            {
+                URHO3D_LOGERROR("Can not optimize model " + GetName() + " without index buffer shadow data");
+                return false;
+            }
+
+            GeometryIndexRange range;
+            range.indexBuffer_ = indexBuffer;
+            range.vertexBuffer_ = geometry->GetVertexBuffer(0);
+            range.type_ = geometry->GetPrimitiveType();
+            range.indexStart_ = geometry->GetIndexStart();
+            range.indexCount_ = geometry->GetIndexCount();
+
+            bool duplicate = false;
+            for (unsigned k = 0; k < ranges.Size(); ++k)
+            {
+                const GeometryIndexRange& other = ranges[k];
+                if (other.indexBuffer_ != range.indexBuffer_)
+                    continue;
+
+                if (other.indexStart_ == range.indexStart_ && other.indexCount_ == range.indexCount_)
+                {
+                    if (other.vertexBuffer_ != range.vertexBuffer_)
+                    {
+                        fixedBuffers.Insert(other.vertexBuffer_);
+                        fixedBuffers.Insert(range.vertexBuffer_);
+                    }
+                    duplicate = true;
+                    break;
+                }
+                else if (range.indexStart_ < other.indexStart_ + other.indexCount_ &&
+                    other.indexStart_ < range.indexStart_ + range.indexCount_)
+                {
+                    URHO3D_LOGERROR("Can not optimize model " + GetName() + " with partially overlapping index ranges");
+                    return false;
+                }
+            }
+
+            if (!duplicate)
+                ranges.Push(range);
+        }
+    }
+
+    // Reorder the triangles for the vertex cache
+    PODVector<unsigned> indices;
+    for (unsigned i = 0; i < ranges.Size(); ++i)
+    {
+        const GeometryIndexRange& range = ranges[i];
+        if (range.type_ != TRIANGLE_LIST)
+            continue;
+
+        GetIndices(indices, range.indexBuffer_, range.indexStart_, range.indexCount_);
+        OptimizeVertexCache(&indices[0], indices.Size(), range.vertexBuffer_->GetVertexCount());
+        SetIndices(range.indexBuffer_, range.indexStart_, range.indexCount_, &indices[0]);
+    }
+
+    // Welding would mix up the bone indices of geometries with different bone mappings
+    for (unsigned i = 0; i < geometryBoneMappings_.Size(); ++i)
+    {
+        if (!geometryBoneMappings_[i].Empty())
+            weldVertices = false;
+    }
+
+    // Weld the vertices and order them by first use. Unused vertices are removed
+    PODVector<unsigned> rangeIndices;
+    PODVector<unsigned> weldRemap;
+    PODVector<unsigned> fetchRemap;
+    for (unsigned i = 0; i < vertexBuffers_.Size(); ++i)
+    {
+        VertexBuffer* buffer = vertexBuffers_[i];
+        if (!buffer || fixedBuffers.Contains(buffer) || GetMorphRangeCount(i))
+            continue;
+
+        indices.Clear();
+        for (unsigned j = 0; j < ranges.Size(); ++j)
+        {
+            if (ranges[j].vertexBuffer_ == buffer)
+            {
+                GetIndices(rangeIndices, ranges[j].indexBuffer_, ranges[j].indexStart_, ranges[j].indexCount_);
+                indices.Push(rangeIndices);
+            }
+        }
+        if (indices.Empty())
+            continue;
+
+        unsigned vertexCount = buffer->GetVertexCount();
+        unsigned vertexSize = buffer->GetVertexSize();
+        const unsigned char* vertexData = buffer->GetShadowData();
+
+        if (weldVertices)
+        {
+            WeldVertices(weldRemap, vertexData, vertexSize, vertexCount);
+            RemapIndices(&indices[0], indices.Size(), weldRemap);
+        }
+        unsigned newVertexCount = OptimizeVertexFetch(fetchRemap, &indices[0], indices.Size(), vertexCount);
+        RemapIndices(&indices[0], indices.Size(), fetchRemap);
+
+        SharedArrayPtr<unsigned char> newVertexData(new unsigned char[newVertexCount * vertexSize]);
+        RemapVertices(newVertexData.Get(), vertexData, vertexSize, vertexCount, fetchRemap);
+        PODVector<VertexElement> elements = buffer->GetElements();
+        buffer->SetSize(newVertexCount, elements, buffer->IsDynamic());
+        buffer->SetData(newVertexData.Get());
+
+        unsigned offset = 0;
+        for (unsigned j = 0; j < ranges.Size(); ++j)
+        {
+            if (ranges[j].vertexBuffer_ == buffer)
+            {
+                SetIndices(ranges[j].indexBuffer_, ranges[j].indexStart_, ranges[j].indexCount_, &indices[offset]);
+                offset += ranges[j].indexCount_;
+            }
+        }
+    }
+
+    // Update the used vertex ranges
+    for (unsigned i = 0; i < geometries_.Size(); ++i)
+    {
+        for (unsigned j = 0; j < geometries_[i].Size(); ++j)
+        {
+            Geometry* geometry = geometries_[i][j];
+            if (geometry && geometry->GetIndexBuffer() && geometry->GetIndexCount())
+                geometry->SetDrawRange(geometry->GetPrimitiveType(), geometry->GetIndexStart(), geometry->GetIndexCount());
+        }
+    }
+
+    return true;
+}
+
 unsigned Model::GetNumGeometryLodLevels(unsigned index) const
 {
     return index < geometries_.Size() ? geometries_[index].Size() : 0;
@@ -753,4 +963,51 @@ unsigned Model::GetMorphRangeCount(unsigned bufferIndex) const
     return bufferIndex < vertexBuffers_.Size() ? morphRangeCounts_[bufferIndex] : 0;
 }
 
+float Model::GetVertexCacheMissRatio() const
+{
+    PODVector<GeometryIndexRange> ranges;
+    PODVector<unsigned> indices;
+    float misses = 0.0f;
+    unsigned triangles = 0;
+
+    for (unsigned i = 0; i < geometries_.Size(); ++i)
+    {
+        for (unsigned j = 0; j < geometries_[i].Size(); ++j)
+        {
+            Geometry* geometry = geometries_[i][j];
+            if (!geometry || geometry->GetPrimitiveType() != TRIANGLE_LIST || !geometry->GetIndexCount())
+                continue;
+            IndexBuffer* indexBuffer = geometry->GetIndexBuffer();
+            VertexBuffer* vertexBuffer = geometry->GetVertexBuffer(0);
+            if (!indexBuffer || !indexBuffer->GetShadowData() || !vertexBuffer)
+                continue;
+
+            // Count the index ranges shared by several geometries once
+            bool duplicate = false;
+            for (unsigned k = 0; k < ranges.Size() && !duplicate; ++k)
+            {
+                duplicate = ranges[k].indexBuffer_ == indexBuffer && ranges[k].indexStart_ == geometry->GetIndexStart() &&
+                    ranges[k].indexCount_ == geometry->GetIndexCount();
+            }
+            if (duplicate)
+                continue;
+
+            GeometryIndexRange range;
+            range.indexBuffer_ = indexBuffer;
+            range.vertexBuffer_ = vertexBuffer;
+            range.type_ = TRIANGLE_LIST;
+            range.indexStart_ = geometry->GetIndexStart();
+            range.indexCount_ = geometry->GetIndexCount();
+            ranges.Push(range);
+
+            GetIndices(indices, indexBuffer, range.indexStart_, range.indexCount_);
+            unsigned rangeTriangles = indices.Size() / 3;
+            misses += Urho3D::GetVertexCacheMissRatio(&indices[0], indices.Size(), vertexBuffer->GetVertexCount()) * rangeTriangles;
+            triangles += rangeTriangles;
+        }
+    }
+
+    return triangles ? misses / triangles : 0.0f;
+}
+
 }
@@ -147,6 +147,8 @@ public:
     void SetMorphs(const Vector<ModelMorph>& morphs);
     /// Clone the model. The geometry data is deep-copied and can be modified in the clone without affecting the original.
     SharedPtr<Model> Clone(const String& cloneName = String::EMPTY) const;
+    /// Reorder the triangles of the geometries for the post-transform vertex cache and the vertices for fetch locality, optionally welding identical vertices. Requires shadowed buffers. Vertex buffers with morphs or used without index data keep their vertex order. Return true if successful.
+    bool OptimizeGeometry(bool weldVertices = true);
 
     /// Return bounding box.
     const BoundingBox& GetBoundingBox() const { return boundingBox_; }
@@ -200,6 +202,8 @@ public:
     unsigned GetMorphRangeStart(unsigned bufferIndex) const;
     /// Return vertex buffer morph range vertex count.
     unsigned GetMorphRangeCount(unsigned bufferIndex) const;
+    /// Return the average post-transform vertex cache misses per triangle (ACMR) of the indexed triangle list geometries. Requires shadowed buffers.
+    float GetVertexCacheMissRatio() const;
 
 private:
     /// Bounding box.
@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#pragma once
+
+#include "../../Graphics/ConstantBuffer.h"
+#include "../../Graphics/GraphicsDefs.h"
+#include "../../Graphics/ShaderProgram.h"
+
+namespace Urho3D
+{
+
+/// Texture formats of the Null graphics backend.
+enum NullTextureFormat
+{
+    NULL_FORMAT_UNKNOWN = 0,
+    NULL_FORMAT_A8,
+    NULL_FORMAT_R8,
+    NULL_FORMAT_RG8,
+    NULL_FORMAT_RGBA8,
+    NULL_FORMAT_RGBA8_SRGB,
+    NULL_FORMAT_RG16,
+    NULL_FORMAT_RGBA16,
+    NULL_FORMAT_R16F,
+    NULL_FORMAT_RG16F,
+    NULL_FORMAT_RGBA16F,
+    NULL_FORMAT_R32F,
+    NULL_FORMAT_RG32F,
+    NULL_FORMAT_RGBA32F,
+    NULL_FORMAT_D16,
+    NULL_FORMAT_D24S8,
+    NULL_FORMAT_D32,
+    NULL_FORMAT_DXT1,
+    NULL_FORMAT_DXT1_SRGB,
+    NULL_FORMAT_DXT3,
+    NULL_FORMAT_DXT3_SRGB,
+    NULL_FORMAT_DXT5,
+    NULL_FORMAT_DXT5_SRGB
+};
+
+typedef HashMap<Pair<ShaderVariation*, ShaderVariation*>, SharedPtr<ShaderProgram> > ShaderProgramMap;
+typedef HashMap<unsigned, SharedPtr<ConstantBuffer> > ConstantBufferMap;
+
+/// %Graphics implementation. Holds the state of the Null backend, which has no device: buffer contents are kept in CPU memory and draw calls are only counted.
+class URHO3D_API GraphicsImpl
+{
+    friend class Graphics;
+
+public:
+    /// Construct.
+    GraphicsImpl();
+
+    /// Return a new unique object name for a device-less GPU object.
+    unsigned CreateObjectName() { return ++lastObjectName_; }
+
+    /// Add bytes written to vertex, index or constant buffers.
+    void AddUploadBytes(unsigned bytes) { uploadBytes_ += bytes; }
+
+    /// Return bytes written to vertex, index or constant buffers this frame.
+    unsigned GetUploadBytes() const { return uploadBytes_; }
+
+    /// Return number of shader parameter updates this frame.
+    unsigned GetNumParameterUpdates() const { return numParameterUpdates_; }
+
+    /// Return number of shader changes this frame.
+    unsigned GetNumShaderChanges() const { return numShaderChanges_; }
+
+    /// Return number of texture changes this frame.
+    unsigned GetNumTextureChanges() const { return numTextureChanges_; }
+
+    /// Return number of render state changes this frame.
+    unsigned GetNumStateChanges() const { return numStateChanges_; }
+
+private:
+    /// Reset the per-frame counters.
+    void ResetCounters();
+
+    /// Constant buffer search map.
+    ConstantBufferMap allConstantBuffers_;
+    /// Shader programs.
+    ShaderProgramMap shaderPrograms_;
+    /// Shader program in use.
+    ShaderProgram* shaderProgram_;
+    /// Whether a screen mode has been set.
+    bool initialized_;
+    /// Last assigned object name.
+    unsigned lastObjectName_;
+    /// Bytes written to buffers this frame.
+    unsigned uploadBytes_;
+    /// Shader parameter updates this frame.
+    unsigned numParameterUpdates_;
+    /// Shader changes this frame.
+    unsigned numShaderChanges_;
+    /// Texture changes this frame.
+    unsigned numTextureChanges_;
+    /// Render state changes this frame.
+    unsigned numStateChanges_;
+};
+
+}
@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "../../Precompiled.h"
+
+#include "../../Graphics/Graphics.h"
+#include "../../Graphics/GraphicsImpl.h"
+#include "../../Graphics/Shader.h"
+#include "../../Graphics/VertexBuffer.h"
+#include "../../IO/Log.h"
+
+#include "../../DebugNew.h"
+
+namespace Urho3D
+{
+
+const char* ShaderVariation::elementSemanticNames[] =
+{
+    "POSITION",
+    "NORMAL",
+    "BINORMAL",
+    "TANGENT",
+    "TEXCOORD",
+    "COLOR",
+    "BLENDWEIGHT",
+    "BLENDINDICES",
+    "OBJECTINDEX"
+};
+
+void ShaderVariation::OnDeviceLost()
+{
+    // No-op on Null graphics
+}
+
+bool ShaderVariation::Create()
+{
+    // The parameters may have been collected on a worker thread already
+    if (object_.name_ || parameters_.Empty())
+    {
+        Release();
+
+        if (!Prepare())
+            return false;
+    }
+
+    object_.name_ = graphics_->GetImpl()->CreateObjectName();
+
+    if (type_ == VS)
+        URHO3D_LOGDEBUG("Created null vertex shader " + GetFullName());
+    else
+        URHO3D_LOGDEBUG("Created null pixel shader " + GetFullName());
+
+    return true;
+}
+
+bool ShaderVariation::Prepare()
+{
+    if (!graphics_)
+        return false;
+
+    if (!owner_)
+    {
+        compilerOutput_ = "Owner shader has expired";
+        return false;
+    }
+
+    // There is no shader compiler, so collect the uniforms and samplers declared in the HLSL source instead. The source is not
+    // preprocessed, so the result is a superset of what a compiled variation would use
+    const String& sourceCode = owner_->GetSourceCode(type_);
+    Vector<String> lines = sourceCode.Split('\n');
+    for (unsigned i = 0; i < lines.Size(); ++i)
+    {
+        String line = lines[i].Trimmed();
+
+        if (line.StartsWith("uniform "))
+        {
+            // uniform <type> c<Name>[<size>];
+            Vector<String> tokens = line.Split(' ');
+            if (tokens.Size() < 3)
+                continue;
+            String varName = tokens[2];
+            for (unsigned j = 0; j < varName.Length(); ++j)
+            {
+                if (varName[j] == '[' || varName[j] == ';' || varName[j] == ':')
+                {
+                    varName.Resize(j);
+                    break;
+                }
+            }
+            if (varName.Length() < 2 || varName[0] != 'c')
+                continue;
+            varName = varName.Substring(1);
+
+            ShaderParameter parameter;
+            parameter.type_ = type_;
+            parameter.name_ = varName;
+            parameters_[StringHash(varName)] = parameter;
+        }
+        else if (line.StartsWith("sampler"))
+        {
+            // sampler2D s<Name> : register(s<index>);
+            unsigned regPos = line.Find("register(s");
+            if (regPos == String::NPOS)
+                continue;
+            unsigned reg = ToUInt(line.Substring(regPos + 10));
+            if (reg < MAX_TEXTURE_UNITS)
+                useTextureUnit_[reg] = true;
+        }
+    }
+
+    return true;
+}
+
+void ShaderVariation::Release()
+{
+    if (object_.name_)
+    {
+        if (!graphics_)
+            return;
+
+        graphics_->CleanupShaderPrograms(this);
+
+        if (type_ == VS)
+        {
+            if (graphics_->GetVertexShader() == this)
+                graphics_->SetShaders(0, 0);
+        }
+        else
+        {
+            if (graphics_->GetPixelShader() == this)
+                graphics_->SetShaders(0, 0);
+        }
+
+        object_.ptr_ = 0;
+    }
+
+    compilerOutput_.Clear();
+
+    for (unsigned i = 0; i < MAX_TEXTURE_UNITS; ++i)
+        useTextureUnit_[i] = false;
+    for (unsigned i = 0; i < MAX_SHADER_PARAMETER_GROUPS; ++i)
+        constantBufferSizes_[i] = 0;
+    parameters_.Clear();
+    byteCode_.Clear();
+    elementHash_ = 0;
+}
+
+void ShaderVariation::SetDefines(const String& defines)
+{
+    defines_ = defines;
+
+    // Internal mechanism for appending the CLIPPLANE define, prevents runtime (every frame) string manipulation
+    definesClipPlane_ = defines;
+    if (!definesClipPlane_.EndsWith(" CLIPPLANE"))
+        definesClipPlane_ += " CLIPPLANE";
+}
+
+}
@@ -0,0 +1,136 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "../../Precompiled.h"
+
+#include "../../Graphics/Graphics.h"
+#include "../../Graphics/GraphicsImpl.h"
+#include "../../Graphics/Material.h"
+#include "../../IO/Log.h"
+
+#include "../../DebugNew.h"
+
+namespace Urho3D
+{
+
+void Texture::SetSRGB(bool enable)
+{
+    if (graphics_)
+        enable &= graphics_->GetSRGBSupport();
+
+    if (enable != sRGB_)
+    {
+        sRGB_ = enable;
+        // If texture had already been created, must recreate it to set the sRGB texture format
+        if (object_.name_)
+            Create();
+    }
+}
+
+bool Texture::GetParametersDirty() const
+{
+    return parametersDirty_;
+}
+
+bool Texture::IsCompressed() const
+{
+    return format_ == NULL_FORMAT_DXT1 || format_ == NULL_FORMAT_DXT1_SRGB || format_ == NULL_FORMAT_DXT3 ||
+        format_ == NULL_FORMAT_DXT3_SRGB || format_ == NULL_FORMAT_DXT5 || format_ == NULL_FORMAT_DXT5_SRGB;
+}
+
+unsigned Texture::GetRowDataSize(int width) const
+{
+    switch (format_)
+    {
+    case NULL_FORMAT_A8:
+    case NULL_FORMAT_R8:
+        return (unsigned)width;
+
+    case NULL_FORMAT_RG8:
+    case NULL_FORMAT_R16F:
+    case NULL_FORMAT_D16:
+        return (unsigned)(width * 2);
+
+    case NULL_FORMAT_RGBA8:
+    case NULL_FORMAT_RGBA8_SRGB:
+    case NULL_FORMAT_RG16:
+    case NULL_FORMAT_RG16F:
+    case NULL_FORMAT_R32F:
+    case NULL_FORMAT_D24S8:
+    case NULL_FORMAT_D32:
+        return (unsigned)(width * 4);
+
+    case NULL_FORMAT_RGBA16:
+    case NULL_FORMAT_RGBA16F:
+    case NULL_FORMAT_RG32F:
+        return (unsigned)(width * 8);
+
+    case NULL_FORMAT_RGBA32F:
+        return (unsigned)(width * 16);
+
+    case NULL_FORMAT_DXT1:
+    case NULL_FORMAT_DXT1_SRGB:
+        return (unsigned)(((width + 3) >> 2) * 8);
+
+    case NULL_FORMAT_DXT3:
+    case NULL_FORMAT_DXT3_SRGB:
+    case NULL_FORMAT_DXT5:
+    case NULL_FORMAT_DXT5_SRGB:
+        return (unsigned)(((width + 3) >> 2) * 16);
+
+    default:
+        return 0;
+    }
+}
+
+void Texture::UpdateParameters()
+{
+    // There is no sampler state to create
+    parametersDirty_ = false;
+}
+
+unsigned Texture::GetSRVFormat(unsigned format)
+{
+    return format;
+}
+
+unsigned Texture::GetDSVFormat(unsigned format)
+{
+    return format;
+}
+
+unsigned Texture::GetSRGBFormat(unsigned format)
+{
+    if (format == NULL_FORMAT_RGBA8)
+        return NULL_FORMAT_RGBA8_SRGB;
+    else if (format == NULL_FORMAT_DXT1)
+        return NULL_FORMAT_DXT1_SRGB;
+    else if (format == NULL_FORMAT_DXT3)
+        return NULL_FORMAT_DXT3_SRGB;
+    else if (format == NULL_FORMAT_DXT5)
+        return NULL_FORMAT_DXT5_SRGB;
+    else
+        return format;
+}
+
+}
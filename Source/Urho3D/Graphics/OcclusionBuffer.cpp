@@ -28,6 +28,10 @@
 #include "../Graphics/OcclusionBuffer.h"
 #include "../IO/Log.h"
 
+#ifdef URHO3D_SSE
+#include <emmintrin.h>
+#endif
+
 #include "../DebugNew.h"
 
 namespace Urho3D
@@ -39,6 +43,7 @@ static const unsigned CLIPMASK_Y_POS = 0x4;
 static const unsigned CLIPMASK_Y_NEG = 0x8;
 static const unsigned CLIPMASK_Z_POS = 0x10;
 static const unsigned CLIPMASK_Z_NEG = 0x20;
+static const int OCCLUSION_TILE_HEIGHT = 16;
 
 void DrawOcclusionBatchWork(const WorkItem* item, unsigned threadIndex)
 {
@@ -47,10 +52,41 @@ void DrawOcclusionBatchWork(const WorkItem* item, unsigned threadIndex)
     buffer->DrawBatch(batch, threadIndex);
 }
 
+void DrawOcclusionTilesWork(const WorkItem* item, unsigned threadIndex)
+{
+    OcclusionBuffer* buffer = reinterpret_cast<OcclusionBuffer*>(item->aux_);
+    int* start = reinterpret_cast<int*>(item->start_);
+    int* end = reinterpret_cast<int*>(item->end_);
+    int width = buffer->GetWidth();
+    int top = (int)(start - buffer->GetBuffer()) / width;
+    buffer->DrawTiles(top, top + (int)(end - start) / width);
+}
+
+/// Write the closer of the interpolated and existing depth values along a span of a row. The span is clipped to the row so that rows in different tiles can be rasterized concurrently. The loop is branchless so that the compiler can vectorize it for the target instruction set.
+static inline void DrawSpan(int* row, int left, int right, int width, int invZ, int dInvZdX)
+{
+    if (left < 0)
+    {
+        invZ -= left * dInvZdX;
+        left = 0;
+    }
+    if (right > width)
+        right = width;
+
+    for (int x = left; x < right; ++x)
+    {
+        int depth = row[x];
+        row[x] = invZ < depth ? invZ : depth;
+        invZ += dInvZdX;
+    }
+}
+
 OcclusionBuffer::OcclusionBuffer(Context* context) :
     Object(context),
+    data_(0),
     width_(0),
     height_(0),
+    numTiles_(0),
     numTriangles_(0),
     maxTriangles_(OCCLUSION_DEFAULT_MAX_TRIANGLES),
     cullMode_(CULL_CCW),
@@ -85,17 +121,20 @@ bool OcclusionBuffer::SetSize(int width, int height, bool threaded)
 
     width_ = width;
     height_ = height;
+    numTiles_ = (height + OCCLUSION_TILE_HEIGHT - 1) / OCCLUSION_TILE_HEIGHT;
+
+    // Reserve extra memory in case 3D clipping is not exact
+    dataWithSafety_ = new int[width * (height + 2) + 2];
+    data_ = dataWithSafety_.Get() + width + 1;
 
-    // Build work buffers for threading
-    unsigned numThreadBuffers = threaded ? GetSubsystem<WorkQueue>()->GetNumThreads() + 1 : 1;
-    buffers_.Resize(numThreadBuffers);
-    for (unsigned i = 0; i < numThreadBuffers; ++i)
+    // Build triangle setup data for threading
+    unsigned numThreads = threaded ? GetSubsystem<WorkQueue>()->GetNumThreads() : 0;
+    threadData_.Clear();
+    if (numThreads)
     {
-        // Reserve extra memory in case 3D clipping is not exact
-        OcclusionBufferData& buffer = buffers_[i];
-        buffer.dataWithSafety_ = new int[width * (height + 2) + 2];
-        buffer.data_ = buffer.dataWithSafety_.Get() + width + 1;
-        buffer.used_ = false;
+        threadData_.Resize(numThreads + 1); // Worker threads + main thread
+        for (unsigned i = 0; i < threadData_.Size(); ++i)
+            threadData_[i].bins_.Resize((unsigned)numTiles_);
     }
 
     mipBuffers_.Clear();
@@ -113,7 +152,8 @@ bool OcclusionBuffer::SetSize(int width, int height, bool threaded)
     }
 
     URHO3D_LOGDEBUG("Set occlusion buffer size " + String(width_) + "x" + String(height_) + " with " +
-             String(mipBuffers_.Size()) + " mip levels and " + String(numThreadBuffers) + " thread buffers");
+             String(mipBuffers_.Size()) + " mip levels and " + String(numTiles_) + (threadData_.Size() ? " threaded" : "") +
+             " tiles");
 
     CalculateViewport();
     return true;
@@ -160,11 +200,7 @@ void OcclusionBuffer::Clear()
 {
     Reset();
 
-    // Only clear the main thread buffer. Rest are cleared on-demand when drawing the first batch
-    ClearBuffer(0);
-    for (unsigned i = 1; i < buffers_.Size(); ++i)
-        buffers_[i].used_ = false;
-
+    ClearBuffer();
     depthHierarchyDirty_ = true;
 }
 
@@ -206,7 +242,10 @@ bool OcclusionBuffer::AddTriangles(const Matrix3x4& model, const void* vertexDat
 
 void OcclusionBuffer::DrawTriangles()
 {
-    if (buffers_.Size() == 1)
+    if (!data_)
+        return;
+
+    if (threadData_.Empty())
     {
         // Not threaded
         for (Vector<OcclusionBatch>::Iterator i = batches_.Begin(); i != batches_.End(); ++i)
@@ -214,11 +253,19 @@ void OcclusionBuffer::DrawTriangles()
 
         depthHierarchyDirty_ = true;
     }
-    else if (buffers_.Size() > 1)
+    else
     {
-        // Threaded
+        // Threaded. First transform, clip and bin the triangles to tiles
         WorkQueue* queue = GetSubsystem<WorkQueue>();
 
+        for (Vector<OcclusionThreadData>::Iterator i = threadData_.Begin(); i != threadData_.End(); ++i)
+        {
+            i->triangles_.Clear();
+            for (unsigned j = 0; j < i->bins_.Size(); ++j)
+                i->bins_[j].Clear();
+            i->numTriangles_ = 0;
+        }
+
         for (Vector<OcclusionBatch>::Iterator i = batches_.Begin(); i != batches_.End(); ++i)
         {
             SharedPtr<WorkItem> item = queue->GetFreeItem();
@@ -231,7 +278,22 @@ void OcclusionBuffer::DrawTriangles()
 
         queue->Complete(M_MAX_UNSIGNED);
 
-        MergeBuffers();
+        // Then rasterize the tiles. As they do not overlap, they can be written to the same buffer
+        for (int i = 0; i < numTiles_; ++i)
+        {
+            SharedPtr<WorkItem> item = queue->GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = DrawOcclusionTilesWork;
+            item->aux_ = this;
+            item->start_ = data_ + i * OCCLUSION_TILE_HEIGHT * width_;
+            item->end_ = data_ + Min((i + 1) * OCCLUSION_TILE_HEIGHT, height_) * width_;
+            queue->AddWorkItem(item);
+        }
+
+        queue->Complete(M_MAX_UNSIGNED);
+
+        for (Vector<OcclusionThreadData>::ConstIterator i = threadData_.Begin(); i != threadData_.End(); ++i)
+            numTriangles_ += i->numTriangles_;
         depthHierarchyDirty_ = true;
     }
 
@@ -240,7 +302,7 @@ void OcclusionBuffer::DrawTriangles()
 
 void OcclusionBuffer::BuildDepthHierarchy()
 {
-    if (buffers_.Empty() || !depthHierarchyDirty_)
+    if (!data_ || !depthHierarchyDirty_)
         return;
 
     URHO3D_PROFILE(BuildDepthHierarchy);
@@ -252,7 +314,7 @@ void OcclusionBuffer::BuildDepthHierarchy()
     {
         for (int y = 0; y < height; ++y)
         {
-            int* src = buffers_[0].data_ + (y * 2) * width_;
+            int* src = data_ + (y * 2) * width_;
             DepthValue* dest = mipBuffers_[0].Get() + y * width;
             DepthValue* end = dest + width;
 
@@ -342,10 +404,71 @@ void OcclusionBuffer::ResetUseTimer()
 
 bool OcclusionBuffer::IsVisible(const BoundingBox& worldSpaceBox) const
 {
-    if (buffers_.Empty())
+    if (!data_)
         return true;
 
-    // Transform corners to projection space
+    // Transform corners to projection space, apply a far clip relative bias and transform to screen space. If any of the
+    // corners cross the near plane, assume visible
+    float minX, maxX, minY, maxY, minZ;
+
+#ifdef URHO3D_SSE
+    // Transform the corners four at a time, first the ones at minimum Z, then at maximum Z
+    const Vector3& boxMin = worldSpaceBox.min_;
+    const Vector3& boxMax = worldSpaceBox.max_;
+    __m128 cornerX = _mm_set_ps(boxMax.x_, boxMin.x_, boxMax.x_, boxMin.x_);
+    __m128 cornerY = _mm_set_ps(boxMax.y_, boxMax.y_, boxMin.y_, boxMin.y_);
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 minXVec = _mm_set1_ps(M_INFINITY);
+    __m128 maxXVec = _mm_set1_ps(-M_INFINITY);
+    __m128 minYVec = minXVec;
+    __m128 maxYVec = maxXVec;
+    __m128 minZVec = minXVec;
+
+    for (unsigned i = 0; i < 2; ++i)
+    {
+        __m128 cornerZ = _mm_set1_ps(i ? boxMax.z_ : boxMin.z_);
+        __m128 x = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(viewProj_.m00_), cornerX),
+            _mm_mul_ps(_mm_set1_ps(viewProj_.m01_), cornerY)), _mm_mul_ps(_mm_set1_ps(viewProj_.m02_), cornerZ)),
+            _mm_set1_ps(viewProj_.m03_));
+        __m128 y = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(viewProj_.m10_), cornerX),
+            _mm_mul_ps(_mm_set1_ps(viewProj_.m11_), cornerY)), _mm_mul_ps(_mm_set1_ps(viewProj_.m12_), cornerZ)),
+            _mm_set1_ps(viewProj_.m13_));
+        __m128 z = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(viewProj_.m20_), cornerX),
+            _mm_mul_ps(_mm_set1_ps(viewProj_.m21_), cornerY)), _mm_mul_ps(_mm_set1_ps(viewProj_.m22_), cornerZ)),
+            _mm_set1_ps(viewProj_.m23_));
+        __m128 w = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(viewProj_.m30_), cornerX),
+            _mm_mul_ps(_mm_set1_ps(viewProj_.m31_), cornerY)), _mm_mul_ps(_mm_set1_ps(viewProj_.m32_), cornerZ)),
+            _mm_set1_ps(viewProj_.m33_));
+
+        z = _mm_sub_ps(z, _mm_set1_ps(OCCLUSION_RELATIVE_BIAS));
+        if (_mm_movemask_ps(_mm_cmple_ps(z, zero)))
+            return true;
+
+        __m128 invW = _mm_div_ps(one, w);
+        x = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(invW, x), _mm_set1_ps(scaleX_)), _mm_set1_ps(offsetX_));
+        y = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(invW, y), _mm_set1_ps(scaleY_)), _mm_set1_ps(offsetY_));
+        z = _mm_mul_ps(_mm_mul_ps(invW, z), _mm_set1_ps(OCCLUSION_Z_SCALE));
+
+        minXVec = _mm_min_ps(minXVec, x);
+        maxXVec = _mm_max_ps(maxXVec, x);
+        minYVec = _mm_min_ps(minYVec, y);
+        maxYVec = _mm_max_ps(maxYVec, y);
+        minZVec = _mm_min_ps(minZVec, z);
+    }
+
+    // Reduce the four lanes
+    minXVec = _mm_min_ps(minXVec, _mm_shuffle_ps(minXVec, minXVec, _MM_SHUFFLE(1, 0, 3, 2)));
+    maxXVec = _mm_max_ps(maxXVec, _mm_shuffle_ps(maxXVec, maxXVec, _MM_SHUFFLE(1, 0, 3, 2)));
+    minYVec = _mm_min_ps(minYVec, _mm_shuffle_ps(minYVec, minYVec, _MM_SHUFFLE(1, 0, 3, 2)));
+    maxYVec = _mm_max_ps(maxYVec, _mm_shuffle_ps(maxYVec, maxYVec, _MM_SHUFFLE(1, 0, 3, 2)));
+    minZVec = _mm_min_ps(minZVec, _mm_shuffle_ps(minZVec, minZVec, _MM_SHUFFLE(1, 0, 3, 2)));
+    minX = _mm_cvtss_f32(_mm_min_ss(minXVec, _mm_shuffle_ps(minXVec, minXVec, _MM_SHUFFLE(0, 0, 0, 1))));
+    maxX = _mm_cvtss_f32(_mm_max_ss(maxXVec, _mm_shuffle_ps(maxXVec, maxXVec, _MM_SHUFFLE(0, 0, 0, 1))));
+    minY = _mm_cvtss_f32(_mm_min_ss(minYVec, _mm_shuffle_ps(minYVec, minYVec, _MM_SHUFFLE(0, 0, 0, 1))));
+    maxY = _mm_cvtss_f32(_mm_max_ss(maxYVec, _mm_shuffle_ps(maxYVec, maxYVec, _MM_SHUFFLE(0, 0, 0, 1))));
+    minZ = _mm_cvtss_f32(_mm_min_ss(minZVec, _mm_shuffle_ps(minZVec, minZVec, _MM_SHUFFLE(0, 0, 0, 1))));
+#else
     Vector4 vertices[8];
     vertices[0] = ModelTransform(viewProj_, worldSpaceBox.min_);
     vertices[1] = ModelTransform(viewProj_, Vector3(worldSpaceBox.max_.x_, worldSpaceBox.min_.y_, worldSpaceBox.min_.z_));
@@ -356,13 +479,9 @@ bool OcclusionBuffer::IsVisible(const BoundingBox& worldSpaceBox) const
     vertices[6] = ModelTransform(viewProj_, Vector3(worldSpaceBox.min_.x_, worldSpaceBox.max_.y_, worldSpaceBox.max_.z_));
     vertices[7] = ModelTransform(viewProj_, worldSpaceBox.max_);
 
-    // Apply a far clip relative bias
     for (unsigned i = 0; i < 8; ++i)
         vertices[i].z_ -= OCCLUSION_RELATIVE_BIAS;
 
-    // Transform to screen space. If any of the corners cross the near plane, assume visible
-    float minX, maxX, minY, maxY, minZ;
-
     if (vertices[0].z_ <= 0.0f)
         return true;
 
@@ -385,6 +504,7 @@ bool OcclusionBuffer::IsVisible(const BoundingBox& worldSpaceBox) const
         if (projected.y_ > maxY) maxY = projected.y_;
         if (projected.z_ < minZ) minZ = projected.z_;
     }
+#endif
 
     // Expand the bounding box 1 pixel in each direction to be conservative and correct rasterization offset
     IntRect rect(
@@ -411,6 +531,11 @@ bool OcclusionBuffer::IsVisible(const BoundingBox& worldSpaceBox) const
     // Convert depth to integer and apply final bias
     int z = (int)(minZ + 0.5f) - OCCLUSION_FIXED_BIAS;
 
+#ifdef URHO3D_SSE
+    // Compare against z - 1 to test for z <= depth with a greater than comparison
+    __m128i zVec = _mm_set1_epi32(z - 1);
+#endif
+
     if (!depthHierarchyDirty_)
     {
         // Start from lowest mip level and check if a conclusive result can be found
@@ -430,6 +555,19 @@ bool OcclusionBuffer::IsVisible(const BoundingBox& worldSpaceBox) const
             {
                 DepthValue* src = row + left;
                 DepthValue* end = row + right;
+#ifdef URHO3D_SSE
+                // Test two minimum and maximum value pairs at a time
+                while (src < end)
+                {
+                    __m128i depth = _mm_loadu_si128(reinterpret_cast<__m128i*>(src));
+                    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(depth, zVec)));
+                    if (mask & 0x5)
+                        return true;
+                    if (mask & 0xa)
+                        allOccluded = false;
+                    src += 2;
+                }
+#endif
                 while (src <= end)
                 {
                     if (z <= src->min_)
@@ -447,12 +585,21 @@ bool OcclusionBuffer::IsVisible(const BoundingBox& worldSpaceBox) const
     }
 
     // If no conclusive result, finally check the pixel-level data
-    int* row = buffers_[0].data_ + rect.top_ * width_;
-    int* endRow = buffers_[0].data_ + rect.bottom_ * width_;
+    int* row = data_ + rect.top_ * width_;
+    int* endRow = data_ + rect.bottom_ * width_;
     while (row <= endRow)
     {
         int* src = row + rect.left_;
         int* end = row + rect.right_;
+#ifdef URHO3D_SSE
+        while (end - src >= 3)
+        {
+            __m128i depth = _mm_loadu_si128(reinterpret_cast<__m128i*>(src));
+            if (_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(depth, zVec))))
+                return true;
+            src += 4;
+        }
+#endif
         while (src <= end)
         {
             if (z <= *src)
@@ -473,13 +620,6 @@ unsigned OcclusionBuffer::GetUseTimer()
 
 void OcclusionBuffer::DrawBatch(const OcclusionBatch& batch, unsigned threadIndex)
 {
-    // If buffer not yet used, clear it
-    if (threadIndex > 0 && !buffers_[threadIndex].used_)
-    {
-        ClearBuffer(threadIndex);
-        buffers_[threadIndex].used_ = true;
-    }
-
     Matrix4 modelViewProj = viewProj_ * batch.model_;
 
     // Theoretical max. amount of vertices if each of the 6 clipping planes doubles the triangle count
@@ -689,7 +829,12 @@ void OcclusionBuffer::DrawTriangle(Vector4* vertices, unsigned threadIndex)
     }
 
     if (drawOk)
-        ++numTriangles_;
+    {
+        if (threadData_.Empty())
+            ++numTriangles_;
+        else
+            ++threadData_[threadIndex].numTriangles_;
+    }
 }
 
 void OcclusionBuffer::ClipVertices(const Vector4& plane, Vector4* vertices, bool* triangles, unsigned& numTriangles)
@@ -812,6 +957,20 @@ struct Edge
         invZStep_ = (int)(slope * gradients.dInvZdX_ + gradients.dInvZdY_ + 0.5f);
     }
 
+    /// Step to the next row.
+    void Advance()
+    {
+        x_ += xStep_;
+        invZ_ += invZStep_;
+    }
+
+    /// Step forward by a number of rows.
+    void Advance(int rows)
+    {
+        x_ += rows * xStep_;
+        invZ_ += rows * invZStep_;
+    }
+
     /// X coordinate.
     int x_;
     /// X coordinate step.
@@ -823,6 +982,57 @@ struct Edge
 };
 
 void OcclusionBuffer::DrawTriangle2D(const Vector3* vertices, bool clockwise, unsigned threadIndex)
+{
+    if (threadData_.Empty())
+    {
+        RasterizeTriangle(vertices, clockwise, 0, height_);
+        return;
+    }
+
+    // In threaded mode store the triangle and add it to the bins of the tiles it overlaps
+    int topY = (int)Min(Min(vertices[0].y_, vertices[1].y_), vertices[2].y_);
+    int bottomY = (int)Max(Max(vertices[0].y_, vertices[1].y_), vertices[2].y_);
+    if (topY == bottomY)
+        return;
+
+    OcclusionThreadData& data = threadData_[threadIndex];
+    unsigned index = data.triangles_.Size();
+    data.triangles_.Resize(index + 1);
+    OcclusionTriangle& triangle = data.triangles_.Back();
+    triangle.vertices_[0] = vertices[0];
+    triangle.vertices_[1] = vertices[1];
+    triangle.vertices_[2] = vertices[2];
+    triangle.clockwise_ = clockwise;
+
+    int firstTile = Clamp(topY / OCCLUSION_TILE_HEIGHT, 0, numTiles_ - 1);
+    int lastTile = Clamp((bottomY - 1) / OCCLUSION_TILE_HEIGHT, 0, numTiles_ - 1);
+    for (int i = firstTile; i <= lastTile; ++i)
+        data.bins_[i].Push(index);
+}
+
+void OcclusionBuffer::DrawTiles(int top, int bottom)
+{
+    int firstTile = top / OCCLUSION_TILE_HEIGHT;
+    int lastTile = (bottom - 1) / OCCLUSION_TILE_HEIGHT;
+
+    for (int i = firstTile; i <= lastTile; ++i)
+    {
+        int minY = Max(i * OCCLUSION_TILE_HEIGHT, top);
+        int maxY = Min((i + 1) * OCCLUSION_TILE_HEIGHT, bottom);
+
+        for (Vector<OcclusionThreadData>::ConstIterator j = threadData_.Begin(); j != threadData_.End(); ++j)
+        {
+            const PODVector<unsigned>& bin = j->bins_[i];
+            for (PODVector<unsigned>::ConstIterator k = bin.Begin(); k != bin.End(); ++k)
+            {
+                const OcclusionTriangle& triangle = j->triangles_[*k];
+                RasterizeTriangle(triangle.vertices_, triangle.clockwise_, minY, maxY);
+            }
+        }
+    }
+}
+
+void OcclusionBuffer::RasterizeTriangle(const Vector3* vertices, bool clockwise, int minY, int maxY)
 {
     int top, middle, bottom;
     bool middleIsRight;
@@ -898,132 +1108,55 @@ void OcclusionBuffer::DrawTriangle2D(const Vector3* vertices, bool clockwise, un
     Edge topToBottom(gradients, vertices[top], vertices[bottom], topY);
     Edge middleToBottom(gradients, vertices[middle], vertices[bottom], middleY);
 
-    int* bufferData = buffers_[threadIndex].data_;
-
-    if (middleIsRight)
+    // Top half, clipped to the row range. Depth is interpolated along the left edge
+    int startY = Max(topY, minY);
+    int endY = Min(middleY, maxY);
+    if (startY < endY)
     {
-        // Top half
-        int* row = bufferData + topY * width_;
-        int* endRow = bufferData + middleY * width_;
-        while (row < endRow)
-        {
-            int invZ = topToBottom.invZ_;
-            int* dest = row + (topToBottom.x_ >> 16);
-            int* end = row + (topToMiddle.x_ >> 16);
-            while (dest < end)
-            {
-                if (invZ < *dest)
-                    *dest = invZ;
-                invZ += gradients.dInvZdXInt_;
-                ++dest;
-            }
+        Edge left = middleIsRight ? topToBottom : topToMiddle;
+        Edge right = middleIsRight ? topToMiddle : topToBottom;
+        left.Advance(startY - topY);
+        right.Advance(startY - topY);
 
-            topToBottom.x_ += topToBottom.xStep_;
-            topToBottom.invZ_ += topToBottom.invZStep_;
-            topToMiddle.x_ += topToMiddle.xStep_;
-            row += width_;
-        }
-
-        // Bottom half
-        row = bufferData + middleY * width_;
-        endRow = bufferData + bottomY * width_;
+        int* row = data_ + startY * width_;
+        int* endRow = data_ + endY * width_;
         while (row < endRow)
         {
-            int invZ = topToBottom.invZ_;
-            int* dest = row + (topToBottom.x_ >> 16);
-            int* end = row + (middleToBottom.x_ >> 16);
-            while (dest < end)
-            {
-                if (invZ < *dest)
-                    *dest = invZ;
-                invZ += gradients.dInvZdXInt_;
-                ++dest;
-            }
-
-            topToBottom.x_ += topToBottom.xStep_;
-            topToBottom.invZ_ += topToBottom.invZStep_;
-            middleToBottom.x_ += middleToBottom.xStep_;
+            DrawSpan(row, left.x_ >> 16, right.x_ >> 16, width_, left.invZ_, gradients.dInvZdXInt_);
+            left.Advance();
+            right.Advance();
             row += width_;
         }
     }
-    else
-    {
-        // Top half
-        int* row = bufferData + topY * width_;
-        int* endRow = bufferData + middleY * width_;
-        while (row < endRow)
-        {
-            int invZ = topToMiddle.invZ_;
-            int* dest = row + (topToMiddle.x_ >> 16);
-            int* end = row + (topToBottom.x_ >> 16);
-            while (dest < end)
-            {
-                if (invZ < *dest)
-                    *dest = invZ;
-                invZ += gradients.dInvZdXInt_;
-                ++dest;
-            }
 
-            topToMiddle.x_ += topToMiddle.xStep_;
-            topToMiddle.invZ_ += topToMiddle.invZStep_;
-            topToBottom.x_ += topToBottom.xStep_;
-            row += width_;
-        }
+    // Bottom half
+    startY = Max(middleY, minY);
+    endY = Min(bottomY, maxY);
+    if (startY < endY)
+    {
+        topToBottom.Advance(startY - topY);
+        middleToBottom.Advance(startY - middleY);
+        Edge& left = middleIsRight ? topToBottom : middleToBottom;
+        Edge& right = middleIsRight ? middleToBottom : topToBottom;
 
-        // Bottom half
-        row = bufferData + middleY * width_;
-        endRow = bufferData + bottomY * width_;
+        int* row = data_ + startY * width_;
+        int* endRow = data_ + endY * width_;
         while (row < endRow)
         {
-            int invZ = middleToBottom.invZ_;
-            int* dest = row + (middleToBottom.x_ >> 16);
-            int* end = row + (topToBottom.x_ >> 16);
-            while (dest < end)
-            {
-                if (invZ < *dest)
-                    *dest = invZ;
-                invZ += gradients.dInvZdXInt_;
-                ++dest;
-            }
-
-            middleToBottom.x_ += middleToBottom.xStep_;
-            middleToBottom.invZ_ += middleToBottom.invZStep_;
-            topToBottom.x_ += topToBottom.xStep_;
+            DrawSpan(row, left.x_ >> 16, right.x_ >> 16, width_, left.invZ_, gradients.dInvZdXInt_);
+            left.Advance();
+            right.Advance();
             row += width_;
         }
     }
 }
 
-void OcclusionBuffer::MergeBuffers()
-{
-    URHO3D_PROFILE(MergeBuffers);
-
-    for (unsigned i = 1; i < buffers_.Size(); ++i)
-    {
-        if (!buffers_[i].used_)
-            continue;
-
-        int* src = buffers_[i].data_;
-        int* dest = buffers_[0].data_;
-        int count = width_ * height_;
-
-        while (count--)
-        {
-            // If thread buffer's depth value is closer, overwrite the original
-            if (*src < *dest)
-                *dest = *src;
-            ++src;
-            ++dest;
-        }
-    }
-}
-
-void OcclusionBuffer::ClearBuffer(unsigned threadIndex)
+void OcclusionBuffer::ClearBuffer()
 {
-    if (threadIndex >= buffers_.Size())
+    if (!data_)
         return;
 
-    int* dest = buffers_[threadIndex].data_;
+    int* dest = data_;
     int count = width_ * height_;
     int fillValue = (int)OCCLUSION_Z_SCALE;
 
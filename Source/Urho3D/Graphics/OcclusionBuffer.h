@@ -48,15 +48,24 @@ struct DepthValue
     int max_;
 };
 
-/// Per-thread occlusion buffer data.
-struct OcclusionBufferData
+/// Screen-space occlusion triangle waiting for threaded rasterization.
+struct OcclusionTriangle
 {
-    /// Full buffer data with safety padding.
-    SharedArrayPtr<int> dataWithSafety_;
-    /// Buffer data.
-    int* data_;
-    /// Use flag.
-    bool used_;
+    /// Vertices in screen space.
+    Vector3 vertices_[3];
+    /// Clockwise winding flag.
+    bool clockwise_;
+};
+
+/// Per-thread triangle setup data for threaded occlusion rendering.
+struct OcclusionThreadData
+{
+    /// Triangles set up by the thread.
+    PODVector<OcclusionTriangle> triangles_;
+    /// Indices of the triangles overlapping each tile.
+    Vector<PODVector<unsigned> > bins_;
+    /// Number of triangles drawn.
+    unsigned numTriangles_;
 };
 
 /// Stored occlusion render job.
@@ -96,7 +105,7 @@ public:
     /// Destruct.
     virtual ~OcclusionBuffer();
 
-    /// Set occlusion buffer size and whether to reserve multiple buffers for threading optimization.
+    /// Set occlusion buffer size and whether to use worker threads for rendering. When threaded, triangles are set up and binned to screen tiles in parallel, after which the tiles are rasterized in parallel.
     bool SetSize(int width, int height, bool threaded);
     /// Set camera view to render from.
     void SetView(Camera* camera);
@@ -121,7 +130,7 @@ public:
     void ResetUseTimer();
 
     /// Return highest level depth values.
-    int* GetBuffer() const { return buffers_.Size() ? buffers_[0].data_ : (int*)0; }
+    int* GetBuffer() const { return data_; }
 
     /// Return view transform matrix.
     const Matrix3x4& GetView() const { return view_; }
@@ -145,15 +154,17 @@ public:
     CullMode GetCullMode() const { return cullMode_; }
 
     /// Return whether is using threads to speed up rendering.
-    bool IsThreaded() const { return buffers_.Size() > 1; }
+    bool IsThreaded() const { return threadData_.Size() > 0; }
 
     /// Test a bounding box for visibility. For best performance, build depth hierarchy first.
     bool IsVisible(const BoundingBox& worldSpaceBox) const;
     /// Return time since last use in milliseconds.
     unsigned GetUseTimer();
 
-    /// Draw a batch. Called internally.
+    /// Draw a batch. In threaded mode only sets up and bins the triangles. Called internally.
     void DrawBatch(const OcclusionBatch& batch, unsigned threadIndex);
+    /// Rasterize the binned triangles of the tiles within a row range in threaded mode. Called internally.
+    void DrawTiles(int top, int bottom);
 
 private:
     /// Apply modelview transform to vertex.
@@ -170,15 +181,19 @@ private:
     void DrawTriangle(Vector4* vertices, unsigned threadIndex);
     /// Clip vertices against a plane.
     void ClipVertices(const Vector4& plane, Vector4* vertices, bool* triangles, unsigned& numTriangles);
-    /// Draw a clipped triangle.
+    /// Draw a clipped triangle, or set it up for threaded rasterization.
     void DrawTriangle2D(const Vector3* vertices, bool clockwise, unsigned threadIndex);
-    /// Clear a thread work buffer.
-    void ClearBuffer(unsigned threadIndex);
-    /// Merge thread work buffers into the first buffer.
-    void MergeBuffers();
+    /// Rasterize a clipped triangle within a row range.
+    void RasterizeTriangle(const Vector3* vertices, bool clockwise, int minY, int maxY);
+    /// Clear the buffer.
+    void ClearBuffer();
 
-    /// Highest-level buffer data per thread.
-    Vector<OcclusionBufferData> buffers_;
+    /// Highest-level buffer data with safety padding.
+    SharedArrayPtr<int> dataWithSafety_;
+    /// Highest-level buffer data.
+    int* data_;
+    /// Triangle setup data per thread in threaded mode.
+    Vector<OcclusionThreadData> threadData_;
     /// Reduced size depth buffers.
     Vector<SharedArrayPtr<DepthValue> > mipBuffers_;
     /// Submitted render jobs.
@@ -187,6 +202,8 @@ private:
     int width_;
     /// Buffer height.
     int height_;
+    /// Number of tiles in threaded mode.
+    int numTiles_;
     /// Number of rendered triangles.
     unsigned numTriangles_;
     /// Maximum number of triangles.
@@ -26,6 +26,7 @@
 #include "../Core/CoreEvents.h"
 #include "../Core/Profiler.h"
 #include "../Core/Thread.h"
+#include "../Core/Timer.h"
 #include "../Core/WorkQueue.h"
 #include "../Graphics/DebugRenderer.h"
 #include "../Graphics/Graphics.h"
@@ -34,6 +35,10 @@
 #include "../Scene/Scene.h"
 #include "../Scene/SceneEvents.h"
 
+#ifdef URHO3D_SSE
+#include <xmmintrin.h>
+#endif
+
 #include "../DebugNew.h"
 
 #ifdef _MSC_VER
@@ -45,6 +50,9 @@ namespace Urho3D
 
 static const float DEFAULT_OCTREE_SIZE = 1000.0f;
 static const int DEFAULT_OCTREE_LEVELS = 8;
+static const unsigned CULLING_BATCH_SIZE = 64;
+static const unsigned THREADED_QUERY_SPLIT_LEVEL = 2;
+static const unsigned MIN_THREADED_QUERY_DRAWABLES = 1024;
 
 extern const char* SUBSYSTEM_CATEGORY;
 
@@ -63,17 +71,109 @@ void UpdateDrawablesWork(const WorkItem* item, unsigned threadIndex)
     }
 }
 
+/// %Octree query used in the worker threads of a threaded query and for filling the visibility cache. Forwards octant tests to the actual query, and collects drawables to be tested by it afterward.
+class CollectOctreeQuery : public OctreeQuery
+{
+public:
+    /// Construct with the actual query and the lists to collect drawables into.
+    CollectOctreeQuery(OctreeQuery& query, PODVector<Drawable*>& insideDrawables, PODVector<Drawable*>& testDrawables) :
+        OctreeQuery(insideDrawables, query.drawableFlags_, query.viewMask_),
+        query_(query),
+        testDrawables_(testDrawables)
+    {
+    }
+
+    /// Intersection test for an octant.
+    virtual Intersection TestOctant(const BoundingBox& box, bool inside) { return query_.TestOctant(box, inside); }
+
+    /// Intersection test for drawables.
+    virtual void TestDrawables(Drawable** start, Drawable** end, bool inside)
+    {
+        PODVector<Drawable*>& dest = inside ? result_ : testDrawables_;
+        unsigned oldSize = dest.Size();
+        dest.Resize(oldSize + (unsigned)(end - start));
+        for (unsigned i = oldSize; start != end; ++i)
+            dest[i] = *start++;
+    }
+
+    /// Return frustum for vectorized culling of drawables by the octree.
+    virtual const Frustum* GetFrustum() const { return query_.GetFrustum(); }
+
+private:
+    /// Actual query.
+    OctreeQuery& query_;
+    /// Drawables to be tested by the actual query.
+    PODVector<Drawable*>& testDrawables_;
+};
+
+void GetDrawablesWork(const WorkItem* item, unsigned threadIndex)
+{
+    OctreeQuery& query = *(reinterpret_cast<OctreeQuery*>(item->aux_));
+    OctreeQueryBatch& batch = *(reinterpret_cast<OctreeQueryBatch*>(item->start_));
+    CollectOctreeQuery collectQuery(query, batch.insideDrawables_, batch.testDrawables_);
+    const Frustum* frustum = query.GetFrustum();
+
+    for (unsigned i = 0; i < batch.octants_.Size(); ++i)
+        batch.octants_[i]->GetDrawablesInternal(collectQuery, frustum, batch.octantsInside_[i]);
+}
+
+void FindReinsertOctantsWork(const WorkItem* item, unsigned threadIndex)
+{
+    Octree* octree = reinterpret_cast<Octree*>(item->aux_);
+    Drawable** start = reinterpret_cast<Drawable**>(item->start_);
+    Drawable** end = reinterpret_cast<Drawable**>(item->end_);
+
+    octree->FindReinsertOctants(start, end);
+}
+
+inline bool CompareReinsertions(const Pair<Octant*, Drawable*>& lhs, const Pair<Octant*, Drawable*>& rhs)
+{
+    // Sort by the octant level and drawable ID instead of pointers, so that the drawable order in the octants is the same on
+    // every run
+    if (lhs.first_->GetLevel() != rhs.first_->GetLevel())
+        return lhs.first_->GetLevel() < rhs.first_->GetLevel();
+    return lhs.second_->GetID() < rhs.second_->GetID();
+}
+
 inline bool CompareRayQueryResults(const RayQueryResult& lhs, const RayQueryResult& rhs)
 {
     return lhs.distance_ < rhs.distance_;
 }
 
+static bool FrustumEquals(const Frustum& lhs, const Frustum& rhs)
+{
+    for (unsigned i = 0; i < NUM_FRUSTUM_VERTICES; ++i)
+    {
+        if (lhs.vertices_[i] != rhs.vertices_[i])
+            return false;
+    }
+
+    return true;
+}
+
+OctreeQueryCache::OctreeQueryCache() :
+    octree_(0),
+    queryNumber_(0),
+    numHits_(0),
+    numMisses_(0),
+    numCachedDrawables_(0)
+{
+}
+
+void OctreeQueryCache::Clear()
+{
+    results_.Clear();
+    octree_ = 0;
+}
+
 Octant::Octant(const BoundingBox& box, unsigned level, Octant* parent, Octree* root, unsigned index) :
+    childMask_(0),
     level_(level),
     numDrawables_(0),
     parent_(parent),
     root_(root),
-    index_(index)
+    index_(index),
+    changeFrameNumber_(parent ? root->GetFrameNumber() : 0)
 {
     Initialize(box);
 
@@ -88,11 +188,11 @@ Octant::~Octant()
         // Remove the drawables (if any) from this octant to the root octant
         for (PODVector<Drawable*>::Iterator i = drawables_.Begin(); i != drawables_.End(); ++i)
         {
-            (*i)->SetOctant(root_);
-            root_->drawables_.Push(*i);
+            root_->PushDrawable(*i);
             root_->QueueUpdate(*i);
         }
         drawables_.Clear();
+        drawableBoxes_.Clear();
         numDrawables_ = 0;
     }
 
@@ -125,6 +225,7 @@ Octant* Octant::GetOrCreateChild(unsigned index)
         newMax.z_ = oldCenter.z_;
 
     children_[index] = new Octant(BoundingBox(newMin, newMax), level_ + 1, this, root_, index);
+    childMask_ |= 1 << index;
     return children_[index];
 }
 
@@ -133,6 +234,10 @@ void Octant::DeleteChild(unsigned index)
     assert(index < NUM_OCTANTS);
     delete children_[index];
     children_[index] = 0;
+    childMask_ &= ~(1 << index);
+    // Record the change here, as the removed octant can no longer report it
+    if (root_)
+        changeFrameNumber_ = root_->GetFrameNumber();
 }
 
 void Octant::InsertDrawable(Drawable* drawable)
@@ -153,9 +258,13 @@ void Octant::InsertDrawable(Drawable* drawable)
         if (oldOctant != this)
         {
             // Add first, then remove, because drawable count going to zero deletes the octree branch in question
+            unsigned oldIndex = drawable->octantIndex_;
             AddDrawable(drawable);
             if (oldOctant)
-                oldOctant->RemoveDrawable(drawable, false);
+            {
+                oldOctant->EraseDrawable(oldIndex);
+                oldOctant->DecDrawableCount();
+            }
         }
     }
     else
@@ -193,6 +302,47 @@ bool Octant::CheckDrawableFit(const BoundingBox& box) const
     return false;
 }
 
+void Octant::UpdateDrawableBox(Drawable* drawable)
+{
+    unsigned index = drawable->octantIndex_;
+    if (index >= drawables_.Size())
+        return;
+
+    DrawableBoxBlock& block = drawableBoxes_[index >> 2];
+    unsigned lane = index & 3;
+    changeFrameNumber_ = root_->GetFrameNumber();
+
+    if (drawable->worldBoundingBoxDirty_)
+    {
+        block.centerX_[lane] = block.centerY_[lane] = block.centerZ_[lane] = 0.0f;
+        block.halfSizeX_[lane] = block.halfSizeY_[lane] = block.halfSizeZ_[lane] = M_INFINITY;
+    }
+    else
+    {
+        const BoundingBox& box = drawable->worldBoundingBox_;
+        Vector3 center = box.Center();
+        Vector3 halfSize = box.HalfSize();
+        block.centerX_[lane] = center.x_;
+        block.centerY_[lane] = center.y_;
+        block.centerZ_[lane] = center.z_;
+        block.halfSizeX_[lane] = halfSize.x_;
+        block.halfSizeY_[lane] = halfSize.y_;
+        block.halfSizeZ_[lane] = halfSize.z_;
+    }
+}
+
+void Octant::InvalidateDrawableBox(Drawable* drawable)
+{
+    unsigned index = drawable->octantIndex_;
+    if (index >= drawables_.Size())
+        return;
+
+    DrawableBoxBlock& block = drawableBoxes_[index >> 2];
+    unsigned lane = index & 3;
+    changeFrameNumber_ = root_->GetFrameNumber();
+    block.halfSizeX_[lane] = block.halfSizeY_[lane] = block.halfSizeZ_[lane] = M_INFINITY;
+}
+
 void Octant::ResetRoot()
 {
     root_ = 0;
@@ -230,7 +380,105 @@ void Octant::Initialize(const BoundingBox& box)
     cullingBox_ = BoundingBox(worldBoundingBox_.min_ - halfSize_, worldBoundingBox_.max_ + halfSize_);
 }
 
-void Octant::GetDrawablesInternal(OctreeQuery& query, bool inside) const
+void Octant::PushDrawable(Drawable* drawable)
+{
+    unsigned index = drawables_.Size();
+    drawable->SetOctant(this);
+    drawable->octantIndex_ = index;
+    drawables_.Push(drawable);
+    if (!(index & 3))
+        drawableBoxes_.Resize(drawableBoxes_.Size() + 1);
+
+    UpdateDrawableBox(drawable);
+}
+
+void Octant::EraseDrawable(unsigned index)
+{
+    unsigned last = drawables_.Size() - 1;
+    if (index != last)
+    {
+        Drawable* moved = drawables_[last];
+        drawables_[index] = moved;
+        moved->octantIndex_ = index;
+
+        const DrawableBoxBlock& src = drawableBoxes_[last >> 2];
+        DrawableBoxBlock& dest = drawableBoxes_[index >> 2];
+        unsigned srcLane = last & 3;
+        unsigned destLane = index & 3;
+        dest.centerX_[destLane] = src.centerX_[srcLane];
+        dest.centerY_[destLane] = src.centerY_[srcLane];
+        dest.centerZ_[destLane] = src.centerZ_[srcLane];
+        dest.halfSizeX_[destLane] = src.halfSizeX_[srcLane];
+        dest.halfSizeY_[destLane] = src.halfSizeY_[srcLane];
+        dest.halfSizeZ_[destLane] = src.halfSizeZ_[srcLane];
+    }
+
+    drawables_.Pop();
+    if (!(last & 3))
+        drawableBoxes_.Pop();
+    changeFrameNumber_ = root_->GetFrameNumber();
+}
+
+void Octant::GetDrawablesInternal(OctreeQuery& query, const Frustum& frustum, OctreeQueryCache& cache, bool inside) const
+{
+    if (this != root_)
+    {
+        Intersection res = query.TestOctant(cullingBox_, inside);
+        if (res == INSIDE)
+            inside = true;
+        else if (res == OUTSIDE)
+            return;
+    }
+
+    if (drawables_.Size())
+    {
+        if (!inside)
+        {
+            // Reuse the previous culling result if no drawables have been added, removed or changed since
+            OctantCullingResult& result = cache.results_[this];
+            if (result.queryNumber_ && changeFrameNumber_ < result.frameNumber_)
+            {
+                ++cache.numHits_;
+                cache.numCachedDrawables_ += drawables_.Size();
+            }
+            else
+            {
+                ++cache.numMisses_;
+                result.visibleDrawables_.Clear();
+                result.untestedDrawables_.Clear();
+                CollectOctreeQuery collectQuery(query, result.visibleDrawables_, result.untestedDrawables_);
+                CullDrawables(collectQuery, frustum);
+                result.frameNumber_ = root_->GetFrameNumber();
+            }
+            result.queryNumber_ = cache.queryNumber_;
+
+            if (result.visibleDrawables_.Size())
+            {
+                Drawable** start = &result.visibleDrawables_[0];
+                query.TestDrawables(start, start + result.visibleDrawables_.Size(), true);
+            }
+            if (result.untestedDrawables_.Size())
+            {
+                Drawable** start = &result.untestedDrawables_[0];
+                query.TestDrawables(start, start + result.untestedDrawables_.Size(), false);
+            }
+        }
+        else
+        {
+            Drawable** start = const_cast<Drawable**>(&drawables_[0]);
+            Drawable** end = start + drawables_.Size();
+            query.TestDrawables(start, end, inside);
+        }
+    }
+
+    for (unsigned i = 0, mask = childMask_; mask; ++i, mask >>= 1)
+    {
+        if (mask & 1)
+            children_[i]->GetDrawablesInternal(query, frustum, cache, inside);
+    }
+}
+
+void Octant::GetDrawablesInternal(OctreeQuery& query, const Frustum* frustum, bool inside) const
 {
     if (this != root_)
     {
@@ -246,18 +494,168 @@ void Octant::GetDrawablesInternal(OctreeQuery& query, bool inside) const
 
     if (drawables_.Size())
     {
-        Drawable** start = const_cast<Drawable**>(&drawables_[0]);
-        Drawable** end = start + drawables_.Size();
-        query.TestDrawables(start, end, inside);
+        if (frustum && !inside)
+            CullDrawables(query, *frustum);
+        else
+        {
+            Drawable** start = const_cast<Drawable**>(&drawables_[0]);
+            Drawable** end = start + drawables_.Size();
+            query.TestDrawables(start, end, inside);
+        }
     }
 
-    for (unsigned i = 0; i < NUM_OCTANTS; ++i)
+    for (unsigned i = 0, mask = childMask_; mask; ++i, mask >>= 1)
     {
-        if (children_[i])
-            children_[i]->GetDrawablesInternal(query, inside);
+        if (mask & 1)
+            children_[i]->GetDrawablesInternal(query, frustum, inside);
     }
 }
 
+void Octant::GetDrawablesInternal(OctreeQuery& query, const Frustum* frustum, bool inside, unsigned splitLevel,
+    PODVector<Octant*>& octants, PODVector<bool>& octantsInside) const
+{
+    if (this != root_)
+    {
+        Intersection res = query.TestOctant(cullingBox_, inside);
+        if (res == INSIDE)
+            inside = true;
+        else if (res == OUTSIDE)
+            return;
+    }
+
+    if (drawables_.Size())
+    {
+        if (frustum && !inside)
+            CullDrawables(query, *frustum);
+        else
+        {
+            Drawable** start = const_cast<Drawable**>(&drawables_[0]);
+            Drawable** end = start + drawables_.Size();
+            query.TestDrawables(start, end, inside);
+        }
+    }
+
+    for (unsigned i = 0, mask = childMask_; mask; ++i, mask >>= 1)
+    {
+        if (mask & 1)
+        {
+            // Leave the octants at the split level to be traversed in worker threads
+            if (level_ + 1 >= splitLevel)
+            {
+                octants.Push(children_[i]);
+                octantsInside.Push(inside);
+            }
+            else
+                children_[i]->GetDrawablesInternal(query, frustum, inside, splitLevel, octants, octantsInside);
+        }
+    }
+}
+
+void Octant::CullDrawables(OctreeQuery& query, const Frustum& frustum) const
+{
+    // Drawables whose bounding box intersects the frustum are passed to the query as inside, while drawables with an
+    // invalid bounding box copy are left for the query to test
+    Drawable* visible[CULLING_BATCH_SIZE];
+    Drawable* untested[CULLING_BATCH_SIZE];
+    unsigned numVisible = 0;
+    unsigned numUntested = 0;
+    unsigned numDrawables = drawables_.Size();
+
+#ifdef URHO3D_SSE
+    __m128 normalX[NUM_FRUSTUM_PLANES];
+    __m128 normalY[NUM_FRUSTUM_PLANES];
+    __m128 normalZ[NUM_FRUSTUM_PLANES];
+    __m128 absNormalX[NUM_FRUSTUM_PLANES];
+    __m128 absNormalY[NUM_FRUSTUM_PLANES];
+    __m128 absNormalZ[NUM_FRUSTUM_PLANES];
+    __m128 planeD[NUM_FRUSTUM_PLANES];
+    for (unsigned i = 0; i < NUM_FRUSTUM_PLANES; ++i)
+    {
+        const Plane& plane = frustum.planes_[i];
+        normalX[i] = _mm_set1_ps(plane.normal_.x_);
+        normalY[i] = _mm_set1_ps(plane.normal_.y_);
+        normalZ[i] = _mm_set1_ps(plane.normal_.z_);
+        absNormalX[i] = _mm_set1_ps(plane.absNormal_.x_);
+        absNormalY[i] = _mm_set1_ps(plane.absNormal_.y_);
+        absNormalZ[i] = _mm_set1_ps(plane.absNormal_.z_);
+        planeD[i] = _mm_set1_ps(plane.d_);
+    }
+    __m128 zero = _mm_setzero_ps();
+#endif
+
+    for (unsigned i = 0; i < numDrawables; i += 4)
+    {
+        const DrawableBoxBlock& block = drawableBoxes_[i >> 2];
+        unsigned outsideMask = 0;
+
+#ifdef URHO3D_SSE
+        __m128 centerX = _mm_loadu_ps(block.centerX_);
+        __m128 centerY = _mm_loadu_ps(block.centerY_);
+        __m128 centerZ = _mm_loadu_ps(block.centerZ_);
+        __m128 halfSizeX = _mm_loadu_ps(block.halfSizeX_);
+        __m128 halfSizeY = _mm_loadu_ps(block.halfSizeY_);
+        __m128 halfSizeZ = _mm_loadu_ps(block.halfSizeZ_);
+        __m128 outside = zero;
+
+        for (unsigned j = 0; j < NUM_FRUSTUM_PLANES; ++j)
+        {
+            __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX[j], centerX), _mm_mul_ps(normalY[j], centerY)),
+                _mm_add_ps(_mm_mul_ps(normalZ[j], centerZ), planeD[j]));
+            __m128 absDist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absNormalX[j], halfSizeX), _mm_mul_ps(absNormalY[j], halfSizeY)),
+                _mm_mul_ps(absNormalZ[j], halfSizeZ));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dist, absDist), zero));
+        }
+
+        outsideMask = (unsigned)_mm_movemask_ps(outside);
+#else
+        for (unsigned j = 0; j < 4; ++j)
+        {
+            for (unsigned k = 0; k < NUM_FRUSTUM_PLANES; ++k)
+            {
+                const Plane& plane = frustum.planes_[k];
+                float dist = plane.normal_.x_ * block.centerX_[j] + plane.normal_.y_ * block.centerY_[j] +
+                    plane.normal_.z_ * block.centerZ_[j] + plane.d_;
+                float absDist = plane.absNormal_.x_ * block.halfSizeX_[j] + plane.absNormal_.y_ * block.halfSizeY_[j] +
+                    plane.absNormal_.z_ * block.halfSizeZ_[j];
+                if (dist + absDist < 0.0f)
+                {
+                    outsideMask |= 1 << j;
+                    break;
+                }
+            }
+        }
+#endif
+
+        unsigned count = Min(numDrawables - i, 4U);
+        for (unsigned j = 0; j < count; ++j)
+        {
+            if (outsideMask & (1 << j))
+                continue;
+
+            if (block.halfSizeX_[j] == M_INFINITY)
+                untested[numUntested++] = drawables_[i + j];
+            else
+                visible[numVisible++] = drawables_[i + j];
+        }
+
+        if (numVisible > CULLING_BATCH_SIZE - 4)
+        {
+            query.TestDrawables(visible, visible + numVisible, true);
+            numVisible = 0;
+        }
+        if (numUntested > CULLING_BATCH_SIZE - 4)
+        {
+            query.TestDrawables(untested, untested + numUntested, false);
+            numUntested = 0;
+        }
+    }
+
+    if (numVisible)
+        query.TestDrawables(visible, visible + numVisible, true);
+    if (numUntested)
+        query.TestDrawables(untested, untested + numUntested, false);
+}
+
 void Octant::GetDrawablesInternal(RayOctreeQuery& query) const
 {
     float octantDist = query.ray_.HitDistance(cullingBox_);
@@ -312,11 +710,34 @@ void Octant::GetDrawablesOnlyInternal(RayOctreeQuery& query, PODVector<Drawable*
     }
 }
 
+unsigned Octant::GetChangeFrameNumberInternal(const BoundingBox& box) const
+{
+    unsigned frameNumber = changeFrameNumber_;
+
+    for (unsigned i = 0, mask = childMask_; mask; ++i, mask >>= 1)
+    {
+        if ((mask & 1) && children_[i]->cullingBox_.IsInsideFast(box) != OUTSIDE)
+            frameNumber = Max(frameNumber, children_[i]->GetChangeFrameNumberInternal(box));
+    }
+
+    return frameNumber;
+}
+
 Octree::Octree(Context* context) :
     Component(context),
     Octant(BoundingBox(-DEFAULT_OCTREE_SIZE, DEFAULT_OCTREE_SIZE), 0, 0, this),
-    numLevels_(DEFAULT_OCTREE_LEVELS)
+    numLevels_(DEFAULT_OCTREE_LEVELS),
+    frameNumber_(0),
+    numUpdatedDrawables_(0),
+    numReinsertedDrawables_(0)
 {
+    // Start from the current frame number so that octants created by a new octree are never older than cached culling
+    // results of a previous octree
+    Time* time = GetSubsystem<Time>();
+    if (time)
+        frameNumber_ = time->GetFrameNumber();
+    changeFrameNumber_ = frameNumber_;
+
     // If the engine is running headless, subscribe to RenderUpdate events for manually updating the octree
     // to allow raycasts and animation update
     if (!GetSubsystem<Graphics>())
@@ -370,6 +791,7 @@ void Octree::SetSize(const BoundingBox& box, unsigned numLevels)
     Initialize(box);
     numDrawables_ = drawables_.Size();
     numLevels_ = Max(numLevels, 1U);
+    changeFrameNumber_ = frameNumber_;
 }
 
 void Octree::Update(const FrameInfo& frame)
@@ -380,6 +802,14 @@ void Octree::Update(const FrameInfo& frame)
         return;
     }
 
+    frameNumber_ = frame.frameNumber_;
+
+    // If enabled, recalculate the dirty world transforms in one linear pass now, so that drawables updating in worker
+    // threads do not need to walk up their node hierarchies
+    Scene* scene = GetScene();
+    if (scene && scene->GetLinearTransformUpdate())
+        scene->UpdateTransforms();
+
     // Let drawables update themselves before reinsertion. This can be used for animation
     if (!drawableUpdates_.Empty())
     {
@@ -387,7 +817,6 @@ void Octree::Update(const FrameInfo& frame)
 
         // Perform updates in worker threads. Notify the scene that a threaded update is going on and components
         // (for example physics objects) should not perform non-threadsafe work when marked dirty
-        Scene* scene = GetScene();
         WorkQueue* queue = GetSubsystem<WorkQueue>();
         scene->BeginThreadedUpdate();
 
@@ -437,7 +866,6 @@ void Octree::Update(const FrameInfo& frame)
     }
 
     // Notify drawable update being finished. Custom animation (eg. IK) can be done at this point
-    Scene* scene = GetScene();
     if (scene)
     {
         using namespace SceneDrawableUpdateFinished;
@@ -448,31 +876,72 @@ void Octree::Update(const FrameInfo& frame)
         scene->SendEvent(E_SCENEDRAWABLEUPDATEFINISHED, eventData);
     }
 
+    numUpdatedDrawables_ = drawableUpdates_.Size();
+    numReinsertedDrawables_ = 0;
+
     // Reinsert drawables that have been moved or resized, or that have been newly added to the octree and do not sit inside
     // the proper octant yet
     if (!drawableUpdates_.Empty())
     {
         URHO3D_PROFILE(ReinsertToOctree);
 
-        for (PODVector<Drawable*>::Iterator i = drawableUpdates_.Begin(); i != drawableUpdates_.End(); ++i)
+        // Check first in worker threads which drawables still fit their current octant, and find the octant to reinsert
+        // from for the rest
         {
-            Drawable* drawable = *i;
-            drawable->updateQueued_ = false;
-            Octant* octant = drawable->GetOctant();
-            const BoundingBox& box = drawable->GetWorldBoundingBox();
+            WorkQueue* queue = GetSubsystem<WorkQueue>();
+            reinsertOctants_.Resize(drawableUpdates_.Size());
+            boxUpdates_.Resize(drawableUpdates_.Size());
 
-            // Skip if no octant or does not belong to this octree anymore
-            if (!octant || octant->GetRoot() != this)
-                continue;
-            // Skip if still fits the current octant
-            if (drawable->IsOccludee() && octant->GetCullingBox().IsInside(box) == INSIDE && octant->CheckDrawableFit(box))
-                continue;
+            int numWorkItems = queue->GetNumThreads() + 1; // Worker threads + main thread
+            int drawablesPerItem = Max((int)(drawableUpdates_.Size() / numWorkItems), 1);
+
+            PODVector<Drawable*>::Iterator start = drawableUpdates_.Begin();
+            for (int i = 0; i < numWorkItems && start != drawableUpdates_.End(); ++i)
+            {
+                SharedPtr<WorkItem> item = queue->GetFreeItem();
+                item->priority_ = M_MAX_UNSIGNED;
+                item->workFunction_ = FindReinsertOctantsWork;
+                item->aux_ = this;
+
+                PODVector<Drawable*>::Iterator end = drawableUpdates_.End();
+                if (i < numWorkItems - 1 && end - start > drawablesPerItem)
+                    end = start + drawablesPerItem;
+
+                item->start_ = &(*start);
+                item->end_ = &(*end);
+                queue->AddWorkItem(item);
+
+                start = end;
+            }
 
-            InsertDrawable(drawable);
+            queue->Complete(M_MAX_UNSIGNED);
+        }
+
+        // Refresh the culling bounding boxes of the drawables that still fit their octant here, as the octants' box data is
+        // shared between the worker threads. Sort the remaining drawables by the level of the octant to reinsert from
+        reinsertions_.Clear();
+        for (unsigned i = 0; i < drawableUpdates_.Size(); ++i)
+        {
+            if (boxUpdates_[i])
+                drawableUpdates_[i]->GetOctant()->UpdateDrawableBox(drawableUpdates_[i]);
+            else if (reinsertOctants_[i])
+                reinsertions_.Push(MakePair(reinsertOctants_[i], drawableUpdates_[i]));
+        }
+        Sort(reinsertions_.Begin(), reinsertions_.End(), CompareReinsertions);
+        numReinsertedDrawables_ = reinsertions_.Size();
+
+        // The octants to reinsert from contain the drawables' current octants, so they will not be deleted while
+        // drawables are moved out of other octants
+        for (PODVector<Pair<Octant*, Drawable*> >::Iterator i = reinsertions_.Begin(); i != reinsertions_.End(); ++i)
+        {
+            Drawable* drawable = i->second_;
+            i->first_->InsertDrawable(drawable);
+            Octant* octant = drawable->GetOctant();
+            octant->UpdateDrawableBox(drawable);
 
 #ifdef _DEBUG
             // Verify that the drawable will be culled correctly
-            octant = drawable->GetOctant();
+            const BoundingBox& box = drawable->GetWorldBoundingBox();
             if (octant != this && octant->GetCullingBox().IsInside(box) != INSIDE)
             {
                 URHO3D_LOGERROR("Drawable is not fully inside its octant's culling bounds: drawable box " + box.ToString() +
@@ -503,10 +972,119 @@ void Octree::RemoveManualDrawable(Drawable* drawable)
         octant->RemoveDrawable(drawable);
 }
 
-void Octree::GetDrawables(OctreeQuery& query) const
+void Octree::GetDrawables(OctreeQuery& query, bool threaded) const
+{
+    query.result_.Clear();
+
+    WorkQueue* queue = GetSubsystem<WorkQueue>();
+    if (!threaded || !queue || !queue->GetNumThreads() || queue->IsCompleting() || numDrawables_ < MIN_THREADED_QUERY_DRAWABLES ||
+        !Thread::IsMainThread())
+    {
+        GetDrawablesInternal(query, query.GetFrustum(), false);
+        return;
+    }
+
+    URHO3D_PROFILE(GetDrawablesThreaded);
+
+    // Traverse the top levels in the main thread and collect the subtrees below
+    queryOctants_.Clear();
+    queryOctantsInside_.Clear();
+    GetDrawablesInternal(query, query.GetFrustum(), false, THREADED_QUERY_SPLIT_LEVEL, queryOctants_, queryOctantsInside_);
+    if (queryOctants_.Empty())
+        return;
+
+    // Divide the subtrees to work items by their drawable count
+    unsigned numWorkItems = Min(queue->GetNumThreads() + 1, queryOctants_.Size()); // Worker threads + main thread
+    unsigned numSubtreeDrawables = 0;
+    for (PODVector<Octant*>::ConstIterator i = queryOctants_.Begin(); i != queryOctants_.End(); ++i)
+        numSubtreeDrawables += (*i)->GetNumDrawables();
+    unsigned drawablesPerItem = numSubtreeDrawables / numWorkItems + 1;
+
+    if (queryBatches_.Size() < numWorkItems)
+        queryBatches_.Resize(numWorkItems);
+
+    unsigned octantIndex = 0;
+    for (unsigned i = 0; i < numWorkItems; ++i)
+    {
+        OctreeQueryBatch& batch = queryBatches_[i];
+        batch.octants_.Clear();
+        batch.octantsInside_.Clear();
+        batch.insideDrawables_.Clear();
+        batch.testDrawables_.Clear();
+
+        unsigned batchDrawables = 0;
+        while (octantIndex < queryOctants_.Size() && (batchDrawables < drawablesPerItem || i == numWorkItems - 1))
+        {
+            batchDrawables += queryOctants_[octantIndex]->GetNumDrawables();
+            batch.octants_.Push(queryOctants_[octantIndex]);
+            batch.octantsInside_.Push(queryOctantsInside_[octantIndex]);
+            ++octantIndex;
+        }
+
+        if (batch.octants_.Empty())
+            continue;
+
+        SharedPtr<WorkItem> item = queue->GetFreeItem();
+        item->priority_ = M_MAX_UNSIGNED;
+        item->workFunction_ = GetDrawablesWork;
+        item->aux_ = &query;
+        item->start_ = &batch;
+        queue->AddWorkItem(item);
+    }
+
+    queue->Complete(M_MAX_UNSIGNED);
+
+    // Let the query test the collected drawables
+    for (unsigned i = 0; i < numWorkItems; ++i)
+    {
+        OctreeQueryBatch& batch = queryBatches_[i];
+        if (batch.octants_.Empty())
+            continue;
+
+        if (batch.insideDrawables_.Size())
+            query.TestDrawables(&batch.insideDrawables_[0], &batch.insideDrawables_[0] + batch.insideDrawables_.Size(), true);
+        if (batch.testDrawables_.Size())
+            query.TestDrawables(&batch.testDrawables_[0], &batch.testDrawables_[0] + batch.testDrawables_.Size(), false);
+    }
+}
+
+void Octree::GetDrawables(OctreeQuery& query, OctreeQueryCache& cache) const
 {
+    const Frustum* frustum = query.GetFrustum();
+    if (!frustum)
+    {
+        GetDrawables(query);
+        return;
+    }
+
+    URHO3D_PROFILE(GetDrawablesCached);
+
     query.result_.Clear();
-    GetDrawablesInternal(query, false);
+
+    // If the frustum or octree has changed, all cached results are invalid
+    if (cache.octree_ != this || !FrustumEquals(cache.frustum_, *frustum))
+    {
+        cache.Clear();
+        cache.octree_ = this;
+        cache.frustum_ = *frustum;
+    }
+
+    if (!++cache.queryNumber_)
+        ++cache.queryNumber_;
+    cache.numHits_ = 0;
+    cache.numMisses_ = 0;
+    cache.numCachedDrawables_ = 0;
+
+    GetDrawablesInternal(query, *frustum, cache, false);
+
+    // Forget the results of octants that were not reached, as they may since have been deleted
+    for (HashMap<const Octant*, OctantCullingResult>::Iterator i = cache.results_.Begin(); i != cache.results_.End();)
+    {
+        if (i->second_.queryNumber_ != cache.queryNumber_)
+            i = cache.results_.Erase(i);
+        else
+            ++i;
+    }
 }
 
 void Octree::Raycast(RayOctreeQuery& query) const
@@ -586,6 +1164,48 @@ void Octree::DrawDebugGeometry(bool depthTest)
     DrawDebugGeometry(debug, depthTest);
 }
 
+void Octree::FindReinsertOctants(Drawable** start, Drawable** end)
+{
+    unsigned index = (unsigned)(start - &drawableUpdates_[0]);
+    Octant** reinsertOctant = &reinsertOctants_[0] + index;
+    bool* boxUpdate = &boxUpdates_[0] + index;
+
+    while (start != end)
+    {
+        Drawable* drawable = *start++;
+        drawable->updateQueued_ = false;
+        Octant* octant = drawable->GetOctant();
+        const BoundingBox& box = drawable->GetWorldBoundingBox();
+        *reinsertOctant = 0;
+        *boxUpdate = false;
+
+        // Skip if no octant or does not belong to this octree anymore
+        if (!octant || octant->GetRoot() != this)
+        {
+            ++reinsertOctant;
+            ++boxUpdate;
+            continue;
+        }
+
+        // If still fits the current octant, only refresh the bounding box used for culling. This is done later in the main
+        // thread, as drawables in the same octant may be checked in different threads
+        if (drawable->IsOccludee() && octant->GetCullingBox().IsInside(box) == INSIDE && octant->CheckDrawableFit(box))
+            *boxUpdate = true;
+        else if (!drawable->IsOccludee())
+            *reinsertOctant = this;
+        else
+        {
+            // Reinsert from the closest octant up the parent chain that contains the bounding box, instead of the root
+            while (octant != this && octant->GetCullingBox().IsInside(box) != INSIDE)
+                octant = octant->GetParent();
+            *reinsertOctant = octant;
+        }
+
+        ++reinsertOctant;
+        ++boxUpdate;
+    }
+}
+
 void Octree::HandleRenderUpdate(StringHash eventType, VariantMap& eventData)
 {
     // When running in headless mode, update the Octree manually during the RenderUpdate event
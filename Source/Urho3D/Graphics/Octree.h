@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "../Container/HashMap.h"
 #include "../Container/List.h"
 #include "../Core/Mutex.h"
 #include "../Graphics/Drawable.h"
@@ -30,14 +31,106 @@
 namespace Urho3D
 {
 
+class Octant;
 class Octree;
 
 static const int NUM_OCTANTS = 8;
 static const unsigned ROOT_INDEX = M_MAX_UNSIGNED;
 
+/// World bounding boxes of four drawable objects in structure-of-arrays layout, used for vectorized frustum culling. A box with infinite half size is invalid and must be tested by the query itself.
+struct DrawableBoxBlock
+{
+    /// Bounding box center X coordinates.
+    float centerX_[4];
+    /// Bounding box center Y coordinates.
+    float centerY_[4];
+    /// Bounding box center Z coordinates.
+    float centerZ_[4];
+    /// Bounding box half size X coordinates.
+    float halfSizeX_[4];
+    /// Bounding box half size Y coordinates.
+    float halfSizeY_[4];
+    /// Bounding box half size Z coordinates.
+    float halfSizeZ_[4];
+};
+
+/// Octree subtrees to traverse in a work item of a threaded octree query, and the collected drawables.
+struct OctreeQueryBatch
+{
+    /// Octants to traverse.
+    PODVector<Octant*> octants_;
+    /// Whether each octant is known to be fully inside the query volume.
+    PODVector<bool> octantsInside_;
+    /// Collected drawables known to be inside the query volume.
+    PODVector<Drawable*> insideDrawables_;
+    /// Collected drawables that need to be tested by the query.
+    PODVector<Drawable*> testDrawables_;
+};
+
+/// Cached frustum culling result of an octant's drawables.
+struct OctantCullingResult
+{
+    /// Construct.
+    OctantCullingResult() :
+        frameNumber_(0),
+        queryNumber_(0)
+    {
+    }
+
+    /// Octree frame number when the drawables were culled.
+    unsigned frameNumber_;
+    /// Number of the last query that used the result.
+    unsigned queryNumber_;
+    /// Drawables whose bounding box intersects the frustum.
+    PODVector<Drawable*> visibleDrawables_;
+    /// Drawables with a dirty bounding box, which need to be tested by the query.
+    PODVector<Drawable*> untestedDrawables_;
+};
+
+/// Visibility cache for repeated frustum queries. Remembers the frustum culling results of drawables per octant, and re-culls only the octants whose drawables have changed since, or all of them if the frustum changes. Octant tests and the query's own drawable tests are still performed on each query.
+class URHO3D_API OctreeQueryCache
+{
+    friend class Octant;
+    friend class Octree;
+
+public:
+    /// Construct.
+    OctreeQueryCache();
+
+    /// Forget all cached results.
+    void Clear();
+
+    /// Return number of octants whose cached culling result was used on the last query.
+    unsigned GetNumHits() const { return numHits_; }
+
+    /// Return number of octants that were culled again on the last query.
+    unsigned GetNumMisses() const { return numMisses_; }
+
+    /// Return number of drawables that were not culled again on the last query thanks to the cache.
+    unsigned GetNumCachedDrawables() const { return numCachedDrawables_; }
+
+private:
+    /// Cached culling results by octant.
+    HashMap<const Octant*, OctantCullingResult> results_;
+    /// Frustum of the cached results.
+    Frustum frustum_;
+    /// Octree of the cached results.
+    const Octree* octree_;
+    /// Query counter.
+    unsigned queryNumber_;
+    /// Number of cache hits on the last query.
+    unsigned numHits_;
+    /// Number of cache misses on the last query.
+    unsigned numMisses_;
+    /// Number of drawables in the octants that hit the cache on the last query.
+    unsigned numCachedDrawables_;
+};
+
 /// %Octree octant
 class URHO3D_API Octant
 {
+    friend void GetDrawablesWork(const WorkItem* item, unsigned threadIndex);
+
 public:
     /// Construct.
     Octant(const BoundingBox& box, unsigned level, Octant* parent, Octree* root, unsigned index = ROOT_INDEX);
@@ -56,22 +149,28 @@ public:
     /// Add a drawable object to this octant.
     void AddDrawable(Drawable* drawable)
     {
-        drawable->SetOctant(this);
-        drawables_.Push(drawable);
+        PushDrawable(drawable);
         IncDrawableCount();
     }
 
     /// Remove a drawable object from this octant.
     void RemoveDrawable(Drawable* drawable, bool resetOctant = true)
     {
-        if (drawables_.Remove(drawable))
+        unsigned index = drawable->octantIndex_;
+        if (index < drawables_.Size() && drawables_[index] == drawable)
         {
+            EraseDrawable(index);
             if (resetOctant)
                 drawable->SetOctant(0);
             DecDrawableCount();
         }
     }
 
+    /// Copy a drawable object's world bounding box for frustum culling, or invalidate the copy if the bounding box is dirty.
+    void UpdateDrawableBox(Drawable* drawable);
+    /// Invalidate the culling copy of a drawable object's world bounding box. Called when the bounding box is dirtied.
+    void InvalidateDrawableBox(Drawable* drawable);
+
     /// Return world-space bounding box.
     const BoundingBox& GetWorldBoundingBox() const { return worldBoundingBox_; }
 
@@ -90,6 +189,9 @@ public:
     /// Return number of drawables.
     unsigned GetNumDrawables() const { return numDrawables_; }
 
+    /// Return bitmask of existing child octants.
+    unsigned GetChildMask() const { return childMask_; }
+
     /// Return true if there are no drawable objects in this octant and child octants.
     bool IsEmpty() { return numDrawables_ == 0; }
 
@@ -101,12 +203,26 @@ public:
 protected:
     /// Initialize bounding box.
     void Initialize(const BoundingBox& box);
-    /// Return drawable objects by a query, called internally.
-    void GetDrawablesInternal(OctreeQuery& query, bool inside) const;
+    /// Return drawable objects by a query using cached frustum culling results for the drawables, called internally.
+    void GetDrawablesInternal(OctreeQuery& query, const Frustum& frustum, OctreeQueryCache& cache, bool inside) const;
+    /// Return drawable objects by a query, called internally. If a frustum is given, the drawables are frustum culled by their bounding box copies before passing them to the query.
+    void GetDrawablesInternal(OctreeQuery& query, const Frustum* frustum, bool inside) const;
+    /// Return drawable objects by a query down to a subdivision level, and collect the octants at that level for threaded traversal, called internally.
+    void GetDrawablesInternal(OctreeQuery& query, const Frustum* frustum, bool inside, unsigned splitLevel,
+        PODVector<Octant*>& octants, PODVector<bool>& octantsInside) const;
+    /// Frustum cull drawables of this octant in groups of four and pass the remaining ones to the query.
+    void CullDrawables(OctreeQuery& query, const Frustum& frustum) const;
     /// Return drawable objects by a ray query, called internally.
     void GetDrawablesInternal(RayOctreeQuery& query) const;
     /// Return drawable objects only for a threaded ray query, called internally.
     void GetDrawablesOnlyInternal(RayOctreeQuery& query, PODVector<Drawable*>& drawables) const;
+    /// Return the latest change frame number of this octant and the child octants intersecting a box, called internally.
+    unsigned GetChangeFrameNumberInternal(const BoundingBox& box) const;
+
+    /// Add a drawable object to the list without changing the drawable count.
+    void PushDrawable(Drawable* drawable);
+    /// Remove a drawable object from the list by index, moving the last drawable in its place.
+    void EraseDrawable(unsigned index);
 
     /// Increase drawable object count recursively.
     void IncDrawableCount()
@@ -138,8 +254,12 @@ protected:
     BoundingBox cullingBox_;
     /// Drawable objects.
     PODVector<Drawable*> drawables_;
+    /// Drawable object bounding boxes in the same order as the drawables.
+    PODVector<DrawableBoxBlock> drawableBoxes_;
     /// Child octants.
     Octant* children_[NUM_OCTANTS];
+    /// Bitmask of existing child octants.
+    unsigned childMask_;
     /// World bounding box center.
     Vector3 center_;
     /// World bounding box half size.
@@ -154,12 +274,15 @@ protected:
     Octree* root_;
     /// Octant index relative to its siblings or ROOT_INDEX for root octant
     unsigned index_;
+    /// Octree frame number when drawables were last added, removed or had their bounding box changed.
+    unsigned changeFrameNumber_;
 };
 
 /// %Octree component. Should be added only to the root scene node
 class URHO3D_API Octree : public Component, public Octant
 {
     friend void RaycastDrawablesWork(const WorkItem* item, unsigned threadIndex);
+    friend void FindReinsertOctantsWork(const WorkItem* item, unsigned threadIndex);
 
     URHO3D_OBJECT(Octree, Component);
 
@@ -185,8 +308,10 @@ public:
     /// Remove a manually added drawable.
     void RemoveManualDrawable(Drawable* drawable);
 
-    /// Return drawable objects by a query.
-    void GetDrawables(OctreeQuery& query) const;
+    /// Return drawable objects by a query. If threaded and called from the main thread outside work queue completion, traversal below the top levels of the octree is split to worker threads. In that case the query's TestOctant() must be threadsafe, while TestDrawables() is called only from the main thread.
+    void GetDrawables(OctreeQuery& query, bool threaded = false) const;
+    /// Return drawable objects by a frustum query, reusing the culling results of octants that have not changed since the previous query with the same cache. Falls back to an uncached query if the query has no frustum.
+    void GetDrawables(OctreeQuery& query, OctreeQueryCache& cache) const;
     /// Return drawable objects by a ray query.
     void Raycast(RayOctreeQuery& query) const;
     /// Return the closest drawable object by a ray query.
@@ -195,6 +320,18 @@ public:
     /// Return subdivision levels.
     unsigned GetNumLevels() const { return numLevels_; }
 
+    /// Return frame number of the last octree update.
+    unsigned GetFrameNumber() const { return frameNumber_; }
+
+    /// Return the latest octree frame number on which drawables were added, removed or had their bounding box changed within a world space box. May also report changes nearby. Is threadsafe outside the octree update.
+    unsigned GetChangeFrameNumber(const BoundingBox& box) const { return GetChangeFrameNumberInternal(box); }
+
+    /// Return number of drawables updated on the last octree update.
+    unsigned GetNumUpdatedDrawables() const { return numUpdatedDrawables_; }
+
+    /// Return number of drawables reinserted on the last octree update.
+    unsigned GetNumReinsertedDrawables() const { return numReinsertedDrawables_; }
+
     /// Mark drawable object as requiring an update and a reinsertion.
     void QueueUpdate(Drawable* drawable);
     /// Cancel drawable object's update.
@@ -205,17 +342,37 @@ public:
 private:
     /// Handle render update in case of headless execution.
     void HandleRenderUpdate(StringHash eventType, VariantMap& eventData);
+    /// Check whether updated drawables still fit their octants, and find the octants to reinsert from for the ones that do not. Called from worker threads.
+    void FindReinsertOctants(Drawable** start, Drawable** end);
 
     /// Drawable objects that require update.
     PODVector<Drawable*> drawableUpdates_;
     /// Drawable objects that were inserted during threaded update phase.
     PODVector<Drawable*> threadedDrawableUpdates_;
+    /// Octants to reinsert the updated drawables from, or null if no reinsertion needed. Same order as the drawable updates.
+    PODVector<Octant*> reinsertOctants_;
+    /// Flags for the updated drawables which still fit their octant and only need their culling bounding box refreshed. Same order as the drawable updates.
+    PODVector<bool> boxUpdates_;
+    /// Drawable objects to reinsert, sorted by the level of the octant to reinsert from and drawable ID.
+    PODVector<Pair<Octant*, Drawable*> > reinsertions_;
     /// Mutex for octree reinsertions.
     Mutex octreeMutex_;
     /// Ray query temporary list of drawables.
     mutable PODVector<Drawable*> rayQueryDrawables_;
+    /// Threaded query work item batches.
+    mutable Vector<OctreeQueryBatch> queryBatches_;
+    /// Threaded query octants to traverse in worker threads.
+    mutable PODVector<Octant*> queryOctants_;
+    /// Threaded query flags for octants being fully inside the query volume.
+    mutable PODVector<bool> queryOctantsInside_;
     /// Subdivision level.
     unsigned numLevels_;
+    /// Frame number of the last octree update.
+    unsigned frameNumber_;
+    /// Number of drawables updated on the last octree update.
+    unsigned numUpdatedDrawables_;
+    /// Number of drawables reinserted on the last octree update.
+    unsigned numReinsertedDrawables_;
 };
 
 }
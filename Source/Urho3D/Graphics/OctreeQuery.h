@@ -55,6 +55,8 @@ public:
     virtual Intersection TestOctant(const BoundingBox& box, bool inside) = 0;
     /// Intersection test for drawables.
     virtual void TestDrawables(Drawable** start, Drawable** end, bool inside) = 0;
+    /// Return frustum for vectorized culling of drawables by the octree, or null if none. When a frustum is returned, drawables outside it are culled before calling TestDrawables(), and drawables known to intersect it are passed as inside.
+    virtual const Frustum* GetFrustum() const { return 0; }
 
     /// Result vector reference.
     PODVector<Drawable*>& result_;
@@ -149,6 +151,8 @@ public:
     virtual Intersection TestOctant(const BoundingBox& box, bool inside);
     /// Intersection test for drawables.
     virtual void TestDrawables(Drawable** start, Drawable** end, bool inside);
+    /// Return frustum for vectorized culling of drawables by the octree.
+    virtual const Frustum* GetFrustum() const { return &frustum_; }
 
     /// Frustum.
     Frustum frustum_;
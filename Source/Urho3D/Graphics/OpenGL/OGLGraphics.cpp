@@ -1046,8 +1046,31 @@ void Graphics::SetShaders(ShaderVariation* vs, ShaderVariation* ps)
     if (vs == vertexShader_ && ps == pixelShader_)
         return;
 
-    // Compile the shaders now if not yet compiled. If already attempted, do not retry
-    if (vs && !vs->GetGPUObjectName())
+    // Try to load a new combination from a cached program binary, so that the shaders do not need to be compiled
+    bool programLinked = false;
+    if (vs && ps)
+    {
+        Pair<ShaderVariation*, ShaderVariation*> combination(vs, ps);
+        ShaderProgramMap::Iterator i = impl_->shaderPrograms_.Find(combination);
+
+        if (i == impl_->shaderPrograms_.End() && impl_->programBinarySupport_ && !shaderCacheDir_.Empty())
+        {
+            URHO3D_PROFILE(LoadShaderProgram);
+
+            SharedPtr<ShaderProgram> newProgram(new ShaderProgram(this, vs, ps));
+            if (newProgram->LoadBinary())
+            {
+                URHO3D_LOGDEBUG("Loaded cached shader program of vertex shader " + vs->GetFullName() + " and pixel shader " +
+                    ps->GetFullName());
+                i = impl_->shaderPrograms_.Insert(MakePair(combination, newProgram));
+            }
+        }
+
+        programLinked = i != impl_->shaderPrograms_.End() && i->second_->GetGPUObjectName();
+    }
+
+    // Compile the shaders now if not yet compiled and not linked already. If already attempted, do not retry
+    if (vs && !vs->GetGPUObjectName() && !programLinked)
     {
         if (vs->GetCompilerOutput().Empty())
         {
@@ -1066,7 +1089,7 @@ void Graphics::SetShaders(ShaderVariation* vs, ShaderVariation* ps)
             vs = 0;
     }
 
-    if (ps && !ps->GetGPUObjectName())
+    if (ps && !ps->GetGPUObjectName() && !programLinked)
     {
         if (ps->GetCompilerOutput().Empty())
         {
@@ -2750,6 +2773,18 @@ void Graphics::CheckFeatureSupport()
     if (numSupportedRTs >= 4)
         deferredSupport_ = true;
 
+    // Check for program binary support to cache linked shader programs on disk. Check the function pointers to work
+    // around GLEW failure to check extensions from a GL3 context
+    impl_->programBinarySupport_ = false;
+    if (glGetProgramBinary && glProgramBinary && glProgramParameteri)
+    {
+        int numFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+        impl_->programBinarySupport_ = numFormats > 0;
+    }
+    impl_->driverString_ = String((const char*)glGetString(GL_VENDOR)) + " " + String((const char*)glGetString(GL_RENDERER)) +
+        " " + String((const char*)glGetString(GL_VERSION));
+
 #if defined(__APPLE__) && !defined(IOS)
     // On OS X check for an Intel driver and use shadow map RGBA dummy color textures, because mixing
     // depth-only FBO rendering and backbuffer rendering will bug, resulting in a black screen in full
@@ -3233,6 +3268,7 @@ void Graphics::SetTextureUnitMappings()
     textureUnits_["IndirectionCubeMap"] = TU_INDIRECTION;
     textureUnits_["DepthBuffer"] = TU_DEPTHBUFFER;
     textureUnits_["LightBuffer"] = TU_LIGHTBUFFER;
+    textureUnits_["ClusterBuffer"] = TU_CLUSTERBUFFER;
     textureUnits_["ZoneCubeMap"] = TU_ZONE;
     textureUnits_["ZoneVolumeMap"] = TU_ZONE;
 #endif
@@ -46,7 +46,8 @@ GraphicsImpl::GraphicsImpl() :
     pixelFormat_(0),
     fboDirty_(false),
     vertexBuffersDirty_(false),
-    shaderProgram_(0)
+    shaderProgram_(0),
+    programBinarySupport_(false)
 {
 }
 
@@ -111,6 +111,12 @@ public:
     /// Return the GL Context.
     const SDL_GLContext& GetGLContext() { return context_; }
 
+    /// Return whether linked shader programs can be saved and loaded as program binaries.
+    bool GetProgramBinarySupport() const { return programBinarySupport_; }
+
+    /// Return the OpenGL vendor, renderer and version strings, which identify the driver that created a program binary.
+    const String& GetDriverString() const { return driverString_; }
+
 private:
     /// SDL OpenGL context.
     SDL_GLContext context_;
@@ -156,12 +162,16 @@ private:
     ShaderProgram* shaderProgram_;
     /// Linked shader programs.
     ShaderProgramMap shaderPrograms_;
+    /// OpenGL vendor, renderer and version strings.
+    String driverString_;
     /// Need FBO commit flag.
     bool fboDirty_;
     /// Need vertex attribute pointer update flag.
     bool vertexBuffersDirty_;
     /// sRGB write mode flag.
     bool sRGBWrite_;
+    /// Program binary support flag.
+    bool programBinarySupport_;
 };
 
 }
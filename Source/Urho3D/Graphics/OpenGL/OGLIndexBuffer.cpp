@@ -156,7 +156,7 @@ bool IndexBuffer::SetDataRange(const void* data, unsigned start, unsigned count,
     return true;
 }
 
-void* IndexBuffer::Lock(unsigned start, unsigned count, bool discard)
+void* IndexBuffer::Lock(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     if (lockState_ != LOCK_NONE)
     {
@@ -258,7 +258,7 @@ bool IndexBuffer::UpdateToGPU()
         return false;
 }
 
-void* IndexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
+void* IndexBuffer::MapBuffer(unsigned start, unsigned count, bool discard, bool noOverwrite)
 {
     // Never called on OpenGL
     return 0;
@@ -22,12 +22,17 @@
 
 #include "../../Precompiled.h"
 
+#include "../../Core/Timer.h"
 #include "../../Graphics/ConstantBuffer.h"
 #include "../../Graphics/Graphics.h"
 #include "../../Graphics/GraphicsImpl.h"
 #include "../../Graphics/ShaderProgram.h"
+#include "../../Graphics/Shader.h"
 #include "../../Graphics/ShaderVariation.h"
+#include "../../IO/File.h"
+#include "../../IO/FileSystem.h"
 #include "../../IO/Log.h"
+#include "../../Resource/ResourceCache.h"
 
 #include "../../DebugNew.h"
 
@@ -128,6 +133,13 @@ bool ShaderProgram::Link()
         return false;
     }
 
+#ifndef GL_ES_VERSION_2_0
+    // Allow retrieving the program binary for the shader cache
+    bool saveBinary = graphics_->GetImpl()->GetProgramBinarySupport() && !graphics_->GetShaderCacheDir().Empty();
+    if (saveBinary)
+        glProgramParameteri(object_.name_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
     glAttachShader(object_.name_, vertexShader_->GetGPUObjectName());
     glAttachShader(object_.name_, pixelShader_->GetGPUObjectName());
     glLinkProgram(object_.name_);
@@ -149,6 +161,83 @@ bool ShaderProgram::Link()
     if (!object_.name_)
         return false;
 
+#ifndef GL_ES_VERSION_2_0
+    if (saveBinary)
+        SaveBinary();
+#endif
+
+    ParseParameters();
+    return true;
+}
+
+bool ShaderProgram::LoadBinary()
+{
+    Release();
+
+    if (!vertexShader_ || !pixelShader_ || !graphics_)
+        return false;
+
+#ifndef GL_ES_VERSION_2_0
+    ResourceCache* cache = graphics_->GetSubsystem<ResourceCache>();
+    String binaryName = GetBinaryName();
+    if (!cache->Exists(binaryName))
+        return false;
+
+    SharedPtr<File> file = cache->GetFile(binaryName);
+    if (!file || file->ReadFileID() != "UGLP")
+    {
+        URHO3D_LOGERROR(binaryName + " is not a valid shader program binary file");
+        return false;
+    }
+
+    // The binary is valid only for the same driver and the same source code
+    if (file->ReadString() != graphics_->GetImpl()->GetDriverString())
+        return false;
+    unsigned long long vsSourceHash = file->ReadUInt64();
+    unsigned long long psSourceHash = file->ReadUInt64();
+    if (vsSourceHash != vertexShader_->GetSourceHash() || psSourceHash != pixelShader_->GetSourceHash())
+        return false;
+
+    unsigned binaryFormat = file->ReadUInt();
+    unsigned binarySize = file->ReadUInt();
+    if (!binarySize)
+    {
+        URHO3D_LOGERROR(binaryName + " has zero length program binary");
+        return false;
+    }
+
+    PODVector<unsigned char> binary(binarySize);
+    if (file->Read(&binary[0], binarySize) != binarySize)
+        return false;
+
+    object_.name_ = glCreateProgram();
+    if (!object_.name_)
+    {
+        linkerOutput_ = "Could not create shader program";
+        return false;
+    }
+
+    glProgramBinary(object_.name_, (GLenum)binaryFormat, &binary[0], (GLsizei)binarySize);
+
+    // The driver may still reject the binary, in which case the shaders will be compiled and linked instead
+    int linked;
+    glGetProgramiv(object_.name_, GL_LINK_STATUS, &linked);
+    if (!linked)
+    {
+        glDeleteProgram(object_.name_);
+        object_.name_ = 0;
+        return false;
+    }
+
+    ParseParameters();
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ShaderProgram::ParseParameters()
+{
     const int MAX_NAME_LENGTH = 256;
     char nameBuffer[MAX_NAME_LENGTH];
     int attributeCount, uniformCount, elementCount, nameLength;
@@ -320,8 +409,81 @@ bool ShaderProgram::Link()
     // Rehash the parameter & vertex attributes maps to ensure minimal load factor
     vertexAttributes_.Rehash(NextPowerOfTwo(vertexAttributes_.Size()));
     shaderParameters_.Rehash(NextPowerOfTwo(shaderParameters_.Size()));
+}
 
-    return true;
+void ShaderProgram::SaveBinary()
+{
+#ifndef GL_ES_VERSION_2_0
+    int length = 0;
+    glGetProgramiv(object_.name_, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    PODVector<unsigned char> binary((unsigned)length);
+    GLenum binaryFormat = 0;
+    int binarySize = 0;
+    glGetProgramBinary(object_.name_, length, &binarySize, &binaryFormat, &binary[0]);
+    if (binarySize <= 0)
+        return;
+
+    ResourceCache* cache = graphics_->GetSubsystem<ResourceCache>();
+    FileSystem* fileSystem = graphics_->GetSubsystem<FileSystem>();
+
+    // Filename may or may not be inside the resource system
+    String fullName = GetBinaryName();
+    if (!IsAbsolutePath(fullName))
+    {
+        // If not absolute, use the resource dir of the vertex shader
+        Shader* owner = vertexShader_->GetOwner();
+        if (!owner)
+            return;
+        String shaderFileName = cache->GetResourceFileName(owner->GetName());
+        if (shaderFileName.Empty())
+            return;
+        fullName = shaderFileName.Substring(0, shaderFileName.Find(owner->GetName())) + fullName;
+    }
+    String path = GetPath(fullName);
+    if (!fileSystem->DirExists(path))
+        fileSystem->CreateDir(path);
+
+    // Write to a uniquely named temporary file and rename it when complete, so that another process or a crash can not
+    // leave a partially written binary behind
+    String tempName = fullName + "." + ToStringHex(Time::GetSystemTime()) + ToStringHex((unsigned)(size_t)this) + ".tmp";
+    SharedPtr<File> file(new File(graphics_->GetContext(), tempName, FILE_WRITE));
+    if (!file->IsOpen())
+        return;
+
+    bool success = file->WriteFileID("UGLP");
+    success &= file->WriteString(graphics_->GetImpl()->GetDriverString());
+    success &= file->WriteUInt64(vertexShader_->GetSourceHash());
+    success &= file->WriteUInt64(pixelShader_->GetSourceHash());
+    success &= file->WriteUInt(binaryFormat);
+    success &= file->WriteUInt((unsigned)binarySize);
+    success &= file->Write(&binary[0], (unsigned)binarySize) == (unsigned)binarySize;
+    file->Close();
+
+    if (!success)
+    {
+        fileSystem->Delete(tempName);
+        return;
+    }
+
+    // Renaming over an existing file fails on Windows, so remove an outdated binary first
+    if (!fileSystem->Rename(tempName, fullName))
+    {
+        fileSystem->Delete(fullName);
+        if (!fileSystem->Rename(tempName, fullName))
+            fileSystem->Delete(tempName);
+    }
+#endif
+}
+
+String ShaderProgram::GetBinaryName() const
+{
+    // Name the binary after both shaders and the low bits of their source hashes, which include the defines. The full
+    // hashes are stored in the file and verified when loading
+    return graphics_->GetShaderCacheDir() + vertexShader_->GetName() + "_" + pixelShader_->GetName() + "_" +
+        ToStringHex((unsigned)vertexShader_->GetSourceHash()) + ToStringHex((unsigned)pixelShader_->GetSourceHash()) + ".glp";
 }
 
 ShaderVariation* ShaderProgram::GetVertexShader() const
@@ -50,6 +50,8 @@ public:
 
     /// Link the shaders and examine the uniforms and samplers used. Return true if successful.
     bool Link();
+    /// Create from a cached program binary and examine the uniforms and samplers used. The shaders do not need to be compiled. Return true if successful.
+    bool LoadBinary();
 
     /// Return the vertex shader.
     ShaderVariation* GetVertexShader() const;
@@ -87,6 +89,13 @@ public:
     static void ClearGlobalParameterSource(ShaderParameterGroup group);
 
 private:
+    /// Examine the vertex attributes, uniforms and samplers used by the linked program.
+    void ParseParameters();
+    /// Save the program binary to the shader cache directory.
+    void SaveBinary();
+    /// Return the program binary file name.
+    String GetBinaryName() const;
+
     /// Vertex shader.
     WeakPtr<ShaderVariation> vertexShader_;
     /// Pixel shader.
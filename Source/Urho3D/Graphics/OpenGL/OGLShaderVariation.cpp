@@ -80,13 +80,23 @@ void ShaderVariation::Release()
         object_.name_ = 0;
         graphics_->CleanupShaderPrograms(this);
     }
+    else if (sourceHash_ && graphics_)
+    {
+        // Shader programs may have been loaded from cached program binaries without compiling this shader
+        graphics_->CleanupShaderPrograms(this);
+    }
 
     compilerOutput_.Clear();
+    sourceHash_ = 0;
 }
 
 bool ShaderVariation::Create()
 {
-    Release();
+    // Release only if compiled before, so that shader programs loaded from cached program binaries remain in use
+    if (object_.name_)
+        Release();
+    else
+        compilerOutput_.Clear();
 
     if (!owner_)
     {
@@ -101,6 +111,54 @@ bool ShaderVariation::Create()
         return false;
     }
 
+    String shaderCode = GetShaderCode();
+    const char* shaderCStr = shaderCode.CString();
+    glShaderSource(object_.name_, 1, &shaderCStr, 0);
+    glCompileShader(object_.name_);
+
+    int compiled, length;
+    glGetShaderiv(object_.name_, GL_COMPILE_STATUS, &compiled);
+    if (!compiled)
+    {
+        glGetShaderiv(object_.name_, GL_INFO_LOG_LENGTH, &length);
+        compilerOutput_.Resize((unsigned)length);
+        int outLength;
+        glGetShaderInfoLog(object_.name_, length, &outLength, &compilerOutput_[0]);
+        glDeleteShader(object_.name_);
+        object_.name_ = 0;
+    }
+    else
+        compilerOutput_.Clear();
+
+    return object_.name_ != 0;
+}
+
+void ShaderVariation::SetDefines(const String& defines)
+{
+    defines_ = defines;
+    sourceHash_ = 0;
+}
+
+unsigned long long ShaderVariation::GetSourceHash()
+{
+    if (!sourceHash_ && owner_)
+    {
+        // StringHash is only 32-bit and case-insensitive, so use a 64-bit FNV-1a hash of the exact source code instead
+        String shaderCode = GetShaderCode();
+        const unsigned char* data = (const unsigned char*)shaderCode.CString();
+        sourceHash_ = 14695981039346656037ULL;
+        for (unsigned i = 0; i < shaderCode.Length(); ++i)
+            sourceHash_ = (sourceHash_ ^ data[i]) * 1099511628211ULL;
+        // Zero is reserved to mean not calculated
+        if (!sourceHash_)
+            sourceHash_ = 1;
+    }
+
+    return sourceHash_;
+}
+
+String ShaderVariation::GetShaderCode() const
+{
     const String& originalShaderCode = owner_->GetSourceCode(type_);
     String shaderCode;
 
@@ -166,30 +224,7 @@ bool ShaderVariation::Create()
     else
         shaderCode += originalShaderCode;
 
-    const char* shaderCStr = shaderCode.CString();
-    glShaderSource(object_.name_, 1, &shaderCStr, 0);
-    glCompileShader(object_.name_);
-
-    int compiled, length;
-    glGetShaderiv(object_.name_, GL_COMPILE_STATUS, &compiled);
-    if (!compiled)
-    {
-        glGetShaderiv(object_.name_, GL_INFO_LOG_LENGTH, &length);
-        compilerOutput_.Resize((unsigned)length);
-        int outLength;
-        glGetShaderInfoLog(object_.name_, length, &outLength, &compilerOutput_[0]);
-        glDeleteShader(object_.name_);
-        object_.name_ = 0;
-    }
-    else
-        compilerOutput_.Clear();
-
-    return object_.name_ != 0;
-}
-
-void ShaderVariation::SetDefines(const String& defines)
-{
-    defines_ = defines;
+    return shaderCode;
 }
 
 }
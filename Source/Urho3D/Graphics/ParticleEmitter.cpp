@@ -32,6 +32,10 @@
 #include "../Scene/Scene.h"
 #include "../Scene/SceneEvents.h"
 
+#ifdef URHO3D_SSE
+#include <xmmintrin.h>
+#endif
+
 #include "../DebugNew.h"
 
 namespace Urho3D
@@ -43,8 +47,17 @@ static const unsigned MAX_PARTICLES_IN_FRAME = 100;
 
 extern const char* autoRemoveModeNames[];
 
+#ifdef URHO3D_SSE
+/// Select the lanes of a where the mask is set and the lanes of b elsewhere.
+static inline __m128 SelectPS(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+#endif
+
 ParticleEmitter::ParticleEmitter(Context* context) :
     BillboardSet(context),
+    numParticles_(0),
     periodTimer_(0.0f),
     emissionTimer_(0.0f),
     lastTimeStep_(0.0f),
@@ -110,8 +123,8 @@ void ParticleEmitter::Update(const FrameInfo& frame)
         return;
 
     // If there is an amount mismatch between particles and billboards, correct it
-    if (particles_.Size() != billboards_.Size())
-        SetNumBillboards(particles_.Size());
+    if (numParticles_ != billboards_.Size())
+        SetNumBillboards(numParticles_);
 
     bool needCommit = false;
 
@@ -167,89 +180,180 @@ void ParticleEmitter::Update(const FrameInfo& frame)
         }
     }
 
-    // Update existing particles
-    Vector3 relativeConstantForce = node_->GetWorldRotation().Inverse() * effect_->GetConstantForce();
+    // Update existing particles. The integration is vectorized over blocks of four particles, while the color and texture
+    // animation, which depend on the frame timings of each particle, are done per particle
+    Vector3 force = lastTimeStep_ * (relative_ ? node_->GetWorldRotation().Inverse() * effect_->GetConstantForce() :
+        effect_->GetConstantForce());
+    // Damping force is proportional to velocity, so it can be applied as a multiplier
+    float damping = 1.0f - lastTimeStep_ * effect_->GetDampingForce();
     // If billboards are not relative, apply scaling to the position update
-    Vector3 scaleVector = Vector3::ONE;
+    Vector3 positionStep = Vector3::ONE * lastTimeStep_;
     if (scaled_ && !relative_)
-        scaleVector = node_->GetWorldScale();
-
-    for (unsigned i = 0; i < particles_.Size(); ++i)
+        positionStep = node_->GetWorldScale() * lastTimeStep_;
+    bool scaling = effect_->GetSizeAdd() != 0.0f || effect_->GetSizeMul() != 1.0f;
+    float sizeAdd = lastTimeStep_ * effect_->GetSizeAdd();
+    float sizeMul = lastTimeStep_ * (effect_->GetSizeMul() - 1.0f) + 1.0f;
+    const Vector<ColorFrame>& colorFrames = effect_->GetColorFrames();
+    const Vector<TextureFrame>& textureFrames = effect_->GetTextureFrames();
+
+#ifdef URHO3D_SSE
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 timeStepV = _mm_set1_ps(lastTimeStep_);
+    __m128 forceX = _mm_set1_ps(force.x_);
+    __m128 forceY = _mm_set1_ps(force.y_);
+    __m128 forceZ = _mm_set1_ps(force.z_);
+    __m128 dampingV = _mm_set1_ps(damping);
+    __m128 positionStepX = _mm_set1_ps(positionStep.x_);
+    __m128 positionStepY = _mm_set1_ps(positionStep.y_);
+    __m128 positionStepZ = _mm_set1_ps(positionStep.z_);
+    __m128 sizeAddV = _mm_set1_ps(sizeAdd);
+    __m128 sizeMulV = _mm_set1_ps(sizeMul);
+#endif
+
+    for (unsigned i = 0; i < numParticles_; i += 4)
     {
-        Particle& particle = particles_[i];
-        Billboard& billboard = billboards_[i];
-
-        if (billboard.enabled_)
+        ParticleBlock& block = particleBlocks_[i >> 2];
+        Billboard* billboards = &billboards_[i];
+        unsigned count = Min(numParticles_ - i, 4U);
+
+        // Expire the particles whose lifetime has ended, and gather the positions and rotations of the rest
+        unsigned aliveMask = 0;
+        float positionX[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float positionY[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float positionZ[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float rotation[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (unsigned j = 0; j < count; ++j)
         {
-            needCommit = true;
+            Billboard& billboard = billboards[j];
+            if (!billboard.enabled_)
+                continue;
 
-            // Time to live
-            if (particle.timer_ >= particle.timeToLive_)
+            needCommit = true;
+            if (block.timer_[j] >= block.timeToLive_[j])
             {
                 billboard.enabled_ = false;
                 continue;
             }
-            particle.timer_ += lastTimeStep_;
 
-            // Velocity & position
-            const Vector3& constantForce = effect_->GetConstantForce();
-            if (constantForce != Vector3::ZERO)
-            {
-                if (relative_)
-                    particle.velocity_ += lastTimeStep_ * relativeConstantForce;
-                else
-                    particle.velocity_ += lastTimeStep_ * constantForce;
-            }
+            aliveMask |= 1 << j;
+            positionX[j] = billboard.position_.x_;
+            positionY[j] = billboard.position_.y_;
+            positionZ[j] = billboard.position_.z_;
+            rotation[j] = billboard.rotation_;
+        }
 
-            float dampingForce = effect_->GetDampingForce();
-            if (dampingForce != 0.0f)
-            {
-                Vector3 force = -dampingForce * particle.velocity_;
-                particle.velocity_ += lastTimeStep_ * force;
-            }
-            billboard.position_ += lastTimeStep_ * particle.velocity_ * scaleVector;
-            billboard.direction_ = particle.velocity_.Normalized();
+        if (!aliveMask)
+            continue;
+
+        float directionX[4];
+        float directionY[4];
+        float directionZ[4];
+
+#ifdef URHO3D_SSE
+        // Only the alive particles' state is stored, so that the free slots do not accumulate denormal or infinite values
+        __m128 alive = _mm_cmpgt_ps(_mm_set_ps((float)((aliveMask >> 3) & 1), (float)((aliveMask >> 2) & 1),
+            (float)((aliveMask >> 1) & 1), (float)(aliveMask & 1)), zero);
+
+        __m128 timer = _mm_loadu_ps(block.timer_);
+        _mm_storeu_ps(block.timer_, SelectPS(alive, _mm_add_ps(timer, timeStepV), timer));
+
+        __m128 oldVelocityX = _mm_loadu_ps(block.velocityX_);
+        __m128 oldVelocityY = _mm_loadu_ps(block.velocityY_);
+        __m128 oldVelocityZ = _mm_loadu_ps(block.velocityZ_);
+        __m128 velocityX = _mm_mul_ps(_mm_add_ps(oldVelocityX, forceX), dampingV);
+        __m128 velocityY = _mm_mul_ps(_mm_add_ps(oldVelocityY, forceY), dampingV);
+        __m128 velocityZ = _mm_mul_ps(_mm_add_ps(oldVelocityZ, forceZ), dampingV);
+        _mm_storeu_ps(block.velocityX_, SelectPS(alive, velocityX, oldVelocityX));
+        _mm_storeu_ps(block.velocityY_, SelectPS(alive, velocityY, oldVelocityY));
+        _mm_storeu_ps(block.velocityZ_, SelectPS(alive, velocityZ, oldVelocityZ));
+
+        _mm_storeu_ps(positionX, _mm_add_ps(_mm_loadu_ps(positionX), _mm_mul_ps(positionStepX, velocityX)));
+        _mm_storeu_ps(positionY, _mm_add_ps(_mm_loadu_ps(positionY), _mm_mul_ps(positionStepY, velocityY)));
+        _mm_storeu_ps(positionZ, _mm_add_ps(_mm_loadu_ps(positionZ), _mm_mul_ps(positionStepZ, velocityZ)));
+
+        // Normalize the velocity for the direction, leaving zero velocities unnormalized
+        __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(velocityX, velocityX), _mm_mul_ps(velocityY, velocityY)),
+            _mm_mul_ps(velocityZ, velocityZ));
+        __m128 invLength = SelectPS(_mm_cmpgt_ps(lengthSquared, zero), _mm_div_ps(one, _mm_sqrt_ps(lengthSquared)), one);
+        _mm_storeu_ps(directionX, _mm_mul_ps(velocityX, invLength));
+        _mm_storeu_ps(directionY, _mm_mul_ps(velocityY, invLength));
+        _mm_storeu_ps(directionZ, _mm_mul_ps(velocityZ, invLength));
+
+        _mm_storeu_ps(rotation, _mm_add_ps(_mm_loadu_ps(rotation), _mm_mul_ps(timeStepV, _mm_loadu_ps(block.rotationSpeed_))));
+
+        if (scaling)
+        {
+            __m128 scale = _mm_loadu_ps(block.scale_);
+            __m128 newScale = _mm_mul_ps(_mm_max_ps(_mm_add_ps(scale, sizeAddV), zero), sizeMulV);
+            _mm_storeu_ps(block.scale_, SelectPS(alive, newScale, scale));
+        }
+#else
+        for (unsigned j = 0; j < count; ++j)
+        {
+            if (!(aliveMask & (1 << j)))
+                continue;
 
-            // Rotation
-            billboard.rotation_ += lastTimeStep_ * particle.rotationSpeed_;
+            block.timer_[j] += lastTimeStep_;
 
-            // Scaling
-            float sizeAdd = effect_->GetSizeAdd();
-            float sizeMul = effect_->GetSizeMul();
-            if (sizeAdd != 0.0f || sizeMul != 1.0f)
-            {
-                particle.scale_ += lastTimeStep_ * sizeAdd;
-                if (particle.scale_ < 0.0f)
-                    particle.scale_ = 0.0f;
-                if (sizeMul != 1.0f)
-                    particle.scale_ *= (lastTimeStep_ * (sizeMul - 1.0f)) + 1.0f;
-                billboard.size_ = particle.size_ * particle.scale_;
-            }
+            Vector3 velocity((block.velocityX_[j] + force.x_) * damping, (block.velocityY_[j] + force.y_) * damping,
+                (block.velocityZ_[j] + force.z_) * damping);
+            block.velocityX_[j] = velocity.x_;
+            block.velocityY_[j] = velocity.y_;
+            block.velocityZ_[j] = velocity.z_;
+
+            positionX[j] += positionStep.x_ * velocity.x_;
+            positionY[j] += positionStep.y_ * velocity.y_;
+            positionZ[j] += positionStep.z_ * velocity.z_;
+
+            Vector3 direction = velocity.Normalized();
+            directionX[j] = direction.x_;
+            directionY[j] = direction.y_;
+            directionZ[j] = direction.z_;
+
+            rotation[j] += lastTimeStep_ * block.rotationSpeed_[j];
+
+            if (scaling)
+                block.scale_[j] = Max(block.scale_[j] + sizeAdd, 0.0f) * sizeMul;
+        }
+#endif
+
+        // Scatter the results to the billboards and animate colors and textures
+        for (unsigned j = 0; j < count; ++j)
+        {
+            if (!(aliveMask & (1 << j)))
+                continue;
+
+            Billboard& billboard = billboards[j];
+            billboard.position_ = Vector3(positionX[j], positionY[j], positionZ[j]);
+            billboard.direction_ = Vector3(directionX[j], directionY[j], directionZ[j]);
+            billboard.rotation_ = rotation[j];
+            if (scaling)
+                billboard.size_ = Vector2(block.sizeX_[j], block.sizeY_[j]) * block.scale_[j];
 
             // Color interpolation
-            unsigned& index = particle.colorIndex_;
-            const Vector<ColorFrame>& colorFrames_ = effect_->GetColorFrames();
-            if (index < colorFrames_.Size())
+            float timer = block.timer_[j];
+            unsigned& index = block.colorIndex_[j];
+            if (index < colorFrames.Size())
             {
-                if (index < colorFrames_.Size() - 1)
+                if (index < colorFrames.Size() - 1)
                 {
-                    if (particle.timer_ >= colorFrames_[index + 1].time_)
+                    if (timer >= colorFrames[index + 1].time_)
                         ++index;
                 }
-                if (index < colorFrames_.Size() - 1)
-                    billboard.color_ = colorFrames_[index].Interpolate(colorFrames_[index + 1], particle.timer_);
+                if (index < colorFrames.Size() - 1)
+                    billboard.color_ = colorFrames[index].Interpolate(colorFrames[index + 1], timer);
                 else
-                    billboard.color_ = colorFrames_[index].color_;
+                    billboard.color_ = colorFrames[index].color_;
             }
 
             // Texture animation
-            unsigned& texIndex = particle.texIndex_;
-            const Vector<TextureFrame>& textureFrames_ = effect_->GetTextureFrames();
-            if (textureFrames_.Size() && texIndex < textureFrames_.Size() - 1)
+            unsigned& texIndex = block.texIndex_[j];
+            if (textureFrames.Size() && texIndex < textureFrames.Size() - 1)
             {
-                if (particle.timer_ >= textureFrames_[texIndex + 1].time_)
+                if (timer >= textureFrames[texIndex + 1].time_)
                 {
-                    billboard.uv_ = textureFrames_[texIndex + 1].uv_;
+                    billboard.uv_ = textureFrames[texIndex + 1].uv_;
                     ++texIndex;
                 }
             }
@@ -290,7 +394,14 @@ void ParticleEmitter::SetNumParticles(unsigned num)
     if (num > MAX_BILLBOARDS)
         num = MAX_BILLBOARDS;
 
-    particles_.Resize(num);
+    // Clear the simulation state of new blocks, as the free slots are also processed by the vectorized update
+    unsigned oldNumBlocks = particleBlocks_.Size();
+    unsigned numBlocks = (num + 3) >> 2;
+    particleBlocks_.Resize(numBlocks);
+    if (numBlocks > oldNumBlocks)
+        memset(&particleBlocks_[oldNumBlocks], 0, (numBlocks - oldNumBlocks) * sizeof(ParticleBlock));
+
+    numParticles_ = num;
     SetNumBillboards(num);
 }
 
@@ -373,16 +484,23 @@ void ParticleEmitter::SetParticlesAttr(const VariantVector& value)
     unsigned index = 0;
     SetNumParticles(index < value.Size() ? value[index++].GetUInt() : 0);
 
-    for (PODVector<Particle>::Iterator i = particles_.Begin(); i != particles_.End() && index < value.Size(); ++i)
+    for (unsigned i = 0; i < numParticles_ && index < value.Size(); ++i)
     {
-        i->velocity_ = value[index++].GetVector3();
-        i->size_ = value[index++].GetVector2();
-        i->timer_ = value[index++].GetFloat();
-        i->timeToLive_ = value[index++].GetFloat();
-        i->scale_ = value[index++].GetFloat();
-        i->rotationSpeed_ = value[index++].GetFloat();
-        i->colorIndex_ = (unsigned)value[index++].GetInt();
-        i->texIndex_ = (unsigned)value[index++].GetInt();
+        ParticleBlock& block = particleBlocks_[i >> 2];
+        unsigned j = i & 3;
+        Vector3 velocity = value[index++].GetVector3();
+        Vector2 size = value[index++].GetVector2();
+        block.velocityX_[j] = velocity.x_;
+        block.velocityY_[j] = velocity.y_;
+        block.velocityZ_[j] = velocity.z_;
+        block.sizeX_[j] = size.x_;
+        block.sizeY_[j] = size.y_;
+        block.timer_[j] = value[index++].GetFloat();
+        block.timeToLive_[j] = value[index++].GetFloat();
+        block.scale_[j] = value[index++].GetFloat();
+        block.rotationSpeed_[j] = value[index++].GetFloat();
+        block.colorIndex_[j] = (unsigned)value[index++].GetInt();
+        block.texIndex_[j] = (unsigned)value[index++].GetInt();
     }
 }
 
@@ -391,22 +509,24 @@ VariantVector ParticleEmitter::GetParticlesAttr() const
     VariantVector ret;
     if (!serializeParticles_)
     {
-        ret.Push(particles_.Size());
+        ret.Push(numParticles_);
         return ret;
     }
 
-    ret.Reserve(particles_.Size() * 8 + 1);
-    ret.Push(particles_.Size());
-    for (PODVector<Particle>::ConstIterator i = particles_.Begin(); i != particles_.End(); ++i)
+    ret.Reserve(numParticles_ * 8 + 1);
+    ret.Push(numParticles_);
+    for (unsigned i = 0; i < numParticles_; ++i)
     {
-        ret.Push(i->velocity_);
-        ret.Push(i->size_);
-        ret.Push(i->timer_);
-        ret.Push(i->timeToLive_);
-        ret.Push(i->scale_);
-        ret.Push(i->rotationSpeed_);
-        ret.Push(i->colorIndex_);
-        ret.Push(i->texIndex_);
+        const ParticleBlock& block = particleBlocks_[i >> 2];
+        unsigned j = i & 3;
+        ret.Push(Vector3(block.velocityX_[j], block.velocityY_[j], block.velocityZ_[j]));
+        ret.Push(Vector2(block.sizeX_[j], block.sizeY_[j]));
+        ret.Push(block.timer_[j]);
+        ret.Push(block.timeToLive_[j]);
+        ret.Push(block.scale_[j]);
+        ret.Push(block.rotationSpeed_[j]);
+        ret.Push(block.colorIndex_[j]);
+        ret.Push(block.texIndex_[j]);
     }
     return ret;
 }
@@ -452,8 +572,9 @@ bool ParticleEmitter::EmitNewParticle()
     unsigned index = GetFreeParticle();
     if (index == M_MAX_UNSIGNED)
         return false;
-    assert(index < particles_.Size());
-    Particle& particle = particles_[index];
+    assert(index < numParticles_);
+    ParticleBlock& block = particleBlocks_[index >> 2];
+    unsigned lane = index & 3;
     Billboard& billboard = billboards_[index];
 
     Vector3 startDir;
@@ -488,17 +609,19 @@ bool ParticleEmitter::EmitNewParticle()
         break;
     }
 
-    particle.size_ = effect_->GetRandomSize();
-    particle.timer_ = 0.0f;
-    particle.timeToLive_ = effect_->GetRandomTimeToLive();
-    particle.scale_ = 1.0f;
-    particle.rotationSpeed_ = effect_->GetRandomRotationSpeed();
-    particle.colorIndex_ = 0;
-    particle.texIndex_ = 0;
+    Vector2 size = effect_->GetRandomSize();
+    block.sizeX_[lane] = size.x_;
+    block.sizeY_[lane] = size.y_;
+    block.timer_[lane] = 0.0f;
+    block.timeToLive_[lane] = effect_->GetRandomTimeToLive();
+    block.scale_[lane] = 1.0f;
+    block.rotationSpeed_[lane] = effect_->GetRandomRotationSpeed();
+    block.colorIndex_[lane] = 0;
+    block.texIndex_[lane] = 0;
 
     if (faceCameraMode_ == FC_DIRECTION)
     {
-        startPos += startDir * particle.size_.y_;
+        startPos += startDir * size.y_;
     }
 
     if (!relative_)
@@ -507,10 +630,13 @@ bool ParticleEmitter::EmitNewParticle()
         startDir = node_->GetWorldRotation() * startDir;
     };
 
-    particle.velocity_ = effect_->GetRandomVelocity() * startDir;
+    Vector3 velocity = effect_->GetRandomVelocity() * startDir;
+    block.velocityX_[lane] = velocity.x_;
+    block.velocityY_[lane] = velocity.y_;
+    block.velocityZ_[lane] = velocity.z_;
 
     billboard.position_ = startPos;
-    billboard.size_ = particles_[index].size_;
+    billboard.size_ = size;
     const Vector<TextureFrame>& textureFrames_ = effect_->GetTextureFrames();
     billboard.uv_ = textureFrames_.Size() ? textureFrames_[0].uv_ : Rect::POSITIVE;
     billboard.rotation_ = effect_->GetRandomRotation();
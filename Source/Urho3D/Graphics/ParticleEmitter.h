@@ -29,25 +29,31 @@ namespace Urho3D
 
 class ParticleEffect;
 
-/// One particle in the particle system.
-struct Particle
+/// Simulation state of four particles in structure-of-arrays layout, used for vectorized particle integration. The positions, rotations and enabled states are stored in the corresponding billboards.
+struct ParticleBlock
 {
-    /// Velocity.
-    Vector3 velocity_;
-    /// Original billboard size.
-    Vector2 size_;
-    /// Time elapsed from creation.
-    float timer_;
-    /// Lifetime.
-    float timeToLive_;
-    /// Size scaling value.
-    float scale_;
-    /// Rotation speed.
-    float rotationSpeed_;
-    /// Current color animation index.
-    unsigned colorIndex_;
-    /// Current texture animation index.
-    unsigned texIndex_;
+    /// Velocity X components.
+    float velocityX_[4];
+    /// Velocity Y components.
+    float velocityY_[4];
+    /// Velocity Z components.
+    float velocityZ_[4];
+    /// Original billboard widths.
+    float sizeX_[4];
+    /// Original billboard heights.
+    float sizeY_[4];
+    /// Times elapsed from creation.
+    float timer_[4];
+    /// Lifetimes.
+    float timeToLive_[4];
+    /// Size scaling values.
+    float scale_[4];
+    /// Rotation speeds.
+    float rotationSpeed_[4];
+    /// Current color animation indices.
+    unsigned colorIndex_[4];
+    /// Current texture animation indices.
+    unsigned texIndex_[4];
 };
 
 /// %Particle emitter component.
@@ -91,7 +97,7 @@ public:
     ParticleEffect* GetEffect() const;
 
     /// Return maximum number of particles.
-    unsigned GetNumParticles() const { return particles_.Size(); }
+    unsigned GetNumParticles() const { return numParticles_; }
 
     /// Return whether is currently emitting.
     bool IsEmitting() const { return emitting_; }
@@ -130,8 +136,10 @@ private:
 
     /// Particle effect.
     SharedPtr<ParticleEffect> effect_;
-    /// Particles.
-    PODVector<Particle> particles_;
+    /// Particle simulation state in blocks of four.
+    PODVector<ParticleBlock> particleBlocks_;
+    /// Number of particles.
+    unsigned numParticles_;
     /// Active/inactive period timer.
     float periodTimer_;
     /// New particle emission timer.
@@ -119,7 +119,8 @@ struct URHO3D_API RenderPathCommand
         useFogColor_(false),
         markToStencil_(false),
         useLitBase_(true),
-        vertexLights_(false)
+        vertexLights_(false),
+        clustered_(false)
     {
     }
 
@@ -206,6 +207,8 @@ struct URHO3D_API RenderPathCommand
     bool useLitBase_;
     /// Vertex lights flag.
     bool vertexLights_;
+    /// Clustered lighting flag. Affects scene pass only.
+    bool clustered_;
     /// Event name.
     String eventName_;
 };
@@ -31,11 +31,13 @@
 #include "../Graphics/GraphicsEvents.h"
 #include "../Graphics/GraphicsImpl.h"
 #include "../Graphics/IndexBuffer.h"
+#include "../Graphics/Light.h"
 #include "../Graphics/Material.h"
 #include "../Graphics/OcclusionBuffer.h"
 #include "../Graphics/Octree.h"
 #include "../Graphics/Renderer.h"
 #include "../Graphics/RenderPath.h"
+#include "../Graphics/Shader.h"
 #include "../Graphics/ShaderVariation.h"
 #include "../Graphics/Technique.h"
 #include "../Graphics/Texture2D.h"
@@ -250,21 +252,44 @@ static const char* heightFogVariations[] =
     "HEIGHTFOG "
 };
 
+static const char* clusteredVariations[] =
+{
+    "",
+    "CLUSTERED "
+};
+
 static const unsigned MAX_BUFFER_AGE = 1000;
 
+/// Number of frames a cached shadow map is kept after its light last needed it.
+static const unsigned MAX_CACHED_SHADOW_MAP_AGE = 60;
+
 static const int MAX_EXTRA_INSTANCING_BUFFER_ELEMENTS = 4;
 
-inline PODVector<VertexElement> CreateInstancingBufferElements(unsigned numExtraElements)
-{
-    static const unsigned NUM_INSTANCEMATRIX_ELEMENTS = 3;
-    static const unsigned FIRST_UNUSED_TEXCOORD = 4;
+/// Number of locks of the largest size so far that the instancing buffer holds before it has to be discarded.
+static const unsigned INSTANCING_BUFFER_MIN_LOCKS = 4;
+
+static const unsigned NUM_INSTANCEMATRIX_ELEMENTS = 3;
+static const unsigned FIRST_UNUSED_TEXCOORD = 4;
 
+inline PODVector<VertexElement> CreateInstancingBufferElements(const PODVector<VertexElement>& extraElements)
+{
     PODVector<VertexElement> elements;
-    for (unsigned i = 0; i < NUM_INSTANCEMATRIX_ELEMENTS + numExtraElements; ++i)
+    for (unsigned i = 0; i < NUM_INSTANCEMATRIX_ELEMENTS; ++i)
         elements.Push(VertexElement(TYPE_VECTOR4, SEM_TEXCOORD, FIRST_UNUSED_TEXCOORD + i, true));
+    for (unsigned i = 0; i < extraElements.Size(); ++i)
+        elements.Push(VertexElement(extraElements[i].type_, extraElements[i].semantic_, extraElements[i].index_, true));
     return elements;
 }
 
+CachedShadowMap::CachedShadowMap() :
+    size_(0),
+    state_(0),
+    frameNumber_(0),
+    useFrameNumber_(0),
+    rendered_(false)
+{
+}
+
 Renderer::Renderer(Context* context) :
     Object(context),
     defaultZone_(new Zone(context)),
@@ -280,6 +305,7 @@ Renderer::Renderer(Context* context) :
     vsmShadowParams_(0.0000001f, 0.2f),
     vsmMultiSample_(1),
     maxShadowMaps_(1),
+    shadowAtlasSize_(SHADOW_ATLAS_DEFAULT_SIZE),
     minInstances_(2),
     maxSortedInstances_(1000),
     maxOccluderTriangles_(5000),
@@ -297,8 +323,16 @@ Renderer::Renderer(Context* context) :
     reuseShadowMaps_(true),
     dynamicInstancing_(true),
     numExtraInstancingBufferElements_(0),
+    instancingBufferOffset_(0),
+    instancingBufferGeneration_(0),
     threadedOcclusion_(false),
+    visibilityCaching_(false),
+    shadowCasterOcclusion_(false),
+    batchCaching_(false),
+    shadowMapCaching_(false),
+    shadowAtlasFull_(false),
     shadersDirty_(true),
+    clusteredShaders_(false),
     initialized_(false),
     resetViews_(false)
 {
@@ -501,11 +535,47 @@ void Renderer::SetDynamicInstancing(bool enable)
 
 void Renderer::SetNumExtraInstancingBufferElements(int elements)
 {
-    if (numExtraInstancingBufferElements_ != elements)
+    elements = Clamp(elements, 0, MAX_EXTRA_INSTANCING_BUFFER_ELEMENTS);
+
+    PODVector<VertexElement> newElements;
+    for (int i = 0; i < elements; ++i)
+        newElements.Push(VertexElement(TYPE_VECTOR4, SEM_TEXCOORD, FIRST_UNUSED_TEXCOORD + NUM_INSTANCEMATRIX_ELEMENTS + i, true));
+
+    SetExtraInstancingBufferElements(newElements);
+}
+
+void Renderer::SetExtraInstancingBufferElements(const PODVector<VertexElement>& elements)
+{
+    for (unsigned i = 0; i < elements.Size(); ++i)
     {
-        numExtraInstancingBufferElements_ = Clamp(elements, 0, MAX_EXTRA_INSTANCING_BUFFER_ELEMENTS);
-        CreateInstancingBuffer();
+        if (elements[i].semantic_ == SEM_TEXCOORD && elements[i].index_ >= FIRST_UNUSED_TEXCOORD &&
+            elements[i].index_ < FIRST_UNUSED_TEXCOORD + NUM_INSTANCEMATRIX_ELEMENTS)
+        {
+            URHO3D_LOGERROR("Extra instancing buffer elements can not use the transform matrix texcoords");
+            return;
+        }
     }
+
+    if (elements.Size() == extraInstancingBufferElements_.Size())
+    {
+        bool changed = false;
+        for (unsigned i = 0; i < elements.Size(); ++i)
+        {
+            if (elements[i].type_ != extraInstancingBufferElements_[i].type_ ||
+                elements[i].semantic_ != extraInstancingBufferElements_[i].semantic_ ||
+                elements[i].index_ != extraInstancingBufferElements_[i].index_)
+            {
+                changed = true;
+                break;
+            }
+        }
+        if (!changed)
+            return;
+    }
+
+    extraInstancingBufferElements_ = elements;
+    numExtraInstancingBufferElements_ = (int)elements.Size();
+    CreateInstancingBuffer();
 }
 
 void Renderer::SetMinInstances(int instances)
@@ -558,6 +628,42 @@ void Renderer::SetThreadedOcclusion(bool enable)
     }
 }
 
+void Renderer::SetVisibilityCaching(bool enable)
+{
+    visibilityCaching_ = enable;
+}
+
+void Renderer::SetShadowCasterOcclusion(bool enable)
+{
+    shadowCasterOcclusion_ = enable;
+}
+
+void Renderer::SetBatchCaching(bool enable)
+{
+    batchCaching_ = enable;
+}
+
+void Renderer::SetShadowMapCaching(bool enable)
+{
+    if (enable != shadowMapCaching_)
+    {
+        shadowMapCaching_ = enable;
+        cachedShadowMaps_.Clear();
+        shadowAtlas_.Reset();
+    }
+}
+
+void Renderer::SetShadowAtlasSize(int size)
+{
+    size = NextPowerOfTwo((unsigned)Max(size, SHADOW_MIN_PIXELS));
+    if (size != shadowAtlasSize_)
+    {
+        shadowAtlasSize_ = size;
+        cachedShadowMaps_.Clear();
+        shadowAtlas_.Reset();
+    }
+}
+
 void Renderer::ReloadShaders()
 {
     shadersDirty_ = true;
@@ -681,6 +787,7 @@ void Renderer::Update(float timeStep)
     numShadowCameras_ = 0;
     numOcclusionBuffers_ = 0;
     updatedOctrees_.Clear();
+    UpdateCachedShadowMaps();
 
     // Reload shaders now if needed
     if (shadersDirty_)
@@ -924,84 +1031,124 @@ Texture2D* Renderer::GetShadowMap(Light* light, Camera* camera, unsigned viewWid
         }
     }
 
-    // Find format and usage of the shadow map
-    unsigned shadowMapFormat = 0;
-    TextureUsage shadowMapUsage = TEXTURE_DEPTHSTENCIL;
-    int multiSample = 1;
+    SharedPtr<Texture2D> newShadowMap = CreateShadowMap(width, height);
 
-    switch (shadowQuality_)
-    {
-    case SHADOWQUALITY_SIMPLE_16BIT:
-    case SHADOWQUALITY_PCF_16BIT:
-        shadowMapFormat = graphics_->GetShadowMapFormat();
-        break;
+    // If failed to create, store a null pointer so that we will not retry
+    shadowMaps_[searchKey].Push(newShadowMap);
+    if (!reuseShadowMaps_)
+        shadowMapAllocations_[searchKey].Push(light);
 
-    case SHADOWQUALITY_SIMPLE_24BIT:
-    case SHADOWQUALITY_PCF_24BIT:
-        shadowMapFormat = graphics_->GetHiresShadowMapFormat();
-        break;
+    return newShadowMap;
+}
 
-    case SHADOWQUALITY_VSM:
-    case SHADOWQUALITY_BLUR_VSM:
-        shadowMapFormat = graphics_->GetRGFloat32Format();
-        shadowMapUsage = TEXTURE_RENDERTARGET;
-        multiSample = vsmMultiSample_;
-        break;
+const CachedShadowMap* Renderer::FindCachedShadowMap(Light* light) const
+{
+    HashMap<Light*, CachedShadowMap>::ConstIterator i = cachedShadowMaps_.Find(light);
+    // A new light may have the address of a removed one
+    return i != cachedShadowMaps_.End() && i->second_.light_ == light ? &i->second_ : 0;
+}
+
+CachedShadowMap& Renderer::GetCachedShadowMap(Light* light)
+{
+    CachedShadowMap& cached = cachedShadowMaps_[light];
+    if (cached.light_ != light)
+    {
+        ReleaseCachedShadowMap(cached);
+        cached = CachedShadowMap();
+        cached.light_ = light;
     }
 
-    if (!shadowMapFormat)
-        return 0;
+    cached.useFrameNumber_ = frame_.frameNumber_;
+    return cached;
+}
 
-    SharedPtr<Texture2D> newShadowMap(new Texture2D(context_));
-    int retries = 3;
-    unsigned dummyColorFormat = graphics_->GetDummyColorFormat();
+bool Renderer::ReserveCachedShadowMap(CachedShadowMap& cached)
+{
+    Light* light = cached.light_;
+    if (!light)
+        return false;
 
-    while (retries)
+    int size = NextPowerOfTwo((unsigned)(shadowMapSize_ * light->GetShadowResolution()));
+
+    if (light->GetLightType() == LIGHT_POINT)
     {
-        if (!newShadowMap->SetSize(width, height, shadowMapFormat, shadowMapUsage, multiSample))
+        // Point light shadow sampling assumes the six faces to fill the whole shadow map, so they can not share the atlas.
+        // Compare the requested size, as the texture may have been created smaller. If creation failed, do not retry
+        // until the shadow resolution changes
+        if (cached.size_ != size)
         {
-            width >>= 1;
-            height >>= 1;
-            --retries;
+            cached.texture_ = CreateShadowMap(size * 2, size * 3);
+            cached.region_ = cached.texture_ ? IntRect(0, 0, cached.texture_->GetWidth(), cached.texture_->GetHeight()) :
+                IntRect::ZERO;
+            cached.size_ = size;
+            cached.rendered_ = false;
         }
-        else
+
+        return cached.texture_.NotNull();
+    }
+
+    if (cached.texture_ && cached.size_ == size)
+        return true;
+
+    // If the shadow resolution changed, return the old region for reuse before reserving a new one
+    ReleaseCachedShadowMap(cached);
+
+    if (size > shadowAtlasSize_)
+        return false;
+
+    if (!shadowAtlas_)
+    {
+        shadowAtlas_ = CreateShadowMap(shadowAtlasSize_, shadowAtlasSize_);
+        if (!shadowAtlas_)
+            return false;
+        shadowAtlasAllocator_.Reset(shadowAtlas_->GetWidth(), shadowAtlas_->GetHeight(), 0, 0, false);
+        freeShadowAtlasRegions_.Clear();
+    }
+
+    IntRect region = IntRect::ZERO;
+    for (unsigned i = 0; i < freeShadowAtlasRegions_.Size(); ++i)
+    {
+        if (freeShadowAtlasRegions_[i].Width() == size)
         {
-#ifndef GL_ES_VERSION_2_0
-            // OpenGL (desktop) and D3D11: shadow compare mode needs to be specifically enabled for the shadow map
-            newShadowMap->SetFilterMode(FILTER_BILINEAR);
-            newShadowMap->SetShadowCompare(shadowMapUsage == TEXTURE_DEPTHSTENCIL);
-#endif
-#ifndef URHO3D_OPENGL
-            // Direct3D9: when shadow compare must be done manually, use nearest filtering so that the filtering of point lights
-            // and other shadowed lights matches
-            newShadowMap->SetFilterMode(graphics_->GetHardwareShadowSupport() ? FILTER_BILINEAR : FILTER_NEAREST);
-#endif
-            // Create dummy color texture for the shadow map if necessary: Direct3D9, or OpenGL when working around an OS X +
-            // Intel driver bug
-            if (shadowMapUsage == TEXTURE_DEPTHSTENCIL && dummyColorFormat)
-            {
-                // If no dummy color rendertarget for this size exists yet, create one now
-                if (!colorShadowMaps_.Contains(searchKey))
-                {
-                    colorShadowMaps_[searchKey] = new Texture2D(context_);
-                    colorShadowMaps_[searchKey]->SetSize(width, height, dummyColorFormat, TEXTURE_RENDERTARGET);
-                }
-                // Link the color rendertarget to the shadow map
-                newShadowMap->GetRenderSurface()->SetLinkedRenderTarget(colorShadowMaps_[searchKey]->GetRenderSurface());
-            }
+            region = freeShadowAtlasRegions_[i];
+            freeShadowAtlasRegions_.EraseSwap(i);
             break;
         }
     }
 
-    // If failed to set size, store a null pointer so that we will not retry
-    if (!retries)
-        newShadowMap.Reset();
+    if (region == IntRect::ZERO)
+    {
+        int x, y;
+        if (!shadowAtlasAllocator_.Allocate(size, size, x, y))
+        {
+            // Repack the atlas on the next frame
+            shadowAtlasFull_ = true;
+            return false;
+        }
+        region = IntRect(x, y, x + size, y + size);
+    }
 
-    shadowMaps_[searchKey].Push(newShadowMap);
-    if (!reuseShadowMaps_)
-        shadowMapAllocations_[searchKey].Push(light);
+    cached.texture_ = shadowAtlas_;
+    cached.region_ = region;
+    cached.size_ = size;
+    return true;
+}
 
-    return newShadowMap;
+void Renderer::ReleaseCachedShadowMap(CachedShadowMap& cached)
+{
+    if (cached.texture_ && cached.texture_ == shadowAtlas_)
+        freeShadowAtlasRegions_.Push(cached.region_);
+
+    cached.texture_.Reset();
+    cached.region_ = IntRect::ZERO;
+    cached.size_ = 0;
+    cached.rendered_ = false;
+}
+
+void Renderer::ResetCachedShadowMaps()
+{
+    for (HashMap<Light*, CachedShadowMap>::Iterator i = cachedShadowMaps_.Begin(); i != cachedShadowMaps_.End(); ++i)
+        i->second_.rendered_ = false;
 }
 
 Texture* Renderer::GetScreenBuffer(int width, int height, unsigned format, int multiSample, bool autoResolve, bool cubemap, bool filtered, bool srgb,
@@ -1166,13 +1313,20 @@ View* Renderer::GetActualView(View* view)
         return view;
 }
 
+void Renderer::SetClusteredShaders()
+{
+    // The passes loaded without the clustered variations reload their shaders when next used
+    clusteredShaders_ = true;
+}
+
 void Renderer::SetBatchShaders(Batch& batch, Technique* tech, bool allowShadows)
 {
     // Check if shaders are unloaded or need reloading
     Pass* pass = batch.pass_;
     Vector<SharedPtr<ShaderVariation> >& vertexShaders = pass->GetVertexShaders();
     Vector<SharedPtr<ShaderVariation> >& pixelShaders = pass->GetPixelShaders();
-    if (!vertexShaders.Size() || !pixelShaders.Size() || pass->GetShadersLoadedFrameNumber() != shadersChangedFrameNumber_)
+    if (!vertexShaders.Size() || !pixelShaders.Size() || pass->GetShadersLoadedFrameNumber() != shadersChangedFrameNumber_ ||
+        (batch.clustered_ && pixelShaders.Size() < 4))
     {
         // First release all previous shaders, then load
         pass->ReleaseShaders();
@@ -1264,7 +1418,10 @@ void Renderer::SetBatchShaders(Batch& batch, Technique* tech, bool allowShadows)
                 batch.vertexShader_ = vertexShaders[vsi];
             }
 
-            batch.pixelShader_ = pixelShaders[heightFog ? 1 : 0];
+            unsigned psi = heightFog ? 1 : 0;
+            if (batch.clustered_ && pixelShaders.Size() > 2)
+                psi += 2;
+            batch.pixelShader_ = pixelShaders[psi];
         }
     }
 
@@ -1357,11 +1514,15 @@ bool Renderer::ResizeInstancingBuffer(unsigned numInstances)
     if (numInstances <= oldSize)
         return true;
 
+    // The instance data written so far is lost
+    instancingBufferOffset_ = 0;
+    ++instancingBufferGeneration_;
+
     unsigned newSize = INSTANCING_BUFFER_DEFAULT_SIZE;
     while (newSize < numInstances)
         newSize <<= 1;
 
-    const PODVector<VertexElement> instancingBufferElements = CreateInstancingBufferElements(numExtraInstancingBufferElements_);
+    const PODVector<VertexElement> instancingBufferElements = CreateInstancingBufferElements(extraInstancingBufferElements_);
     if (!instancingBuffer_->SetSize(newSize, instancingBufferElements, true))
     {
         URHO3D_LOGERROR("Failed to resize instancing buffer to " + String(newSize));
@@ -1374,6 +1535,47 @@ bool Renderer::ResizeInstancingBuffer(unsigned numInstances)
     return true;
 }
 
+bool Renderer::HasInstancingBufferSpace(unsigned numInstances) const
+{
+    if (!instancingBuffer_ || instancingBuffer_->IsDataLost())
+        return false;
+
+    unsigned size = instancingBuffer_->GetVertexCount();
+    return numInstances * INSTANCING_BUFFER_MIN_LOCKS <= size && instancingBufferOffset_ + numInstances <= size;
+}
+
+void* Renderer::LockInstancingBuffer(unsigned numInstances, unsigned& startIndex)
+{
+    if (!numInstances)
+        return 0;
+
+    // Prefer a buffer that holds several locks of this size, so that views and frames can append to it without discarding
+    if (!ResizeInstancingBuffer(numInstances * INSTANCING_BUFFER_MIN_LOCKS) && !ResizeInstancingBuffer(numInstances))
+        return 0;
+
+    bool discard = false;
+    if (instancingBufferOffset_ + numInstances > instancingBuffer_->GetVertexCount() || instancingBuffer_->IsDataLost())
+    {
+        // Start over from the beginning. Discarding gives a new buffer, so that draw calls still pending on the GPU are not affected
+        instancingBufferOffset_ = 0;
+        ++instancingBufferGeneration_;
+        instancingBuffer_->ClearDataLost();
+        discard = true;
+    }
+
+    void* dest = instancingBuffer_->Lock(instancingBufferOffset_, numInstances, discard, true);
+    if (!dest)
+    {
+        instancingBufferOffset_ = 0;
+        ++instancingBufferGeneration_;
+        return 0;
+    }
+
+    startIndex = instancingBufferOffset_;
+    instancingBufferOffset_ += numInstances;
+    return dest;
+}
+
 void Renderer::SaveScreenBufferAllocations()
 {
     savedScreenBufferAllocations_ = screenBufferAllocations_;
@@ -1579,6 +1781,138 @@ void Renderer::RemoveUnusedBuffers()
     }
 }
 
+SharedPtr<Texture2D> Renderer::CreateShadowMap(int width, int height)
+{
+    // Find format and usage of the shadow map
+    unsigned shadowMapFormat = 0;
+    TextureUsage shadowMapUsage = TEXTURE_DEPTHSTENCIL;
+    int multiSample = 1;
+
+    switch (shadowQuality_)
+    {
+    case SHADOWQUALITY_SIMPLE_16BIT:
+    case SHADOWQUALITY_PCF_16BIT:
+        shadowMapFormat = graphics_->GetShadowMapFormat();
+        break;
+
+    case SHADOWQUALITY_SIMPLE_24BIT:
+    case SHADOWQUALITY_PCF_24BIT:
+        shadowMapFormat = graphics_->GetHiresShadowMapFormat();
+        break;
+
+    case SHADOWQUALITY_VSM:
+    case SHADOWQUALITY_BLUR_VSM:
+        shadowMapFormat = graphics_->GetRGFloat32Format();
+        shadowMapUsage = TEXTURE_RENDERTARGET;
+        multiSample = vsmMultiSample_;
+        break;
+    }
+
+    if (!shadowMapFormat)
+        return SharedPtr<Texture2D>();
+
+    SharedPtr<Texture2D> newShadowMap(new Texture2D(context_));
+    int searchKey = (width << 16) | height;
+    int retries = 3;
+    unsigned dummyColorFormat = graphics_->GetDummyColorFormat();
+
+    while (retries)
+    {
+        if (!newShadowMap->SetSize(width, height, shadowMapFormat, shadowMapUsage, multiSample))
+        {
+            width >>= 1;
+            height >>= 1;
+            --retries;
+        }
+        else
+        {
+#ifndef GL_ES_VERSION_2_0
+            // OpenGL (desktop) and D3D11: shadow compare mode needs to be specifically enabled for the shadow map
+            newShadowMap->SetFilterMode(FILTER_BILINEAR);
+            newShadowMap->SetShadowCompare(shadowMapUsage == TEXTURE_DEPTHSTENCIL);
+#endif
+#ifndef URHO3D_OPENGL
+            // Direct3D9: when shadow compare must be done manually, use nearest filtering so that the filtering of point lights
+            // and other shadowed lights matches
+            newShadowMap->SetFilterMode(graphics_->GetHardwareShadowSupport() ? FILTER_BILINEAR : FILTER_NEAREST);
+#endif
+            // Create dummy color texture for the shadow map if necessary: Direct3D9, or OpenGL when working around an OS X +
+            // Intel driver bug
+            if (shadowMapUsage == TEXTURE_DEPTHSTENCIL && dummyColorFormat)
+            {
+                // If no dummy color rendertarget for this size exists yet, create one now
+                if (!colorShadowMaps_.Contains(searchKey))
+                {
+                    colorShadowMaps_[searchKey] = new Texture2D(context_);
+                    colorShadowMaps_[searchKey]->SetSize(width, height, dummyColorFormat, TEXTURE_RENDERTARGET);
+                }
+                // Link the color rendertarget to the shadow map
+                newShadowMap->GetRenderSurface()->SetLinkedRenderTarget(colorShadowMaps_[searchKey]->GetRenderSurface());
+            }
+            break;
+        }
+    }
+
+    // If failed to set size, return null
+    if (!retries)
+        newShadowMap.Reset();
+
+    return newShadowMap;
+}
+
+void Renderer::UpdateCachedShadowMaps()
+{
+    if (cachedShadowMaps_.Empty())
+        return;
+
+    // If the shadow atlas ran out of space, repack it from scratch with the lights that remain in use
+    bool repackAtlas = shadowAtlasFull_ && shadowAtlas_;
+    if (repackAtlas)
+    {
+        shadowAtlasAllocator_.Reset(shadowAtlas_->GetWidth(), shadowAtlas_->GetHeight(), 0, 0, false);
+        freeShadowAtlasRegions_.Clear();
+    }
+    shadowAtlasFull_ = false;
+
+    // Shadow map contents may have been lost along with the graphics device
+    bool atlasDataLost = shadowAtlas_ && shadowAtlas_->IsDataLost();
+    if (atlasDataLost)
+        shadowAtlas_->ClearDataLost();
+
+    for (HashMap<Light*, CachedShadowMap>::Iterator i = cachedShadowMaps_.Begin(); i != cachedShadowMaps_.End();)
+    {
+        CachedShadowMap& cached = i->second_;
+
+        if (!cached.light_ || frame_.frameNumber_ - cached.useFrameNumber_ > MAX_CACHED_SHADOW_MAP_AGE)
+        {
+            if (!repackAtlas)
+                ReleaseCachedShadowMap(cached);
+            i = cachedShadowMaps_.Erase(i);
+            continue;
+        }
+
+        if (cached.texture_ && cached.texture_ == shadowAtlas_)
+        {
+            if (repackAtlas)
+            {
+                cached.texture_.Reset();
+                cached.region_ = IntRect::ZERO;
+                cached.size_ = 0;
+                cached.rendered_ = false;
+            }
+            else if (atlasDataLost)
+                cached.rendered_ = false;
+        }
+        else if (cached.texture_ && cached.texture_->IsDataLost())
+        {
+            cached.texture_->ClearDataLost();
+            cached.rendered_ = false;
+        }
+
+        ++i;
+    }
+}
+
 void Renderer::ResetShadowMapAllocations()
 {
     for (HashMap<int, PODVector<Light*> >::Iterator i = shadowMapAllocations_.Begin(); i != shadowMapAllocations_.End(); ++i)
@@ -1650,6 +1984,32 @@ void Renderer::LoadShaders()
             deferredLightPSVariations_[i] += "ORTHO ";
     }
 
+    // Combine the pass independent defines once here, instead of for each pass
+    litVSVariations_.Resize(MAX_GEOMETRYTYPES * MAX_LIGHT_VS_VARIATIONS);
+    for (unsigned i = 0; i < MAX_GEOMETRYTYPES * MAX_LIGHT_VS_VARIATIONS; ++i)
+        litVSVariations_[i] = String(lightVSVariations[i % MAX_LIGHT_VS_VARIATIONS]) + geometryVSVariations[i / MAX_LIGHT_VS_VARIATIONS];
+
+    litPSVariations_.Resize(MAX_LIGHT_PS_VARIATIONS * 2);
+    for (unsigned i = 0; i < MAX_LIGHT_PS_VARIATIONS * 2; ++i)
+    {
+        unsigned l = i % MAX_LIGHT_PS_VARIATIONS;
+        litPSVariations_[i] = lightPSVariations[l];
+        if (l & LPS_SHADOW)
+            litPSVariations_[i] += GetShadowVariations();
+        litPSVariations_[i] += heightFogVariations[i / MAX_LIGHT_PS_VARIATIONS];
+    }
+
+    vertexLitVSVariations_.Resize(MAX_GEOMETRYTYPES * MAX_VERTEXLIGHT_VS_VARIATIONS);
+    for (unsigned i = 0; i < MAX_GEOMETRYTYPES * MAX_VERTEXLIGHT_VS_VARIATIONS; ++i)
+    {
+        vertexLitVSVariations_[i] = String(vertexLightVSVariations[i % MAX_VERTEXLIGHT_VS_VARIATIONS]) +
+            geometryVSVariations[i / MAX_VERTEXLIGHT_VS_VARIATIONS];
+    }
+
+    unlitPSVariations_.Resize(4);
+    for (unsigned i = 0; i < 4; ++i)
+        unlitPSVariations_[i] = String(heightFogVariations[i & 1]) + clusteredVariations[i >> 1];
+
     shadersDirty_ = false;
 }
 
@@ -1671,8 +2031,8 @@ void Renderer::LoadPassShaders(Pass* pass)
         extraShaderDefines = " VSM_SHADOW ";
     }
 
-    String vsDefines = pass->GetEffectiveVertexShaderDefines();
-    String psDefines = pass->GetEffectivePixelShaderDefines();
+    String vsDefines = pass->GetEffectiveVertexShaderDefines() + extraShaderDefines;
+    String psDefines = pass->GetEffectivePixelShaderDefines() + extraShaderDefines;
 
     if (pass->GetLightingMode() == LIGHTING_PERPIXEL)
     {
@@ -1681,28 +2041,9 @@ void Renderer::LoadPassShaders(Pass* pass)
         pixelShaders.Resize(MAX_LIGHT_PS_VARIATIONS * 2);
 
         for (unsigned j = 0; j < MAX_GEOMETRYTYPES * MAX_LIGHT_VS_VARIATIONS; ++j)
-        {
-            unsigned g = j / MAX_LIGHT_VS_VARIATIONS;
-            unsigned l = j % MAX_LIGHT_VS_VARIATIONS;
-
-            vertexShaders[j] = graphics_->GetShader(VS, pass->GetVertexShader(),
-                vsDefines + extraShaderDefines + lightVSVariations[l] + geometryVSVariations[g]);
-        }
+            vertexShaders[j] = graphics_->GetShader(VS, pass->GetVertexShader(), vsDefines + litVSVariations_[j]);
         for (unsigned j = 0; j < MAX_LIGHT_PS_VARIATIONS * 2; ++j)
-        {
-            unsigned l = j % MAX_LIGHT_PS_VARIATIONS;
-            unsigned h = j / MAX_LIGHT_PS_VARIATIONS;
-
-            if (l & LPS_SHADOW)
-            {
-                pixelShaders[j] = graphics_->GetShader(PS, pass->GetPixelShader(),
-                    psDefines + extraShaderDefines + lightPSVariations[l] + GetShadowVariations() +
-                    heightFogVariations[h]);
-            }
-            else
-                pixelShaders[j] = graphics_->GetShader(PS, pass->GetPixelShader(),
-                    psDefines + extraShaderDefines + lightPSVariations[l] + heightFogVariations[h]);
-        }
+            pixelShaders[j] = graphics_->GetShader(PS, pass->GetPixelShader(), psDefines + litPSVariations_[j]);
     }
     else
     {
@@ -1711,29 +2052,21 @@ void Renderer::LoadPassShaders(Pass* pass)
         {
             vertexShaders.Resize(MAX_GEOMETRYTYPES * MAX_VERTEXLIGHT_VS_VARIATIONS);
             for (unsigned j = 0; j < MAX_GEOMETRYTYPES * MAX_VERTEXLIGHT_VS_VARIATIONS; ++j)
-            {
-                unsigned g = j / MAX_VERTEXLIGHT_VS_VARIATIONS;
-                unsigned l = j % MAX_VERTEXLIGHT_VS_VARIATIONS;
-                vertexShaders[j] = graphics_->GetShader(VS, pass->GetVertexShader(),
-                    vsDefines + extraShaderDefines + vertexLightVSVariations[l] + geometryVSVariations[g]);
-            }
+                vertexShaders[j] = graphics_->GetShader(VS, pass->GetVertexShader(), vsDefines + vertexLitVSVariations_[j]);
         }
         else
         {
             vertexShaders.Resize(MAX_GEOMETRYTYPES);
             for (unsigned j = 0; j < MAX_GEOMETRYTYPES; ++j)
-            {
-                vertexShaders[j] = graphics_->GetShader(VS, pass->GetVertexShader(),
-                    vsDefines + extraShaderDefines + geometryVSVariations[j]);
-            }
+                vertexShaders[j] = graphics_->GetShader(VS, pass->GetVertexShader(), vsDefines + geometryVSVariations[j]);
         }
 
-        pixelShaders.Resize(2);
-        for (unsigned j = 0; j < 2; ++j)
-        {
-            pixelShaders[j] =
-                graphics_->GetShader(PS, pass->GetPixelShader(), psDefines + extraShaderDefines + heightFogVariations[j]);
-        }
+        // Load height fog variations, and clustered lighting variations once a view uses clustered lighting, if the pass is
+        // declared to support them
+        unsigned numPSVariations = clusteredShaders_ && pass->GetClusteredSupport() ? 4 : 2;
+        pixelShaders.Resize(numPSVariations);
+        for (unsigned j = 0; j < numPSVariations; ++j)
+            pixelShaders[j] = graphics_->GetShader(PS, pass->GetPixelShader(), psDefines + unlitPSVariations_[j]);
     }
 
     pass->MarkShadersLoaded(shadersChangedFrameNumber_);
@@ -1887,8 +2220,11 @@ void Renderer::CreateInstancingBuffer()
         return;
     }
 
+    instancingBufferOffset_ = 0;
+    ++instancingBufferGeneration_;
+
     instancingBuffer_ = new VertexBuffer(context_);
-    const PODVector<VertexElement> instancingBufferElements = CreateInstancingBufferElements(numExtraInstancingBufferElements_);
+    const PODVector<VertexElement> instancingBufferElements = CreateInstancingBufferElements(extraInstancingBufferElements_);
     if (!instancingBuffer_->SetSize(INSTANCING_BUFFER_DEFAULT_SIZE, instancingBufferElements, true))
     {
         instancingBuffer_.Reset();
@@ -1901,6 +2237,8 @@ void Renderer::ResetShadowMaps()
     shadowMaps_.Clear();
     shadowMapAllocations_.Clear();
     colorShadowMaps_.Clear();
+    cachedShadowMaps_.Clear();
+    shadowAtlas_.Reset();
 }
 
 void Renderer::ResetBuffers()
@@ -27,6 +27,7 @@
 #include "../Graphics/Batch.h"
 #include "../Graphics/Drawable.h"
 #include "../Graphics/Viewport.h"
+#include "../Math/AreaAllocator.h"
 #include "../Math/Color.h"
 
 namespace Urho3D
@@ -54,6 +55,7 @@ class Zone;
 
 static const int SHADOW_MIN_PIXELS = 64;
 static const int INSTANCING_BUFFER_DEFAULT_SIZE = 1024;
+static const int SHADOW_ATLAS_DEFAULT_SIZE = 4096;
 
 /// Light vertex shader variations.
 enum LightVSVariation
@@ -167,6 +169,32 @@ enum DeferredLightPSVariation
     MAX_DEFERRED_LIGHT_PS_VARIATIONS
 };
 
+/// Cached shadow map of a static spot or point light.
+struct CachedShadowMap
+{
+    /// Construct.
+    CachedShadowMap();
+
+    /// Light.
+    WeakPtr<Light> light_;
+    /// Shadow map texture. Spot lights share the shadow atlas, while point lights have a texture of their own.
+    SharedPtr<Texture2D> texture_;
+    /// Region of the texture reserved for the light.
+    IntRect region_;
+    /// Shadow map size the texture or region was requested with. A point light texture may be smaller if creating it failed.
+    int size_;
+    /// Shadow caster bounding box in light projection space when the shadow map was rendered. Used for spot light focusing.
+    BoundingBox shadowCasterBox_;
+    /// Hash of the light, octree and view parameters the shadow map depends on, as seen last.
+    unsigned state_;
+    /// Octree frame number when the shadow map was rendered.
+    unsigned frameNumber_;
+    /// Frame number when the light last needed the shadow map.
+    unsigned useFrameNumber_;
+    /// Whether the shadow map has been rendered with the current state.
+    bool rendered_;
+};
+
 /// High-level rendering subsystem. Manages drawing of 3D views.
 class URHO3D_API Renderer : public Object
 {
@@ -224,6 +252,8 @@ public:
     void SetDynamicInstancing(bool enable);
     /// Set number of extra instancing buffer elements. Default is 0. Extra 4-vectors are available through TEXCOORD7 and further.
     void SetNumExtraInstancingBufferElements(int elements);
+    /// Set extra instancing buffer elements of any type and semantic, to be used instead of extra 4-vectors. The elements must not use TEXCOORD4-6, which hold the transform matrix.
+    void SetExtraInstancingBufferElements(const PODVector<VertexElement>& elements);
     /// Set minimum number of instances required in a batch group to render as instanced.
     void SetMinInstances(int instances);
     /// Set maximum number of sorted instances per batch group. If exceeded, instances are rendered unsorted.
@@ -236,6 +266,16 @@ public:
     void SetOccluderSizeThreshold(float screenSize);
     /// Set whether to thread occluder rendering. Default false.
     void SetThreadedOcclusion(bool enable);
+    /// Set whether views cache the frustum culling results of unchanged octants between frames. Benefits mostly static cameras. Default false.
+    void SetVisibilityCaching(bool enable);
+    /// Set whether to occlusion cull shadow casters separately for each shadow camera, using the shadow casters marked as occluders. Default false.
+    void SetShadowCasterOcclusion(bool enable);
+    /// Set whether views cache the base pass batches of drawables that need no geometry update, and keep their batch groups and unchanged instance data between frames. Helps most with render paths that have several base passes. Default false.
+    void SetBatchCaching(bool enable);
+    /// Set whether to cache the shadow maps of static spot and point lights between frames, and render them again only when the light or the drawables within its range have changed. Spot lights share a shadow atlas texture. Not supported with VSM shadows. Default false.
+    void SetShadowMapCaching(bool enable);
+    /// Set shadow atlas texture size for cached spot light shadow maps. Default 4096.
+    void SetShadowAtlasSize(int size);
     /// Set shadow depth bias multiplier for mobile platforms to counteract possible worse shadow map precision. Default 1.0 (no effect.)
     void SetMobileShadowBiasMul(float mul);
     /// Set shadow depth bias addition for mobile platforms to counteract possible worse shadow map precision. Default 0.0 (no effect.)
@@ -306,6 +346,9 @@ public:
     /// Return number of extra instancing buffer elements.
     int GetNumExtraInstancingBufferElements() const { return numExtraInstancingBufferElements_; };
 
+    /// Return extra instancing buffer elements.
+    const PODVector<VertexElement>& GetExtraInstancingBufferElements() const { return extraInstancingBufferElements_; }
+
     /// Return minimum number of instances required in a batch group to render as instanced.
     int GetMinInstances() const { return minInstances_; }
 
@@ -324,6 +367,27 @@ public:
     /// Return whether occlusion rendering is threaded.
     bool GetThreadedOcclusion() const { return threadedOcclusion_; }
 
+    /// Return whether views cache frustum culling results between frames.
+    bool GetVisibilityCaching() const { return visibilityCaching_; }
+
+    /// Return whether shadow casters are occlusion culled per shadow camera.
+    bool GetShadowCasterOcclusion() const { return shadowCasterOcclusion_; }
+
+    /// Return whether views cache base pass batches between frames.
+    bool GetBatchCaching() const { return batchCaching_; }
+
+    /// Return whether shadow maps of static lights are cached between frames.
+    bool GetShadowMapCaching() const { return shadowMapCaching_; }
+
+    /// Return shadow atlas texture size.
+    int GetShadowAtlasSize() const { return shadowAtlasSize_; }
+
+    /// Return the shadow atlas texture, or null if not created yet.
+    Texture2D* GetShadowAtlas() const { return shadowAtlas_; }
+
+    /// Return the frame number on which shaders were last reloaded.
+    unsigned GetShadersChangedFrameNumber() const { return shadersChangedFrameNumber_; }
+
     /// Return shadow depth bias multiplier for mobile platforms.
     float GetMobileShadowBiasMul() const { return mobileShadowBiasMul_; }
 
@@ -372,6 +436,9 @@ public:
     /// Return the instancing vertex buffer
     VertexBuffer* GetInstancingBuffer() const { return dynamicInstancing_ ? instancingBuffer_ : (VertexBuffer*)0; }
 
+    /// Return the instancing buffer generation. Incremented whenever the buffer is discarded or recreated, which invalidates the instance data written earlier.
+    unsigned GetInstancingBufferGeneration() const { return instancingBufferGeneration_; }
+
     /// Return the frame update parameters.
     const FrameInfo& GetFrameInfo() const { return frame_; }
 
@@ -392,6 +459,14 @@ public:
     Geometry* GetQuadGeometry();
     /// Allocate a shadow map. If shadow map reuse is disabled, a different map is returned each time.
     Texture2D* GetShadowMap(Light* light, Camera* camera, unsigned viewWidth, unsigned viewHeight);
+    /// Return the cached shadow map of a light, or null if it has none. Called by View, also from worker threads.
+    const CachedShadowMap* FindCachedShadowMap(Light* light) const;
+    /// Return the cached shadow map of a light, creating it if necessary. Called by View.
+    CachedShadowMap& GetCachedShadowMap(Light* light);
+    /// Reserve the shadow map region of a cached shadow map if not reserved yet: from the shadow atlas for spot lights, or a texture of its own for point lights. Return true if successful. Called by View.
+    bool ReserveCachedShadowMap(CachedShadowMap& cached);
+    /// Forget the contents of all cached shadow maps so that they are rendered again. Call after changes the caching can not detect, such as material changes of the shadow casters.
+    void ResetCachedShadowMaps();
     /// Allocate a rendertarget or depth-stencil texture for deferred rendering or postprocessing. Should only be called during actual rendering, not before.
     Texture* GetScreenBuffer
         (int width, int height, unsigned format, int multiSample, bool autoResolve, bool cubemap, bool filtered, bool srgb, unsigned persistentKey = 0);
@@ -407,6 +482,8 @@ public:
     View* GetPreparedView(Camera* cullCamera);
     /// Choose shaders for a forward rendering batch.
     void SetBatchShaders(Batch& batch, Technique* tech, bool allowShadows = true);
+    /// Load the clustered lighting pixel shader variations of the unlit passes from now on. Called by View when it uses clustered lighting.
+    void SetClusteredShaders();
     /// Choose shaders for a deferred light volume batch.
     void SetLightVolumeBatchShaders
         (Batch& batch, Camera* camera, const String& vsName, const String& psName, const String& vsDefines, const String& psDefines);
@@ -414,6 +491,10 @@ public:
     void SetCullMode(CullMode mode, Camera* camera);
     /// Ensure sufficient size of the instancing vertex buffer. Return true if successful.
     bool ResizeInstancingBuffer(unsigned numInstances);
+    /// Lock a range for instances after the data written so far, discarding the buffer and starting from its beginning if there is no space left. Return the data pointer and start index if successful.
+    void* LockInstancingBuffer(unsigned numInstances, unsigned& startIndex);
+    /// Return whether instances can be appended to the instancing buffer without discarding or recreating it.
+    bool HasInstancingBufferSpace(unsigned numInstances) const;
     /// Save the screen buffer allocation status. Called by View.
     void SaveScreenBufferAllocations();
     /// Restore the screen buffer allocation status. Called by View.
@@ -451,6 +532,12 @@ private:
     void PrepareViewRender();
     /// Remove unused occlusion and screen buffers.
     void RemoveUnusedBuffers();
+    /// Create a shadow map texture in the format of the current shadow quality. Return null if failed.
+    SharedPtr<Texture2D> CreateShadowMap(int width, int height);
+    /// Evict the cached shadow maps of removed and unused lights, and repack the shadow atlas if it ran out of space.
+    void UpdateCachedShadowMaps();
+    /// Release the texture of a cached shadow map, returning its shadow atlas region for reuse.
+    void ReleaseCachedShadowMap(CachedShadowMap& cached);
     /// Reset shadow map allocation counts.
     void ResetShadowMapAllocations();
     /// Reset screem buffer allocation counts.
@@ -504,6 +591,14 @@ private:
     HashMap<int, SharedPtr<Texture2D> > colorShadowMaps_;
     /// Shadow map allocations by resolution.
     HashMap<int, PODVector<Light*> > shadowMapAllocations_;
+    /// Cached shadow maps by light.
+    HashMap<Light*, CachedShadowMap> cachedShadowMaps_;
+    /// Shadow atlas texture for cached spot light shadow maps.
+    SharedPtr<Texture2D> shadowAtlas_;
+    /// Shadow atlas region allocator.
+    AreaAllocator shadowAtlasAllocator_;
+    /// Shadow atlas regions released by lights, reused for lights of the same shadow map size.
+    PODVector<IntRect> freeShadowAtlasRegions_;
     /// Instance of shadow map filter
     Object* shadowMapFilterInstance_;
     /// Function pointer of shadow map filter
@@ -532,6 +627,14 @@ private:
     Mutex rendererMutex_;
     /// Current variation names for deferred light volume shaders.
     Vector<String> deferredLightPSVariations_;
+    /// Current variation names for per-pixel lit vertex shaders by light and geometry type.
+    Vector<String> litVSVariations_;
+    /// Current variation names for per-pixel lit pixel shaders by light and height fog.
+    Vector<String> litPSVariations_;
+    /// Current variation names for vertex lit vertex shaders by vertex lights and geometry type.
+    Vector<String> vertexLitVSVariations_;
+    /// Current variation names for unlit pixel shaders by height fog and clustered lighting.
+    Vector<String> unlitPSVariations_;
     /// Frame info for rendering.
     FrameInfo frame_;
     /// Texture anisotropy level.
@@ -554,6 +657,8 @@ private:
     int vsmMultiSample_;
     /// Maximum number of shadow maps per resolution.
     int maxShadowMaps_;
+    /// Shadow atlas texture size.
+    int shadowAtlasSize_;
     /// Minimum number of instances required in a batch group to render as instanced.
     int minInstances_;
     /// Maximum sorted instances per batch group.
@@ -594,10 +699,28 @@ private:
     bool dynamicInstancing_;
     /// Number of extra instancing data elements.
     int numExtraInstancingBufferElements_;
+    /// Extra instancing data elements.
+    PODVector<VertexElement> extraInstancingBufferElements_;
+    /// Index of the first unused instance in the instancing buffer.
+    unsigned instancingBufferOffset_;
+    /// Instancing buffer generation.
+    unsigned instancingBufferGeneration_;
     /// Threaded occlusion rendering flag.
     bool threadedOcclusion_;
+    /// Visibility caching flag.
+    bool visibilityCaching_;
+    /// Shadow caster occlusion flag.
+    bool shadowCasterOcclusion_;
+    /// Batch caching flag.
+    bool batchCaching_;
+    /// Shadow map caching flag.
+    bool shadowMapCaching_;
+    /// Shadow atlas out of space flag.
+    bool shadowAtlasFull_;
     /// Shaders need reloading flag.
     bool shadersDirty_;
+    /// Load clustered lighting pixel shader variations flag. Set when a view first uses clustered lighting.
+    bool clusteredShaders_;
     /// Initialized flag.
     bool initialized_;
     /// Flag for views needing reset.
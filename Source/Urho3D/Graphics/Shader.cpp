@@ -87,12 +87,28 @@ bool Shader::BeginLoad(Deserializer& source)
     if (!graphics)
         return false;
 
+    // When reloading, the include files may have changed without a timestamp change, for example inside a package, so
+    // expand them again
+    if (!vsSourceCode_.Empty())
+        graphics->ClearShaderIncludes();
+
     // Load the shader source code and resolve any includes
     timeStamp_ = 0;
     String shaderCode;
-    if (!ProcessSource(shaderCode, source))
+    Vector<ShaderSourceFile> files;
+    if (!ProcessSource(shaderCode, source, files))
         return false;
 
+    // Store resource dependencies for includes so that we know to reload if any of them changes. Use the latest timestamp
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    for (unsigned i = 0; i < files.Size(); ++i)
+    {
+        if (files[i].name_ != GetName())
+            cache->StoreResourceDependency(this, files[i].name_);
+        if (files[i].timeStamp_ > timeStamp_)
+            timeStamp_ = files[i].timeStamp_;
+    }
+
     // Comment out the unneeded shader function
     vsSourceCode_ = shaderCode;
     psSourceCode_ = shaderCode;
@@ -157,24 +173,19 @@ ShaderVariation* Shader::GetVariation(ShaderType type, const char* defines)
     return i->second_;
 }
 
-bool Shader::ProcessSource(String& code, Deserializer& source)
+bool Shader::ProcessSource(String& code, Deserializer& source, Vector<ShaderSourceFile>& files)
 {
-    ResourceCache* cache = GetSubsystem<ResourceCache>();
-
     // If the source if a non-packaged file, store the timestamp
+    ShaderSourceFile sourceFile;
+    sourceFile.name_ = source.GetName();
+    sourceFile.timeStamp_ = 0;
     File* file = dynamic_cast<File*>(&source);
     if (file && !file->IsPackaged())
     {
-        FileSystem* fileSystem = GetSubsystem<FileSystem>();
-        String fullName = cache->GetResourceFileName(file->GetName());
-        unsigned fileTimeStamp = fileSystem->GetLastModifiedTime(fullName);
-        if (fileTimeStamp > timeStamp_)
-            timeStamp_ = fileTimeStamp;
+        sourceFile.fullName_ = GetSubsystem<ResourceCache>()->GetResourceFileName(file->GetName());
+        sourceFile.timeStamp_ = GetSubsystem<FileSystem>()->GetLastModifiedTime(sourceFile.fullName_);
     }
-
-    // Store resource dependencies for includes so that we know to reload if any of them changes
-    if (source.GetName() != GetName())
-        cache->StoreResourceDependency(this, source.GetName());
+    files.Push(sourceFile);
 
     while (!source.IsEof())
     {
@@ -184,12 +195,8 @@ bool Shader::ProcessSource(String& code, Deserializer& source)
         {
             String includeFileName = GetPath(source.GetName()) + line.Substring(9).Replaced("\"", "").Trimmed();
 
-            SharedPtr<File> includeFile = cache->GetFile(includeFileName);
-            if (!includeFile)
-                return false;
-
             // Add the include file into the current code recursively
-            if (!ProcessSource(code, *includeFile))
+            if (!ProcessInclude(code, includeFileName, files))
                 return false;
         }
         else
@@ -205,6 +212,49 @@ bool Shader::ProcessSource(String& code, Deserializer& source)
     return true;
 }
 
+bool Shader::ProcessInclude(String& code, const String& includeFileName, Vector<ShaderSourceFile>& files)
+{
+    // Use the already expanded include file if none of its files has been modified since
+    Graphics* graphics = GetSubsystem<Graphics>();
+    ShaderInclude expanded;
+    if (graphics->GetShaderInclude(includeFileName, expanded))
+    {
+        FileSystem* fileSystem = GetSubsystem<FileSystem>();
+        bool upToDate = true;
+        for (unsigned i = 0; i < expanded.files_.Size(); ++i)
+        {
+            const ShaderSourceFile& file = expanded.files_[i];
+            if (!file.fullName_.Empty() && fileSystem->GetLastModifiedTime(file.fullName_) != file.timeStamp_)
+            {
+                upToDate = false;
+                break;
+            }
+        }
+
+        if (upToDate)
+        {
+            code += expanded.code_;
+            files.Push(expanded.files_);
+            return true;
+        }
+
+        expanded.code_.Clear();
+        expanded.files_.Clear();
+    }
+
+    SharedPtr<File> includeFile = GetSubsystem<ResourceCache>()->GetFile(includeFileName);
+    if (!includeFile)
+        return false;
+
+    if (!ProcessSource(expanded.code_, *includeFile, expanded.files_))
+        return false;
+
+    code += expanded.code_;
+    files.Push(expanded.files_);
+    graphics->StoreShaderInclude(includeFileName, expanded);
+    return true;
+}
+
 String Shader::NormalizeDefines(const String& defines)
 {
     Vector<String> definesVec = defines.ToUpper().Split(' ');
@@ -30,6 +30,26 @@ namespace Urho3D
 
 class ShaderVariation;
 
+/// Source file read when processing shader source code.
+struct ShaderSourceFile
+{
+    /// Resource name.
+    String name_;
+    /// Full file name, empty if the file is packaged.
+    String fullName_;
+    /// Last modified time when read, zero if the file is packaged.
+    unsigned timeStamp_;
+};
+
+/// %Shader include file with its own includes expanded.
+struct ShaderInclude
+{
+    /// Expanded source code.
+    String code_;
+    /// Files read during the expansion, starting with the include file itself.
+    Vector<ShaderSourceFile> files_;
+};
+
 /// %Shader resource consisting of several shader variations.
 class URHO3D_API Shader : public Resource
 {
@@ -60,8 +80,10 @@ public:
     unsigned GetTimeStamp() const { return timeStamp_; }
 
 private:
-    /// Process source code and include files. Return true if successful.
-    bool ProcessSource(String& code, Deserializer& file);
+    /// Process source code and include files. Record the files read. Return true if successful.
+    bool ProcessSource(String& code, Deserializer& file, Vector<ShaderSourceFile>& files);
+    /// Process an include file, using the expanded include file cached by Graphics if it is up to date. Record the files read. Return true if successful.
+    bool ProcessInclude(String& code, const String& includeFileName, Vector<ShaderSourceFile>& files);
     /// Sort the defines and strip extra spaces to prevent creation of unnecessary duplicate shader variations.
     String NormalizeDefines(const String& defines);
     /// Recalculate the memory used by the shader.
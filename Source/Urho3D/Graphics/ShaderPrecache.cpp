@@ -22,6 +22,8 @@
 
 #include "../Precompiled.h"
 
+#include "../Core/Timer.h"
+#include "../Core/WorkQueue.h"
 #include "../Graphics/Graphics.h"
 #include "../Graphics/GraphicsImpl.h"
 #include "../Graphics/ShaderPrecache.h"
@@ -35,6 +37,18 @@
 namespace Urho3D
 {
 
+#ifndef URHO3D_OPENGL
+static void PrepareShaderWork(const WorkItem* item, unsigned threadIndex)
+{
+    ShaderVariation* variation = reinterpret_cast<ShaderVariation*>(item->start_);
+    if (!variation->Prepare() && !variation->GetCompilerOutput().Empty())
+    {
+        URHO3D_LOGERROR("Failed to compile " + String(variation->GetShaderType() == VS ? "vertex" : "pixel") + " shader " +
+            variation->GetFullName() + ":\n" + variation->GetCompilerOutput());
+    }
+}
+#endif
+
 ShaderPrecache::ShaderPrecache(Context* context, const String& fileName) :
     Object(context),
     fileName_(fileName),
@@ -108,9 +122,14 @@ void ShaderPrecache::LoadShaders(Graphics* graphics, Deserializer& source)
 {
     URHO3D_LOGDEBUG("Begin precaching shaders");
 
+    HiresTimer timer;
     XMLFile xmlFile(graphics->GetContext());
     xmlFile.Load(source);
 
+    // Collect the combinations first, so that the shaders can be prepared in parallel
+    PODVector<Pair<ShaderVariation*, ShaderVariation*> > combinations;
+    HashSet<ShaderVariation*> variations;
+
     XMLElement shader = xmlFile.GetRoot().GetChild("shader");
     while (shader)
     {
@@ -132,12 +151,39 @@ void ShaderPrecache::LoadShaders(Graphics* graphics, Deserializer& source)
 
         ShaderVariation* vs = graphics->GetShader(VS, shader.GetAttribute("vs"), vsDefines);
         ShaderVariation* ps = graphics->GetShader(PS, shader.GetAttribute("ps"), psDefines);
-        // Set the shaders active to actually compile them
-        graphics->SetShaders(vs, ps);
+        combinations.Push(MakePair(vs, ps));
+        if (vs && !vs->GetGPUObjectName() && vs->GetCompilerOutput().Empty())
+            variations.Insert(vs);
+        if (ps && !ps->GetGPUObjectName() && ps->GetCompilerOutput().Empty())
+            variations.Insert(ps);
 
         shader = shader.GetNext("shader");
     }
 
+    // Load or compile the bytecode on worker threads. On OpenGL the shaders have to be compiled on the main thread
+#ifndef URHO3D_OPENGL
+    WorkQueue* queue = graphics->GetSubsystem<WorkQueue>();
+    if (queue && queue->GetNumThreads() && variations.Size() > 1)
+    {
+        for (HashSet<ShaderVariation*>::ConstIterator i = variations.Begin(); i != variations.End(); ++i)
+        {
+            SharedPtr<WorkItem> item = queue->GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = PrepareShaderWork;
+            item->start_ = *i;
+            queue->AddWorkItem(item);
+        }
+
+        queue->Complete(M_MAX_UNSIGNED);
+    }
+#endif
+
+    // Set the shaders active to actually create them and link the programs
+    for (unsigned i = 0; i < combinations.Size(); ++i)
+        graphics->SetShaders(combinations[i].first_, combinations[i].second_);
+
+    URHO3D_LOGINFO("Precached " + String(combinations.Size()) + " shader combinations of " + String(variations.Size()) +
+        " new shaders in " + String(timer.GetUSec(false) / 1000) + " ms");
     URHO3D_LOGDEBUG("End precaching shaders");
 }
 
@@ -90,6 +90,8 @@ public:
 
     /// Compile the shader. Return true if successful.
     bool Create();
+    /// Load or compile the bytecode without creating the GPU object, so that Create() only needs to create it. May be called from a worker thread. Return true if successful. Not available on OpenGL, where shaders are compiled on the main thread.
+    bool Prepare();
     /// Set name.
     void SetName(const String& name);
     /// Set defines.
@@ -122,6 +124,11 @@ public:
     /// Return shader bytecode. Stored persistently on Direct3D11 only.
     const PODVector<unsigned char>& GetByteCode() const { return byteCode_; }
 
+#ifdef URHO3D_OPENGL
+    /// Return case-sensitive 64-bit hash of the source code with the defines prepended. Used only on OpenGL to identify cached shader program binaries.
+    unsigned long long GetSourceHash();
+#endif
+
     /// Return defines.
     const String& GetDefines() const { return defines_; }
 
@@ -148,6 +155,10 @@ private:
     void SaveByteCode(const String& binaryShaderName);
     /// Calculate constant buffer sizes from parameters.
     void CalculateConstantBufferSizes();
+#ifdef URHO3D_OPENGL
+    /// Return the source code with the defines prepended, as passed to the OpenGL shader compiler.
+    String GetShaderCode() const;
+#endif
 
     /// Shader this variation belongs to.
     WeakPtr<Shader> owner_;
@@ -155,6 +166,8 @@ private:
     ShaderType type_;
     /// Vertex element hash for vertex shaders. Zero for pixel shaders. Note that hashing is different than vertex buffers.
     unsigned long long elementHash_;
+    /// Source code hash, zero if not calculated yet. Used only on OpenGL.
+    unsigned long long sourceHash_;
     /// Shader parameters.
     HashMap<StringHash, ShaderParameter> parameters_;
     /// Texture unit use flags.
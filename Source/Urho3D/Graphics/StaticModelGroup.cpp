@@ -28,11 +28,16 @@
 #include "../Graphics/Geometry.h"
 #include "../Graphics/Material.h"
 #include "../Graphics/OcclusionBuffer.h"
+#include "../Graphics/Octree.h"
 #include "../Graphics/OctreeQuery.h"
 #include "../Graphics/StaticModelGroup.h"
 #include "../Graphics/VertexBuffer.h"
 #include "../Scene/Scene.h"
 
+#ifdef URHO3D_SSE
+#include <xmmintrin.h>
+#endif
+
 #include "../DebugNew.h"
 
 namespace Urho3D
@@ -40,8 +45,60 @@ namespace Urho3D
 
 extern const char* GEOMETRY_CATEGORY;
 
+/// Number of consecutive instances in a culling cell. Must be a multiple of four.
+static const unsigned INSTANCES_PER_CELL = 64;
+
+/// Spread the lowest 10 bits of a value to every third bit.
+static inline unsigned SpreadBits(unsigned value)
+{
+    value = (value * 0x00010001u) & 0xff0000ffu;
+    value = (value * 0x00000101u) & 0x0f00f00fu;
+    value = (value * 0x00000011u) & 0xc30c30c3u;
+    value = (value * 0x00000005u) & 0x49249249u;
+    return value;
+}
+
+/// Return the first hash table slot for a node pointer. The table size must be a power of two.
+static inline unsigned GetNodeSlot(Node* node, unsigned mask)
+{
+    return (unsigned)(((size_t)node >> 4) * 0x9e3779b1u) & mask;
+}
+
+/// Sort instance keys by the Morton code in their high 32 bits. The sort is stable, so equal codes stay in index order.
+static void SortInstanceKeys(PODVector<unsigned long long>& keys)
+{
+    PODVector<unsigned long long> tempKeys(keys.Size());
+    if (RadixSort(keys.Buffer(), tempKeys.Buffer(), keys.Size(), GetRadixSortKey, 4, 4) != keys.Buffer())
+        keys.Swap(tempKeys);
+}
+
+/// Store an instance world bounding box to a box block.
+static inline void SetInstanceBox(DrawableBoxBlock& block, unsigned lane, const BoundingBox& box)
+{
+    Vector3 center = box.Center();
+    Vector3 halfSize = box.HalfSize();
+    block.centerX_[lane] = center.x_;
+    block.centerY_[lane] = center.y_;
+    block.centerZ_[lane] = center.z_;
+    block.halfSizeX_[lane] = halfSize.x_;
+    block.halfSizeY_[lane] = halfSize.y_;
+    block.halfSizeZ_[lane] = halfSize.z_;
+}
+
+/// Return an instance world bounding box from a box block.
+static inline BoundingBox GetInstanceBox(const DrawableBoxBlock& block, unsigned lane)
+{
+    Vector3 center(block.centerX_[lane], block.centerY_[lane], block.centerZ_[lane]);
+    Vector3 halfSize(block.halfSizeX_[lane], block.halfSizeY_[lane], block.halfSizeZ_[lane]);
+    return BoundingBox(center - halfSize, center + halfSize);
+}
+
 StaticModelGroup::StaticModelGroup(Context* context) :
     StaticModel(context),
+    numWorldTransforms_(0),
+    numMovedInstances_(0),
+    instancesDirty_(true),
+    instanceCulling_(true),
     nodesDirty_(false),
     nodeIDsDirty_(false)
 {
@@ -60,6 +117,7 @@ void StaticModelGroup::RegisterObject(Context* context)
     URHO3D_COPY_BASE_ATTRIBUTES(StaticModel);
     URHO3D_ACCESSOR_ATTRIBUTE("Instance Nodes", GetNodeIDsAttr, SetNodeIDsAttr, VariantVector, Variant::emptyVariantVector,
         AM_DEFAULT | AM_NODEIDVECTOR);
+    URHO3D_ACCESSOR_ATTRIBUTE("Instance Culling", GetInstanceCulling, SetInstanceCulling, bool, true, AM_DEFAULT);
 }
 
 void StaticModelGroup::ApplyAttributes()
@@ -93,8 +151,7 @@ void StaticModelGroup::ApplyAttributes()
         }
     }
 
-    worldTransforms_.Resize(instanceNodes_.Size());
-    numWorldTransforms_ = 0; // Correct amount will be found during world bounding box update
+    instancesDirty_ = true; // Transforms will be gathered during world bounding box update
     nodesDirty_ = false;
 
     OnMarkedDirty(GetNode());
@@ -157,7 +214,7 @@ void StaticModelGroup::ProcessRayQuery(const RayOctreeQuery& query, PODVector<Ra
             result.distance_ = distance;
             result.drawable_ = this;
             result.node_ = node_;
-            result.subObject_ = i;
+            result.subObject_ = instanceIndices_[i];
             results.Push(result);
         }
     }
@@ -170,20 +227,35 @@ void StaticModelGroup::UpdateBatches(const FrameInfo& frame)
     const Matrix3x4& worldTransform = node_->GetWorldTransform();
     distance_ = frame.camera_->GetDistance(worldBoundingBox.Center());
 
+    // Draw only the instances inside the view frustum if the group has several cells. Several lights may update the batches
+    // simultaneously, so guard the culling result storage
+    const Matrix3x4* transforms = numWorldTransforms_ ? &worldTransforms_[0] : &Matrix3x4::IDENTITY;
+    unsigned numTransforms = numWorldTransforms_;
+    if (instanceCulling_ && cellBoxes_.Size() > 1)
+    {
+        MutexLock lock(instanceMutex_);
+        InstanceCullResult* result = CullInstances(frame);
+        if (result)
+        {
+            numTransforms = result->worldTransforms_.Size();
+            transforms = numTransforms ? &result->worldTransforms_[0] : &Matrix3x4::IDENTITY;
+        }
+    }
+
     if (batches_.Size() > 1)
     {
         for (unsigned i = 0; i < batches_.Size(); ++i)
         {
             batches_[i].distance_ = frame.camera_->GetDistance(worldTransform * geometryData_[i].center_);
-            batches_[i].worldTransform_ = numWorldTransforms_ ? &worldTransforms_[0] : &Matrix3x4::IDENTITY;
-            batches_[i].numWorldTransforms_ = numWorldTransforms_;
+            batches_[i].worldTransform_ = transforms;
+            batches_[i].numWorldTransforms_ = numTransforms;
         }
     }
     else if (batches_.Size() == 1)
     {
         batches_[0].distance_ = distance_;
-        batches_[0].worldTransform_ = numWorldTransforms_ ? &worldTransforms_[0] : &Matrix3x4::IDENTITY;
-        batches_[0].numWorldTransforms_ = numWorldTransforms_;
+        batches_[0].worldTransform_ = transforms;
+        batches_[0].numWorldTransforms_ = numTransforms;
     }
 
     float scale = worldBoundingBox.Size().DotProduct(DOT_SCALE);
@@ -267,6 +339,12 @@ bool StaticModelGroup::DrawOcclusion(OcclusionBuffer* buffer)
     return true;
 }
 
+const Matrix3x4* StaticModelGroup::GetShadowWorldTransforms(unsigned batchIndex, unsigned& numWorldTransforms) const
+{
+    numWorldTransforms = numWorldTransforms_;
+    return numWorldTransforms_ ? &worldTransforms_[0] : &Matrix3x4::IDENTITY;
+}
+
 void StaticModelGroup::AddInstanceNode(Node* node)
 {
     if (!node)
@@ -310,6 +388,12 @@ void StaticModelGroup::RemoveAllInstanceNodes()
     UpdateNumTransforms();
 }
 
+void StaticModelGroup::SetInstanceCulling(bool enable)
+{
+    instanceCulling_ = enable;
+    MarkNetworkUpdate();
+}
+
 Node* StaticModelGroup::GetInstanceNode(unsigned index) const
 {
     return index < instanceNodes_.Size() ? instanceNodes_[index] : (Node*)0;
@@ -359,38 +443,409 @@ const VariantVector& StaticModelGroup::GetNodeIDsAttr() const
 
 void StaticModelGroup::OnNodeSetEnabled(Node* node)
 {
+    instancesDirty_ = true;
+    Drawable::OnMarkedDirty(node);
+}
+
+void StaticModelGroup::OnMarkedDirty(Node* node)
+{
+    // Remember the moved instance nodes to update only their transforms. If the group's own node was dirtied, the model
+    // bounding box may have changed, so update all instances. Instance nodes may be dirtied from several worker threads
+    // during a threaded scene update
+    MutexLock lock(instanceMutex_);
+    if (node == node_)
+        instancesDirty_ = true;
+    else if (!instancesDirty_)
+    {
+        movedNodes_.Push(node);
+        if (movedNodes_.Size() > instanceNodes_.Size())
+            instancesDirty_ = true;
+    }
+
+    StaticModel::OnMarkedDirty(node);
+}
+
+void StaticModelGroup::OnNodeDestroyed(Node* node)
+{
+    // Remember the destroyed instance nodes to remove only them from their cells. Removing many at once degrades the
+    // spatial order of the cells, so rebuild then
+    MutexLock lock(instanceMutex_);
+    if (!instancesDirty_)
+    {
+        removedNodes_.Push(node);
+        if (removedNodes_.Size() > numWorldTransforms_ / 4)
+            instancesDirty_ = true;
+    }
+
     Drawable::OnMarkedDirty(node);
 }
 
 void StaticModelGroup::OnWorldBoundingBoxUpdate()
 {
-    // Update transforms and bounding box at the same time to have to go through the objects only once
-    unsigned index = 0;
+    // This function may be called from multiple worker threads simultaneously
+    MutexLock lock(instanceMutex_);
+
+    if (instancesDirty_ || !UpdateMovedInstances())
+        RebuildInstances();
 
     BoundingBox worldBox;
+    for (unsigned i = 0; i < cellBoxes_.Size(); ++i)
+        worldBox.Merge(cellBoxes_[i]);
 
-    for (unsigned i = 0; i < instanceNodes_.Size(); ++i)
+    worldBoundingBox_ = worldBox;
+}
+
+void StaticModelGroup::RebuildInstances()
+{
+    unsigned numInstances = instanceNodes_.Size();
+    worldTransforms_.Resize(numInstances);
+    instanceIndices_.Resize(numInstances);
+
+    unsigned numValid = 0;
+    BoundingBox positionBox;
+
+    for (unsigned i = 0; i < numInstances; ++i)
     {
         Node* node = instanceNodes_[i];
         if (!node || !node->IsEnabled())
             continue;
 
         const Matrix3x4& worldTransform = node->GetWorldTransform();
-        worldTransforms_[index++] = worldTransform;
-        worldBox.Merge(boundingBox_.Transformed(worldTransform));
+        worldTransforms_[numValid] = worldTransform;
+        instanceIndices_[numValid] = i;
+        positionBox.Merge(worldTransform.Translation());
+        ++numValid;
     }
 
-    worldBoundingBox_ = worldBox;
+    // Sort the instances along a Morton curve of their positions, so that cells of consecutive instances are spatially compact
+    if (numValid > INSTANCES_PER_CELL)
+    {
+        Vector3 size = positionBox.Size();
+        Vector3 scale(size.x_ > 0.0f ? 1023.0f / size.x_ : 0.0f, size.y_ > 0.0f ? 1023.0f / size.y_ : 0.0f,
+            size.z_ > 0.0f ? 1023.0f / size.z_ : 0.0f);
+
+        PODVector<unsigned long long> sortKeys(numValid);
+        for (unsigned i = 0; i < numValid; ++i)
+        {
+            Vector3 position = (worldTransforms_[i].Translation() - positionBox.min_) * scale;
+            unsigned code = SpreadBits((unsigned)position.x_) | (SpreadBits((unsigned)position.y_) << 1) |
+                (SpreadBits((unsigned)position.z_) << 2);
+            sortKeys[i] = ((unsigned long long)code << 32) | i;
+        }
+        SortInstanceKeys(sortKeys);
+
+        PODVector<Matrix3x4> sortedTransforms(numValid);
+        PODVector<unsigned> sortedIndices(numValid);
+        for (unsigned i = 0; i < numValid; ++i)
+        {
+            unsigned index = (unsigned)sortKeys[i];
+            sortedTransforms[i] = worldTransforms_[index];
+            sortedIndices[i] = instanceIndices_[index];
+        }
+        for (unsigned i = 0; i < numValid; ++i)
+        {
+            worldTransforms_[i] = sortedTransforms[i];
+            instanceIndices_[i] = sortedIndices[i];
+        }
+    }
+
+    instanceBoxes_.Resize((numValid + 3) >> 2);
+    cellBoxes_.Resize((numValid + INSTANCES_PER_CELL - 1) / INSTANCES_PER_CELL);
+    for (unsigned i = 0; i < cellBoxes_.Size(); ++i)
+        cellBoxes_[i].Clear();
+
+    unsigned numSlots = 1;
+    while (numSlots < numValid * 2)
+        numSlots <<= 1;
+    slotNodes_.Resize(numSlots);
+    slotIndices_.Resize(numSlots);
+    memset(&slotNodes_[0], 0, numSlots * sizeof(Node*));
+
+    for (unsigned i = 0; i < numValid; ++i)
+    {
+        BoundingBox box = boundingBox_.Transformed(worldTransforms_[i]);
+        SetInstanceBox(instanceBoxes_[i >> 2], i & 3, box);
+        cellBoxes_[i / INSTANCES_PER_CELL].Merge(box);
+
+        Node* node = instanceNodes_[instanceIndices_[i]];
+        unsigned slot = GetNodeSlot(node, numSlots - 1);
+        while (slotNodes_[slot])
+            slot = (slot + 1) & (numSlots - 1);
+        slotNodes_[slot] = node;
+        slotIndices_[slot] = i;
+    }
+
+    numWorldTransforms_ = numValid;
+    numMovedInstances_ = 0;
+    movedNodes_.Clear();
+    removedNodes_.Clear();
+    instancesDirty_ = false;
+}
+
+bool StaticModelGroup::UpdateMovedInstances()
+{
+    if (removedNodes_.Size() && !RemoveDestroyedInstances())
+        return false;
+
+    for (unsigned i = 0; i < movedNodes_.Size(); ++i)
+    {
+        unsigned slot = FindNodeSlot(movedNodes_[i]);
+        if (slot == M_MAX_UNSIGNED)
+            continue;
+
+        // The moved node pointer is only used for lookup, as the node may have been destroyed since
+        unsigned index = slotIndices_[slot];
+        Node* node = instanceNodes_[instanceIndices_[index]];
+        const Matrix3x4& worldTransform = node->GetWorldTransform();
+        worldTransforms_[index] = worldTransform;
+        BoundingBox box = boundingBox_.Transformed(worldTransform);
+        SetInstanceBox(instanceBoxes_[index >> 2], index & 3, box);
+        cellBoxes_[index / INSTANCES_PER_CELL].Merge(box);
+        ++numMovedInstances_;
+    }
+
+    movedNodes_.Clear();
+
+    // The cell boxes only grow as instances move. Refit them once many instances have moved
+    if (numMovedInstances_ > numWorldTransforms_ / 4)
+    {
+        for (unsigned i = 0; i < cellBoxes_.Size(); ++i)
+            cellBoxes_[i].Clear();
+        for (unsigned i = 0; i < numWorldTransforms_; ++i)
+            cellBoxes_[i / INSTANCES_PER_CELL].Merge(GetInstanceBox(instanceBoxes_[i >> 2], i & 3));
+        numMovedInstances_ = 0;
+    }
+
+    return true;
+}
+
+bool StaticModelGroup::RemoveDestroyedInstances()
+{
+    // Take the destroyed nodes out of the hash table and mark their instances removed. The node pointers are only used
+    // for lookup
+    PODVector<unsigned> removedIndices;
+    for (unsigned i = 0; i < removedNodes_.Size(); ++i)
+    {
+        unsigned slot = FindNodeSlot(removedNodes_[i]);
+        if (slot == M_MAX_UNSIGNED)
+            continue;
+
+        unsigned index = slotIndices_[slot];
+        instanceIndices_[index] = M_MAX_UNSIGNED;
+        removedIndices.Push(index);
+        RemoveNodeSlot(slot);
+    }
+    removedNodes_.Clear();
+
+    // Fill each hole with the last remaining instance, and collect the cells that need refitting
+    PODVector<unsigned> dirtyCells;
+    for (unsigned i = 0; i < removedIndices.Size(); ++i)
+    {
+        unsigned index = removedIndices[i];
+        dirtyCells.Push(index / INSTANCES_PER_CELL);
+
+        while (numWorldTransforms_ && instanceIndices_[numWorldTransforms_ - 1] == M_MAX_UNSIGNED)
+            --numWorldTransforms_;
+        if (index >= numWorldTransforms_)
+            continue;
+
+        unsigned last = --numWorldTransforms_;
+        dirtyCells.Push(last / INSTANCES_PER_CELL);
+        Node* node = instanceNodes_[instanceIndices_[last]];
+        unsigned slot = FindNodeSlot(node);
+        if (slot == M_MAX_UNSIGNED)
+            return false;
+
+        worldTransforms_[index] = worldTransforms_[last];
+        instanceIndices_[index] = instanceIndices_[last];
+        SetInstanceBox(instanceBoxes_[index >> 2], index & 3, GetInstanceBox(instanceBoxes_[last >> 2], last & 3));
+        slotIndices_[slot] = index;
+    }
+
+    unsigned numCells = (numWorldTransforms_ + INSTANCES_PER_CELL - 1) / INSTANCES_PER_CELL;
+    cellBoxes_.Resize(numCells);
+    for (unsigned i = 0; i < dirtyCells.Size(); ++i)
+    {
+        unsigned cell = dirtyCells[i];
+        if (cell >= numCells)
+            continue;
+
+        cellBoxes_[cell].Clear();
+        unsigned end = Min((cell + 1) * INSTANCES_PER_CELL, numWorldTransforms_);
+        for (unsigned j = cell * INSTANCES_PER_CELL; j < end; ++j)
+            cellBoxes_[cell].Merge(GetInstanceBox(instanceBoxes_[j >> 2], j & 3));
+    }
+
+    return true;
+}
+
+unsigned StaticModelGroup::FindNodeSlot(Node* node) const
+{
+    if (!node || slotNodes_.Empty())
+        return M_MAX_UNSIGNED;
+
+    unsigned mask = slotNodes_.Size() - 1;
+    unsigned slot = GetNodeSlot(node, mask);
+    while (slotNodes_[slot] && slotNodes_[slot] != node)
+        slot = (slot + 1) & mask;
+
+    return slotNodes_[slot] ? slot : M_MAX_UNSIGNED;
+}
+
+void StaticModelGroup::RemoveNodeSlot(unsigned slot)
+{
+    // Shift the following entries of the probe sequence back, so that lookups need no deleted markers
+    unsigned mask = slotNodes_.Size() - 1;
+    for (;;)
+    {
+        slotNodes_[slot] = 0;
+        unsigned next = slot;
+        for (;;)
+        {
+            next = (next + 1) & mask;
+            if (!slotNodes_[next])
+                return;
+
+            // An entry can move back only if its home slot is not cyclically within (slot, next]
+            unsigned home = GetNodeSlot(slotNodes_[next], mask);
+            bool stays = slot <= next ? (slot < home && home <= next) : (slot < home || home <= next);
+            if (!stays)
+                break;
+        }
+
+        slotNodes_[slot] = slotNodes_[next];
+        slotIndices_[slot] = slotIndices_[next];
+        slot = next;
+    }
+}
+
+InstanceCullResult* StaticModelGroup::CullInstances(const FrameInfo& frame)
+{
+    const Frustum& frustum = frame.camera_->GetFrustum();
+    if (frustum.IsInside(worldBoundingBox_) == INSIDE)
+        return 0;
+
+    // Use the storage of this camera if already culled on this frame, otherwise one that is not in use on this frame. The
+    // batches of earlier views refer to their results until rendered, so they must not be overwritten
+    InstanceCullResult* result = 0;
+    for (unsigned i = 0; i < MAX_INSTANCE_CULL_CAMERAS; ++i)
+    {
+        InstanceCullResult& cullResult = cullResults_[i];
+        if (cullResult.camera_ == frame.camera_ && cullResult.frameNumber_ == frame.frameNumber_)
+        {
+            result = &cullResult;
+            break;
+        }
+        if (!result && (!cullResult.camera_ || cullResult.frameNumber_ != frame.frameNumber_))
+            result = &cullResult;
+    }
+    if (!result)
+        return 0;
+
+    result->camera_ = frame.camera_;
+    result->frameNumber_ = frame.frameNumber_;
+    result->worldTransforms_.Resize(numWorldTransforms_);
+    Matrix3x4* dest = numWorldTransforms_ ? &result->worldTransforms_[0] : 0;
+    unsigned numVisible = 0;
+
+#ifdef URHO3D_SSE
+    __m128 normalX[NUM_FRUSTUM_PLANES];
+    __m128 normalY[NUM_FRUSTUM_PLANES];
+    __m128 normalZ[NUM_FRUSTUM_PLANES];
+    __m128 absNormalX[NUM_FRUSTUM_PLANES];
+    __m128 absNormalY[NUM_FRUSTUM_PLANES];
+    __m128 absNormalZ[NUM_FRUSTUM_PLANES];
+    __m128 planeD[NUM_FRUSTUM_PLANES];
+    for (unsigned i = 0; i < NUM_FRUSTUM_PLANES; ++i)
+    {
+        const Plane& plane = frustum.planes_[i];
+        normalX[i] = _mm_set1_ps(plane.normal_.x_);
+        normalY[i] = _mm_set1_ps(plane.normal_.y_);
+        normalZ[i] = _mm_set1_ps(plane.normal_.z_);
+        absNormalX[i] = _mm_set1_ps(plane.absNormal_.x_);
+        absNormalY[i] = _mm_set1_ps(plane.absNormal_.y_);
+        absNormalZ[i] = _mm_set1_ps(plane.absNormal_.z_);
+        planeD[i] = _mm_set1_ps(plane.d_);
+    }
+    __m128 zero = _mm_setzero_ps();
+#endif
+
+    for (unsigned i = 0; i < cellBoxes_.Size(); ++i)
+    {
+        Intersection cellIntersection = frustum.IsInside(cellBoxes_[i]);
+        if (cellIntersection == OUTSIDE)
+            continue;
+
+        unsigned start = i * INSTANCES_PER_CELL;
+        unsigned end = Min(start + INSTANCES_PER_CELL, numWorldTransforms_);
+
+        // Cells fully inside need no per-instance tests
+        if (cellIntersection == INSIDE)
+        {
+            for (unsigned j = start; j < end; ++j)
+                dest[numVisible++] = worldTransforms_[j];
+            continue;
+        }
+
+        for (unsigned j = start; j < end; j += 4)
+        {
+            const DrawableBoxBlock& block = instanceBoxes_[j >> 2];
+            unsigned outsideMask = 0;
+
+#ifdef URHO3D_SSE
+            __m128 centerX = _mm_loadu_ps(block.centerX_);
+            __m128 centerY = _mm_loadu_ps(block.centerY_);
+            __m128 centerZ = _mm_loadu_ps(block.centerZ_);
+            __m128 halfSizeX = _mm_loadu_ps(block.halfSizeX_);
+            __m128 halfSizeY = _mm_loadu_ps(block.halfSizeY_);
+            __m128 halfSizeZ = _mm_loadu_ps(block.halfSizeZ_);
+            __m128 outside = zero;
+
+            for (unsigned k = 0; k < NUM_FRUSTUM_PLANES; ++k)
+            {
+                __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX[k], centerX), _mm_mul_ps(normalY[k], centerY)),
+                    _mm_add_ps(_mm_mul_ps(normalZ[k], centerZ), planeD[k]));
+                __m128 absDist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absNormalX[k], halfSizeX), _mm_mul_ps(absNormalY[k], halfSizeY)),
+                    _mm_mul_ps(absNormalZ[k], halfSizeZ));
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dist, absDist), zero));
+            }
+
+            outsideMask = (unsigned)_mm_movemask_ps(outside);
+#else
+            for (unsigned k = 0; k < 4; ++k)
+            {
+                for (unsigned l = 0; l < NUM_FRUSTUM_PLANES; ++l)
+                {
+                    const Plane& plane = frustum.planes_[l];
+                    float dist = plane.normal_.x_ * block.centerX_[k] + plane.normal_.y_ * block.centerY_[k] +
+                        plane.normal_.z_ * block.centerZ_[k] + plane.d_;
+                    float absDist = plane.absNormal_.x_ * block.halfSizeX_[k] + plane.absNormal_.y_ * block.halfSizeY_[k] +
+                        plane.absNormal_.z_ * block.halfSizeZ_[k];
+                    if (dist + absDist < 0.0f)
+                    {
+                        outsideMask |= 1 << k;
+                        break;
+                    }
+                }
+            }
+#endif
+
+            unsigned count = Min(end - j, 4U);
+            for (unsigned k = 0; k < count; ++k)
+            {
+                if (!(outsideMask & (1 << k)))
+                    dest[numVisible++] = worldTransforms_[j + k];
+            }
+        }
+    }
 
-    // Store the amount of valid instances we found instead of resizing worldTransforms_. This is because this function may be 
-    // called from multiple worker threads simultaneously
-    numWorldTransforms_ = index;
+    result->worldTransforms_.Resize(numVisible);
+    return result;
 }
 
 void StaticModelGroup::UpdateNumTransforms()
 {
-    worldTransforms_.Resize(instanceNodes_.Size());
-    numWorldTransforms_ = 0; // Correct amount will be during world bounding box update
+    instancesDirty_ = true; // Transforms will be gathered during world bounding box update
     nodeIDsDirty_ = true;
 
     OnMarkedDirty(GetNode());
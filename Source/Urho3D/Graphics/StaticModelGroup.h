@@ -22,12 +22,36 @@
 
 #pragma once
 
+#include "../Core/Mutex.h"
 #include "../Graphics/StaticModel.h"
 
 namespace Urho3D
 {
 
-/// Renders several object instances while culling and receiving light as one unit. Can be used as a CPU-side optimization, but note that also regular StaticModels will use instanced rendering if possible.
+struct DrawableBoxBlock;
+
+/// Maximum number of cameras per frame that a StaticModelGroup culls its instances for. Further cameras draw all instances.
+static const unsigned MAX_INSTANCE_CULL_CAMERAS = 4;
+
+/// Instances of a StaticModelGroup found visible from a camera on a frame.
+struct InstanceCullResult
+{
+    /// Construct.
+    InstanceCullResult() :
+        camera_(0),
+        frameNumber_(0)
+    {
+    }
+
+    /// Camera.
+    Camera* camera_;
+    /// Frame number.
+    unsigned frameNumber_;
+    /// World transforms of the visible instances.
+    PODVector<Matrix3x4> worldTransforms_;
+};
+
+/// Renders several object instances while receiving light as one unit. Can be used as a CPU-side optimization, but note that also regular StaticModels will use instanced rendering if possible. Large groups are divided into spatial cells of instances, and only the instances inside the view frustum are drawn.
 class URHO3D_API StaticModelGroup : public StaticModel
 {
     URHO3D_OBJECT(StaticModelGroup, StaticModel);
@@ -50,6 +74,8 @@ public:
     virtual unsigned GetNumOccluderTriangles();
     /// Draw to occlusion buffer. Return true if did not run out of triangles.
     virtual bool DrawOcclusion(OcclusionBuffer* buffer);
+    /// Return world transforms of a source batch for rendering to shadow maps. Includes also the instances outside the view.
+    virtual const Matrix3x4* GetShadowWorldTransforms(unsigned batchIndex, unsigned& numWorldTransforms) const;
 
     /// Add an instance scene node. It does not need any drawable components of its own.
     void AddInstanceNode(Node* node);
@@ -57,6 +83,8 @@ public:
     void RemoveInstanceNode(Node* node);
     /// Remove all instance scene nodes.
     void RemoveAllInstanceNodes();
+    /// Set whether instances outside the view frustum are culled. Default true.
+    void SetInstanceCulling(bool enable);
 
     /// Return number of instance nodes.
     unsigned GetNumInstanceNodes() const { return instanceNodes_.Size(); }
@@ -64,6 +92,9 @@ public:
     /// Return instance node by index.
     Node* GetInstanceNode(unsigned index) const;
 
+    /// Return whether instances outside the view frustum are culled.
+    bool GetInstanceCulling() const { return instanceCulling_; }
+
     /// Set node IDs attribute.
     void SetNodeIDsAttr(const VariantVector& value);
 
@@ -73,23 +104,63 @@ public:
 protected:
     /// Handle scene node enabled status changing.
     virtual void OnNodeSetEnabled(Node* node);
+    /// Handle node transform being dirtied.
+    virtual void OnMarkedDirty(Node* node);
+    /// Handle an instance node being destroyed.
+    virtual void OnNodeDestroyed(Node* node);
     /// Recalculate the world-space bounding box.
     virtual void OnWorldBoundingBoxUpdate();
 
 private:
     /// Ensure proper size of world transforms when nodes are added/removed. Also mark node IDs dirty.
     void UpdateNumTransforms();
+    /// Gather the transforms and bounding boxes of all valid instances and sort them into spatial cells.
+    void RebuildInstances();
+    /// Update the transforms and bounding boxes of moved instances. Return false if the instances need to be rebuilt.
+    bool UpdateMovedInstances();
+    /// Remove the instances of destroyed nodes and refit the cells they were in. Return false if the instances need to be rebuilt.
+    bool RemoveDestroyedInstances();
+    /// Return the hash table slot of a valid instance node, or M_MAX_UNSIGNED if not found.
+    unsigned FindNodeSlot(Node* node) const;
+    /// Remove a node from the hash table.
+    void RemoveNodeSlot(unsigned slot);
+    /// Cull the instances against the camera frustum. Return the culling result storage, or null if all instances are visible.
+    InstanceCullResult* CullInstances(const FrameInfo& frame);
     /// Update node IDs attribute from the actual nodes.
     void UpdateNodeIDs() const;
 
     /// Instance nodes.
     Vector<WeakPtr<Node> > instanceNodes_;
-    /// World transforms of valid (existing and visible) instances.
+    /// World transforms of valid (existing and visible) instances in spatial order.
     PODVector<Matrix3x4> worldTransforms_;
+    /// World bounding boxes of valid instances in the same order.
+    PODVector<DrawableBoxBlock> instanceBoxes_;
+    /// World bounding boxes of cells of consecutive valid instances.
+    PODVector<BoundingBox> cellBoxes_;
+    /// Instance node indices of valid instances.
+    PODVector<unsigned> instanceIndices_;
+    /// Open addressing hash table of valid instance nodes for finding their world transform indices.
+    PODVector<Node*> slotNodes_;
+    /// World transform indices of the hash table nodes.
+    PODVector<unsigned> slotIndices_;
+    /// Instance nodes moved since the last bounding box update.
+    PODVector<Node*> movedNodes_;
+    /// Instance nodes destroyed since the last bounding box update.
+    PODVector<Node*> removedNodes_;
+    /// Instance culling results of the cameras.
+    InstanceCullResult cullResults_[MAX_INSTANCE_CULL_CAMERAS];
+    /// Mutex for instance updates and culling, which may happen in several worker threads.
+    Mutex instanceMutex_;
     /// IDs of instance nodes for serialization.
     mutable VariantVector nodeIDsAttr_;
     /// Number of valid instance node transforms.
     unsigned numWorldTransforms_;
+    /// Number of instances moved since the cell bounding boxes were last fitted.
+    unsigned numMovedInstances_;
+    /// Whether instances need to be rebuilt.
+    bool instancesDirty_;
+    /// Instance culling flag.
+    bool instanceCulling_;
     /// Whether node IDs have been set and nodes should be searched for during ApplyAttributes.
     mutable bool nodesDirty_;
     /// Whether nodes have been manipulated by the API and node ID attribute should be refreshed.
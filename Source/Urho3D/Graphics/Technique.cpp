@@ -79,9 +79,11 @@ Pass::Pass(const String& name) :
     depthTestMode_(CMP_LESSEQUAL),
     lightingMode_(LIGHTING_UNLIT),
     shadersLoadedFrameNumber_(0),
+    shadersVersion_(0),
     alphaToCoverage_(false),
     depthWrite_(true),
-    isDesktop_(false)
+    isDesktop_(false),
+    clusteredSupport_(false)
 {
     name_ = name.ToLower();
     index_ = Technique::GetPassIndex(name_);
@@ -174,11 +176,18 @@ void Pass::ReleaseShaders()
 {
     vertexShaders_.Clear();
     pixelShaders_.Clear();
+    ++shadersVersion_;
 }
 
 void Pass::MarkShadersLoaded(unsigned frameNumber)
 {
     shadersLoadedFrameNumber_ = frameNumber;
+    ++shadersVersion_;
+}
+
+void Pass::SetClusteredSupport(bool enable)
+{
+    clusteredSupport_ = enable;
 }
 
 String Pass::GetEffectiveVertexShaderDefines() const
@@ -333,6 +342,9 @@ bool Technique::BeginLoad(Deserializer& source)
 
             if (passElem.HasAttribute("alphatocoverage"))
                 newPass->SetAlphaToCoverage(passElem.GetBool("alphatocoverage"));
+
+            if (passElem.HasAttribute("clustered"))
+                newPass->SetClusteredSupport(passElem.GetBool("clustered"));
         }
         else
             URHO3D_LOGERROR("Missing pass name");
@@ -377,6 +389,7 @@ SharedPtr<Technique> Technique::Clone(const String& cloneName) const
         newPass->SetLightingMode(srcPass->GetLightingMode());
         newPass->SetDepthWrite(srcPass->GetDepthWrite());
         newPass->SetAlphaToCoverage(srcPass->GetAlphaToCoverage());
+        newPass->SetClusteredSupport(srcPass->GetClusteredSupport());
         newPass->SetIsDesktop(srcPass->IsDesktop());
         newPass->SetVertexShader(srcPass->GetVertexShader());
         newPass->SetPixelShader(srcPass->GetPixelShader());
@@ -77,6 +77,8 @@ public:
     void ReleaseShaders();
     /// Mark shaders loaded this frame.
     void MarkShadersLoaded(unsigned frameNumber);
+    /// Set whether the pixel shader adds the lights of the light clusters when compiled with the CLUSTERED define.
+    void SetClusteredSupport(bool enable);
 
     /// Return pass name.
     const String& GetName() const { return name_; }
@@ -99,6 +101,9 @@ public:
     /// Return last shaders loaded frame number.
     unsigned GetShadersLoadedFrameNumber() const { return shadersLoadedFrameNumber_; }
 
+    /// Return shaders version, which changes whenever the shaders are released or loaded.
+    unsigned GetShadersVersion() const { return shadersVersion_; }
+
     /// Return depth write mode.
     bool GetDepthWrite() const { return depthWrite_; }
 
@@ -108,6 +113,9 @@ public:
     /// Return whether requires desktop level hardware.
     bool IsDesktop() const { return isDesktop_; }
 
+    /// Return whether the pixel shader adds the lights of the light clusters.
+    bool GetClusteredSupport() const { return clusteredSupport_; }
+
     /// Return vertex shader name.
     const String& GetVertexShader() const { return vertexShaderName_; }
 
@@ -150,12 +158,16 @@ private:
     PassLightingMode lightingMode_;
     /// Last shaders loaded frame number.
     unsigned shadersLoadedFrameNumber_;
+    /// Shaders version.
+    unsigned shadersVersion_;
     /// Depth write mode.
     bool depthWrite_;
     /// Alpha-to-coverage mode.
     bool alphaToCoverage_;
     /// Require desktop level hardware flag.
     bool isDesktop_;
+    /// Clustered lighting support of the loaded pixel shaders.
+    bool clusteredSupport_;
     /// Vertex shader name.
     String vertexShaderName_;
     /// Pixel shader name.
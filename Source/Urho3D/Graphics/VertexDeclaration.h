@@ -22,7 +22,9 @@
 
 #pragma once
 
-#if defined(URHO3D_OPENGL)
+#if defined(URHO3D_NULL_GRAPHICS)
+// Null graphics API does not have VertexDeclaration class
+#elif defined(URHO3D_OPENGL)
 //#error OpenGL Graphics API does not have VertexDeclaration class, remove this header file in your build to fix this error
 #elif defined(URHO3D_D3D11)
 #include "Direct3D11/D3D11VertexDeclaration.h"
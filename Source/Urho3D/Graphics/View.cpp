@@ -65,6 +65,23 @@ static const Vector3* directions[] =
     &Vector3::BACK
 };
 
+/// Number of light cluster tiles horizontally.
+static const unsigned CLUSTER_TILES_X = 16;
+/// Number of light cluster tiles vertically.
+static const unsigned CLUSTER_TILES_Y = 8;
+/// Number of exponentially spaced light cluster depth slices.
+static const unsigned CLUSTER_SLICES = 24;
+/// Number of light clusters in a depth slice.
+static const unsigned CLUSTERS_PER_SLICE = CLUSTER_TILES_X * CLUSTER_TILES_Y;
+/// Total number of light clusters.
+static const unsigned NUM_CLUSTERS = CLUSTERS_PER_SLICE * CLUSTER_SLICES;
+/// Maximum number of lights per cluster. Must match MAXCLUSTERLIGHTS in the shaders.
+static const unsigned MAX_CLUSTER_LIGHTS = 32;
+/// Maximum number of clustered lights in a view. Further lights are rendered per-pixel.
+static const unsigned MAX_CLUSTERED_LIGHTS = 4096;
+/// Width of the light cluster texture in texels.
+static const int CLUSTER_TEXTURE_WIDTH = 1024;
+
 /// %Frustum octree query for shadowcasters.
 class ShadowCasterOctreeQuery : public FrustumOctreeQuery
 {
@@ -244,6 +261,48 @@ void ProcessLightWork(const WorkItem* item, unsigned threadIndex)
     view->ProcessLight(*query, threadIndex);
 }
 
+void AssignClusterLightsWork(const WorkItem* item, unsigned threadIndex)
+{
+    View* view = reinterpret_cast<View*>(item->aux_);
+    const unsigned* start = reinterpret_cast<const unsigned*>(item->start_);
+    const unsigned* end = reinterpret_cast<const unsigned*>(item->end_);
+    const unsigned* counts = &view->clusterLightCounts_[0];
+
+    view->AssignClusterLights((unsigned)(start - counts) / CLUSTERS_PER_SLICE, (unsigned)(end - counts) / CLUSTERS_PER_SLICE);
+}
+
+static void PushBatch(BatchQueue& batchQueue, Batch& batch)
+{
+    // If batch is static with multiple world transforms and cannot instance, we must push copies of the batch individually
+    if (batch.geometryType_ == GEOM_STATIC && batch.numWorldTransforms_ > 1)
+    {
+        unsigned numTransforms = batch.numWorldTransforms_;
+        batch.numWorldTransforms_ = 1;
+        for (unsigned i = 0; i < numTransforms; ++i)
+        {
+            // Move the transform pointer to generate copies of the batch which only refer to 1 world transform
+            batchQueue.batches_.Push(batch);
+            ++batch.worldTransform_;
+        }
+    }
+    else
+        batchQueue.batches_.Push(batch);
+}
+
+static unsigned HashData(const void* data, unsigned size, unsigned hash)
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    for (unsigned i = 0; i < size; ++i)
+        hash = SDBMHash(hash, bytes[i]);
+    return hash;
+}
+
+static bool CompareShadowOccluders(Drawable* lhs, Drawable* rhs)
+{
+    // Draw the largest shadow casters first, as they are most likely to hide the others
+    return lhs->GetWorldBoundingBox().Size().LengthSquared() > rhs->GetWorldBoundingBox().Size().LengthSquared();
+}
+
 void UpdateDrawableGeometriesWork(const WorkItem* item, unsigned threadIndex)
 {
     const FrameInfo& frame = *(reinterpret_cast<FrameInfo*>(item->aux_));
@@ -301,12 +360,18 @@ View::View(Context* context) :
     farClipZone_(0),
     occlusionBuffer_(0),
     renderTarget_(0),
-    substituteRenderTarget_(0)
+    substituteRenderTarget_(0),
+    clusteredLighting_(false),
+    baseBatchCacheQuality_(-1),
+    baseBatchCacheShadersFrame_(0),
+    baseBatchCacheInstancing_(false)
 {
     // Create octree query and scene results vector for each thread
     unsigned numThreads = GetSubsystem<WorkQueue>()->GetNumThreads() + 1; // Worker threads + main thread
     tempDrawables_.Resize(numThreads);
     sceneResults_.Resize(numThreads);
+    shadowOccluders_.Resize(numThreads);
+    occludedShadowCasters_.Resize(numThreads);
     frame_.camera_ = 0;
 }
 
@@ -368,6 +433,7 @@ bool View::Define(RenderSurface* renderTarget, Viewport* viewport)
             useLitBase_ = sourceView_->useLitBase_;
             hasScenePasses_ = sourceView_->hasScenePasses_;
             noStencil_ = sourceView_->noStencil_;
+            clusteredLighting_ = sourceView_->clusteredLighting_;
             lightVolumeCommand_ = sourceView_->lightVolumeCommand_;
             octree_ = sourceView_->octree_;
             return true;
@@ -392,6 +458,7 @@ bool View::Define(RenderSurface* renderTarget, Viewport* viewport)
     useLitBase_ = false;
     hasScenePasses_ = false;
     noStencil_ = false;
+    clusteredLighting_ = false;
     lightVolumeCommand_ = 0;
 
     scenePasses_.Clear();
@@ -435,6 +502,7 @@ bool View::Define(RenderSurface* renderTarget, Viewport* viewport)
             info.allowInstancing_ = command.sortMode_ != SORT_BACKTOFRONT;
             info.markToStencil_ = !noStencil_ && command.markToStencil_;
             info.vertexLights_ = command.vertexLights_;
+            info.clustered_ = command.clustered_;
 
             // Check scenepass metadata for defining custom passes which interact with lighting
             if (!command.metadata_.Empty())
@@ -510,6 +578,30 @@ bool View::Define(RenderSurface* renderTarget, Viewport* viewport)
             useLitBase_ = command.useLitBase_;
     }
 
+    // Use clustered lighting if requested by a scene pass. The light clusters are defined in perspective view space, so
+    // with an orthographic camera the clustered scene passes fall back to forward lighting
+#ifdef DESKTOP_GRAPHICS
+    if (hasScenePasses_ && !cullCamera_->IsOrthographic())
+    {
+        for (unsigned i = 0; i < scenePasses_.Size(); ++i)
+        {
+            if (scenePasses_[i].clustered_)
+                clusteredLighting_ = true;
+        }
+    }
+#endif
+    if (clusteredLighting_)
+    {
+        // The clustered lights are added in the base pass, so it must not be replaced by a litbase pass
+        useLitBase_ = false;
+        renderer_->SetClusteredShaders();
+    }
+    else
+    {
+        for (unsigned i = 0; i < scenePasses_.Size(); ++i)
+            scenePasses_[i].clustered_ = false;
+    }
+
     drawShadows_ = renderer_->GetDrawShadows();
     materialQuality_ = renderer_->GetMaterialQuality();
     maxOccluderTriangles_ = renderer_->GetMaxOccluderTriangles();
@@ -557,9 +649,52 @@ void View::Update(const FrameInfo& frame)
     zones_.Clear();
     occluders_.Clear();
     activeOccluders_ = 0;
+    reusedShadowMaps_ = 0;
+    for (unsigned i = 0; i < occludedShadowCasters_.Size(); ++i)
+        occludedShadowCasters_[i] = 0;
     vertexLightQueues_.Clear();
+
+    // When base pass batches are cached, keep the batch groups between frames, unless the scene passes or the shaders have
+    // changed, in which case start over
+    bool keepGroups = false;
+    if (renderer_->GetBatchCaching())
+    {
+        keepGroups = baseBatchCachePasses_.Size() == scenePasses_.Size() && baseBatchCacheQuality_ == materialQuality_ &&
+            baseBatchCacheShadersFrame_ == renderer_->GetShadersChangedFrameNumber() &&
+            baseBatchCacheInstancing_ == renderer_->GetDynamicInstancing();
+        for (unsigned i = 0; keepGroups && i < scenePasses_.Size(); ++i)
+        {
+            const ScenePassInfo& info = scenePasses_[i];
+            const ScenePassInfo& cachedInfo = baseBatchCachePasses_[i];
+            keepGroups = info.passIndex_ == cachedInfo.passIndex_ && info.allowInstancing_ == cachedInfo.allowInstancing_ &&
+                info.markToStencil_ == cachedInfo.markToStencil_ && info.vertexLights_ == cachedInfo.vertexLights_ &&
+                info.clustered_ == cachedInfo.clustered_ && info.batchQueue_ == cachedInfo.batchQueue_;
+        }
+
+        if (!keepGroups)
+        {
+            baseBatchCache_.Clear();
+            freeBaseBatchCacheEntries_.Clear();
+            baseBatchCachePasses_ = scenePasses_;
+            baseBatchCacheQuality_ = materialQuality_;
+            baseBatchCacheShadersFrame_ = renderer_->GetShadersChangedFrameNumber();
+            baseBatchCacheInstancing_ = renderer_->GetDynamicInstancing();
+        }
+    }
+    else if (baseBatchCache_.Size())
+    {
+        baseBatchCache_.Clear();
+        freeBaseBatchCacheEntries_.Clear();
+        baseBatchCachePasses_.Clear();
+    }
+
     for (HashMap<unsigned, BatchQueue>::Iterator i = batchQueues_.Begin(); i != batchQueues_.End(); ++i)
-        i->second_.Clear(maxSortedInstances);
+    {
+        if (keepGroups)
+            i->second_.ClearKeepGroups(maxSortedInstances);
+        else
+            i->second_.Clear(maxSortedInstances);
+    }
 
     if (hasScenePasses_ && (!cullCamera_ || !octree_))
     {
@@ -691,6 +826,14 @@ View* View::GetSourceView() const
     return sourceView_;
 }
 
+unsigned View::GetNumOccludedShadowCasters() const
+{
+    unsigned count = 0;
+    for (unsigned i = 0; i < occludedShadowCasters_.Size(); ++i)
+        count += occludedShadowCasters_[i];
+    return count;
+}
+
 void View::SetGlobalShaderParameters()
 {
     graphics_->SetShaderParameter(VSP_DELTATIME, frame_.timeStep_);
@@ -759,6 +902,21 @@ void View::SetCameraShaderParameters(Camera* camera)
 #endif
 
     graphics_->SetShaderParameter(VSP_VIEWPROJ, projection * camera->GetView());
+
+    // Set light cluster parameters, which refer to the culling camera of the view
+    Texture2D* clusterTexture = GetClusterTexture();
+    if (clusterTexture && camera == camera_)
+    {
+        const View* actualView = sourceView_ ? sourceView_.Get() : this;
+        float texWidth = (float)clusterTexture->GetWidth();
+        float texHeight = (float)clusterTexture->GetHeight();
+        graphics_->SetShaderParameter(PSP_CLUSTERVIEW, actualView->clusterView_);
+        graphics_->SetShaderParameter(PSP_CLUSTERPROJ, actualView->clusterProj_);
+        graphics_->SetShaderParameter(PSP_CLUSTERGRID, Vector4((float)CLUSTER_TILES_X, (float)CLUSTER_TILES_Y, (float)CLUSTER_SLICES,
+            (float)NUM_CLUSTERS));
+        graphics_->SetShaderParameter(PSP_CLUSTERDEPTH, actualView->clusterDepth_);
+        graphics_->SetShaderParameter(PSP_CLUSTERTEXSIZE, Vector4(texWidth, texHeight, 1.0f / texWidth, 1.0f / texHeight));
+    }
 }
 
 void View::SetGBufferShaderParameters(const IntVector2& texSize, const IntRect& viewRect)
@@ -863,17 +1021,28 @@ void View::GetDrawables()
     else
         occluders_.Clear();
 
-    // Get lights and geometries. Coarse occlusion for octants is used at this point
+    // Get lights and geometries. Coarse occlusion for octants is used at this point. If visibility caching is enabled, reuse
+    // the frustum culling results of the octants that have not changed since the last frame
+    bool useCache = renderer_->GetVisibilityCaching();
+    if (!useCache)
+        visibilityCache_.Clear();
+
     if (occlusionBuffer_)
     {
         OccludedFrustumOctreeQuery query
             (tempDrawables, cullCamera_->GetFrustum(), occlusionBuffer_, DRAWABLE_GEOMETRY | DRAWABLE_LIGHT, cullCamera_->GetViewMask());
-        octree_->GetDrawables(query);
+        if (useCache)
+            octree_->GetDrawables(query, visibilityCache_);
+        else
+            octree_->GetDrawables(query, true);
     }
     else
     {
         FrustumOctreeQuery query(tempDrawables, cullCamera_->GetFrustum(), DRAWABLE_GEOMETRY | DRAWABLE_LIGHT, cullCamera_->GetViewMask());
-        octree_->GetDrawables(query);
+        if (useCache)
+            octree_->GetDrawables(query, visibilityCache_);
+        else
+            octree_->GetDrawables(query, true);
     }
 
     // Check drawable occlusion, find zones for moved drawables and collect geometries & lights in worker threads
@@ -974,7 +1143,38 @@ void View::ProcessLights()
     URHO3D_PROFILE(ProcessLights);
 
     WorkQueue* queue = GetSubsystem<WorkQueue>();
+
+    // If using clustered lighting, assign the suitable lights to the light clusters instead of querying their lit geometries
+    clusteredLights_.Clear();
+    if (clusteredLighting_)
+        CheckClusteredGeometries();
     lightQueryResults_.Resize(lights_.Size());
+    unsigned numQueries = 0;
+    for (unsigned i = 0; i < lights_.Size(); ++i)
+    {
+        Light* light = lights_[i];
+        if (clusteredLighting_ && clusteredLights_.Size() < MAX_CLUSTERED_LIGHTS && IsClusteredLight(light))
+            clusteredLights_.Push(light);
+        else
+            lightQueryResults_[numQueries++].light_ = light;
+    }
+    lightQueryResults_.Resize(numQueries);
+
+    // If shadow casters are occlusion culled, prepare a non-threaded occlusion buffer for each thread. The shadow cameras
+    // have a square aspect ratio
+    if (drawShadows_ && maxOccluderTriangles_ > 0 && renderer_->GetShadowCasterOcclusion())
+    {
+        int size = renderer_->GetOcclusionBufferSize();
+        shadowOcclusionBuffers_.Resize(tempDrawables_.Size());
+        for (unsigned i = 0; i < shadowOcclusionBuffers_.Size(); ++i)
+        {
+            if (!shadowOcclusionBuffers_[i])
+                shadowOcclusionBuffers_[i] = new OcclusionBuffer(context_);
+            shadowOcclusionBuffers_[i]->SetSize(size, size, false);
+        }
+    }
+    else
+        shadowOcclusionBuffers_.Clear();
 
     for (unsigned i = 0; i < lightQueryResults_.Size(); ++i)
     {
@@ -983,15 +1183,381 @@ void View::ProcessLights()
         item->workFunction_ = ProcessLightWork;
         item->aux_ = this;
 
-        LightQueryResult& query = lightQueryResults_[i];
-        query.light_ = lights_[i];
-
-        item->start_ = &query;
+        item->start_ = &lightQueryResults_[i];
         queue->AddWorkItem(item);
     }
 
+    // Assign the clustered lights in worker threads, split by depth slices
+    if (clusteredLighting_)
+    {
+        PrepareClusters();
+
+        unsigned numWorkItems = Min(queue->GetNumThreads() + 1, CLUSTER_SLICES);
+        unsigned* counts = &clusterLightCounts_[0];
+        unsigned beginSlice = 0;
+        for (unsigned i = 0; i < numWorkItems; ++i)
+        {
+            unsigned endSlice = CLUSTER_SLICES * (i + 1) / numWorkItems;
+
+            SharedPtr<WorkItem> item = queue->GetFreeItem();
+            item->priority_ = M_MAX_UNSIGNED;
+            item->workFunction_ = AssignClusterLightsWork;
+            item->aux_ = this;
+            item->start_ = counts + beginSlice * CLUSTERS_PER_SLICE;
+            item->end_ = counts + endSlice * CLUSTERS_PER_SLICE;
+            queue->AddWorkItem(item);
+
+            beginSlice = endSlice;
+        }
+    }
+
     // Ensure all lights have been processed before proceeding
     queue->Complete(M_MAX_UNSIGNED);
+
+    // If the light clusters could not be uploaded, render the clustered lights per-pixel instead
+    if (clusteredLighting_ && !UploadClusters())
+    {
+        clusteredLighting_ = false;
+        numQueries = lightQueryResults_.Size();
+        lightQueryResults_.Resize(numQueries + clusteredLights_.Size());
+        for (unsigned i = 0; i < clusteredLights_.Size(); ++i)
+        {
+            LightQueryResult& query = lightQueryResults_[numQueries + i];
+            query.light_ = clusteredLights_[i];
+            ProcessLight(query, 0);
+        }
+        clusteredLights_.Clear();
+    }
+
+    // Query shadow casters for directional lights now, so that the octree queries can be split to worker threads
+    for (unsigned i = 0; i < lightQueryResults_.Size(); ++i)
+    {
+        LightQueryResult& query = lightQueryResults_[i];
+        if (query.light_->GetLightType() == LIGHT_DIRECTIONAL && query.numSplits_)
+            GetShadowCasters(query, 0, true);
+    }
+}
+
+void View::CheckClusteredGeometries()
+{
+    clusteredGeometries_.Resize(geometries_.Size());
+    nonClusteredBoxes_.Clear();
+    nonClusteredBounds_.Clear();
+
+    for (unsigned i = 0; i < geometries_.Size(); ++i)
+    {
+        Drawable* drawable = geometries_[i];
+        clusteredGeometries_[i] = IsClusteredGeometry(drawable);
+        if (!clusteredGeometries_[i])
+        {
+            const BoundingBox& box = drawable->GetWorldBoundingBox();
+            nonClusteredBoxes_.Push(box);
+            nonClusteredBounds_.Merge(box);
+        }
+    }
+}
+
+bool View::IsClusteredGeometry(Drawable* drawable)
+{
+    const Vector<SourceBatch>& batches = drawable->GetBatches();
+    bool lit = false;
+
+    for (unsigned i = 0; i < batches.Size(); ++i)
+    {
+        const SourceBatch& srcBatch = batches[i];
+
+        Technique* tech = GetTechnique(drawable, srcBatch.material_);
+        if (!srcBatch.geometry_ || !srcBatch.numWorldTransforms_ || !tech)
+            continue;
+        if (gBufferPassIndex_ != M_MAX_UNSIGNED && tech->HasPass(gBufferPassIndex_))
+            continue;
+
+        // Per-pixel lights would be rendered in the light or litalpha pass. The clustered lights must instead be added by
+        // the shader of the corresponding base or alpha pass
+        unsigned passIndex;
+        if (tech->GetSupportedPass(lightPassIndex_))
+            passIndex = basePassIndex_;
+        else if (tech->GetSupportedPass(litAlphaPassIndex_))
+            passIndex = alphaPassIndex_;
+        else
+            continue;
+
+        lit = true;
+        bool clusteredScenePass = false;
+        for (unsigned j = 0; j < scenePasses_.Size(); ++j)
+        {
+            if (scenePasses_[j].passIndex_ == passIndex && scenePasses_[j].clustered_)
+                clusteredScenePass = true;
+        }
+
+        Pass* pass = tech->GetSupportedPass(passIndex);
+        if (!clusteredScenePass || !pass || !pass->GetClusteredSupport())
+            return false;
+    }
+
+    // The light clusters do not support light masks
+    return !lit || GetLightMask(drawable) == DEFAULT_LIGHTMASK;
+}
+
+bool View::IsClusteredLight(Light* light) const
+{
+    // Directional and per-vertex lights, and lights with custom textures are rendered as before
+    if (light->GetLightType() == LIGHT_DIRECTIONAL || light->GetPerVertex() || light->GetRampTexture() ||
+        light->GetShapeTexture())
+        return false;
+
+    // The light clusters do not support light masks
+    if (light->GetLightMask() != DEFAULT_LIGHTMASK)
+        return false;
+
+    // Shadowed lights need their shadow maps, so they must be rendered per-pixel
+    bool isShadowed = drawShadows_ && light->GetCastShadows() && light->GetShadowIntensity() < 1.0f;
+    if (isShadowed && light->GetShadowDistance() > 0.0f && light->GetDistance() > light->GetShadowDistance())
+        isShadowed = false;
+    if (isShadowed)
+        return false;
+
+    // Lights touching geometries that can not take their lights from the clusters must be rendered per-pixel
+    if (nonClusteredBoxes_.Empty())
+        return true;
+
+    if (light->GetLightType() == LIGHT_SPOT)
+    {
+        Frustum frustum = light->GetFrustum();
+        if (frustum.IsInsideFast(nonClusteredBounds_) == OUTSIDE)
+            return true;
+        for (unsigned i = 0; i < nonClusteredBoxes_.Size(); ++i)
+        {
+            if (frustum.IsInsideFast(nonClusteredBoxes_[i]) != OUTSIDE)
+                return false;
+        }
+    }
+    else
+    {
+        Sphere sphere(light->GetNode()->GetWorldPosition(), light->GetRange());
+        if (sphere.IsInsideFast(nonClusteredBounds_) == OUTSIDE)
+            return true;
+        for (unsigned i = 0; i < nonClusteredBoxes_.Size(); ++i)
+        {
+            if (sphere.IsInsideFast(nonClusteredBoxes_[i]) != OUTSIDE)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+void View::PrepareClusters()
+{
+    URHO3D_PROFILE(PrepareClusters);
+
+    // Store the camera parameters, as the camera may change (e.g. flip for rendering to a texture) before rendering
+    float nearClip = cullCamera_->GetNearClip();
+    float farClip = cullCamera_->GetFarClip();
+    Matrix4 projection = cullCamera_->GetProjection();
+    clusterView_ = cullCamera_->GetView();
+    clusterProj_ = Vector4(projection.m00_, projection.m11_, projection.m02_, projection.m12_);
+    clusterDepth_ = Vector2(1.0f / nearClip, (float)CLUSTER_SLICES / logf(farClip / nearClip));
+
+    clusterLightBoxes_.Clear();
+    clusterLightData_.Clear();
+    clusterLightCounts_.Resize(NUM_CLUSTERS);
+    clusterLightIndices_.Resize(NUM_CLUSTERS * MAX_CLUSTER_LIGHTS);
+
+    float specularLighting = renderer_->GetSpecularLighting() ? 1.0f : 0.0f;
+
+    for (PODVector<Light*>::ConstIterator i = clusteredLights_.Begin(); i != clusteredLights_.End(); ++i)
+    {
+        Light* light = *i;
+        Node* lightNode = light->GetNode();
+        float range = light->GetRange();
+
+        BoundingBox viewBox;
+        if (light->GetLightType() == LIGHT_POINT)
+        {
+            Vector3 center = clusterView_ * lightNode->GetWorldPosition();
+            viewBox.Define(center - Vector3(range, range, range), center + Vector3(range, range, range));
+        }
+        else
+            viewBox.Define(light->GetFrustum().Transformed(clusterView_));
+
+        if (viewBox.max_.z_ < nearClip || viewBox.min_.z_ > farClip)
+            continue;
+
+        clusterLightBoxes_.Push(viewBox);
+
+        // Fade the light color the same way as for per-pixel lights
+        float fade = 1.0f;
+        float fadeEnd = light->GetDrawDistance();
+        float fadeStart = light->GetFadeDistance();
+        if (fadeEnd > 0.0f && fadeStart > 0.0f && fadeStart < fadeEnd)
+            fade = Min(1.0f - (light->GetDistance() - fadeStart) / (fadeEnd - fadeStart), 1.0f);
+
+        Color color = light->GetEffectiveColor() * fade;
+        clusterLightData_.Push(Vector4(lightNode->GetWorldPosition(), 1.0f / Max(range, M_EPSILON)));
+        clusterLightData_.Push(Vector4(color.r_, color.g_, color.b_, light->GetEffectiveSpecularIntensity() * specularLighting));
+
+        // Spot cone as direction and cutoff premultiplied by the inverse cutoff range, like for vertex lights. Point lights
+        // get a constant full spot attenuation
+        if (light->GetLightType() == LIGHT_SPOT)
+        {
+            float cutoff = Cos(light->GetFov() * 0.5f);
+            float invCutoff = 1.0f / (1.0f - cutoff);
+            clusterLightData_.Push(Vector4(-lightNode->GetWorldDirection() * invCutoff, cutoff * invCutoff));
+        }
+        else
+            clusterLightData_.Push(Vector4(0.0f, 0.0f, 0.0f, -1.0f));
+    }
+}
+
+void View::AssignClusterLights(unsigned beginSlice, unsigned endSlice)
+{
+    for (unsigned i = beginSlice * CLUSTERS_PER_SLICE; i < endSlice * CLUSTERS_PER_SLICE; ++i)
+        clusterLightCounts_[i] = 0;
+
+    float nearClip = 1.0f / clusterDepth_.x_;
+    float sliceScale = clusterDepth_.y_;
+
+    for (unsigned i = 0; i < clusterLightBoxes_.Size(); ++i)
+    {
+        const BoundingBox& box = clusterLightBoxes_[i];
+
+        // Find the depth slices the light touches
+        int firstSlice = box.min_.z_ > nearClip ? (int)(logf(box.min_.z_ / nearClip) * sliceScale) : 0;
+        int lastSlice = box.max_.z_ > nearClip ? (int)(logf(box.max_.z_ / nearClip) * sliceScale) : 0;
+        firstSlice = Max(firstSlice, (int)beginSlice);
+        lastSlice = Min(lastSlice, (int)endSlice - 1);
+
+        for (int slice = firstSlice; slice <= lastSlice; ++slice)
+        {
+            // Project the part of the light bounds inside the slice to find the tiles
+            float sliceNear = Max(nearClip * expf((float)slice / sliceScale), box.min_.z_);
+            float sliceFar = Min(nearClip * expf((float)(slice + 1) / sliceScale), box.max_.z_);
+            float minX = box.min_.x_ / (box.min_.x_ >= 0.0f ? sliceFar : sliceNear);
+            float maxX = box.max_.x_ / (box.max_.x_ >= 0.0f ? sliceNear : sliceFar);
+            float minY = box.min_.y_ / (box.min_.y_ >= 0.0f ? sliceFar : sliceNear);
+            float maxY = box.max_.y_ / (box.max_.y_ >= 0.0f ? sliceNear : sliceFar);
+
+            float x1 = minX * clusterProj_.x_ + clusterProj_.z_;
+            float x2 = maxX * clusterProj_.x_ + clusterProj_.z_;
+            float y1 = minY * clusterProj_.y_ + clusterProj_.w_;
+            float y2 = maxY * clusterProj_.y_ + clusterProj_.w_;
+            float minNdcX = Min(x1, x2);
+            float maxNdcX = Max(x1, x2);
+            float minNdcY = Min(y1, y2);
+            float maxNdcY = Max(y1, y2);
+            if (maxNdcX < -1.0f || minNdcX > 1.0f || maxNdcY < -1.0f || minNdcY > 1.0f)
+                continue;
+
+            int minTileX = Clamp((int)((minNdcX * 0.5f + 0.5f) * CLUSTER_TILES_X), 0, (int)CLUSTER_TILES_X - 1);
+            int maxTileX = Clamp((int)((maxNdcX * 0.5f + 0.5f) * CLUSTER_TILES_X), 0, (int)CLUSTER_TILES_X - 1);
+            int minTileY = Clamp((int)((minNdcY * 0.5f + 0.5f) * CLUSTER_TILES_Y), 0, (int)CLUSTER_TILES_Y - 1);
+            int maxTileY = Clamp((int)((maxNdcY * 0.5f + 0.5f) * CLUSTER_TILES_Y), 0, (int)CLUSTER_TILES_Y - 1);
+
+            for (int y = minTileY; y <= maxTileY; ++y)
+            {
+                unsigned cluster = (slice * CLUSTER_TILES_Y + y) * CLUSTER_TILES_X + minTileX;
+                for (int x = minTileX; x <= maxTileX; ++x, ++cluster)
+                {
+                    // The lights are sorted by importance, so when a cluster is full, the least important lights are dropped
+                    unsigned& count = clusterLightCounts_[cluster];
+                    if (count < MAX_CLUSTER_LIGHTS)
+                        clusterLightIndices_[cluster * MAX_CLUSTER_LIGHTS + count++] = (unsigned short)i;
+                }
+            }
+        }
+    }
+}
+
+bool View::UploadClusters()
+{
+    URHO3D_PROFILE(UploadClusters);
+
+    // Texture layout: a header texel (index list start, light count) for each cluster, followed by three texels for each
+    // light, followed by the light index lists, one texel per index pointing to the light's first texel
+    unsigned numLightTexels = clusterLightData_.Size();
+    unsigned numIndices = 0;
+    for (unsigned i = 0; i < NUM_CLUSTERS; ++i)
+        numIndices += clusterLightCounts_[i];
+
+    unsigned numTexels = NUM_CLUSTERS + numLightTexels + numIndices;
+    int numRows = (numTexels + CLUSTER_TEXTURE_WIDTH - 1) / CLUSTER_TEXTURE_WIDTH;
+
+    bool recreated = false;
+    if (!clusterTexture_ || clusterTexture_->GetHeight() < numRows)
+    {
+        if (!clusterTexture_)
+        {
+            clusterTexture_ = new Texture2D(context_);
+            clusterTexture_->SetNumLevels(1);
+            clusterTexture_->SetFilterMode(FILTER_NEAREST);
+            clusterTexture_->SetAddressMode(COORD_U, ADDRESS_CLAMP);
+            clusterTexture_->SetAddressMode(COORD_V, ADDRESS_CLAMP);
+        }
+
+        if (!clusterTexture_->SetSize(CLUSTER_TEXTURE_WIDTH, NextPowerOfTwo((unsigned)numRows), Graphics::GetRGBAFloat32Format(),
+            TEXTURE_DYNAMIC))
+        {
+            URHO3D_LOGERROR("Failed to create light cluster texture");
+            clusterTexture_.Reset();
+            return false;
+        }
+        recreated = true;
+    }
+
+    clusterTextureData_.Resize(numRows * CLUSTER_TEXTURE_WIDTH * 4);
+    float* dest = &clusterTextureData_[0];
+    unsigned lightStart = NUM_CLUSTERS;
+    unsigned indexStart = lightStart + numLightTexels;
+
+    for (unsigned i = 0; i < NUM_CLUSTERS; ++i)
+    {
+        unsigned count = clusterLightCounts_[i];
+        *dest++ = (float)indexStart;
+        *dest++ = (float)count;
+        *dest++ = 0.0f;
+        *dest++ = 0.0f;
+
+        const unsigned short* indices = &clusterLightIndices_[i * MAX_CLUSTER_LIGHTS];
+        float* indexDest = &clusterTextureData_[indexStart * 4];
+        for (unsigned j = 0; j < count; ++j)
+        {
+            *indexDest++ = (float)(lightStart + indices[j] * 3);
+            *indexDest++ = 0.0f;
+            *indexDest++ = 0.0f;
+            *indexDest++ = 0.0f;
+        }
+        indexStart += count;
+    }
+
+    if (numLightTexels)
+        memcpy(dest, &clusterLightData_[0], numLightTexels * sizeof(Vector4));
+
+    // Clear the unused end of the last row
+    unsigned usedFloats = numTexels * 4;
+    for (unsigned i = usedFloats; i < clusterTextureData_.Size(); ++i)
+        clusterTextureData_[i] = 0.0f;
+
+    // Upload only if changed, as in a static view the clusters stay the same
+    if (!recreated && clusterTextureData_.Size() == uploadedClusterTextureData_.Size() &&
+        !memcmp(&clusterTextureData_[0], &uploadedClusterTextureData_[0], clusterTextureData_.Size() * sizeof(float)))
+        return true;
+
+    if (!clusterTexture_->SetData(0, 0, 0, CLUSTER_TEXTURE_WIDTH, numRows, &clusterTextureData_[0]))
+    {
+        URHO3D_LOGERROR("Failed to upload light cluster texture");
+        uploadedClusterTextureData_.Clear();
+        return false;
+    }
+
+    Swap(clusterTextureData_, uploadedClusterTextureData_);
+    return true;
+}
+
+Texture2D* View::GetClusterTexture() const
+{
+    const View* actualView = sourceView_ ? sourceView_.Get() : this;
+    return actualView->clusteredLighting_ ? actualView->clusterTexture_.Get() : (Texture2D*)0;
 }
 
 void View::GetLightBatches()
@@ -1036,17 +1602,59 @@ void View::GetLightBatches()
                 lightQueue.light_ = light;
                 lightQueue.negative_ = light->IsNegative();
                 lightQueue.shadowMap_ = 0;
+                lightQueue.shadowMapCached_ = false;
+                lightQueue.cacheShadowMap_ = false;
                 lightQueue.litBaseBatches_.Clear(maxSortedInstances);
                 lightQueue.litBatches_.Clear(maxSortedInstances);
                 lightQueue.volumeBatches_.Clear();
 
-                // Allocate shadow map now
-                if (shadowSplits > 0)
+                // Remember the state of a moving light, so that its shadow map can be cached once it stops
+                if (query.shadowMapCache_ == SHADOWCACHE_DYNAMIC)
+                {
+                    CachedShadowMap& cached = renderer_->GetCachedShadowMap(light);
+                    cached.state_ = query.shadowState_;
+                    cached.rendered_ = false;
+                }
+
+                // Allocate shadow map now. Use the cached shadow map if possible
+                if (shadowSplits > 0 && query.shadowMapCache_ >= SHADOWCACHE_RENDER)
+                {
+                    CachedShadowMap& cached = renderer_->GetCachedShadowMap(light);
+                    if (renderer_->ReserveCachedShadowMap(cached))
+                    {
+                        lightQueue.shadowMap_ = cached.texture_;
+                        lightQueue.shadowMapRegion_ = cached.region_;
+
+                        if (query.shadowMapCache_ == SHADOWCACHE_RENDER)
+                        {
+                            cached.shadowCasterBox_ = query.shadowCasterBox_[0];
+                            cached.frameNumber_ = octree_->GetFrameNumber();
+                            // The cached shadow map becomes valid only once it has actually been rendered
+                            cached.rendered_ = false;
+                            lightQueue.cacheShadowMap_ = true;
+                        }
+                        else if (cached.rendered_)
+                        {
+                            lightQueue.shadowMapCached_ = true;
+                            query.shadowCasterBox_[0] = cached.shadowCasterBox_;
+                            ++reusedShadowMaps_;
+                        }
+                        else
+                            lightQueue.shadowMap_ = 0;
+                    }
+
+                    // Without shadow casters, a shadow map that was to be reused can not be rendered now
+                    if (!lightQueue.shadowMap_ && query.shadowMapCache_ == SHADOWCACHE_REUSE)
+                        shadowSplits = 0;
+                }
+                if (shadowSplits > 0 && !lightQueue.shadowMap_)
                 {
                     lightQueue.shadowMap_ = renderer_->GetShadowMap(light, cullCamera_, (unsigned)viewSize_.x_, (unsigned)viewSize_.y_);
                     // If did not manage to get a shadow map, convert the light to unshadowed
                     if (!lightQueue.shadowMap_)
                         shadowSplits = 0;
+                    else
+                        lightQueue.shadowMapRegion_ = IntRect(0, 0, lightQueue.shadowMap_->GetWidth(), lightQueue.shadowMap_->GetHeight());
                 }
 
                 // Setup shadow batch queues
@@ -1061,7 +1669,7 @@ void View::GetLightBatches()
                     shadowQueue.shadowBatches_.Clear(maxSortedInstances);
 
                     // Setup the shadow split viewport and finalize shadow camera parameters
-                    shadowQueue.shadowViewport_ = GetShadowMapViewport(light, j, lightQueue.shadowMap_);
+                    shadowQueue.shadowViewport_ = GetShadowMapViewport(light, j, lightQueue.shadowMapRegion_);
                     FinalizeShadowCamera(shadowCamera, light, shadowQueue.shadowViewport_, query.shadowCasterBox_[j]);
 
                     // Loop through shadow casters
@@ -1085,9 +1693,12 @@ void View::GetLightBatches()
                         for (unsigned l = 0; l < batches.Size(); ++l)
                         {
                             const SourceBatch& srcBatch = batches[l];
+                            // The drawable may cull its view batches, but the shadow map can also need the parts outside the view
+                            unsigned numWorldTransforms;
+                            const Matrix3x4* worldTransform = drawable->GetShadowWorldTransforms(l, numWorldTransforms);
 
                             Technique* tech = GetTechnique(drawable, srcBatch.material_);
-                            if (!srcBatch.geometry_ || !srcBatch.numWorldTransforms_ || !tech)
+                            if (!srcBatch.geometry_ || !numWorldTransforms || !tech)
                                 continue;
 
                             Pass* pass = tech->GetSupportedPass(Technique::shadowPassIndex);
@@ -1096,6 +1707,8 @@ void View::GetLightBatches()
                                 continue;
 
                             Batch destBatch(srcBatch);
+                            destBatch.worldTransform_ = worldTransform;
+                            destBatch.numWorldTransforms_ = numWorldTransforms;
                             destBatch.pass_ = pass;
                             destBatch.zone_ = 0;
 
@@ -1177,88 +1790,334 @@ void View::GetBaseBatches()
 {
     URHO3D_PROFILE(GetBaseBatches);
 
+    bool batchCaching = renderer_->GetBatchCaching();
+
     for (PODVector<Drawable*>::ConstIterator i = geometries_.Begin(); i != geometries_.End(); ++i)
     {
         Drawable* drawable = *i;
+        bool clusteredGeometry = clusteredLighting_ && clusteredGeometries_[i - geometries_.Begin()];
         UpdateGeometryType type = drawable->GetUpdateGeometryType();
         if (type == UPDATE_MAIN_THREAD)
             nonThreadedGeometries_.Push(drawable);
         else if (type == UPDATE_WORKER_THREAD)
             threadedGeometries_.Push(drawable);
 
-        const Vector<SourceBatch>& batches = drawable->GetBatches();
-        bool vertexLightsProcessed = false;
+        // Drawables that need no geometry update can reuse their batches from the previous frames
+        if (batchCaching && type == UPDATE_NONE)
+        {
+            BaseBatchCacheEntry* entry = GetBaseBatchCacheEntry(drawable);
+            if (!entry || !AddCachedBaseBatches(drawable, *entry, clusteredGeometry))
+                AddBaseBatches(drawable, entry, clusteredGeometry);
+        }
+        else
+            AddBaseBatches(drawable, 0, clusteredGeometry);
+    }
+
+    if (batchCaching)
+    {
+        // Remove the groups that were kept from the previous frame, but did not get instances
+        for (unsigned i = 0; i < scenePasses_.Size(); ++i)
+            scenePasses_[i].batchQueue_->RemoveEmptyGroups();
 
-        for (unsigned j = 0; j < batches.Size(); ++j)
+        // Free the cache entries of drawables that are not visible, if there are many of them
+        if (baseBatchCache_.Size() - freeBaseBatchCacheEntries_.Size() > geometries_.Size() * 2 + 1024)
         {
-            const SourceBatch& srcBatch = batches[j];
+            for (unsigned i = 0; i < baseBatchCache_.Size(); ++i)
+            {
+                BaseBatchCacheEntry& entry = baseBatchCache_[i];
+                if (entry.drawable_ && entry.frameNumber_ != frame_.frameNumber_)
+                {
+                    entry.drawable_ = 0;
+                    entry.valid_ = false;
+                    freeBaseBatchCacheEntries_.Push(i);
+                }
+            }
+        }
+    }
+}
+
+void View::AddBaseBatches(Drawable* drawable, BaseBatchCacheEntry* entry, bool clusteredGeometry)
+{
+    const Vector<SourceBatch>& batches = drawable->GetBatches();
+    bool vertexLightsProcessed = false;
 
-            // Check here if the material refers to a rendertarget texture with camera(s) attached
-            // Only check this for backbuffer views (null rendertarget)
-            if (srcBatch.material_ && srcBatch.material_->GetAuxViewFrameNumber() != frame_.frameNumber_ && !renderTarget_)
-                CheckMaterialForAuxView(srcBatch.material_);
+    if (entry)
+    {
+        Zone* zone = GetZone(drawable);
+        entry->batches_.Clear();
+        entry->setupBatches_.Clear();
+        entry->numSourceBatches_ = batches.Size();
+        entry->zone_ = zone;
+        entry->zoneLightMask_ = zone->GetLightMask();
+        entry->lightMask_ = GetLightMask(drawable);
+        entry->basePassFlags_ = drawable->GetBasePassFlags();
+        entry->heightFog_ = zone->GetHeightFog();
+        entry->clustered_ = clusteredGeometry;
+        entry->valid_ = true;
+        entry->frameNumber_ = frame_.frameNumber_;
+    }
 
-            Technique* tech = GetTechnique(drawable, srcBatch.material_);
-            if (!srcBatch.geometry_ || !srcBatch.numWorldTransforms_ || !tech)
+    for (unsigned j = 0; j < batches.Size(); ++j)
+    {
+        const SourceBatch& srcBatch = batches[j];
+
+        // Check here if the material refers to a rendertarget texture with camera(s) attached
+        // Only check this for backbuffer views (null rendertarget)
+        if (srcBatch.material_ && srcBatch.material_->GetAuxViewFrameNumber() != frame_.frameNumber_ && !renderTarget_)
+            CheckMaterialForAuxView(srcBatch.material_);
+
+        Technique* tech = GetTechnique(drawable, srcBatch.material_);
+
+        if (entry)
+        {
+            // Record the source batch state first with a null queue, and fill in the first batch it produces
+            CachedBaseBatch cachedBatch;
+            cachedBatch.geometry_ = srcBatch.geometry_;
+            cachedBatch.material_ = srcBatch.material_;
+            cachedBatch.tech_ = tech;
+            cachedBatch.pass_ = 0;
+            cachedBatch.queue_ = 0;
+            cachedBatch.group_ = 0;
+            cachedBatch.groupVersion_ = 0;
+            cachedBatch.sourceIndex_ = j;
+            cachedBatch.passIndex_ = 0;
+            cachedBatch.shadersVersion_ = 0;
+            cachedBatch.geometryType_ = srcBatch.geometryType_;
+            cachedBatch.renderOrder_ = srcBatch.material_ ? srcBatch.material_->GetRenderOrder() : DEFAULT_RENDER_ORDER;
+            cachedBatch.hasTransforms_ = srcBatch.numWorldTransforms_ != 0;
+            cachedBatch.instanced_ = false;
+            cachedBatch.allowInstancing_ = false;
+            entry->batches_.Push(cachedBatch);
+            entry->setupBatches_.Push(Batch(srcBatch));
+        }
+
+        if (!srcBatch.geometry_ || !srcBatch.numWorldTransforms_ || !tech)
+            continue;
+
+        // Check each of the scene passes
+        for (unsigned k = 0; k < scenePasses_.Size(); ++k)
+        {
+            ScenePassInfo& info = scenePasses_[k];
+            // Skip forward base pass if the corresponding litbase pass already exists
+            if (info.passIndex_ == basePassIndex_ && j < 32 && drawable->HasBasePass(j))
                 continue;
 
-            // Check each of the scene passes
-            for (unsigned k = 0; k < scenePasses_.Size(); ++k)
-            {
-                ScenePassInfo& info = scenePasses_[k];
-                // Skip forward base pass if the corresponding litbase pass already exists
-                if (info.passIndex_ == basePassIndex_ && j < 32 && drawable->HasBasePass(j))
-                    continue;
+            Pass* pass = tech->GetSupportedPass(info.passIndex_);
+            if (!pass)
+                continue;
 
-                Pass* pass = tech->GetSupportedPass(info.passIndex_);
-                if (!pass)
-                    continue;
+            Batch destBatch(srcBatch);
+            destBatch.pass_ = pass;
+            destBatch.zone_ = GetZone(drawable);
+            destBatch.isBase_ = true;
+            destBatch.clustered_ = info.clustered_ && clusteredGeometry && pass->GetClusteredSupport();
+            destBatch.lightMask_ = (unsigned char)GetLightMask(drawable);
 
-                Batch destBatch(srcBatch);
-                destBatch.pass_ = pass;
-                destBatch.zone_ = GetZone(drawable);
-                destBatch.isBase_ = true;
-                destBatch.lightMask_ = (unsigned char)GetLightMask(drawable);
+            if (info.vertexLights_)
+            {
+                const PODVector<Light*>& drawableVertexLights = drawable->GetVertexLights();
+                if (drawableVertexLights.Size() && !vertexLightsProcessed)
+                {
+                    // Limit vertex lights. If this is a deferred opaque batch, remove converted per-pixel lights,
+                    // as they will be rendered as light volumes in any case, and drawing them also as vertex lights
+                    // would result in double lighting
+                    drawable->LimitVertexLights(deferred_ && destBatch.pass_->GetBlendMode() == BLEND_REPLACE);
+                    vertexLightsProcessed = true;
+                }
 
-                if (info.vertexLights_)
+                if (drawableVertexLights.Size())
                 {
-                    const PODVector<Light*>& drawableVertexLights = drawable->GetVertexLights();
-                    if (drawableVertexLights.Size() && !vertexLightsProcessed)
+                    // Find a vertex light queue. If not found, create new
+                    unsigned long long hash = GetVertexLightQueueHash(drawableVertexLights);
+                    HashMap<unsigned long long, LightBatchQueue>::Iterator i = vertexLightQueues_.Find(hash);
+                    if (i == vertexLightQueues_.End())
                     {
-                        // Limit vertex lights. If this is a deferred opaque batch, remove converted per-pixel lights,
-                        // as they will be rendered as light volumes in any case, and drawing them also as vertex lights
-                        // would result in double lighting
-                        drawable->LimitVertexLights(deferred_ && destBatch.pass_->GetBlendMode() == BLEND_REPLACE);
-                        vertexLightsProcessed = true;
+                        i = vertexLightQueues_.Insert(MakePair(hash, LightBatchQueue()));
+                        i->second_.light_ = 0;
+                        i->second_.shadowMap_ = 0;
+                        i->second_.shadowMapCached_ = false;
+                        i->second_.cacheShadowMap_ = false;
+                        i->second_.vertexLights_ = drawableVertexLights;
                     }
 
-                    if (drawableVertexLights.Size())
-                    {
-                        // Find a vertex light queue. If not found, create new
-                        unsigned long long hash = GetVertexLightQueueHash(drawableVertexLights);
-                        HashMap<unsigned long long, LightBatchQueue>::Iterator i = vertexLightQueues_.Find(hash);
-                        if (i == vertexLightQueues_.End())
-                        {
-                            i = vertexLightQueues_.Insert(MakePair(hash, LightBatchQueue()));
-                            i->second_.light_ = 0;
-                            i->second_.shadowMap_ = 0;
-                            i->second_.vertexLights_ = drawableVertexLights;
-                        }
+                    destBatch.lightQueue_ = &(i->second_);
+                }
+            }
+            else
+                destBatch.lightQueue_ = 0;
 
-                        destBatch.lightQueue_ = &(i->second_);
+            bool allowInstancing = info.allowInstancing_;
+            if (allowInstancing && info.markToStencil_ && destBatch.lightMask_ != (destBatch.zone_->GetLightMask() & 0xff))
+                allowInstancing = false;
+
+            BatchGroup* group = AddBatchToQueue(*info.batchQueue_, destBatch, tech, allowInstancing);
+
+            if (entry)
+            {
+                // Batches with vertex lights can not be cached, as the lights change
+                if (destBatch.lightQueue_)
+                    entry->valid_ = false;
+                else
+                {
+                    if (entry->batches_.Back().queue_)
+                    {
+                        CachedBaseBatch sourceState = entry->batches_.Back();
+                        entry->batches_.Push(sourceState);
+                        entry->setupBatches_.Push(destBatch);
                     }
+                    else
+                        entry->setupBatches_.Back() = destBatch;
+
+                    CachedBaseBatch& cachedBatch = entry->batches_.Back();
+                    cachedBatch.pass_ = pass;
+                    cachedBatch.queue_ = info.batchQueue_;
+                    cachedBatch.group_ = group;
+                    cachedBatch.groupVersion_ = info.batchQueue_->groupVersion_;
+                    cachedBatch.passIndex_ = info.passIndex_;
+                    cachedBatch.shadersVersion_ = pass->GetShadersVersion();
+                    cachedBatch.instanced_ = destBatch.geometryType_ == GEOM_INSTANCED;
+                    cachedBatch.allowInstancing_ = allowInstancing;
                 }
-                else
-                    destBatch.lightQueue_ = 0;
+            }
+        }
+    }
+}
 
-                bool allowInstancing = info.allowInstancing_;
-                if (allowInstancing && info.markToStencil_ && destBatch.lightMask_ != (destBatch.zone_->GetLightMask() & 0xff))
-                    allowInstancing = false;
+BaseBatchCacheEntry* View::GetBaseBatchCacheEntry(Drawable* drawable)
+{
+    View* cacheView = drawable->GetBatchCacheView();
+    unsigned index = drawable->GetBatchCacheIndex();
 
-                AddBatchToQueue(*info.batchQueue_, destBatch, tech, allowInstancing);
-            }
+    if (cacheView == this)
+    {
+        if (index < baseBatchCache_.Size() && baseBatchCache_[index].drawable_ == drawable)
+        {
+            drawable->SetBatchCacheSlot(this, index, frame_.frameNumber_);
+            return &baseBatchCache_[index];
+        }
+    }
+    // If another view has used its cached batches recently, let it keep them
+    else if (cacheView && drawable->GetBatchCacheFrameNumber() + 1 >= frame_.frameNumber_)
+        return 0;
+
+    if (freeBaseBatchCacheEntries_.Size())
+    {
+        index = freeBaseBatchCacheEntries_.Back();
+        freeBaseBatchCacheEntries_.Pop();
+    }
+    else
+    {
+        index = baseBatchCache_.Size();
+        baseBatchCache_.Resize(index + 1);
+    }
+
+    BaseBatchCacheEntry& entry = baseBatchCache_[index];
+    entry.drawable_ = drawable;
+    entry.valid_ = false;
+    drawable->SetBatchCacheSlot(this, index, frame_.frameNumber_);
+    return &entry;
+}
+
+bool View::AddCachedBaseBatches(Drawable* drawable, BaseBatchCacheEntry& entry, bool clusteredGeometry)
+{
+    if (!entry.valid_ || clusteredGeometry != entry.clustered_)
+        return false;
+
+    // Check that nothing the batches depend on has changed
+    Zone* zone = GetZone(drawable);
+    if (zone != entry.zone_ || zone->GetLightMask() != entry.zoneLightMask_ || zone->GetHeightFog() != entry.heightFog_ ||
+        GetLightMask(drawable) != entry.lightMask_ || drawable->GetBasePassFlags() != entry.basePassFlags_)
+        return false;
+
+    const Vector<SourceBatch>& batches = drawable->GetBatches();
+    if (batches.Size() != entry.numSourceBatches_)
+        return false;
+
+    if (drawable->GetVertexLights().Size())
+    {
+        for (unsigned i = 0; i < scenePasses_.Size(); ++i)
+        {
+            if (scenePasses_[i].vertexLights_)
+                return false;
+        }
+    }
+
+    // Every source batch has at least one cached batch, so the source batch states can be checked from them. The source
+    // batch state is kept with the cached batches to avoid touching more memory per drawable
+    unsigned lastSourceIndex = M_MAX_UNSIGNED;
+    for (PODVector<CachedBaseBatch>::ConstIterator i = entry.batches_.Begin(); i != entry.batches_.End(); ++i)
+    {
+        const SourceBatch& srcBatch = batches[i->sourceIndex_];
+        Material* material = srcBatch.material_;
+        if (srcBatch.geometry_ != i->geometry_ || material != i->material_ || srcBatch.geometryType_ != i->geometryType_ ||
+            (srcBatch.numWorldTransforms_ != 0) != i->hasTransforms_)
+            return false;
+
+        if (i->sourceIndex_ != lastSourceIndex)
+        {
+            if (material && material->GetRenderOrder() != i->renderOrder_)
+                return false;
+            if (GetTechnique(drawable, material) != i->tech_)
+                return false;
+            lastSourceIndex = i->sourceIndex_;
+        }
+
+        // The shaders of a pass are released when it is edited
+        if (i->queue_ && (i->tech_->GetSupportedPass(i->passIndex_) != i->pass_ || i->pass_->GetShadersVersion() != i->shadersVersion_))
+            return false;
+    }
+
+    if (!renderTarget_)
+    {
+        for (unsigned i = 0; i < batches.Size(); ++i)
+        {
+            Material* material = batches[i].material_;
+            if (material && material->GetAuxViewFrameNumber() != frame_.frameNumber_)
+                CheckMaterialForAuxView(material);
+        }
+    }
+
+    entry.frameNumber_ = frame_.frameNumber_;
+
+    for (unsigned i = 0; i < entry.batches_.Size(); ++i)
+    {
+        CachedBaseBatch& cachedBatch = entry.batches_[i];
+        if (!cachedBatch.queue_)
+            continue;
+
+        const SourceBatch& srcBatch = batches[cachedBatch.sourceIndex_];
+
+        // Reuse the batch group if no groups have been removed from the queue since it was looked up. When the group already
+        // has instances on this frame, only the transforms are needed
+        bool groupValid = cachedBatch.instanced_ && cachedBatch.group_ && cachedBatch.groupVersion_ == cachedBatch.queue_->groupVersion_;
+        if (groupValid && !cachedBatch.group_->instances_.Empty())
+        {
+            BatchGroup& group = *cachedBatch.group_;
+            unsigned oldSize = group.instances_.Size();
+            group.AddTransforms(srcBatch);
+            CheckInstancingLimit(group, oldSize, cachedBatch.tech_);
+            continue;
+        }
+
+        // Refresh the per-frame data from the source batch
+        Batch& batch = entry.setupBatches_[i];
+        batch.distance_ = srcBatch.distance_;
+        batch.worldTransform_ = srcBatch.worldTransform_;
+        batch.numWorldTransforms_ = srcBatch.numWorldTransforms_;
+        batch.instancingData_ = srcBatch.instancingData_;
+
+        if (groupValid)
+            AddBatchToGroup(*cachedBatch.group_, batch, cachedBatch.tech_);
+        else if (cachedBatch.instanced_)
+        {
+            cachedBatch.group_ = AddBatchToQueue(*cachedBatch.queue_, batch, cachedBatch.tech_, cachedBatch.allowInstancing_);
+            cachedBatch.groupVersion_ = cachedBatch.queue_->groupVersion_;
         }
+        else
+            PushBatch(*cachedBatch.queue_, batch);
     }
+
+    return true;
 }
 
 void View::UpdateGeometries()
@@ -1357,6 +2216,14 @@ void View::UpdateGeometries()
 
     // Finally ensure all threaded work has completed
     queue->Complete(M_MAX_UNSIGNED);
+
+    // The threaded updates may leave GPU work, such as uploading generated vertex data, to be finished in the main thread
+    for (PODVector<Drawable*>::ConstIterator i = threadedGeometries_.Begin(); i != threadedGeometries_.End(); ++i)
+    {
+        if (*i && (*i)->GetUpdateGeometryType() == UPDATE_MAIN_THREAD)
+            (*i)->UpdateGeometry(frame_);
+    }
+
     geometriesUpdated_ = true;
 }
 
@@ -1706,7 +2573,7 @@ void View::SetRenderTargets(RenderPathCommand& command)
             {
                 useColorWrite = false;
                 useCustomDepth = true;
-#if !defined(URHO3D_OPENGL) && !defined(URHO3D_D3D11)
+#if !defined(URHO3D_OPENGL) && !defined(URHO3D_D3D11) && !defined(URHO3D_NULL_GRAPHICS)
                 // On D3D9 actual depth-only rendering is illegal, we need a color rendertarget
                 if (!depthOnlyDummyTexture_)
                 {
@@ -2234,7 +3101,7 @@ void View::ProcessLight(LightQueryResult& query, unsigned threadIndex)
     Light* light = query.light_;
     LightType type = light->GetLightType();
     unsigned lightMask = light->GetLightMask();
-    const Frustum& frustum = cullCamera_->GetFrustum();
+    query.shadowMapCache_ = SHADOWCACHE_NONE;
 
     // Check if light should be shadowed
     bool isShadowed = drawShadows_ && light->GetCastShadows() && !light->GetPerVertex() && light->GetShadowIntensity() < 1.0f;
@@ -2297,6 +3164,88 @@ void View::ProcessLight(LightQueryResult& query, unsigned threadIndex)
     // Determine number of shadow cameras and setup their initial positions
     SetupShadowCameras(query);
 
+    // Directional light shadow casters are queried later from the main thread
+    if (type != LIGHT_DIRECTIONAL)
+    {
+        CheckShadowMapCache(query);
+
+        // A reused cached shadow map needs no shadow casters
+        if (query.shadowMapCache_ != SHADOWCACHE_REUSE)
+            GetShadowCasters(query, threadIndex, false);
+        else
+        {
+            query.shadowCasters_.Clear();
+            for (unsigned i = 0; i < query.numSplits_; ++i)
+                query.shadowCasterBegin_[i] = query.shadowCasterEnd_[i] = 0;
+        }
+    }
+}
+
+void View::CheckShadowMapCache(LightQueryResult& query)
+{
+    // Directional light shadow maps follow the view. VSM shadow maps are blurred as a whole, so they can not share the atlas
+    ShadowQuality quality = renderer_->GetShadowQuality();
+    if (!renderer_->GetShadowMapCaching() || query.light_->GetLightType() == LIGHT_DIRECTIONAL ||
+        quality == SHADOWQUALITY_VSM || quality == SHADOWQUALITY_BLUR_VSM)
+        return;
+
+    // Hash everything that the shadow map contents and layout depend on, apart from the shadow casters
+    Light* light = query.light_;
+    const BiasParameters& bias = light->GetShadowBias();
+    const FocusParameters& focus = light->GetShadowFocus();
+    float parameters[] = {
+        light->GetRange(),
+        light->GetFov(),
+        light->GetAspectRatio(),
+        light->GetShadowNearFarRatio(),
+        light->GetShadowResolution(),
+        bias.constantBias_,
+        bias.slopeScaledBias_,
+        focus.quantize_,
+        focus.minView_
+    };
+    unsigned flags[] = {
+        (unsigned)light->GetLightType(),
+        light->GetLightMask(),
+        cullCamera_->GetViewMask(),
+        (unsigned)focus.focus_
+    };
+    const Octree* octree = octree_;
+
+    unsigned state = HashData(light->GetNode()->GetWorldTransform().Data(), sizeof(Matrix3x4), 0);
+    state = HashData(parameters, sizeof parameters, state);
+    state = HashData(flags, sizeof flags, state);
+    state = HashData(&octree, sizeof octree, state);
+    query.shadowState_ = state;
+
+    // Wait for the light to stay still for a frame before caching
+    const CachedShadowMap* cached = renderer_->FindCachedShadowMap(light);
+    if (!cached || cached->state_ != state)
+    {
+        query.shadowMapCache_ = SHADOWCACHE_DYNAMIC;
+        return;
+    }
+
+    // Likewise wait while drawables within the light's range are moving. The cached shadow map can be reused if it was
+    // rendered on an earlier frame after the latest change. Views of the same frame may be rendered in any order, so a
+    // shadow map rendered on this frame is not yet known to be ready
+    unsigned frameNumber = octree_->GetFrameNumber();
+    unsigned changeFrameNumber = octree_->GetChangeFrameNumber(light->GetWorldBoundingBox());
+    if (changeFrameNumber >= frameNumber)
+        query.shadowMapCache_ = SHADOWCACHE_DYNAMIC;
+    else if (cached->rendered_ && changeFrameNumber < cached->frameNumber_ && cached->frameNumber_ < frameNumber)
+        query.shadowMapCache_ = SHADOWCACHE_REUSE;
+    else
+        query.shadowMapCache_ = SHADOWCACHE_RENDER;
+}
+
+void View::GetShadowCasters(LightQueryResult& query, unsigned threadIndex, bool threaded)
+{
+    Light* light = query.light_;
+    LightType type = light->GetLightType();
+    const Frustum& frustum = cullCamera_->GetFrustum();
+    PODVector<Drawable*>& tempDrawables = tempDrawables_[threadIndex];
+
     // Process each split for shadow casters
     query.shadowCasters_.Clear();
     for (unsigned i = 0; i < query.numSplits_; ++i)
@@ -2305,9 +3254,16 @@ void View::ProcessLight(LightQueryResult& query, unsigned threadIndex)
         const Frustum& shadowCameraFrustum = shadowCamera->GetFrustum();
         query.shadowCasterBegin_[i] = query.shadowCasterEnd_[i] = query.shadowCasters_.Size();
 
-        // For point light check that the face is visible: if not, can skip the split
-        if (type == LIGHT_POINT && frustum.IsInsideFast(BoundingBox(shadowCameraFrustum)) == OUTSIDE)
-            continue;
+        // For point light check that the face is visible: if not, can skip the split. If the light can be occluded, also
+        // test the face against the main view's occlusion buffer. A cached shadow map needs all faces for other views
+        if (type == LIGHT_POINT && query.shadowMapCache_ != SHADOWCACHE_RENDER)
+        {
+            BoundingBox faceBox(shadowCameraFrustum);
+            if (frustum.IsInsideFast(faceBox) == OUTSIDE)
+                continue;
+            if (occlusionBuffer_ && light->IsOccludee() && !occlusionBuffer_->IsVisible(faceBox))
+                continue;
+        }
 
         // For directional light check that the split is inside the visible scene: if not, can skip the split
         if (type == LIGHT_DIRECTIONAL)
@@ -2319,11 +3275,11 @@ void View::ProcessLight(LightQueryResult& query, unsigned threadIndex)
 
             // Reuse lit geometry query for all except directional lights
             ShadowCasterOctreeQuery query(tempDrawables, shadowCameraFrustum, DRAWABLE_GEOMETRY, cullCamera_->GetViewMask());
-            octree_->GetDrawables(query);
+            octree_->GetDrawables(query, threaded);
         }
 
         // Check which shadow casters actually contribute to the shadowing
-        ProcessShadowCasters(query, tempDrawables, i);
+        ProcessShadowCasters(query, tempDrawables, i, threadIndex);
     }
 
     // If no shadow casters, the light can be rendered unshadowed. At this point we have not allocated a shadow map yet, so the
@@ -2332,7 +3288,8 @@ void View::ProcessLight(LightQueryResult& query, unsigned threadIndex)
         query.numSplits_ = 0;
 }
 
-void View::ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawable*>& drawables, unsigned splitIndex)
+void View::ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawable*>& drawables, unsigned splitIndex,
+    unsigned threadIndex)
 {
     Light* light = query.light_;
     unsigned lightMask = light->GetLightMask();
@@ -2342,6 +3299,8 @@ void View::ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawabl
     const Matrix3x4& lightView = shadowCamera->GetView();
     const Matrix4& lightProj = shadowCamera->GetProjection();
     LightType type = light->GetLightType();
+    // A cached shadow map is reused from other camera positions, so it must not depend on the view
+    bool viewIndependent = query.shadowMapCache_ == SHADOWCACHE_RENDER;
 
     query.shadowCasterBox_[splitIndex].Clear();
 
@@ -2358,7 +3317,7 @@ void View::ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawabl
     BoundingBox lightViewFrustumBox(lightViewFrustum);
 
     // Check for degenerate split frustum: in that case there is no need to get shadow casters
-    if (lightViewFrustum.vertices_[0] == lightViewFrustum.vertices_[4])
+    if (!viewIndependent && lightViewFrustum.vertices_[0] == lightViewFrustum.vertices_[4])
         return;
 
     BoundingBox lightViewBox;
@@ -2387,13 +3346,14 @@ void View::ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawabl
         float drawDistance = drawable->GetDrawDistance();
         if (drawDistance > 0.0f && (maxShadowDistance <= 0.0f || drawDistance < maxShadowDistance))
             maxShadowDistance = drawDistance;
-        if (maxShadowDistance > 0.0f && drawable->GetDistance() > maxShadowDistance)
+        if (!viewIndependent && maxShadowDistance > 0.0f && drawable->GetDistance() > maxShadowDistance)
             continue;
 
         // Project shadow caster bounding box to light view space for visibility check
         lightViewBox = drawable->GetWorldBoundingBox().Transformed(lightView);
 
-        if (IsShadowCasterVisible(drawable, lightViewBox, shadowCamera, lightView, lightViewFrustum, lightViewFrustumBox))
+        if (viewIndependent ||
+            IsShadowCasterVisible(drawable, lightViewBox, shadowCamera, lightView, lightViewFrustum, lightViewFrustumBox))
         {
             // Merge to shadow caster bounding box (only needed for focused spot lights) and add to the list
             if (type == LIGHT_SPOT && light->GetShadowFocus().focus_)
@@ -2406,6 +3366,66 @@ void View::ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawabl
     }
 
     query.shadowCasterEnd_[splitIndex] = query.shadowCasters_.Size();
+
+    if (shadowOcclusionBuffers_.Size())
+        OcclusionCullShadowCasters(query, splitIndex, threadIndex);
+}
+
+void View::OcclusionCullShadowCasters(LightQueryResult& query, unsigned splitIndex, unsigned threadIndex)
+{
+    unsigned begin = query.shadowCasterBegin_[splitIndex];
+    unsigned end = query.shadowCasterEnd_[splitIndex];
+
+    PODVector<Drawable*>& occluders = shadowOccluders_[threadIndex];
+    occluders.Clear();
+    for (unsigned i = begin; i < end; ++i)
+    {
+        if (query.shadowCasters_[i]->IsOccluder())
+            occluders.Push(query.shadowCasters_[i]);
+    }
+
+    // Nothing to do if there are no occluders, or nothing else to occlude
+    if (occluders.Empty() || occluders.Size() == end - begin)
+        return;
+
+    URHO3D_PROFILE(OcclusionCullShadowCasters);
+
+    Sort(occluders.Begin(), occluders.End(), CompareShadowOccluders);
+
+    OcclusionBuffer* buffer = shadowOcclusionBuffers_[threadIndex];
+    buffer->SetView(query.shadowCameras_[splitIndex]);
+    buffer->SetMaxTriangles((unsigned)maxOccluderTriangles_);
+    buffer->Clear();
+
+    for (unsigned i = 0; i < occluders.Size(); ++i)
+    {
+        Drawable* occluder = occluders[i];
+        if (i > 0 && !buffer->IsVisible(occluder->GetWorldBoundingBox()))
+            continue;
+
+        bool success = occluder->DrawOcclusion(buffer);
+        buffer->DrawTriangles();
+        if (!success)
+            break;
+    }
+
+    buffer->BuildDepthHierarchy();
+
+    // Compact the split's shadow casters. The split is the last one processed so far, so the list can simply be shrunk
+    unsigned dest = begin;
+    for (unsigned i = begin; i < end; ++i)
+    {
+        Drawable* drawable = query.shadowCasters_[i];
+        if (!drawable->IsOccludee() || buffer->IsVisible(drawable->GetWorldBoundingBox()))
+            query.shadowCasters_[dest++] = drawable;
+    }
+
+    if (dest < end)
+    {
+        occludedShadowCasters_[threadIndex] += end - dest;
+        query.shadowCasters_.Resize(dest);
+        query.shadowCasterEnd_[splitIndex] = dest;
+    }
 }
 
 bool View::IsShadowCasterVisible(Drawable* drawable, BoundingBox lightViewBox, Camera* shadowCamera, const Matrix3x4& lightView,
@@ -2444,10 +3464,11 @@ bool View::IsShadowCasterVisible(Drawable* drawable, BoundingBox lightViewBox, C
     }
 }
 
-IntRect View::GetShadowMapViewport(Light* light, unsigned splitIndex, Texture2D* shadowMap)
+IntRect View::GetShadowMapViewport(Light* light, unsigned splitIndex, const IntRect& region)
 {
-    unsigned width = (unsigned)shadowMap->GetWidth();
-    unsigned height = (unsigned)shadowMap->GetHeight();
+    unsigned width = (unsigned)region.Width();
+    unsigned height = (unsigned)region.Height();
+    IntRect viewport;
 
     switch (light->GetLightType())
     {
@@ -2455,23 +3476,30 @@ IntRect View::GetShadowMapViewport(Light* light, unsigned splitIndex, Texture2D*
         {
             int numSplits = light->GetNumShadowSplits();
             if (numSplits == 1)
-                return IntRect(0, 0, width, height);
+                viewport = IntRect(0, 0, width, height);
             else if (numSplits == 2)
-                return IntRect(splitIndex * width / 2, 0, (splitIndex + 1) * width / 2, height);
+                viewport = IntRect(splitIndex * width / 2, 0, (splitIndex + 1) * width / 2, height);
             else
-                return IntRect((splitIndex & 1) * width / 2, (splitIndex / 2) * height / 2, ((splitIndex & 1) + 1) * width / 2,
+                viewport = IntRect((splitIndex & 1) * width / 2, (splitIndex / 2) * height / 2, ((splitIndex & 1) + 1) * width / 2,
                     (splitIndex / 2 + 1) * height / 2);
         }
+        break;
 
     case LIGHT_SPOT:
-        return IntRect(0, 0, width, height);
+        viewport = IntRect(0, 0, width, height);
+        break;
 
     case LIGHT_POINT:
-        return IntRect((splitIndex & 1) * width / 2, (splitIndex / 2) * height / 3, ((splitIndex & 1) + 1) * width / 2,
+        viewport = IntRect((splitIndex & 1) * width / 2, (splitIndex / 2) * height / 3, ((splitIndex & 1) + 1) * width / 2,
             (splitIndex / 2 + 1) * height / 3);
+        break;
     }
 
-    return IntRect();
+    viewport.left_ += region.left_;
+    viewport.right_ += region.left_;
+    viewport.top_ += region.top_;
+    viewport.bottom_ += region.top_;
+    return viewport;
 }
 
 void View::SetupShadowCameras(LightQueryResult& query)
@@ -2824,7 +3852,7 @@ void View::CheckMaterialForAuxView(Material* material)
     material->MarkForAuxView(frame_.frameNumber_);
 }
 
-void View::AddBatchToQueue(BatchQueue& batchQueue, Batch& batch, Technique* tech, bool allowInstancing, bool allowShadows)
+BatchGroup* View::AddBatchToQueue(BatchQueue& batchQueue, Batch& batch, Technique* tech, bool allowInstancing, bool allowShadows)
 {
     if (!batch.material_)
         batch.material_ = renderer_->GetDefaultMaterial();
@@ -2839,45 +3867,46 @@ void View::AddBatchToQueue(BatchQueue& batchQueue, Batch& batch, Technique* tech
 
         HashMap<BatchGroupKey, BatchGroup>::Iterator i = batchQueue.batchGroups_.Find(key);
         if (i == batchQueue.batchGroups_.End())
-        {
-            // Create a new group based on the batch
-            // In case the group remains below the instancing limit, do not enable instancing shaders yet
-            BatchGroup newGroup(batch);
-            newGroup.geometryType_ = GEOM_STATIC;
-            renderer_->SetBatchShaders(newGroup, tech, allowShadows);
-            newGroup.CalculateSortKey();
-            i = batchQueue.batchGroups_.Insert(MakePair(key, newGroup));
-        }
+            i = batchQueue.batchGroups_.Insert(MakePair(key, BatchGroup(batch)));
 
-        int oldSize = i->second_.instances_.Size();
-        i->second_.AddTransforms(batch);
-        // Convert to using instancing shaders when the instancing limit is reached
-        if (oldSize < minInstances_ && (int)i->second_.instances_.Size() >= minInstances_)
-        {
-            i->second_.geometryType_ = GEOM_INSTANCED;
-            renderer_->SetBatchShaders(i->second_, tech, allowShadows);
-            i->second_.CalculateSortKey();
-        }
+        AddBatchToGroup(i->second_, batch, tech, allowShadows);
+        return &i->second_;
     }
     else
     {
         renderer_->SetBatchShaders(batch, tech, allowShadows);
         batch.CalculateSortKey();
+        PushBatch(batchQueue, batch);
+        return 0;
+    }
+}
 
-        // If batch is static with multiple world transforms and cannot instance, we must push copies of the batch individually
-        if (batch.geometryType_ == GEOM_STATIC && batch.numWorldTransforms_ > 1)
-        {
-            unsigned numTransforms = batch.numWorldTransforms_;
-            batch.numWorldTransforms_ = 1;
-            for (unsigned i = 0; i < numTransforms; ++i)
-            {
-                // Move the transform pointer to generate copies of the batch which only refer to 1 world transform
-                batchQueue.batches_.Push(batch);
-                ++batch.worldTransform_;
-            }
-        }
-        else
-            batchQueue.batches_.Push(batch);
+void View::AddBatchToGroup(BatchGroup& group, const Batch& batch, Technique* tech, bool allowShadows)
+{
+    // A new group, or a group kept from the previous frame, is set up from its first batch on this frame, so that it gets
+    // the current distance and shaders. In case the group remains below the instancing limit, do not enable instancing
+    // shaders yet
+    if (group.instances_.Empty())
+    {
+        static_cast<Batch&>(group) = batch;
+        group.geometryType_ = GEOM_STATIC;
+        renderer_->SetBatchShaders(group, tech, allowShadows);
+        group.CalculateSortKey();
+    }
+
+    unsigned oldSize = group.instances_.Size();
+    group.AddTransforms(batch);
+    CheckInstancingLimit(group, oldSize, tech, allowShadows);
+}
+
+void View::CheckInstancingLimit(BatchGroup& group, unsigned oldSize, Technique* tech, bool allowShadows)
+{
+    // Convert to using instancing shaders when the instancing limit is reached
+    if ((int)oldSize < minInstances_ && (int)group.instances_.Size() >= minInstances_)
+    {
+        group.geometryType_ = GEOM_INSTANCED;
+        renderer_->SetBatchShaders(group, tech, allowShadows);
+        group.CalculateSortKey();
     }
 }
 
@@ -2893,41 +3922,60 @@ void View::PrepareInstancingBuffer()
 
     URHO3D_PROFILE(PrepareInstancingBuffer);
 
-    unsigned totalInstances = 0;
+    VertexBuffer* instancingBuffer = renderer_->GetInstancingBuffer();
+    const unsigned stride = instancingBuffer->GetVertexSize();
+
+    // With batch caching, instance data written on earlier frames is reused while unchanged and not yet discarded from the buffer
+    const bool keepData = renderer_->GetBatchCaching();
+    unsigned totalInstances = ReuseInstancingData(renderer_->GetInstancingBufferGeneration(), stride, keepData);
+    if (!totalInstances)
+        return;
+
+    // If the buffer will be discarded to make space, all data has to be written again
+    if (!renderer_->HasInstancingBufferSpace(totalInstances))
+        totalInstances = ReuseInstancingData(M_MAX_UNSIGNED, stride, keepData);
+
+    unsigned lockStart;
+    void* dest = renderer_->LockInstancingBuffer(totalInstances, lockStart);
+    if (!dest)
+    {
+        // Draw without instancing. Reused data may also have been lost, so do not use it either
+        ReuseInstancingData(M_MAX_UNSIGNED, stride, false);
+        return;
+    }
 
+    const unsigned generation = renderer_->GetInstancingBufferGeneration();
+    unsigned freeIndex = 0;
     for (HashMap<unsigned, BatchQueue>::Iterator i = batchQueues_.Begin(); i != batchQueues_.End(); ++i)
-        totalInstances += i->second_.GetNumInstances();
+        i->second_.SetInstancingData(dest, lockStart, stride, freeIndex, generation, keepData);
 
     for (Vector<LightBatchQueue>::Iterator i = lightQueues_.Begin(); i != lightQueues_.End(); ++i)
     {
         for (unsigned j = 0; j < i->shadowSplits_.Size(); ++j)
-            totalInstances += i->shadowSplits_[j].shadowBatches_.GetNumInstances();
-        totalInstances += i->litBaseBatches_.GetNumInstances();
-        totalInstances += i->litBatches_.GetNumInstances();
+            i->shadowSplits_[j].shadowBatches_.SetInstancingData(dest, lockStart, stride, freeIndex, generation, keepData);
+        i->litBaseBatches_.SetInstancingData(dest, lockStart, stride, freeIndex, generation, keepData);
+        i->litBatches_.SetInstancingData(dest, lockStart, stride, freeIndex, generation, keepData);
     }
 
-    if (!totalInstances || !renderer_->ResizeInstancingBuffer(totalInstances))
-        return;
+    instancingBuffer->Unlock();
+}
 
-    VertexBuffer* instancingBuffer = renderer_->GetInstancingBuffer();
-    unsigned freeIndex = 0;
-    void* dest = instancingBuffer->Lock(0, totalInstances, true);
-    if (!dest)
-        return;
+unsigned View::ReuseInstancingData(unsigned bufferGeneration, unsigned stride, bool keepData)
+{
+    unsigned numInstances = 0;
 
-    const unsigned stride = instancingBuffer->GetVertexSize();
     for (HashMap<unsigned, BatchQueue>::Iterator i = batchQueues_.Begin(); i != batchQueues_.End(); ++i)
-        i->second_.SetInstancingData(dest, stride, freeIndex);
+        numInstances += i->second_.ReuseInstancingData(bufferGeneration, stride, keepData);
 
     for (Vector<LightBatchQueue>::Iterator i = lightQueues_.Begin(); i != lightQueues_.End(); ++i)
     {
         for (unsigned j = 0; j < i->shadowSplits_.Size(); ++j)
-            i->shadowSplits_[j].shadowBatches_.SetInstancingData(dest, stride, freeIndex);
-        i->litBaseBatches_.SetInstancingData(dest, stride, freeIndex);
-        i->litBatches_.SetInstancingData(dest, stride, freeIndex);
+            numInstances += i->shadowSplits_[j].shadowBatches_.ReuseInstancingData(bufferGeneration, stride, keepData);
+        numInstances += i->litBaseBatches_.ReuseInstancingData(bufferGeneration, stride, keepData);
+        numInstances += i->litBatches_.ReuseInstancingData(bufferGeneration, stride, keepData);
     }
 
-    instancingBuffer->Unlock();
+    return numInstances;
 }
 
 void View::SetupLightVolumeBatch(Batch& batch)
@@ -2980,8 +4028,8 @@ void View::SetupLightVolumeBatch(Batch& batch)
 
 bool View::NeedRenderShadowMap(const LightBatchQueue& queue)
 {
-    // Must have a shadow map, and either forward or deferred lit batches
-    return queue.shadowMap_ && (!queue.litBatches_.IsEmpty() || !queue.litBaseBatches_.IsEmpty() ||
+    // Must have a shadow map that is not cached from an earlier frame, and either forward or deferred lit batches
+    return queue.shadowMap_ && !queue.shadowMapCached_ && (!queue.litBatches_.IsEmpty() || !queue.litBaseBatches_.IsEmpty() ||
         !queue.volumeBatches_.Empty());
 }
 
@@ -3008,7 +4056,8 @@ void View::RenderShadowMap(const LightBatchQueue& queue)
         // Disable other render targets
         for (unsigned i = 1; i < MAX_RENDERTARGETS; ++i)
             graphics_->SetRenderTarget(i, (RenderSurface*) 0);
-        graphics_->SetViewport(IntRect(0, 0, shadowMap->GetWidth(), shadowMap->GetHeight()));
+        // Clear only the light's own region if the shadow map is in the shadow atlas
+        graphics_->SetViewport(queue.shadowMapRegion_);
         graphics_->Clear(CLEAR_DEPTH);
     }
     else // if the shadow map is a color rendertarget
@@ -3020,7 +4069,7 @@ void View::RenderShadowMap(const LightBatchQueue& queue)
             graphics_->SetRenderTarget(i, (RenderSurface*) 0);
         graphics_->SetDepthStencil(renderer_->GetDepthStencil(shadowMap->GetWidth(), shadowMap->GetHeight(),
             shadowMap->GetMultiSample(), shadowMap->GetAutoResolve()));
-        graphics_->SetViewport(IntRect(0, 0, shadowMap->GetWidth(), shadowMap->GetHeight()));
+        graphics_->SetViewport(queue.shadowMapRegion_);
         graphics_->Clear(CLEAR_DEPTH | CLEAR_COLOR, Color::WHITE);
 
         parameters = BiasParameters(0.0f, 0.0f);
@@ -3065,6 +4114,14 @@ void View::RenderShadowMap(const LightBatchQueue& queue)
     // reset some parameters
     graphics_->SetColorWrite(true);
     graphics_->SetDepthBias(0.0f, 0.0f);
+
+    // Mark the cached shadow map valid for later frames, unless its region was reserved for another size meanwhile
+    if (queue.cacheShadowMap_)
+    {
+        CachedShadowMap& cached = renderer_->GetCachedShadowMap(queue.light_);
+        if (cached.texture_ == shadowMap && cached.region_ == queue.shadowMapRegion_)
+            cached.rendered_ = true;
+    }
 }
 
 RenderSurface* View::GetDepthStencil(RenderSurface* renderTarget)
@@ -27,6 +27,7 @@
 #include "../Core/Object.h"
 #include "../Graphics/Batch.h"
 #include "../Graphics/Light.h"
+#include "../Graphics/Octree.h"
 #include "../Graphics/Zone.h"
 #include "../Math/Polyhedron.h"
 
@@ -51,6 +52,19 @@ class Zone;
 struct RenderPathCommand;
 struct WorkItem;
 
+/// Shadow map caching mode of a light on the current frame.
+enum ShadowMapCacheMode
+{
+    /// Shadow map is not cached.
+    SHADOWCACHE_NONE = 0,
+    /// Light or its shadow casters are moving: shadow map is rendered as usual, and the cached shadow map waits for them to stop.
+    SHADOWCACHE_DYNAMIC,
+    /// Cached shadow map is rendered with all shadow casters in the light's range.
+    SHADOWCACHE_RENDER,
+    /// Cached shadow map from an earlier frame is reused.
+    SHADOWCACHE_REUSE
+};
+
 /// Intermediate light processing result.
 struct LightQueryResult
 {
@@ -74,6 +88,10 @@ struct LightQueryResult
     float shadowFarSplits_[MAX_LIGHT_SPLITS];
     /// Shadow map split count.
     unsigned numSplits_;
+    /// Shadow map caching mode.
+    ShadowMapCacheMode shadowMapCache_;
+    /// Hash of the light and view parameters a cached shadow map depends on.
+    unsigned shadowState_;
 };
 
 /// Scene render pass info.
@@ -87,10 +105,85 @@ struct ScenePassInfo
     bool markToStencil_;
     /// Vertex light flag.
     bool vertexLights_;
+    /// Clustered lighting flag.
+    bool clustered_;
     /// Batch queue.
     BatchQueue* batchQueue_;
 };
 
+/// Cached base pass batch of a drawable, with the source batch state it depends on. A source batch that produced no batches is recorded with a null queue, so that every source batch is checked.
+struct CachedBaseBatch
+{
+    /// Geometry of the source batch.
+    Geometry* geometry_;
+    /// Material of the source batch.
+    Material* material_;
+    /// Technique chosen for the material.
+    Technique* tech_;
+    /// Pass.
+    Pass* pass_;
+    /// Batch queue, or null if the source batch produced no batches.
+    BatchQueue* queue_;
+    /// Batch group of an instanced batch, or null if not looked up yet.
+    BatchGroup* group_;
+    /// Group version of the batch queue when the batch group was looked up.
+    unsigned groupVersion_;
+    /// Source batch index.
+    unsigned sourceIndex_;
+    /// Pass index.
+    unsigned passIndex_;
+    /// Shaders version of the pass when the shaders were chosen.
+    unsigned shadersVersion_;
+    /// Geometry type of the source batch.
+    GeometryType geometryType_;
+    /// Render order of the material.
+    unsigned char renderOrder_;
+    /// Whether the source batch had world transforms.
+    bool hasTransforms_;
+    /// Instanced flag.
+    bool instanced_;
+    /// Allow instancing flag.
+    bool allowInstancing_;
+};
+
+/// Cached base pass batches of a drawable that needs no geometry update.
+struct BaseBatchCacheEntry
+{
+    /// Construct.
+    BaseBatchCacheEntry() :
+        drawable_(0),
+        valid_(false),
+        frameNumber_(0)
+    {
+    }
+
+    /// Drawable, or null if the entry is free.
+    Drawable* drawable_;
+
+    /// Cached batches in source batch order.
+    PODVector<CachedBaseBatch> batches_;
+    /// Batches with the pass, zone and shaders set up, in the same order as the cached batches. Only needed when the batch starts a batch group or is not instanced, so they are kept apart from the cached batches.
+    PODVector<Batch> setupBatches_;
+    /// Number of source batches.
+    unsigned numSourceBatches_;
+    /// Zone.
+    Zone* zone_;
+    /// Light mask of the zone.
+    unsigned zoneLightMask_;
+    /// Light mask of the drawable.
+    unsigned lightMask_;
+    /// Base pass flags of the drawable.
+    unsigned basePassFlags_;
+    /// Height fog flag of the zone.
+    bool heightFog_;
+    /// Whether the drawable could take its lights from the light clusters.
+    bool clustered_;
+    /// Whether the cached batches can be used.
+    bool valid_;
+    /// Frame number on which the entry was last used.
+    unsigned frameNumber_;
+};
+
 /// Per-thread geometry, light and scene range collection structure.
 struct PerThreadSceneResult
 {
@@ -111,6 +204,7 @@ class URHO3D_API View : public Object
 {
     friend void CheckVisibilityWork(const WorkItem* item, unsigned threadIndex);
     friend void ProcessLightWork(const WorkItem* item, unsigned threadIndex);
+    friend void AssignClusterLightsWork(const WorkItem* item, unsigned threadIndex);
 
     URHO3D_OBJECT(View, Object);
 
@@ -174,12 +268,30 @@ public:
     /// Return the last used software occlusion buffer.
     OcclusionBuffer* GetOcclusionBuffer() const { return occlusionBuffer_; }
 
+    /// Return the visibility cache used for the main view query when visibility caching is enabled in the renderer.
+    const OctreeQueryCache& GetVisibilityCache() const { return visibilityCache_; }
+
     /// Return number of occluders that were actually rendered. Occluders may be rejected if running out of triangles or if behind other occluders.
     unsigned GetNumActiveOccluders() const { return activeOccluders_; }
 
+    /// Return number of shadow casters that were culled by per-shadow camera occlusion on the last frame.
+    unsigned GetNumOccludedShadowCasters() const;
+
+    /// Return number of lights that reused a cached shadow map on the last frame.
+    unsigned GetNumReusedShadowMaps() const { return reusedShadowMaps_; }
+
     /// Return the source view that was already prepared. Used when viewports specify the same culling camera.
     View* GetSourceView() const;
 
+    /// Return whether the view uses clustered lighting.
+    bool GetClusteredLighting() const { return clusteredLighting_; }
+
+    /// Return lights assigned to the light clusters instead of being rendered per-pixel.
+    const PODVector<Light*>& GetClusteredLights() const { return clusteredLights_; }
+
+    /// Return the light cluster texture. Null if clustered lighting is not in use.
+    Texture2D* GetClusterTexture() const;
+
     /// Set global (per-frame) shader parameters. Called by Batch and internally by View.
     void SetGlobalShaderParameters();
     /// Set camera-specific shader parameters. Called by Batch and internally by View.
@@ -200,10 +312,28 @@ private:
     void GetBatches();
     /// Get lit geometries and shadowcasters for visible lights.
     void ProcessLights();
+    /// Find the visible geometries that can take their lights from the light clusters, and record the bounds of the others.
+    void CheckClusteredGeometries();
+    /// Return whether a geometry can take all its lights from the light clusters.
+    bool IsClusteredGeometry(Drawable* drawable);
+    /// Return whether a light can be assigned to the light clusters.
+    bool IsClusteredLight(Light* light) const;
+    /// Compute the view space bounds and shader data of the clustered lights.
+    void PrepareClusters();
+    /// Assign the clustered lights to the clusters of a range of depth slices.
+    void AssignClusterLights(unsigned beginSlice, unsigned endSlice);
+    /// Write the light clusters to the cluster texture. Return true if successful.
+    bool UploadClusters();
     /// Get batches from lit geometries and shadowcasters.
     void GetLightBatches();
     /// Get unlit batches.
     void GetBaseBatches();
+    /// Get unlit batches of a drawable. If a cache entry is given, record the batches to it.
+    void AddBaseBatches(Drawable* drawable, BaseBatchCacheEntry* entry, bool clusteredGeometry);
+    /// Add the cached unlit batches of a drawable if they are still valid. Return true on success.
+    bool AddCachedBaseBatches(Drawable* drawable, BaseBatchCacheEntry& entry, bool clusteredGeometry);
+    /// Return the base pass batch cache entry of a drawable, allocating one if necessary. Return null if another view is caching the drawable's batches.
+    BaseBatchCacheEntry* GetBaseBatchCacheEntry(Drawable* drawable);
     /// Update geometries and sort batches.
     void UpdateGeometries();
     /// Get pixel lit batches for a certain light and drawable.
@@ -232,10 +362,16 @@ private:
     void UpdateOccluders(PODVector<Drawable*>& occluders, Camera* camera);
     /// Draw occluders to occlusion buffer.
     void DrawOccluders(OcclusionBuffer* buffer, const PODVector<Drawable*>& occluders);
-    /// Query for lit geometries and shadow casters for a light.
+    /// Query for lit geometries and shadow casters for a light. Shadow casters of directional lights are left to be queried from the main thread.
     void ProcessLight(LightQueryResult& query, unsigned threadIndex);
+    /// Choose the shadow map caching mode of a light after its shadow cameras have been set up.
+    void CheckShadowMapCache(LightQueryResult& query);
+    /// Query for shadow casters for a light's shadow splits. Point and spot lights reuse the lit geometry query result in the temporary drawables. If threaded, the octree queries of directional lights may use worker threads.
+    void GetShadowCasters(LightQueryResult& query, unsigned threadIndex, bool threaded);
     /// Process shadow casters' visibilities and build their combined view- or projection-space bounding box.
-    void ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawable*>& drawables, unsigned splitIndex);
+    void ProcessShadowCasters(LightQueryResult& query, const PODVector<Drawable*>& drawables, unsigned splitIndex, unsigned threadIndex);
+    /// Render the occluders among a shadow split's casters from the shadow camera and remove the casters hidden behind them.
+    void OcclusionCullShadowCasters(LightQueryResult& query, unsigned splitIndex, unsigned threadIndex);
     /// Set up initial shadow camera view(s).
     void SetupShadowCameras(LightQueryResult& query);
     /// Set up a directional light shadow camera
@@ -249,18 +385,24 @@ private:
     /// Check visibility of one shadow caster.
     bool IsShadowCasterVisible(Drawable* drawable, BoundingBox lightViewBox, Camera* shadowCamera, const Matrix3x4& lightView,
         const Frustum& lightViewFrustum, const BoundingBox& lightViewFrustumBox);
-    /// Return the viewport for a shadow map split.
-    IntRect GetShadowMapViewport(Light* light, unsigned splitIndex, Texture2D* shadowMap);
+    /// Return the viewport for a shadow map split within the light's shadow map region.
+    IntRect GetShadowMapViewport(Light* light, unsigned splitIndex, const IntRect& region);
     /// Find and set a new zone for a drawable when it has moved.
     void FindZone(Drawable* drawable);
     /// Return material technique, considering the drawable's LOD distance.
     Technique* GetTechnique(Drawable* drawable, Material* material);
     /// Check if material should render an auxiliary view (if it has a camera attached.)
     void CheckMaterialForAuxView(Material* material);
-    /// Choose shaders for a batch and add it to queue.
-    void AddBatchToQueue(BatchQueue& queue, Batch& batch, Technique* tech, bool allowInstancing = true, bool allowShadows = true);
-    /// Prepare instancing buffer by filling it with all instance transforms.
+    /// Choose shaders for a batch and add it to queue. Return the batch group if the batch was instanced.
+    BatchGroup* AddBatchToQueue(BatchQueue& queue, Batch& batch, Technique* tech, bool allowInstancing = true, bool allowShadows = true);
+    /// Add an instanced batch's transforms to a batch group and convert the group to use instancing shaders when it has enough instances.
+    void AddBatchToGroup(BatchGroup& group, const Batch& batch, Technique* tech, bool allowShadows = true);
+    /// Convert a batch group to use instancing shaders if it had less instances than the instancing limit before adding transforms, and has enough now.
+    void CheckInstancingLimit(BatchGroup& group, unsigned oldSize, Technique* tech, bool allowShadows = true);
+    /// Prepare instancing buffer by appending the instance transforms that it does not already hold after the data written so far.
     void PrepareInstancingBuffer();
+    /// Reuse the unchanged instance data of all queues from the instancing buffer of the given generation, if keeping data. Return the number of instances that still need to be written.
+    unsigned ReuseInstancingData(unsigned bufferGeneration, unsigned stride, bool keepData);
     /// Set up a light volume rendering batch.
     void SetupLightVolumeBatch(Batch& batch);
     /// Check whether a light queue needs shadow rendering.
@@ -376,10 +518,20 @@ private:
     bool noStencil_;
     /// Draw debug geometry flag. Copied from the viewport.
     bool drawDebug_;
+    /// Clustered lighting flag. If in use, unshadowed point and spot lights are assigned to a froxel grid and added in the clustered scene passes instead of being rendered per-pixel.
+    bool clusteredLighting_;
     /// Renderpath.
     RenderPath* renderPath_;
     /// Per-thread octree query results.
     Vector<PODVector<Drawable*> > tempDrawables_;
+    /// Per-thread occlusion buffers for shadow cameras. Empty when shadow caster occlusion is not in use.
+    Vector<SharedPtr<OcclusionBuffer> > shadowOcclusionBuffers_;
+    /// Per-thread shadow occluder lists.
+    Vector<PODVector<Drawable*> > shadowOccluders_;
+    /// Per-thread counts of occlusion culled shadow casters.
+    PODVector<unsigned> occludedShadowCasters_;
+    /// Cached frustum culling results of the main view query.
+    OctreeQueryCache visibilityCache_;
     /// Per-thread geometries, lights and Z range collection results.
     Vector<PerThreadSceneResult> sceneResults_;
     /// Visible zones.
@@ -394,8 +546,38 @@ private:
     PODVector<Drawable*> occluders_;
     /// Lights.
     PODVector<Light*> lights_;
+    /// Lights assigned to the light clusters.
+    PODVector<Light*> clusteredLights_;
+    /// Whether each visible geometry can take its lights from the light clusters.
+    PODVector<bool> clusteredGeometries_;
+    /// World bounding boxes of the visible geometries that need their lights per-pixel.
+    PODVector<BoundingBox> nonClusteredBoxes_;
+    /// Union of the world bounding boxes of the visible geometries that need their lights per-pixel.
+    BoundingBox nonClusteredBounds_;
+    /// View space bounding boxes of the clustered lights that are within the view's depth range.
+    PODVector<BoundingBox> clusterLightBoxes_;
+    /// Shader data of the clustered lights that are within the view's depth range, three vectors per light.
+    PODVector<Vector4> clusterLightData_;
+    /// Number of lights in each cluster.
+    PODVector<unsigned> clusterLightCounts_;
+    /// Light indices of each cluster.
+    PODVector<unsigned short> clusterLightIndices_;
+    /// Cluster texture contents.
+    PODVector<float> clusterTextureData_;
+    /// Cluster texture contents uploaded last.
+    PODVector<float> uploadedClusterTextureData_;
+    /// Cluster texture.
+    SharedPtr<Texture2D> clusterTexture_;
+    /// World to view transform of the culling camera when the clusters were built.
+    Matrix3x4 clusterView_;
+    /// Projection scale and offset of the culling camera when the clusters were built.
+    Vector4 clusterProj_;
+    /// Inverse near clip distance and depth slice scale of the clusters.
+    Vector2 clusterDepth_;
     /// Number of active occluders.
     unsigned activeOccluders_;
+    /// Number of lights that reused a cached shadow map.
+    unsigned reusedShadowMaps_;
 
     /// Drawables that limit their maximum light count.
     HashSet<Drawable*> maxLightsDrawables_;
@@ -411,6 +593,18 @@ private:
     HashMap<unsigned long long, LightBatchQueue> vertexLightQueues_;
     /// Batch queues by pass index.
     HashMap<unsigned, BatchQueue> batchQueues_;
+    /// Cached base pass batches. Drawables store the index of their entry.
+    Vector<BaseBatchCacheEntry> baseBatchCache_;
+    /// Indices of free base pass batch cache entries.
+    PODVector<unsigned> freeBaseBatchCacheEntries_;
+    /// Scene passes the base pass batch cache was built for.
+    PODVector<ScenePassInfo> baseBatchCachePasses_;
+    /// Material quality the base pass batch cache was built for.
+    int baseBatchCacheQuality_;
+    /// Shader reload frame number the base pass batch cache was built for.
+    unsigned baseBatchCacheShadersFrame_;
+    /// Dynamic instancing setting the base pass batch cache was built for.
+    bool baseBatchCacheInstancing_;
     /// Index of the GBuffer pass.
     unsigned gBufferPassIndex_;
     /// Index of the opaque forward base pass.
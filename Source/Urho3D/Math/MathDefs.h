@@ -32,6 +32,7 @@
 
 #include <cstdlib>
 #include <cmath>
+#include <cstring>
 #include <limits>
 
 namespace Urho3D
@@ -256,6 +257,17 @@ inline float HalfToFloat(unsigned short value)
     return out;
 }
 
+/// Convert a float to an unsigned integer with the same ordering, for sorting by integer keys. Negative zero gives the same key as positive zero.
+inline unsigned FloatToSortKey(float value)
+{
+    unsigned bits;
+    memcpy(&bits, &value, sizeof bits);
+    // Compare the bits, as the compiler may assume no signed zeros with fast math
+    if (bits == 0x80000000)
+        bits = 0;
+    return (bits & 0x80000000) ? ~bits : bits | 0x80000000;
+}
+
 /// Calculate both sine and cosine, with angle in degrees.
 URHO3D_API void SinCos(float angle, float& sin, float& cos);
 
@@ -248,6 +248,10 @@ void Component::OnNodeSetEnabled(Node* node)
 {
 }
 
+void Component::OnNodeDestroyed(Node* node)
+{
+}
+
 void Component::SetID(unsigned id)
 {
     id_ = id;
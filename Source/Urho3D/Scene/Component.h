@@ -119,6 +119,8 @@ protected:
     virtual void OnMarkedDirty(Node* node);
     /// Handle scene node enabled status changing.
     virtual void OnNodeSetEnabled(Node* node);
+    /// Handle a scene node the component listens to being destroyed. The node must not be accessed beyond its address.
+    virtual void OnNodeDestroyed(Node* node);
     /// Set ID. Called by Scene.
     void SetID(unsigned id);
     /// Set scene node. Called by Node when creating the component.
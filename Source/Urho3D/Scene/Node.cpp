@@ -58,7 +58,9 @@ Node::Node(Context* context) :
     position_(Vector3::ZERO),
     rotation_(Quaternion::IDENTITY),
     scale_(Vector3::ONE),
-    worldRotation_(Quaternion::IDENTITY)
+    worldRotation_(Quaternion::IDENTITY),
+    transformStore_(0),
+    transformIndex_(M_MAX_UNSIGNED)
 {
     impl_ = new NodeImpl();
     impl_->owner_ = 0;
@@ -66,6 +68,13 @@ Node::Node(Context* context) :
 
 Node::~Node()
 {
+    // Notify listener components, which otherwise would have to poll their weak pointers to find out
+    for (Vector<WeakPtr<Component> >::Iterator i = listeners_.Begin(); i != listeners_.End(); ++i)
+    {
+        if (*i)
+            (*i)->OnNodeDestroyed(this);
+    }
+
     RemoveAllChildren();
     RemoveAllComponents();
 
@@ -742,9 +751,18 @@ void Node::MarkDirty()
         // Therefore if we are recursing here to mark this node dirty, and it already was,
         // then all children of this node must also be already dirty, and we don't need to
         // reflag them again.
-        if (cur->dirty_)
-            return;
-        cur->dirty_ = true;
+        if (cur->transformStore_)
+        {
+            if (cur->transformStore_->IsDirty(cur->transformIndex_))
+                return;
+            cur->transformStore_->MarkDirty(cur->transformIndex_);
+        }
+        else
+        {
+            if (cur->dirty_)
+                return;
+            cur->dirty_ = true;
+        }
 
         // Notify listener components first, then mark child nodes
         for (Vector<WeakPtr<Component> >::Iterator i = cur->listeners_.Begin(); i != cur->listeners_.End();)
@@ -833,6 +851,8 @@ void Node::AddChild(Node* node, unsigned index)
         scene_->NodeAdded(node);
 
     node->parent_ = this;
+    if (scene_)
+        scene_->NodeParentChanged(node);
     node->MarkDirty();
     node->MarkNetworkUpdate();
     // If the child node has components, also mark network update on them to ensure they have a valid NetworkState
@@ -1152,7 +1172,7 @@ void Node::AddListener(Component* component)
 
     listeners_.Push(WeakPtr<Component>(component));
     // If the node is currently dirty, notify immediately
-    if (dirty_)
+    if (IsDirty())
         component->OnMarkedDirty(this);
 }
 
@@ -2023,13 +2043,26 @@ void Node::UpdateWorldTransform() const
     // Assume the root node (scene) has identity transform
     if (parent_ == scene_ || !parent_)
     {
-        worldTransform_ = transform;
-        worldRotation_ = rotation_;
+        if (transformStore_)
+            transformStore_->SetWorldTransform(transformIndex_, transform, rotation_);
+        else
+        {
+            worldTransform_ = transform;
+            worldRotation_ = rotation_;
+        }
     }
     else
     {
-        worldTransform_ = parent_->GetWorldTransform() * transform;
-        worldRotation_ = parent_->GetWorldRotation() * rotation_;
+        if (transformStore_)
+        {
+            transformStore_->SetWorldTransform(transformIndex_, parent_->GetWorldTransform() * transform,
+                parent_->GetWorldRotation() * rotation_);
+        }
+        else
+        {
+            worldTransform_ = parent_->GetWorldTransform() * transform;
+            worldRotation_ = parent_->GetWorldRotation() * rotation_;
+        }
     }
 
     dirty_ = false;
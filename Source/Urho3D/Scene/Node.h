@@ -25,6 +25,7 @@
 #include "../IO/VectorBuffer.h"
 #include "../Math/Matrix3x4.h"
 #include "../Scene/Animatable.h"
+#include "../Scene/TransformStore.h"
 
 namespace Urho3D
 {
@@ -75,6 +76,7 @@ class URHO3D_API Node : public Animatable
     URHO3D_OBJECT(Node, Animatable);
 
     friend class Connection;
+    friend class TransformStore;
 
 public:
     /// Construct.
@@ -393,10 +395,10 @@ public:
     /// Return position in world space.
     Vector3 GetWorldPosition() const
     {
-        if (dirty_)
+        if (IsDirty())
             UpdateWorldTransform();
 
-        return worldTransform_.Translation();
+        return GetStoredWorldTransform().Translation();
     }
 
     /// Return position in world space (for Urho2D).
@@ -409,10 +411,10 @@ public:
     /// Return rotation in world space.
     Quaternion GetWorldRotation() const
     {
-        if (dirty_)
+        if (IsDirty())
             UpdateWorldTransform();
 
-        return worldRotation_;
+        return GetStoredWorldRotation();
     }
 
     /// Return rotation in world space (for Urho2D).
@@ -424,37 +426,37 @@ public:
     /// Return direction in world space.
     Vector3 GetWorldDirection() const
     {
-        if (dirty_)
+        if (IsDirty())
             UpdateWorldTransform();
 
-        return worldRotation_ * Vector3::FORWARD;
+        return GetStoredWorldRotation() * Vector3::FORWARD;
     }
 
     /// Return node's up vector in world space.
     Vector3 GetWorldUp() const
     {
-        if (dirty_)
+        if (IsDirty())
             UpdateWorldTransform();
 
-        return worldRotation_ * Vector3::UP;
+        return GetStoredWorldRotation() * Vector3::UP;
     }
 
     /// Return node's right vector in world space.
     Vector3 GetWorldRight() const
     {
-        if (dirty_)
+        if (IsDirty())
             UpdateWorldTransform();
 
-        return worldRotation_ * Vector3::RIGHT;
+        return GetStoredWorldRotation() * Vector3::RIGHT;
     }
 
     /// Return scale in world space.
     Vector3 GetWorldScale() const
     {
-        if (dirty_)
+        if (IsDirty())
             UpdateWorldTransform();
 
-        return worldTransform_.Scale();
+        return GetStoredWorldTransform().Scale();
     }
 
     /// Return scale in world space (for Urho2D).
@@ -467,10 +469,10 @@ public:
     /// Return world space transform matrix.
     const Matrix3x4& GetWorldTransform() const
     {
-        if (dirty_)
+        if (IsDirty())
             UpdateWorldTransform();
 
-        return worldTransform_;
+        return GetStoredWorldTransform();
     }
 
     /// Convert a local space position to world space.
@@ -487,7 +489,7 @@ public:
     Vector2 WorldToLocal2D(const Vector2& vector) const;
 
     /// Return whether transform has changed and world transform needs recalculation.
-    bool IsDirty() const { return dirty_; }
+    bool IsDirty() const { return transformStore_ ? transformStore_->IsDirty(transformIndex_) : dirty_; }
 
     /// Return number of child scene nodes.
     unsigned GetNumChildren(bool recursive = false) const;
@@ -626,6 +628,16 @@ private:
     Component* SafeCreateComponent(const String& typeName, StringHash type, CreateMode mode, unsigned id);
     /// Recalculate the world transform.
     void UpdateWorldTransform() const;
+    /// Return the world transform without recalculating it, from the scene's transform store if the node is in it.
+    const Matrix3x4& GetStoredWorldTransform() const
+    {
+        return transformStore_ ? transformStore_->GetWorldTransform(transformIndex_) : worldTransform_;
+    }
+    /// Return the world rotation without recalculating it, from the scene's transform store if the node is in it.
+    const Quaternion& GetStoredWorldRotation() const
+    {
+        return transformStore_ ? transformStore_->GetWorldRotation(transformIndex_) : worldRotation_;
+    }
     /// Remove child node by iterator.
     void RemoveChild(Vector<SharedPtr<Node> >::Iterator i);
     /// Return child nodes recursively.
@@ -643,9 +655,9 @@ private:
     /// Handle attribute animation update event.
     void HandleAttributeAnimationUpdate(StringHash eventType, VariantMap& eventData);
 
-    /// World-space transform matrix.
+    /// World-space transform matrix. Not used while the node is in the scene's transform store.
     mutable Matrix3x4 worldTransform_;
-    /// World transform needs update flag.
+    /// World transform needs update flag. Not used while the node is in the scene's transform store.
     mutable bool dirty_;
     /// Enabled flag.
     bool enabled_;
@@ -669,8 +681,12 @@ private:
     Quaternion rotation_;
     /// Scale.
     Vector3 scale_;
-    /// World-space rotation.
+    /// World-space rotation. Not used while the node is in the scene's transform store.
     mutable Quaternion worldRotation_;
+    /// Scene's transform store holding the world transform, or null if not stored.
+    TransformStore* transformStore_;
+    /// Index in the transform store.
+    unsigned transformIndex_;
     /// Components.
     Vector<SharedPtr<Component> > components_;
     /// Child scene nodes.
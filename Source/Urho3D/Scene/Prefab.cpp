@@ -0,0 +1,215 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Core/Context.h"
+#include "../IO/FileSystem.h"
+#include "../IO/Log.h"
+#include "../IO/MemoryBuffer.h"
+#include "../IO/VectorBuffer.h"
+#include "../Resource/JSONFile.h"
+#include "../Resource/ResourceCache.h"
+#include "../Resource/XMLFile.h"
+#include "../Scene/Prefab.h"
+#include "../Scene/Scene.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+Prefab::Prefab(Context* context) :
+    Resource(context)
+{
+}
+
+Prefab::~Prefab()
+{
+}
+
+void Prefab::RegisterObject(Context* context)
+{
+    context->RegisterFactory<Prefab>();
+}
+
+bool Prefab::BeginLoad(Deserializer& source)
+{
+    data_.Clear();
+    xmlFile_.Reset();
+    jsonFile_.Reset();
+    resources_.Clear();
+    loadResourceRefs_.Clear();
+
+    String extension = GetExtension(source.GetName());
+    if (extension == ".xml")
+    {
+        SharedPtr<XMLFile> xmlFile(new XMLFile(context_));
+        if (!xmlFile->Load(source))
+            return false;
+
+        xmlFile_ = xmlFile;
+        GetResourceRefsXML(context_, xmlFile_->GetRoot(), loadResourceRefs_);
+    }
+    else if (extension == ".json")
+    {
+        SharedPtr<JSONFile> jsonFile(new JSONFile(context_));
+        if (!jsonFile->Load(source))
+            return false;
+
+        jsonFile_ = jsonFile;
+        GetResourceRefsJSON(context_, jsonFile_->GetRoot(), loadResourceRefs_);
+    }
+    else
+    {
+        data_.Resize(source.GetSize() - source.GetPosition());
+        if (data_.Size() && source.Read(&data_[0], data_.Size()) != data_.Size())
+        {
+            data_.Clear();
+            return false;
+        }
+
+        MemoryBuffer buffer(data_);
+        if (data_.Empty() || !GetResourceRefs(context_, buffer, Node::GetTypeStatic(), loadResourceRefs_))
+        {
+            URHO3D_LOGERROR("Invalid binary data in prefab " + GetName());
+            data_.Clear();
+            loadResourceRefs_.Clear();
+            return false;
+        }
+    }
+
+    // If async loading, request the referred resources to be loaded as well. If not threaded, they are loaded synchronously
+    // in EndLoad()
+#ifdef URHO3D_THREADING
+    if (GetAsyncLoadState() == ASYNC_LOADING)
+    {
+        ResourceCache* cache = GetSubsystem<ResourceCache>();
+        for (unsigned i = 0; i < loadResourceRefs_.Size(); ++i)
+        {
+            cache->BackgroundLoadResource(loadResourceRefs_[i].type_, cache->SanitateResourceName(loadResourceRefs_[i].name_),
+                true, this);
+        }
+    }
+#endif
+
+    return true;
+}
+
+bool Prefab::EndLoad()
+{
+    AcquireResources(loadResourceRefs_);
+    loadResourceRefs_.Clear();
+
+    // Convert XML or JSON data to binary once, so that instances do not need to parse it. If the data has animations,
+    // which binary data does not hold, it stays empty and each instance is parsed from the source
+    VectorBuffer buffer;
+    if (xmlFile_ && ConvertNodeDataXML(context_, xmlFile_->GetRoot(), buffer))
+        data_ = buffer.GetBuffer();
+    else if (jsonFile_ && ConvertNodeDataJSON(context_, jsonFile_->GetRoot(), buffer))
+        data_ = buffer.GetBuffer();
+
+    UpdateMemoryUse();
+    return true;
+}
+
+bool Prefab::Save(Serializer& dest) const
+{
+    if (xmlFile_)
+        return xmlFile_->Save(dest);
+    if (jsonFile_)
+        return jsonFile_->Save(dest);
+
+    if (data_.Empty())
+    {
+        URHO3D_LOGERROR("Can not save empty prefab " + GetName());
+        return false;
+    }
+
+    return dest.Write(&data_[0], data_.Size()) == data_.Size();
+}
+
+bool Prefab::SetNode(Node* node)
+{
+    data_.Clear();
+    xmlFile_.Reset();
+    jsonFile_.Reset();
+    resources_.Clear();
+
+    if (!node)
+        return false;
+
+    VectorBuffer buffer;
+    if (!node->Save(buffer))
+    {
+        URHO3D_LOGERROR("Failed to save node to prefab " + GetName());
+        return false;
+    }
+
+    data_ = buffer.GetBuffer();
+
+    Vector<ResourceRef> refs;
+    MemoryBuffer source(data_);
+    GetResourceRefs(context_, source, Node::GetTypeStatic(), refs);
+    AcquireResources(refs);
+    UpdateMemoryUse();
+    return true;
+}
+
+Node* Prefab::Instantiate(Scene* scene, const Vector3& position, const Quaternion& rotation, CreateMode mode)
+{
+    if (!scene)
+        return 0;
+
+    if (!data_.Empty())
+    {
+        MemoryBuffer buffer(data_);
+        return scene->Instantiate(buffer, position, rotation, mode);
+    }
+
+    if (xmlFile_)
+        return scene->InstantiateXML(xmlFile_->GetRoot(), position, rotation, mode);
+    else if (jsonFile_)
+        return scene->InstantiateJSON(jsonFile_->GetRoot(), position, rotation, mode);
+    else
+        return 0;
+}
+
+void Prefab::AcquireResources(const Vector<ResourceRef>& refs)
+{
+    // If async loading, the resources have been requested already and should exist
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    for (unsigned i = 0; i < refs.Size(); ++i)
+    {
+        SharedPtr<Resource> resource(cache->GetResource(refs[i].type_, refs[i].name_));
+        if (resource && !resources_.Contains(resource))
+            resources_.Push(resource);
+    }
+}
+
+void Prefab::UpdateMemoryUse()
+{
+    SetMemoryUse(sizeof(Prefab) + data_.Size() + (xmlFile_ ? xmlFile_->GetMemoryUse() : 0) +
+        (jsonFile_ ? jsonFile_->GetMemoryUse() : 0) + resources_.Size() * sizeof(SharedPtr<Resource>));
+}
+
+}
@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Resource/Resource.h"
+#include "../Scene/Node.h"
+
+namespace Urho3D
+{
+
+class JSONFile;
+class Scene;
+class XMLFile;
+
+/// Object prefab resource. Holds XML, JSON or binary node data and the resources it refers to. XML and JSON data is converted to binary data when loaded, and the instances are loaded from that.
+class URHO3D_API Prefab : public Resource
+{
+    URHO3D_OBJECT(Prefab, Resource);
+
+public:
+    /// Construct.
+    Prefab(Context* context);
+    /// Destruct.
+    virtual ~Prefab();
+    /// Register object factory.
+    static void RegisterObject(Context* context);
+
+    /// Load resource from stream. May be called from a worker thread. Return true if successful.
+    virtual bool BeginLoad(Deserializer& source);
+    /// Finish resource loading. Always called from the main thread. Return true if successful.
+    virtual bool EndLoad();
+    /// Save resource in the format it was loaded in, or binary if set from a node. Return true if successful.
+    virtual bool Save(Serializer& dest) const;
+
+    /// Set binary data from an existing node hierarchy. Return true if successful.
+    bool SetNode(Node* node);
+    /// Instantiate into a scene. Return the root node, or null if failed.
+    Node* Instantiate(Scene* scene, const Vector3& position, const Quaternion& rotation, CreateMode mode = REPLICATED);
+
+    /// Return binary node data. If loaded from XML or JSON, converted from it, or empty if it has object or attribute animations.
+    const PODVector<unsigned char>& GetData() const { return data_; }
+
+    /// Return XML source data, or null if not loaded from XML.
+    XMLFile* GetXMLFile() const { return xmlFile_; }
+    /// Return JSON source data, or null if not loaded from JSON.
+    JSONFile* GetJSONFile() const { return jsonFile_; }
+    /// Return resources referred to by the content.
+    const Vector<SharedPtr<Resource> >& GetResources() const { return resources_; }
+
+private:
+    /// Acquire the resources referred to by the content.
+    void AcquireResources(const Vector<ResourceRef>& refs);
+    /// Recalculate memory use.
+    void UpdateMemoryUse();
+
+    /// Binary node data.
+    PODVector<unsigned char> data_;
+    /// XML source data.
+    SharedPtr<XMLFile> xmlFile_;
+    /// JSON source data.
+    SharedPtr<JSONFile> jsonFile_;
+    /// Resources referred to by the content.
+    Vector<SharedPtr<Resource> > resources_;
+    /// Resources referred to by the content, found during loading.
+    Vector<ResourceRef> loadResourceRefs_;
+};
+
+}
@@ -28,6 +28,7 @@
 #include "../Core/WorkQueue.h"
 #include "../IO/File.h"
 #include "../IO/Log.h"
+#include "../IO/MemoryBuffer.h"
 #include "../IO/PackageFile.h"
 #include "../Resource/ResourceCache.h"
 #include "../Resource/ResourceEvents.h"
@@ -35,9 +36,11 @@
 #include "../Resource/JSONFile.h"
 #include "../Scene/Component.h"
 #include "../Scene/ObjectAnimation.h"
+#include "../Scene/Prefab.h"
 #include "../Scene/ReplicationState.h"
 #include "../Scene/Scene.h"
 #include "../Scene/SceneEvents.h"
+#include "../Scene/SceneStreamer.h"
 #include "../Scene/SmoothedTransform.h"
 #include "../Scene/SplinePath.h"
 #include "../Scene/UnknownComponent.h"
@@ -55,12 +58,44 @@ const char* SUBSYSTEM_CATEGORY = "Subsystem";
 static const float DEFAULT_SMOOTHING_CONSTANT = 50.0f;
 static const float DEFAULT_SNAP_THRESHOLD = 5.0f;
 
+/// Return how many consecutive IDs starting from the next free ID are not in use, up to the requested count.
+template <class T> static unsigned GetFreeIDRange(const HashMap<unsigned, T*>& objects, unsigned next, unsigned last, unsigned count)
+{
+    // The range does not wrap around, and the next free ID after it must stay valid
+    count = Min(count, last - next);
+    unsigned end = next + count;
+
+    // Check either each ID of the range, or each ID in use, whichever is less work
+    if (objects.Size() < count)
+    {
+        for (typename HashMap<unsigned, T*>::ConstIterator i = objects.Begin(); i != objects.End(); ++i)
+        {
+            if (i->first_ >= next && i->first_ < end)
+                end = i->first_;
+        }
+    }
+    else
+    {
+        for (unsigned id = next; id < end; ++id)
+        {
+            if (objects.Contains(id))
+                return id - next;
+        }
+    }
+
+    return end - next;
+}
+
 Scene::Scene(Context* context) :
     Node(context),
     replicatedNodeID_(FIRST_REPLICATED_ID),
     replicatedComponentID_(FIRST_REPLICATED_ID),
     localNodeID_(FIRST_LOCAL_ID),
     localComponentID_(FIRST_LOCAL_ID),
+    reservedReplicatedNodeIDs_(0),
+    reservedLocalNodeIDs_(0),
+    reservedReplicatedComponentIDs_(0),
+    reservedLocalComponentIDs_(0),
     checksum_(0),
     asyncLoadingMs_(5),
     timeScale_(1.0f),
@@ -69,7 +104,9 @@ Scene::Scene(Context* context) :
     snapThreshold_(DEFAULT_SNAP_THRESHOLD),
     updateEnabled_(true),
     asyncLoading_(false),
-    threadedUpdate_(false)
+    threadedUpdate_(false),
+    linearTransformUpdate_(false),
+    batchInstantiating_(false)
 {
     // Assign an ID to self so that nodes can refer to this node as a parent
     SetID(GetFreeNodeID(REPLICATED));
@@ -612,6 +649,124 @@ Node* Scene::InstantiateJSON(Deserializer& source, const Vector3& position, cons
     return InstantiateJSON(json->GetRoot(), position, rotation, mode);
 }
 
+Node* Scene::Instantiate(Prefab* prefab, const Vector3& position, const Quaternion& rotation, CreateMode mode)
+{
+    return prefab ? prefab->Instantiate(this, position, rotation, mode) : 0;
+}
+
+bool Scene::InstantiateBatch(Prefab* prefab, const PODVector<Vector3>& positions, const PODVector<Quaternion>& rotations,
+    PODVector<Node*>& dest, CreateMode mode)
+{
+    URHO3D_PROFILE(InstantiateBatch);
+
+    if (!prefab)
+        return false;
+    if (positions.Size() != rotations.Size())
+    {
+        URHO3D_LOGERROR("Position and rotation counts do not match for batch instantiation");
+        return false;
+    }
+    if (positions.Empty())
+        return true;
+
+    if (!prefab->GetData().Empty())
+        return InstantiateCopies(prefab->GetData(), positions, rotations, dest, dest.Size(), mode);
+    else if (prefab->GetXMLFile())
+        return InstantiateBatchXML(prefab->GetXMLFile()->GetRoot(), positions, rotations, dest, mode);
+    else if (prefab->GetJSONFile())
+        return InstantiateBatchJSON(prefab->GetJSONFile()->GetRoot(), positions, rotations, dest, mode);
+    else
+        return false;
+}
+
+bool Scene::InstantiateBatch(Deserializer& source, const PODVector<Vector3>& positions, const PODVector<Quaternion>& rotations,
+    PODVector<Node*>& dest, CreateMode mode)
+{
+    URHO3D_PROFILE(InstantiateBatch);
+
+    if (positions.Size() != rotations.Size())
+    {
+        URHO3D_LOGERROR("Position and rotation counts do not match for batch instantiation");
+        return false;
+    }
+
+    // Read the source data into memory once, then load each copy from there
+    VectorBuffer buffer(source, source.GetSize() - source.GetPosition());
+    return InstantiateCopies(buffer.GetBuffer(), positions, rotations, dest, dest.Size(), mode);
+}
+
+bool Scene::InstantiateBatchXML(const XMLElement& source, const PODVector<Vector3>& positions, const PODVector<Quaternion>& rotations,
+    PODVector<Node*>& dest, CreateMode mode)
+{
+    URHO3D_PROFILE(InstantiateBatchXML);
+
+    if (positions.Size() != rotations.Size())
+    {
+        URHO3D_LOGERROR("Position and rotation counts do not match for batch instantiation");
+        return false;
+    }
+    if (positions.Empty())
+        return true;
+
+    // Parse the XML data only once into binary data, before any copy exists that event handlers could modify
+    VectorBuffer buffer;
+    if (ConvertNodeDataXML(context_, source, buffer))
+        return InstantiateCopies(buffer.GetBuffer(), positions, rotations, dest, dest.Size(), mode);
+
+    // Binary data can not hold animations, so in that case parse the XML data for each copy
+    unsigned destStart = dest.Size();
+    for (unsigned i = 0; i < positions.Size(); ++i)
+    {
+        Node* node = InstantiateXML(source, positions[i], rotations[i], mode);
+        if (!node)
+        {
+            for (unsigned j = destStart; j < dest.Size(); ++j)
+                dest[j]->Remove();
+            dest.Resize(destStart);
+            return false;
+        }
+        dest.Push(node);
+    }
+
+    return true;
+}
+
+bool Scene::InstantiateBatchJSON(const JSONValue& source, const PODVector<Vector3>& positions, const PODVector<Quaternion>& rotations,
+    PODVector<Node*>& dest, CreateMode mode)
+{
+    URHO3D_PROFILE(InstantiateBatchJSON);
+
+    if (positions.Size() != rotations.Size())
+    {
+        URHO3D_LOGERROR("Position and rotation counts do not match for batch instantiation");
+        return false;
+    }
+    if (positions.Empty())
+        return true;
+
+    // Parse the JSON data only once into binary data, before any copy exists that event handlers could modify
+    VectorBuffer buffer;
+    if (ConvertNodeDataJSON(context_, source, buffer))
+        return InstantiateCopies(buffer.GetBuffer(), positions, rotations, dest, dest.Size(), mode);
+
+    // Binary data can not hold animations, so in that case parse the JSON data for each copy
+    unsigned destStart = dest.Size();
+    for (unsigned i = 0; i < positions.Size(); ++i)
+    {
+        Node* node = InstantiateJSON(source, positions[i], rotations[i], mode);
+        if (!node)
+        {
+            for (unsigned j = destStart; j < dest.Size(); ++j)
+                dest[j]->Remove();
+            dest.Resize(destStart);
+            return false;
+        }
+        dest.Push(node);
+    }
+
+    return true;
+}
+
 void Scene::Clear(bool clearReplicated, bool clearLocal)
 {
     StopAsyncLoading();
@@ -703,6 +858,22 @@ void Scene::UnregisterAllVars()
     varNames_.Clear();
 }
 
+void Scene::SetLinearTransformUpdate(bool enable)
+{
+    if (enable == linearTransformUpdate_)
+        return;
+
+    linearTransformUpdate_ = enable;
+    if (enable)
+    {
+        const Vector<SharedPtr<Node> >& children = GetChildren();
+        for (Vector<SharedPtr<Node> >::ConstIterator i = children.Begin(); i != children.End(); ++i)
+            nodeTransforms_.Insert(*i);
+    }
+    else
+        nodeTransforms_.Clear();
+}
+
 Node* Scene::GetNode(unsigned id) const
 {
     if (id < FIRST_LOCAL_ID)
@@ -759,6 +930,8 @@ const String& Scene::GetVarName(StringHash hash) const
 
 void Scene::Update(float timeStep)
 {
+    asyncLoadTimer_.Reset();
+
     if (asyncLoading_)
     {
         UpdateAsyncLoading();
@@ -813,7 +986,10 @@ void Scene::BeginThreadedUpdate()
 {
     // Check the work queue subsystem whether it actually has created worker threads. If not, do not enter threaded mode.
     if (GetSubsystem<WorkQueue>()->GetNumThreads())
+    {
         threadedUpdate_ = true;
+        nodeTransforms_.SetThreadedUpdate(true);
+    }
 }
 
 void Scene::EndThreadedUpdate()
@@ -822,6 +998,7 @@ void Scene::EndThreadedUpdate()
         return;
 
     threadedUpdate_ = false;
+    nodeTransforms_.SetThreadedUpdate(false);
 
     if (!delayedDirtyComponents_.Empty())
     {
@@ -839,10 +1016,24 @@ void Scene::DelayedMarkedDirty(Component* component)
     delayedDirtyComponents_.Push(component);
 }
 
+void Scene::UpdateTransforms()
+{
+    URHO3D_PROFILE(UpdateTransforms);
+
+    nodeTransforms_.Update();
+}
+
 unsigned Scene::GetFreeNodeID(CreateMode mode)
 {
     if (mode == REPLICATED)
     {
+        // IDs reserved for batch instantiation are known to be free
+        if (reservedReplicatedNodeIDs_)
+        {
+            --reservedReplicatedNodeIDs_;
+            return replicatedNodeID_++;
+        }
+
         for (;;)
         {
             unsigned ret = replicatedNodeID_;
@@ -857,6 +1048,12 @@ unsigned Scene::GetFreeNodeID(CreateMode mode)
     }
     else
     {
+        if (reservedLocalNodeIDs_)
+        {
+            --reservedLocalNodeIDs_;
+            return localNodeID_++;
+        }
+
         for (;;)
         {
             unsigned ret = localNodeID_;
@@ -875,6 +1072,12 @@ unsigned Scene::GetFreeComponentID(CreateMode mode)
 {
     if (mode == REPLICATED)
     {
+        if (reservedReplicatedComponentIDs_)
+        {
+            --reservedReplicatedComponentIDs_;
+            return replicatedComponentID_++;
+        }
+
         for (;;)
         {
             unsigned ret = replicatedComponentID_;
@@ -889,6 +1092,12 @@ unsigned Scene::GetFreeComponentID(CreateMode mode)
     }
     else
     {
+        if (reservedLocalComponentIDs_)
+        {
+            --reservedLocalComponentIDs_;
+            return localComponentID_++;
+        }
+
         for (;;)
         {
             unsigned ret = localComponentID_;
@@ -966,6 +1175,12 @@ void Scene::NodeAdded(Node* node)
         NodeAdded(*i);
 }
 
+void Scene::NodeParentChanged(Node* node)
+{
+    if (linearTransformUpdate_)
+        nodeTransforms_.Insert(node);
+}
+
 void Scene::NodeTagAdded(Node* node, const String& tag)
 {
     taggedNodes_[tag].Push(node);
@@ -990,6 +1205,7 @@ void Scene::NodeRemoved(Node* node)
     else
         localNodes_.Erase(id);
 
+    nodeTransforms_.Remove(node);
     node->ResetScene();
 
     // Remove node from tag cache
@@ -1194,8 +1410,6 @@ void Scene::UpdateAsyncLoading()
     if (asyncProgress_.loadedResources_ < asyncProgress_.totalResources_)
         return;
 
-    HiresTimer asyncLoadTimer;
-
     for (;;)
     {
         if (asyncProgress_.loadedNodes_ >= asyncProgress_.totalNodes_)
@@ -1236,7 +1450,7 @@ void Scene::UpdateAsyncLoading()
         ++asyncProgress_.loadedNodes_;
 
         // Break if time limit exceeded, so that we keep sufficient FPS
-        if (asyncLoadTimer.GetUSec(false) >= asyncLoadingMs_ * 1000)
+        if (IsAsyncLoadingTimeExceeded())
             break;
     }
 
@@ -1270,6 +1484,92 @@ void Scene::FinishAsyncLoading()
     SendEvent(E_ASYNCLOADFINISHED, eventData);
 }
 
+bool Scene::InstantiateCopies(const PODVector<unsigned char>& data, const PODVector<Vector3>& positions,
+    const PODVector<Quaternion>& rotations, PODVector<Node*>& dest, unsigned destStart, CreateMode mode)
+{
+    SceneResolver resolver;
+    bool success = true;
+
+    batchInstantiating_ = true;
+
+    for (unsigned i = dest.Size() - destStart; i < positions.Size(); ++i)
+    {
+        // Once the first copy exists, reserve IDs for the rest according to its nodes and components
+        if (i == 1)
+            ReserveIDs(dest[destStart], positions.Size() - 1);
+
+        MemoryBuffer source(data);
+        unsigned nodeID = source.ReadUInt();
+        // Rewrite IDs when instantiating
+        Node* node = CreateChild(0, mode);
+        dest.Push(node);
+        resolver.AddNode(nodeID, node);
+
+        if (!node->Load(source, resolver, true, true, mode))
+        {
+            success = false;
+            break;
+        }
+
+        resolver.Resolve();
+        node->ApplyAttributes();
+        node->SetTransform(positions[i], rotations[i]);
+    }
+
+    batchInstantiating_ = false;
+    reservedReplicatedNodeIDs_ = 0;
+    reservedLocalNodeIDs_ = 0;
+    reservedReplicatedComponentIDs_ = 0;
+    reservedLocalComponentIDs_ = 0;
+
+    // Remove all copies on failure, so that a failed batch leaves the scene unchanged
+    if (!success)
+    {
+        for (unsigned i = destStart; i < dest.Size(); ++i)
+            dest[i]->Remove();
+        dest.Resize(destStart);
+    }
+
+    return success;
+}
+
+void Scene::ReserveIDs(Node* copy, unsigned numCopies)
+{
+    unsigned numReplicatedNodes = 0;
+    unsigned numLocalNodes = 0;
+    unsigned numReplicatedComponents = 0;
+    unsigned numLocalComponents = 0;
+
+    PODVector<Node*> nodes;
+    copy->GetChildren(nodes, true);
+    nodes.Push(copy);
+
+    for (unsigned i = 0; i < nodes.Size(); ++i)
+    {
+        if (nodes[i]->GetID() < FIRST_LOCAL_ID)
+            ++numReplicatedNodes;
+        else
+            ++numLocalNodes;
+
+        const Vector<SharedPtr<Component> >& components = nodes[i]->GetComponents();
+        for (unsigned j = 0; j < components.Size(); ++j)
+        {
+            if (components[j]->GetID() < FIRST_LOCAL_ID)
+                ++numReplicatedComponents;
+            else
+                ++numLocalComponents;
+        }
+    }
+
+    reservedReplicatedNodeIDs_ = GetFreeIDRange(replicatedNodes_, replicatedNodeID_, LAST_REPLICATED_ID,
+        numReplicatedNodes * numCopies);
+    reservedLocalNodeIDs_ = GetFreeIDRange(localNodes_, localNodeID_, LAST_LOCAL_ID, numLocalNodes * numCopies);
+    reservedReplicatedComponentIDs_ = GetFreeIDRange(replicatedComponents_, replicatedComponentID_, LAST_REPLICATED_ID,
+        numReplicatedComponents * numCopies);
+    reservedLocalComponentIDs_ = GetFreeIDRange(localComponents_, localComponentID_, LAST_LOCAL_ID,
+        numLocalComponents * numCopies);
+}
+
 void Scene::FinishLoading(Deserializer* source)
 {
     if (source)
@@ -1293,250 +1593,270 @@ void Scene::PreloadResources(File* file, bool isSceneFile)
 {
     // If not threaded, can not background load resources, so rather load synchronously later when needed
 #ifdef URHO3D_THREADING
+    Vector<ResourceRef> refs;
+    GetResourceRefs(context_, *file, isSceneFile ? Scene::GetTypeStatic() : Node::GetTypeStatic(), refs);
+    PreloadResourceRefs(refs);
+#endif
+}
+
+void Scene::PreloadResourcesXML(const XMLElement& element)
+{
+#ifdef URHO3D_THREADING
+    Vector<ResourceRef> refs;
+    GetResourceRefsXML(context_, element, refs);
+    PreloadResourceRefs(refs);
+#endif
+}
+
+void Scene::PreloadResourcesJSON(const JSONValue& value)
+{
+#ifdef URHO3D_THREADING
+    Vector<ResourceRef> refs;
+    GetResourceRefsJSON(context_, value, refs);
+    PreloadResourceRefs(refs);
+#endif
+}
+
+void Scene::PreloadResourceRefs(const Vector<ResourceRef>& refs)
+{
     ResourceCache* cache = GetSubsystem<ResourceCache>();
 
+    for (unsigned i = 0; i < refs.Size(); ++i)
+    {
+        // Sanitate resource name beforehand so that when we get the background load event, the name matches exactly
+        String name = cache->SanitateResourceName(refs[i].name_);
+        bool success = cache->BackgroundLoadResource(refs[i].type_, name);
+        if (success)
+        {
+            ++asyncProgress_.totalResources_;
+            asyncProgress_.resources_.Insert(StringHash(name));
+        }
+    }
+}
+
+/// Append a resource reference, or the references of a resource reference list, with a non-empty name.
+static void AppendResourceRefs(const Variant& value, Vector<ResourceRef>& dest)
+{
+    if (value.GetType() == VAR_RESOURCEREF)
+    {
+        const ResourceRef& ref = value.GetResourceRef();
+        if (!ref.name_.Empty())
+            dest.Push(ref);
+    }
+    else if (value.GetType() == VAR_RESOURCEREFLIST)
+    {
+        const ResourceRefList& refList = value.GetResourceRefList();
+        for (unsigned i = 0; i < refList.names_.Size(); ++i)
+        {
+            if (!refList.names_[i].Empty())
+                dest.Push(ResourceRef(refList.type_, refList.names_[i]));
+        }
+    }
+}
+
+/// Find a resource attribute by name. The search starts after the previously found attribute, as the attributes are usually in order.
+static const AttributeInfo* FindResourceAttribute(const Vector<AttributeInfo>& attributes, const String& name,
+    unsigned& startIndex)
+{
+    unsigned i = startIndex;
+    for (unsigned attempts = attributes.Size(); attempts; --attempts)
+    {
+        const AttributeInfo& attr = attributes[i];
+        if ((attr.mode_ & AM_FILE) && !attr.name_.Compare(name, true))
+        {
+            startIndex = (i + 1) % attributes.Size();
+            return (attr.type_ == VAR_RESOURCEREF || attr.type_ == VAR_RESOURCEREFLIST) ? &attr : 0;
+        }
+        i = (i + 1) % attributes.Size();
+    }
+
+    return 0;
+}
+
+bool GetResourceRefs(Context* context, Deserializer& source, StringHash nodeType, Vector<ResourceRef>& dest)
+{
     // Read node ID (not needed)
-    /*unsigned nodeID = */file->ReadUInt();
+    /*unsigned nodeID = */source.ReadUInt();
 
     // Read Node or Scene attributes; these do not include any resources
-    const Vector<AttributeInfo>* attributes = context_->GetAttributes(isSceneFile ? Scene::GetTypeStatic() : Node::GetTypeStatic());
-    assert(attributes);
-
-    for (unsigned i = 0; i < attributes->Size(); ++i)
+    const Vector<AttributeInfo>* attributes = context->GetAttributes(nodeType);
+    for (unsigned i = 0; attributes && i < attributes->Size(); ++i)
     {
         const AttributeInfo& attr = attributes->At(i);
-        if (!(attr.mode_ & AM_FILE))
-            continue;
-        /*Variant varValue = */file->ReadVariant(attr.type_);
+        if (attr.mode_ & AM_FILE)
+            source.ReadVariant(attr.type_);
     }
 
     // Read component attributes
-    unsigned numComponents = file->ReadVLE();
+    unsigned numComponents = source.ReadVLE();
     for (unsigned i = 0; i < numComponents; ++i)
     {
-        VectorBuffer compBuffer(*file, file->ReadVLE());
+        if (source.IsEof())
+            return false;
+
+        VectorBuffer compBuffer(source, source.ReadVLE());
         StringHash compType = compBuffer.ReadStringHash();
         // Read component ID (not needed)
         /*unsigned compID = */compBuffer.ReadUInt();
 
-        attributes = context_->GetAttributes(compType);
-        if (attributes)
+        attributes = context->GetAttributes(compType);
+        for (unsigned j = 0; attributes && j < attributes->Size(); ++j)
         {
-            for (unsigned j = 0; j < attributes->Size(); ++j)
-            {
-                const AttributeInfo& attr = attributes->At(j);
-                if (!(attr.mode_ & AM_FILE))
-                    continue;
-                Variant varValue = compBuffer.ReadVariant(attr.type_);
-                if (attr.type_ == VAR_RESOURCEREF)
-                {
-                    const ResourceRef& ref = varValue.GetResourceRef();
-                    // Sanitate resource name beforehand so that when we get the background load event, the name matches exactly
-                    String name = cache->SanitateResourceName(ref.name_);
-                    bool success = cache->BackgroundLoadResource(ref.type_, name);
-                    if (success)
-                    {
-                        ++asyncProgress_.totalResources_;
-                        asyncProgress_.resources_.Insert(StringHash(name));
-                    }
-                }
-                else if (attr.type_ == VAR_RESOURCEREFLIST)
-                {
-                    const ResourceRefList& refList = varValue.GetResourceRefList();
-                    for (unsigned k = 0; k < refList.names_.Size(); ++k)
-                    {
-                        String name = cache->SanitateResourceName(refList.names_[k]);
-                        bool success = cache->BackgroundLoadResource(refList.type_, name);
-                        if (success)
-                        {
-                            ++asyncProgress_.totalResources_;
-                            asyncProgress_.resources_.Insert(StringHash(name));
-                        }
-                    }
-                }
-            }
+            const AttributeInfo& attr = attributes->At(j);
+            if (attr.mode_ & AM_FILE)
+                AppendResourceRefs(compBuffer.ReadVariant(attr.type_), dest);
         }
     }
 
     // Read child nodes
-    unsigned numChildren = file->ReadVLE();
+    unsigned numChildren = source.ReadVLE();
     for (unsigned i = 0; i < numChildren; ++i)
-        PreloadResources(file, false);
-#endif
+    {
+        if (source.IsEof() || !GetResourceRefs(context, source, Node::GetTypeStatic(), dest))
+            return false;
+    }
+
+    return true;
 }
 
-void Scene::PreloadResourcesXML(const XMLElement& element)
+void GetResourceRefsXML(Context* context, const XMLElement& element, Vector<ResourceRef>& dest)
 {
-    // If not threaded, can not background load resources, so rather load synchronously later when needed
-#ifdef URHO3D_THREADING
-    ResourceCache* cache = GetSubsystem<ResourceCache>();
-
     // Node or Scene attributes do not include any resources; therefore skip to the components
-    XMLElement compElem = element.GetChild("component");
-    while (compElem)
+    for (XMLElement compElem = element.GetChild("component"); compElem; compElem = compElem.GetNext("component"))
     {
-        String typeName = compElem.GetAttribute("type");
-        const Vector<AttributeInfo>* attributes = context_->GetAttributes(StringHash(typeName));
-        if (attributes)
+        const Vector<AttributeInfo>* attributes = context->GetAttributes(StringHash(compElem.GetAttribute("type")));
+        if (!attributes || attributes->Empty())
+            continue;
+
+        unsigned startIndex = 0;
+        for (XMLElement attrElem = compElem.GetChild("attribute"); attrElem; attrElem = attrElem.GetNext("attribute"))
         {
-            XMLElement attrElem = compElem.GetChild("attribute");
-            unsigned startIndex = 0;
-
-            while (attrElem)
-            {
-                String name = attrElem.GetAttribute("name");
-                unsigned i = startIndex;
-                unsigned attempts = attributes->Size();
-
-                while (attempts)
-                {
-                    const AttributeInfo& attr = attributes->At(i);
-                    if ((attr.mode_ & AM_FILE) && !attr.name_.Compare(name, true))
-                    {
-                        if (attr.type_ == VAR_RESOURCEREF)
-                        {
-                            ResourceRef ref = attrElem.GetVariantValue(attr.type_).GetResourceRef();
-                            String name = cache->SanitateResourceName(ref.name_);
-                            bool success = cache->BackgroundLoadResource(ref.type_, name);
-                            if (success)
-                            {
-                                ++asyncProgress_.totalResources_;
-                                asyncProgress_.resources_.Insert(StringHash(name));
-                            }
-                        }
-                        else if (attr.type_ == VAR_RESOURCEREFLIST)
-                        {
-                            ResourceRefList refList = attrElem.GetVariantValue(attr.type_).GetResourceRefList();
-                            for (unsigned k = 0; k < refList.names_.Size(); ++k)
-                            {
-                                String name = cache->SanitateResourceName(refList.names_[k]);
-                                bool success = cache->BackgroundLoadResource(refList.type_, name);
-                                if (success)
-                                {
-                                    ++asyncProgress_.totalResources_;
-                                    asyncProgress_.resources_.Insert(StringHash(name));
-                                }
-                            }
-                        }
-
-                        startIndex = (i + 1) % attributes->Size();
-                        break;
-                    }
-                    else
-                    {
-                        i = (i + 1) % attributes->Size();
-                        --attempts;
-                    }
-                }
-
-                attrElem = attrElem.GetNext("attribute");
-            }
+            const AttributeInfo* attr = FindResourceAttribute(*attributes, attrElem.GetAttribute("name"), startIndex);
+            if (attr)
+                AppendResourceRefs(attrElem.GetVariantValue(attr->type_), dest);
         }
-
-        compElem = compElem.GetNext("component");
     }
 
-    XMLElement childElem = element.GetChild("node");
-    while (childElem)
+    for (XMLElement childElem = element.GetChild("node"); childElem; childElem = childElem.GetNext("node"))
+        GetResourceRefsXML(context, childElem, dest);
+}
+
+void GetResourceRefsJSON(Context* context, const JSONValue& value, Vector<ResourceRef>& dest)
+{
+    // Node or Scene attributes do not include any resources; therefore skip to the components
+    const JSONArray& componentArray = value.Get("components").GetArray();
+    for (unsigned i = 0; i < componentArray.Size(); ++i)
     {
-        PreloadResourcesXML(childElem);
-        childElem = childElem.GetNext("node");
+        const JSONValue& compValue = componentArray[i];
+        const Vector<AttributeInfo>* attributes = context->GetAttributes(StringHash(compValue.Get("type").GetString()));
+        if (!attributes || attributes->Empty())
+            continue;
+
+        const JSONArray& attributesArray = compValue.Get("attributes").GetArray();
+        unsigned startIndex = 0;
+        for (unsigned j = 0; j < attributesArray.Size(); ++j)
+        {
+            const JSONValue& attrVal = attributesArray[j];
+            const AttributeInfo* attr = FindResourceAttribute(*attributes, attrVal.Get("name").GetString(), startIndex);
+            if (attr)
+                AppendResourceRefs(attrVal.Get("value").GetVariantValue(attr->type_), dest);
+        }
     }
-#endif
+
+    const JSONArray& childrenArray = value.Get("children").GetArray();
+    for (unsigned i = 0; i < childrenArray.Size(); ++i)
+        GetResourceRefsJSON(context, childrenArray[i], dest);
 }
 
-void Scene::PreloadResourcesJSON(const JSONValue& value)
+/// Return whether XML node data has object or attribute animations in the node, its components or child nodes.
+static bool HasAnimationsXML(const XMLElement& element)
 {
-    // If not threaded, can not background load resources, so rather load synchronously later when needed
-#ifdef URHO3D_THREADING
-    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    if (element.HasChild("objectanimation") || element.HasChild("attributeanimation"))
+        return true;
 
-    // Node or Scene attributes do not include any resources; therefore skip to the components
-    JSONArray componentArray = value.Get("components").GetArray();
+    for (XMLElement compElem = element.GetChild("component"); compElem; compElem = compElem.GetNext("component"))
+    {
+        if (compElem.HasChild("objectanimation") || compElem.HasChild("attributeanimation"))
+            return true;
+    }
 
-    for (unsigned i = 0; i < componentArray.Size(); i++)
+    for (XMLElement childElem = element.GetChild("node"); childElem; childElem = childElem.GetNext("node"))
     {
-        const JSONValue& compValue = componentArray.At(i);
-        String typeName = compValue.Get("type").GetString();
+        if (HasAnimationsXML(childElem))
+            return true;
+    }
 
-        const Vector<AttributeInfo>* attributes = context_->GetAttributes(StringHash(typeName));
-        if (attributes)
-        {
-            JSONArray attributesArray = compValue.Get("attributes").GetArray();
-
-            unsigned startIndex = 0;
-
-            for (unsigned j = 0; j < attributesArray.Size(); j++)
-            {
-                const JSONValue& attrVal = attributesArray.At(j);
-                String name = attrVal.Get("name").GetString();
-                unsigned i = startIndex;
-                unsigned attempts = attributes->Size();
-
-                while (attempts)
-                {
-                    const AttributeInfo& attr = attributes->At(i);
-                    if ((attr.mode_ & AM_FILE) && !attr.name_.Compare(name, true))
-                    {
-                        if (attr.type_ == VAR_RESOURCEREF)
-                        {
-                            ResourceRef ref = attrVal.Get("value").GetVariantValue(attr.type_).GetResourceRef();
-                            String name = cache->SanitateResourceName(ref.name_);
-                            bool success = cache->BackgroundLoadResource(ref.type_, name);
-                            if (success)
-                            {
-                                ++asyncProgress_.totalResources_;
-                                asyncProgress_.resources_.Insert(StringHash(name));
-                            }
-                        }
-                        else if (attr.type_ == VAR_RESOURCEREFLIST)
-                        {
-                            ResourceRefList refList = attrVal.Get("value").GetVariantValue(attr.type_).GetResourceRefList();
-                            for (unsigned k = 0; k < refList.names_.Size(); ++k)
-                            {
-                                String name = cache->SanitateResourceName(refList.names_[k]);
-                                bool success = cache->BackgroundLoadResource(refList.type_, name);
-                                if (success)
-                                {
-                                    ++asyncProgress_.totalResources_;
-                                    asyncProgress_.resources_.Insert(StringHash(name));
-                                }
-                            }
-                        }
-
-                        startIndex = (i + 1) % attributes->Size();
-                        break;
-                    }
-                    else
-                    {
-                        i = (i + 1) % attributes->Size();
-                        --attempts;
-                    }
-                }
-
-            }
-        }
+    return false;
+}
+
+/// Return whether JSON node data has object or attribute animations in the node, its components or child nodes.
+static bool HasAnimationsJSON(const JSONValue& value)
+{
+    if (!value.Get("objectanimation").IsNull() || !value.Get("attributeanimation").IsNull())
+        return true;
 
+    const JSONArray& componentArray = value.Get("components").GetArray();
+    for (unsigned i = 0; i < componentArray.Size(); ++i)
+    {
+        if (!componentArray[i].Get("objectanimation").IsNull() || !componentArray[i].Get("attributeanimation").IsNull())
+            return true;
     }
 
-    JSONArray childrenArray = value.Get("children").GetArray();
-    for (unsigned i = 0; i < childrenArray.Size(); i++)
+    const JSONArray& childrenArray = value.Get("children").GetArray();
+    for (unsigned i = 0; i < childrenArray.Size(); ++i)
     {
-        const JSONValue& childVal = childrenArray.At(i);
-        PreloadResourcesJSON(childVal);
+        if (HasAnimationsJSON(childrenArray[i]))
+            return true;
     }
-#endif
+
+    return false;
+}
+
+/// Save a node loaded outside any scene as binary data. No scene events are sent, and the node keeps the IDs of the source data.
+static bool SaveDetachedNode(Node* node, SceneResolver& resolver, Serializer& dest)
+{
+    resolver.Resolve();
+    node->ApplyAttributes();
+    return node->Save(dest);
+}
+
+bool ConvertNodeDataXML(Context* context, const XMLElement& source, Serializer& dest)
+{
+    if (HasAnimationsXML(source))
+        return false;
+
+    SharedPtr<Node> node(new Node(context));
+    SceneResolver resolver;
+    unsigned nodeID = source.GetUInt("id");
+    node->SetID(nodeID);
+    resolver.AddNode(nodeID, node);
+    return node->LoadXML(source, resolver, true, false, REPLICATED) && SaveDetachedNode(node, resolver, dest);
+}
+
+bool ConvertNodeDataJSON(Context* context, const JSONValue& source, Serializer& dest)
+{
+    if (HasAnimationsJSON(source))
+        return false;
+
+    SharedPtr<Node> node(new Node(context));
+    SceneResolver resolver;
+    unsigned nodeID = source.Get("id").GetUInt();
+    node->SetID(nodeID);
+    resolver.AddNode(nodeID, node);
+    return node->LoadJSON(source, resolver, true, false, REPLICATED) && SaveDetachedNode(node, resolver, dest);
 }
 
 void RegisterSceneLibrary(Context* context)
 {
     ValueAnimation::RegisterObject(context);
     ObjectAnimation::RegisterObject(context);
+    Prefab::RegisterObject(context);
     Node::RegisterObject(context);
     Scene::RegisterObject(context);
     SmoothedTransform::RegisterObject(context);
     UnknownComponent::RegisterObject(context);
     SplinePath::RegisterObject(context);
+    SceneStreamer::RegisterObject(context);
 }
 
 }
@@ -24,6 +24,7 @@
 
 #include "../Container/HashSet.h"
 #include "../Core/Mutex.h"
+#include "../Core/Timer.h"
 #include "../Resource/XMLElement.h"
 #include "../Resource/JSONFile.h"
 #include "../Scene/Node.h"
@@ -34,6 +35,7 @@ namespace Urho3D
 
 class File;
 class PackageFile;
+class Prefab;
 
 static const unsigned FIRST_REPLICATED_ID = 0x1;
 static const unsigned LAST_REPLICATED_ID = 0xffffff;
@@ -139,6 +141,20 @@ public:
         (const JSONValue& source, const Vector3& position, const Quaternion& rotation, CreateMode mode = REPLICATED);
     /// Instantiate scene content from JSON data. Return root node if successful.
     Node* InstantiateJSON(Deserializer& source, const Vector3& position, const Quaternion& rotation, CreateMode mode = REPLICATED);
+    /// Instantiate scene content from a prefab. Return root node if successful.
+    Node* Instantiate(Prefab* prefab, const Vector3& position, const Quaternion& rotation, CreateMode mode = REPLICATED);
+    /// Instantiate several copies of a prefab, one for each position and rotation. The prefab's data is parsed only once. Return true if successful, and append the root nodes to the destination vector.
+    bool InstantiateBatch(Prefab* prefab, const PODVector<Vector3>& positions, const PODVector<Quaternion>& rotations,
+        PODVector<Node*>& dest, CreateMode mode = REPLICATED);
+    /// Instantiate several copies of scene content from binary data, one for each position and rotation. The source data is read only once. Return true if successful, and append the root nodes to the destination vector.
+    bool InstantiateBatch(Deserializer& source, const PODVector<Vector3>& positions, const PODVector<Quaternion>& rotations,
+        PODVector<Node*>& dest, CreateMode mode = REPLICATED);
+    /// Instantiate several copies of scene content from XML data, one for each position and rotation. Return true if successful, and append the root nodes to the destination vector.
+    bool InstantiateBatchXML(const XMLElement& source, const PODVector<Vector3>& positions, const PODVector<Quaternion>& rotations,
+        PODVector<Node*>& dest, CreateMode mode = REPLICATED);
+    /// Instantiate several copies of scene content from JSON data, one for each position and rotation. Return true if successful, and append the root nodes to the destination vector.
+    bool InstantiateBatchJSON(const JSONValue& source, const PODVector<Vector3>& positions, const PODVector<Quaternion>& rotations,
+        PODVector<Node*>& dest, CreateMode mode = REPLICATED);
 
     /// Clear scene completely of either replicated, local or all nodes and components.
     void Clear(bool clearReplicated = true, bool clearLocal = true);
@@ -164,6 +180,8 @@ public:
     void UnregisterVar(const String& name);
     /// Clear all registered node user variable hash reverse mappings.
     void UnregisterAllVars();
+    /// Set whether to keep the node world transforms in contiguous parent-before-child storage and recalculate the dirty ones in one linear pass before the octree update, instead of lazily on access.
+    void SetLinearTransformUpdate(bool enable);
 
     /// Return node from the whole scene by ID, or null if not found.
     Node* GetNode(unsigned id) const;
@@ -205,6 +223,12 @@ public:
     /// Return maximum milliseconds per frame to spend on async loading.
     int GetAsyncLoadingMs() const { return asyncLoadingMs_; }
 
+    /// Return whether linear world transform update is enabled.
+    bool GetLinearTransformUpdate() const { return linearTransformUpdate_; }
+
+    /// Return whether the time spent on async loading during the current scene update exceeds the limit. Used to share the time budget with other time-sliced loading, such as scene streaming.
+    bool IsAsyncLoadingTimeExceeded() const { return asyncLoadTimer_.GetUSec(false) >= asyncLoadingMs_ * 1000; }
+
     /// Return required package files.
     const Vector<SharedPtr<PackageFile> >& GetRequiredPackageFiles() const { return requiredPackageFiles_; }
 
@@ -219,10 +243,15 @@ public:
     void EndThreadedUpdate();
     /// Add a component to the delayed dirty notify queue. Is thread-safe.
     void DelayedMarkedDirty(Component* component);
+    /// Recalculate the dirty world transforms in parent-before-child order. Called by Octree when linear transform update is enabled.
+    void UpdateTransforms();
 
     /// Return threaded update flag.
     bool IsThreadedUpdate() const { return threadedUpdate_; }
 
+    /// Return whether a batch instantiation is loading content. During it drawables defer their octree insertion to the next octree update.
+    bool IsBatchInstantiating() const { return batchInstantiating_; }
+
     /// Get free node ID, either non-local or local.
     unsigned GetFreeNodeID(CreateMode mode);
     /// Get free component ID, either non-local or local.
@@ -237,6 +266,8 @@ public:
     void NodeAdded(Node* node);
     /// Node removed. Remove from ID map.
     void NodeRemoved(Node* node);
+    /// Node added or reparented. Add to the transform store, or reorder it there.
+    void NodeParentChanged(Node* node);
     /// Component added. Add to ID map.
     void ComponentAdded(Component* component);
     /// Component removed. Remove from ID map.
@@ -275,6 +306,13 @@ private:
     void PreloadResourcesXML(const XMLElement& element);
     /// Preload resources from a JSON scene or object prefab file.
     void PreloadResourcesJSON(const JSONValue& value);
+    /// Request background loading of resources found in a scene or object prefab file.
+    void PreloadResourceRefs(const Vector<ResourceRef>& refs);
+    /// Instantiate copies of binary node data for the positions that do not have a copy in the destination vector yet. On failure remove all copies from the start index. Return true if successful.
+    bool InstantiateCopies(const PODVector<unsigned char>& data, const PODVector<Vector3>& positions,
+        const PODVector<Quaternion>& rotations, PODVector<Node*>& dest, unsigned destStart, CreateMode mode);
+    /// Reserve free node and component IDs for further copies of an instantiated node hierarchy.
+    void ReserveIDs(Node* copy, unsigned numCopies);
 
     /// Replicated scene nodes by ID.
     HashMap<unsigned, Node*> replicatedNodes_;
@@ -304,6 +342,8 @@ private:
     PODVector<Component*> delayedDirtyComponents_;
     /// Mutex for the delayed dirty notification queue.
     Mutex sceneMutex_;
+    /// Node world transforms for linear transform update.
+    TransformStore nodeTransforms_;
     /// Preallocated event data map for smoothing update events.
     VariantMap smoothingData_;
     /// Next free non-local node ID.
@@ -314,10 +354,20 @@ private:
     unsigned localNodeID_;
     /// Next free local component ID.
     unsigned localComponentID_;
+    /// Number of free non-local node IDs reserved for batch instantiation.
+    unsigned reservedReplicatedNodeIDs_;
+    /// Number of free local node IDs reserved for batch instantiation.
+    unsigned reservedLocalNodeIDs_;
+    /// Number of free non-local component IDs reserved for batch instantiation.
+    unsigned reservedReplicatedComponentIDs_;
+    /// Number of free local component IDs reserved for batch instantiation.
+    unsigned reservedLocalComponentIDs_;
     /// Scene source file checksum.
     mutable unsigned checksum_;
     /// Maximum milliseconds per frame to spend on async scene loading.
     int asyncLoadingMs_;
+    /// Timer for the async loading time of the current scene update.
+    mutable HiresTimer asyncLoadTimer_;
     /// Scene update time scale.
     float timeScale_;
     /// Elapsed time accumulator.
@@ -332,8 +382,22 @@ private:
     bool asyncLoading_;
     /// Threaded update flag.
     bool threadedUpdate_;
+    /// Linear transform update flag.
+    bool linearTransformUpdate_;
+    /// Batch instantiation flag.
+    bool batchInstantiating_;
 };
 
+/// Collect resources referred to by the components of binary scene or node data, which starts from the node ID. Return false if the data ends prematurely.
+bool URHO3D_API GetResourceRefs(Context* context, Deserializer& source, StringHash nodeType, Vector<ResourceRef>& dest);
+/// Collect resources referred to by the components of XML scene or node data.
+void URHO3D_API GetResourceRefsXML(Context* context, const XMLElement& element, Vector<ResourceRef>& dest);
+/// Collect resources referred to by the components of JSON scene or node data.
+void URHO3D_API GetResourceRefsJSON(Context* context, const JSONValue& value, Vector<ResourceRef>& dest);
+/// Convert XML node data to binary node data without instantiating it into a scene. Return false if the data is invalid, or has object or attribute animations, which binary node data does not hold.
+bool URHO3D_API ConvertNodeDataXML(Context* context, const XMLElement& source, Serializer& dest);
+/// Convert JSON node data to binary node data without instantiating it into a scene. Return false if the data is invalid, or has object or attribute animations, which binary node data does not hold.
+bool URHO3D_API ConvertNodeDataJSON(Context* context, const JSONValue& source, Serializer& dest);
 /// Register Scene library objects.
 void URHO3D_API RegisterSceneLibrary(Context* context);
 
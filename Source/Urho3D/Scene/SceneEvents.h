@@ -110,6 +110,22 @@ URHO3D_EVENT(E_ASYNCLOADFINISHED, AsyncLoadFinished)
     URHO3D_PARAM(P_SCENE, Scene);                  // Scene pointer
 };
 
+/// Streamed scene cell has finished loading.
+URHO3D_EVENT(E_STREAMINGCELLLOADED, StreamingCellLoaded)
+{
+    URHO3D_PARAM(P_SCENE, Scene);                  // Scene pointer
+    URHO3D_PARAM(P_CELL, Cell);                    // IntVector2
+    URHO3D_PARAM(P_NODE, Node);                    // Node pointer
+};
+
+/// Streamed scene cell has been unloaded. The root node has already been removed from the scene.
+URHO3D_EVENT(E_STREAMINGCELLUNLOADED, StreamingCellUnloaded)
+{
+    URHO3D_PARAM(P_SCENE, Scene);                  // Scene pointer
+    URHO3D_PARAM(P_CELL, Cell);                    // IntVector2
+    URHO3D_PARAM(P_NODE, Node);                    // Node pointer
+};
+
 /// A child node has been added to a parent node.
 URHO3D_EVENT(E_NODEADDED, NodeAdded)
 {
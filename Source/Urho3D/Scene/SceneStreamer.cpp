@@ -0,0 +1,654 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Container/Sort.h"
+#include "../Core/Context.h"
+#include "../Core/Profiler.h"
+#include "../IO/File.h"
+#include "../IO/Log.h"
+#include "../IO/MemoryBuffer.h"
+#include "../Resource/ResourceCache.h"
+#include "../Resource/ResourceEvents.h"
+#include "../Scene/Prefab.h"
+#include "../Scene/Scene.h"
+#include "../Scene/SceneEvents.h"
+#include "../Scene/SceneStreamer.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+extern const char* SUBSYSTEM_CATEGORY;
+
+static const float DEFAULT_CELL_SIZE = 100.0f;
+static const float DEFAULT_LOAD_DISTANCE = 200.0f;
+static const float DEFAULT_UNLOAD_DISTANCE = 250.0f;
+static const unsigned MAX_LOADING_CELLS = 4;
+
+/// Cell that is a candidate for loading.
+struct CellCandidate
+{
+    /// Cell coordinates.
+    IntVector2 coords_;
+    /// Distance to the nearest observer.
+    float distance_;
+};
+
+static bool CompareCellCandidates(const CellCandidate& lhs, const CellCandidate& rhs)
+{
+    return lhs.distance_ < rhs.distance_;
+}
+
+SceneStreamer::SceneStreamer(Context* context) :
+    Component(context),
+    cellSize_(DEFAULT_CELL_SIZE),
+    loadDistance_(DEFAULT_LOAD_DISTANCE),
+    unloadDistance_(DEFAULT_UNLOAD_DISTANCE),
+    memoryBudget_(0),
+    memoryUse_(0)
+{
+    // Remains subscribed without a scene, so that content loading for unloaded cells can be tracked until it finishes
+    SubscribeToEvent(E_RESOURCEBACKGROUNDLOADED, URHO3D_HANDLER(SceneStreamer, HandleResourceBackgroundLoaded));
+}
+
+SceneStreamer::~SceneStreamer()
+{
+    ReleaseCancelledLoads();
+}
+
+void SceneStreamer::RegisterObject(Context* context)
+{
+    context->RegisterFactory<SceneStreamer>(SUBSYSTEM_CATEGORY);
+
+    URHO3D_ACCESSOR_ATTRIBUTE("Is Enabled", IsEnabled, SetEnabled, bool, true, AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Cell Prefix", GetCellPrefix, SetCellPrefix, String, String::EMPTY, AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Cell Size", GetCellSize, SetCellSize, float, DEFAULT_CELL_SIZE, AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Load Distance", GetLoadDistance, SetLoadDistance, float, DEFAULT_LOAD_DISTANCE, AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Unload Distance", GetUnloadDistance, SetUnloadDistance, float, DEFAULT_UNLOAD_DISTANCE, AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Memory Budget", GetMemoryBudget, SetMemoryBudget, unsigned, 0, AM_DEFAULT);
+}
+
+void SceneStreamer::SetCellSize(float size)
+{
+    size = Max(size, M_EPSILON);
+    if (size != cellSize_)
+    {
+        UnloadAllCells();
+        cellSize_ = size;
+        MarkNetworkUpdate();
+    }
+}
+
+void SceneStreamer::SetLoadDistance(float distance)
+{
+    loadDistance_ = Max(distance, 0.0f);
+    MarkNetworkUpdate();
+}
+
+void SceneStreamer::SetUnloadDistance(float distance)
+{
+    unloadDistance_ = Max(distance, 0.0f);
+    MarkNetworkUpdate();
+}
+
+void SceneStreamer::SetMemoryBudget(unsigned bytes)
+{
+    memoryBudget_ = bytes;
+    MarkNetworkUpdate();
+}
+
+void SceneStreamer::SetCellPrefix(const String& prefix)
+{
+    if (prefix != cellPrefix_)
+    {
+        UnloadAllCells();
+        cellPrefix_ = prefix;
+        MarkNetworkUpdate();
+    }
+}
+
+void SceneStreamer::AddObserver(Node* node)
+{
+    if (!node)
+        return;
+
+    WeakPtr<Node> nodeWeak(node);
+    if (!observers_.Contains(nodeWeak))
+        observers_.Push(nodeWeak);
+}
+
+void SceneStreamer::RemoveObserver(Node* node)
+{
+    observers_.Remove(WeakPtr<Node>(node));
+}
+
+void SceneStreamer::RemoveAllObservers()
+{
+    observers_.Clear();
+}
+
+void SceneStreamer::UnloadAllCells()
+{
+    for (HashMap<IntVector2, StreamingCell>::Iterator i = cells_.Begin(); i != cells_.End(); ++i)
+        UnloadCell(i->second_);
+
+    cells_.Clear();
+    memoryUse_ = 0;
+
+    SendUnloadedEvents();
+}
+
+bool SceneStreamer::SaveCells(const PODVector<Node*>& nodes, const String& filePrefix)
+{
+    URHO3D_PROFILE(SaveStreamingCells);
+
+    Scene* scene = GetScene();
+    if (!scene)
+    {
+        URHO3D_LOGERROR("Can not save streaming cells without a scene");
+        return false;
+    }
+
+    HashMap<IntVector2, PODVector<Node*> > cellNodes;
+    for (unsigned i = 0; i < nodes.Size(); ++i)
+    {
+        Node* node = nodes[i];
+        if (!node || node->GetParent() != scene)
+        {
+            URHO3D_LOGWARNING("Skipping node which is not a root-level node of the scene");
+            continue;
+        }
+
+        cellNodes[GetCellCoords(node->GetWorldPosition())].Push(node);
+    }
+
+    for (HashMap<IntVector2, PODVector<Node*> >::ConstIterator i = cellNodes.Begin(); i != cellNodes.End(); ++i)
+    {
+        // Temporarily parent the nodes to a cell root node at the origin to save them; world transforms are retained
+        Node* cellNode = scene->CreateChild("Cell " + i->first_.ToString(), LOCAL);
+        const PODVector<Node*>& children = i->second_;
+        for (unsigned j = 0; j < children.Size(); ++j)
+            children[j]->SetParent(cellNode);
+
+        String fileName = filePrefix + String(i->first_.x_) + "_" + String(i->first_.y_) + ".bin";
+        File file(context_, fileName, FILE_WRITE);
+        bool success = file.IsOpen() && cellNode->Save(file);
+
+        for (unsigned j = 0; j < children.Size(); ++j)
+            children[j]->SetParent(scene);
+        cellNode->Remove();
+
+        if (!success)
+        {
+            URHO3D_LOGERROR("Failed to save streaming cell " + fileName);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+unsigned SceneStreamer::GetNumLoadedCells() const
+{
+    unsigned num = 0;
+    for (HashMap<IntVector2, StreamingCell>::ConstIterator i = cells_.Begin(); i != cells_.End(); ++i)
+    {
+        if (i->second_.state_ == CELL_LOADED)
+            ++num;
+    }
+    return num;
+}
+
+bool SceneStreamer::IsCellLoaded(const IntVector2& coords) const
+{
+    HashMap<IntVector2, StreamingCell>::ConstIterator i = cells_.Find(coords);
+    return i != cells_.End() && i->second_.state_ == CELL_LOADED;
+}
+
+Node* SceneStreamer::GetCellNode(const IntVector2& coords) const
+{
+    HashMap<IntVector2, StreamingCell>::ConstIterator i = cells_.Find(coords);
+    return (i != cells_.End() && i->second_.state_ == CELL_LOADED) ? i->second_.node_.Get() : (Node*)0;
+}
+
+IntVector2 SceneStreamer::GetCellCoords(const Vector3& position) const
+{
+    return IntVector2((int)floorf(position.x_ / cellSize_), (int)floorf(position.z_ / cellSize_));
+}
+
+String SceneStreamer::GetCellName(const IntVector2& coords) const
+{
+    return cellPrefix_ + String(coords.x_) + "_" + String(coords.y_) + ".bin";
+}
+
+void SceneStreamer::OnSceneSet(Scene* scene)
+{
+    if (scene)
+        SubscribeToEvent(scene, E_SCENEUPDATE, URHO3D_HANDLER(SceneStreamer, HandleSceneUpdate));
+    else
+    {
+        UnsubscribeFromEvent(E_SCENEUPDATE);
+        UnloadAllCells();
+    }
+}
+
+void SceneStreamer::HandleSceneUpdate(StringHash eventType, VariantMap& eventData)
+{
+    ReleaseCancelledLoads();
+
+    if (!IsEnabledEffective())
+        return;
+
+    UpdateCells();
+    UpdateInstantiation();
+}
+
+void SceneStreamer::HandleResourceBackgroundLoaded(StringHash eventType, VariantMap& eventData)
+{
+    using namespace ResourceBackgroundLoaded;
+
+    const String& name = eventData[P_RESOURCENAME].GetString();
+    StringHash nameHash(name);
+    for (HashMap<IntVector2, StreamingCell>::Iterator i = cells_.Begin(); i != cells_.End(); ++i)
+    {
+        StreamingCell& cell = i->second_;
+        if (cell.state_ != CELL_LOADING || cell.nameHash_ != nameHash)
+            continue;
+
+        // The cell may have been unloaded and loaded again while its content was loading
+        cancelledLoads_.Erase(nameHash);
+
+        Resource* resource = static_cast<Resource*>(eventData[P_RESOURCE].GetPtr());
+        if (eventData[P_SUCCESS].GetBool() && resource && resource->IsInstanceOf<Prefab>())
+            BeginInstantiation(cell, static_cast<Prefab*>(resource));
+        else
+            cell.state_ = CELL_FAILED;
+        return;
+    }
+
+    // The cell was unloaded while its content was loading. The resource cache stores the content only after this event,
+    // so release it on the next update
+    if (cancelledLoads_.Erase(nameHash))
+        pendingReleases_.Push(name);
+}
+
+void SceneStreamer::UpdateCells()
+{
+    URHO3D_PROFILE(UpdateStreamingCells);
+
+    PODVector<Vector3> observerPositions;
+    for (unsigned i = observers_.Size() - 1; i < observers_.Size(); --i)
+    {
+        if (observers_[i])
+            observerPositions.Push(observers_[i]->GetWorldPosition());
+        else
+            observers_.Erase(i);
+    }
+
+    // Unload cells that are beyond the unload distance from all observers
+    unsigned numLoadingCells = 0;
+    for (HashMap<IntVector2, StreamingCell>::Iterator i = cells_.Begin(); i != cells_.End();)
+    {
+        StreamingCell& cell = i->second_;
+        cell.distance_ = GetCellDistance(cell.coords_, observerPositions);
+        if (cell.distance_ > unloadDistance_)
+        {
+            UnloadCell(cell);
+            i = cells_.Erase(i);
+        }
+        else
+        {
+            if (cell.state_ == CELL_LOADING)
+                ++numLoadingCells;
+            ++i;
+        }
+    }
+
+    // If over the memory budget, unload the farthest cells, but always keep at least one
+    while (memoryBudget_ && memoryUse_ > memoryBudget_)
+    {
+        HashMap<IntVector2, StreamingCell>::Iterator farthest = cells_.End();
+        unsigned numCells = 0;
+        for (HashMap<IntVector2, StreamingCell>::Iterator i = cells_.Begin(); i != cells_.End(); ++i)
+        {
+            if (!i->second_.prefab_)
+                continue;
+            ++numCells;
+            if (farthest == cells_.End() || i->second_.distance_ > farthest->second_.distance_)
+                farthest = i;
+        }
+        if (numCells < 2)
+            break;
+
+        UnloadCell(farthest->second_);
+        cells_.Erase(farthest);
+    }
+
+    // Find the cells within load distance which are not loaded yet, and load the nearest first
+    PODVector<CellCandidate> candidates;
+    for (unsigned i = 0; i < observerPositions.Size(); ++i)
+    {
+        const Vector3& position = observerPositions[i];
+        IntVector2 minCoords = GetCellCoords(position - Vector3(loadDistance_, 0.0f, loadDistance_));
+        IntVector2 maxCoords = GetCellCoords(position + Vector3(loadDistance_, 0.0f, loadDistance_));
+
+        for (int y = minCoords.y_; y <= maxCoords.y_; ++y)
+        {
+            for (int x = minCoords.x_; x <= maxCoords.x_; ++x)
+            {
+                CellCandidate candidate;
+                candidate.coords_ = IntVector2(x, y);
+                if (cells_.Contains(candidate.coords_))
+                    continue;
+
+                candidate.distance_ = GetCellDistance(candidate.coords_, observerPositions);
+                if (candidate.distance_ > loadDistance_)
+                    continue;
+
+                bool found = false;
+                for (unsigned j = 0; j < candidates.Size(); ++j)
+                {
+                    if (candidates[j].coords_ == candidate.coords_)
+                    {
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found)
+                    candidates.Push(candidate);
+            }
+        }
+    }
+
+    Sort(candidates.Begin(), candidates.End(), CompareCellCandidates);
+
+    for (unsigned i = 0; i < candidates.Size() && numLoadingCells < MAX_LOADING_CELLS; ++i)
+    {
+        const CellCandidate& candidate = candidates[i];
+
+        // When the memory budget is full, a cell can only be loaded in place of a farther cell
+        if (memoryBudget_ && memoryUse_ >= memoryBudget_)
+        {
+            HashMap<IntVector2, StreamingCell>::Iterator farthest = cells_.End();
+            for (HashMap<IntVector2, StreamingCell>::Iterator j = cells_.Begin(); j != cells_.End(); ++j)
+            {
+                if (j->second_.prefab_ && j->second_.distance_ > candidate.distance_ &&
+                    (farthest == cells_.End() || j->second_.distance_ > farthest->second_.distance_))
+                    farthest = j;
+            }
+            if (farthest == cells_.End())
+                break;
+
+            UnloadCell(farthest->second_);
+            cells_.Erase(farthest);
+        }
+
+        StreamingCell& cell = cells_[candidate.coords_];
+        cell.coords_ = candidate.coords_;
+        cell.distance_ = candidate.distance_;
+        LoadCell(cell);
+        if (cell.state_ == CELL_LOADING)
+            ++numLoadingCells;
+    }
+
+    SendUnloadedEvents();
+}
+
+void SceneStreamer::UpdateInstantiation()
+{
+    URHO3D_PROFILE(InstantiateStreamingCells);
+
+    Scene* scene = GetScene();
+    PODVector<IntVector2> finishedCells;
+    bool timeExceeded = false;
+
+    for (HashMap<IntVector2, StreamingCell>::Iterator i = cells_.Begin(); i != cells_.End() && !timeExceeded; ++i)
+    {
+        StreamingCell& cell = i->second_;
+        if (cell.state_ != CELL_INSTANTIATING)
+            continue;
+
+        Node* cellNode = cell.node_;
+        if (!cellNode)
+        {
+            // The cell root node was removed from outside
+            UnloadCell(cell);
+            cell.state_ = CELL_EMPTY;
+            continue;
+        }
+
+        // Load one root-level child node with its full sub-hierarchy at a time, sharing the time budget of Scene::LoadAsync()
+        MemoryBuffer buffer(cell.prefab_->GetData());
+        buffer.Seek(cell.position_);
+        bool success = true;
+
+        while (cell.loadedChildren_ < cell.totalChildren_)
+        {
+            unsigned nodeID = buffer.ReadUInt();
+            Node* newNode = cellNode->CreateChild(String::EMPTY, LOCAL);
+            cell.resolver_.AddNode(nodeID, newNode);
+            if (!newNode->Load(buffer, cell.resolver_, true, true, LOCAL))
+            {
+                newNode->Remove();
+                success = false;
+                break;
+            }
+            ++cell.loadedChildren_;
+
+            if (scene->IsAsyncLoadingTimeExceeded())
+            {
+                timeExceeded = true;
+                break;
+            }
+        }
+
+        if (!success)
+        {
+            URHO3D_LOGERROR("Failed to load streaming cell " + cell.prefab_->GetName());
+            UnloadCell(cell);
+            cell.state_ = CELL_FAILED;
+            continue;
+        }
+
+        cell.position_ = buffer.GetPosition();
+
+        if (cell.loadedChildren_ >= cell.totalChildren_)
+        {
+            cell.resolver_.Resolve();
+            cell.resolver_.Reset();
+            cellNode->ApplyAttributes();
+            cell.state_ = CELL_LOADED;
+            finishedCells.Push(cell.coords_);
+        }
+    }
+
+    // Send the events last, as the event handlers may load or unload cells
+    SendUnloadedEvents();
+
+    for (unsigned i = 0; i < finishedCells.Size(); ++i)
+    {
+        Node* cellNode = GetCellNode(finishedCells[i]);
+        if (!cellNode)
+            continue;
+
+        using namespace StreamingCellLoaded;
+
+        VariantMap& eventData = GetEventDataMap();
+        eventData[P_SCENE] = scene;
+        eventData[P_CELL] = finishedCells[i];
+        eventData[P_NODE] = cellNode;
+        SendEvent(E_STREAMINGCELLLOADED, eventData);
+    }
+}
+
+void SceneStreamer::LoadCell(StreamingCell& cell)
+{
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    String name = cache->SanitateResourceName(GetCellName(cell.coords_));
+    cell.nameHash_ = name;
+
+    if (!cache->Exists(name))
+    {
+        cell.state_ = CELL_EMPTY;
+        return;
+    }
+
+    cell.state_ = CELL_LOADING;
+
+    // Load the cell content and the resources it refers to in the background. If threading is not supported, the load
+    // happens immediately
+    Prefab* prefab = cache->GetExistingResource<Prefab>(name);
+    if (!prefab)
+    {
+        cache->BackgroundLoadResource<Prefab>(name);
+        prefab = cache->GetExistingResource<Prefab>(name);
+    }
+
+    if (prefab)
+        BeginInstantiation(cell, prefab);
+}
+
+void SceneStreamer::BeginInstantiation(StreamingCell& cell, Prefab* prefab)
+{
+    cell.prefab_ = prefab;
+    memoryUse_ += prefab->GetMemoryUse();
+
+    if (prefab->GetData().Empty())
+    {
+        cell.state_ = CELL_EMPTY;
+        return;
+    }
+
+    MemoryBuffer buffer(prefab->GetData());
+    unsigned nodeID = buffer.ReadUInt();
+
+    // Create the cell root node and load its own attributes and components. The child nodes are loaded in the updates
+    Node* cellNode = GetScene()->CreateChild(String::EMPTY, LOCAL);
+    cell.resolver_.Reset();
+    cell.resolver_.AddNode(nodeID, cellNode);
+    if (!cellNode->Load(buffer, cell.resolver_, false, true, LOCAL))
+    {
+        URHO3D_LOGERROR("Failed to load streaming cell " + prefab->GetName());
+        cellNode->Remove();
+        cell.resolver_.Reset();
+        cell.state_ = CELL_FAILED;
+        return;
+    }
+
+    // Streamed content should not be saved with the scene
+    cellNode->SetTemporary(true);
+
+    cell.node_ = cellNode;
+    cell.totalChildren_ = buffer.ReadVLE();
+    cell.loadedChildren_ = 0;
+    cell.position_ = buffer.GetPosition();
+    cell.state_ = CELL_INSTANTIATING;
+}
+
+void SceneStreamer::UnloadCell(StreamingCell& cell)
+{
+    // If the content is still loading in the background, it can only be released from the resource cache once loaded
+    if (cell.state_ == CELL_LOADING)
+        cancelledLoads_.Insert(cell.nameHash_);
+
+    if (cell.node_)
+    {
+        // Keep the removed root node alive until the unload event has been sent
+        if (cell.state_ == CELL_LOADED)
+            unloadedCells_.Push(MakePair(cell.coords_, SharedPtr<Node>(cell.node_)));
+
+        cell.node_->Remove();
+        cell.node_.Reset();
+    }
+
+    if (cell.prefab_)
+    {
+        memoryUse_ -= cell.prefab_->GetMemoryUse();
+
+        // Release the cell content from the resource cache unless it is used elsewhere
+        String name = cell.prefab_->GetName();
+        cell.prefab_.Reset();
+        ResourceCache* cache = GetSubsystem<ResourceCache>();
+        if (cache)
+            cache->ReleaseResource(Prefab::GetTypeStatic(), name);
+    }
+
+    cell.resolver_.Reset();
+    cell.state_ = CELL_UNLOADED;
+}
+
+void SceneStreamer::SendUnloadedEvents()
+{
+    // Event handlers may unload further cells, which are appended and sent in the same loop
+    for (unsigned i = 0; i < unloadedCells_.Size(); ++i)
+    {
+        IntVector2 coords = unloadedCells_[i].first_;
+        SharedPtr<Node> cellNode = unloadedCells_[i].second_;
+
+        using namespace StreamingCellUnloaded;
+
+        VariantMap& eventData = GetEventDataMap();
+        eventData[P_SCENE] = GetScene();
+        eventData[P_CELL] = coords;
+        eventData[P_NODE] = cellNode.Get();
+        SendEvent(E_STREAMINGCELLUNLOADED, eventData);
+    }
+
+    unloadedCells_.Clear();
+}
+
+void SceneStreamer::ReleaseCancelledLoads()
+{
+    if (pendingReleases_.Empty())
+        return;
+
+    // Content which is in use again by a cell loaded in the meanwhile is not released, as other references to it exist
+    ResourceCache* cache = GetSubsystem<ResourceCache>();
+    for (unsigned i = 0; cache && i < pendingReleases_.Size(); ++i)
+        cache->ReleaseResource(Prefab::GetTypeStatic(), pendingReleases_[i]);
+
+    pendingReleases_.Clear();
+}
+
+float SceneStreamer::GetCellDistance(const IntVector2& coords, const PODVector<Vector3>& observerPositions) const
+{
+    float minX = coords.x_ * cellSize_;
+    float minZ = coords.y_ * cellSize_;
+    float maxX = minX + cellSize_;
+    float maxZ = minZ + cellSize_;
+    float distance = M_INFINITY;
+
+    for (unsigned i = 0; i < observerPositions.Size(); ++i)
+    {
+        const Vector3& position = observerPositions[i];
+        float dx = Max(Max(minX - position.x_, position.x_ - maxX), 0.0f);
+        float dz = Max(Max(minZ - position.z_, position.z_ - maxZ), 0.0f);
+        distance = Min(distance, sqrtf(dx * dx + dz * dz));
+    }
+
+    return distance;
+}
+
+}
@@ -0,0 +1,196 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Container/HashSet.h"
+#include "../Scene/Component.h"
+#include "../Scene/SceneResolver.h"
+
+namespace Urho3D
+{
+
+class Prefab;
+
+/// Streaming cell state.
+enum StreamingCellState
+{
+    CELL_UNLOADED = 0,
+    CELL_LOADING,
+    CELL_INSTANTIATING,
+    CELL_LOADED,
+    CELL_EMPTY,
+    CELL_FAILED
+};
+
+/// Spatial cell of a streamed scene.
+struct StreamingCell
+{
+    /// Construct.
+    StreamingCell() :
+        state_(CELL_UNLOADED),
+        position_(0),
+        loadedChildren_(0),
+        totalChildren_(0),
+        distance_(0.0f)
+    {
+    }
+
+    /// Cell coordinates.
+    IntVector2 coords_;
+    /// Cell resource name hash.
+    StringHash nameHash_;
+    /// Loading state.
+    StreamingCellState state_;
+    /// Cell content.
+    SharedPtr<Prefab> prefab_;
+    /// Root node of the instantiated content.
+    WeakPtr<Node> node_;
+    /// Scene resolver used during instantiation.
+    SceneResolver resolver_;
+    /// Read position in the content data during instantiation.
+    unsigned position_;
+    /// Instantiated root-level child nodes.
+    unsigned loadedChildren_;
+    /// Total root-level child nodes.
+    unsigned totalChildren_;
+    /// Distance to the nearest observer.
+    float distance_;
+};
+
+/// %Scene streaming component. Loads and unloads spatial cells of the scene, stored as separate binary files, around observer nodes. Cells are square on the XZ plane. Should be created into the root scene node.
+class URHO3D_API SceneStreamer : public Component
+{
+    URHO3D_OBJECT(SceneStreamer, Component);
+
+public:
+    /// Construct.
+    SceneStreamer(Context* context);
+    /// Destruct.
+    virtual ~SceneStreamer();
+    /// Register object factory.
+    static void RegisterObject(Context* context);
+
+    /// Set cell size. Unloads all cells.
+    void SetCellSize(float size);
+    /// Set distance from an observer within which cells are loaded.
+    void SetLoadDistance(float distance);
+    /// Set distance from all observers beyond which cells are unloaded. Should be larger than the load distance to avoid cells being repeatedly loaded and unloaded.
+    void SetUnloadDistance(float distance);
+    /// Set memory budget for the binary data of loaded cells in bytes. 0 is unlimited. The memory used by the instantiated nodes and components is not counted.
+    void SetMemoryBudget(unsigned bytes);
+    /// Set resource name prefix of the cell files. The cell coordinates and the extension are appended, for example "Cells/World_" becomes "Cells/World_2_-1.bin". Unloads all cells.
+    void SetCellPrefix(const String& prefix);
+    /// Add an observer node.
+    void AddObserver(Node* node);
+    /// Remove an observer node.
+    void RemoveObserver(Node* node);
+    /// Remove all observer nodes.
+    void RemoveAllObservers();
+    /// Unload all cells.
+    void UnloadAllCells();
+    /// Partition root-level nodes into cells by their world position and save each cell to a binary file named with the given file name prefix. Saving modifies the scene node order. Return true if successful.
+    bool SaveCells(const PODVector<Node*>& nodes, const String& filePrefix);
+
+    /// Return cell size.
+    float GetCellSize() const { return cellSize_; }
+
+    /// Return load distance.
+    float GetLoadDistance() const { return loadDistance_; }
+
+    /// Return unload distance.
+    float GetUnloadDistance() const { return unloadDistance_; }
+
+    /// Return memory budget.
+    unsigned GetMemoryBudget() const { return memoryBudget_; }
+
+    /// Return cell resource name prefix.
+    const String& GetCellPrefix() const { return cellPrefix_; }
+
+    /// Return number of observers.
+    unsigned GetNumObservers() const { return observers_.Size(); }
+
+    /// Return memory use of the binary data of loaded cells.
+    unsigned GetMemoryUse() const { return memoryUse_; }
+
+    /// Return number of fully loaded cells.
+    unsigned GetNumLoadedCells() const;
+    /// Return whether a cell is fully loaded.
+    bool IsCellLoaded(const IntVector2& coords) const;
+    /// Return root node of a loaded cell, or null if not loaded.
+    Node* GetCellNode(const IntVector2& coords) const;
+    /// Return cell coordinates for a world position.
+    IntVector2 GetCellCoords(const Vector3& position) const;
+    /// Return resource name of a cell.
+    String GetCellName(const IntVector2& coords) const;
+
+protected:
+    /// Handle scene being assigned.
+    virtual void OnSceneSet(Scene* scene);
+
+private:
+    /// Handle scene update event.
+    void HandleSceneUpdate(StringHash eventType, VariantMap& eventData);
+    /// Handle background resource loading finishing.
+    void HandleResourceBackgroundLoaded(StringHash eventType, VariantMap& eventData);
+    /// Decide which cells to load and unload based on the observer positions.
+    void UpdateCells();
+    /// Continue instantiating cells within the scene's async loading time budget.
+    void UpdateInstantiation();
+    /// Start loading a cell.
+    void LoadCell(StreamingCell& cell);
+    /// Start instantiating a cell whose content has been loaded.
+    void BeginInstantiation(StreamingCell& cell, Prefab* prefab);
+    /// Unload a cell.
+    void UnloadCell(StreamingCell& cell);
+    /// Send the events of cells unloaded since the last call. Called after the cells have been iterated, as the event handlers may load or unload cells.
+    void SendUnloadedEvents();
+    /// Release cell content which finished loading after the cell was unloaded.
+    void ReleaseCancelledLoads();
+    /// Return distance from the nearest observer to a cell.
+    float GetCellDistance(const IntVector2& coords, const PODVector<Vector3>& observerPositions) const;
+
+    /// Cells that are loading, loaded, known to be empty, or failed to load.
+    HashMap<IntVector2, StreamingCell> cells_;
+    /// Name hashes of cell content which is still loading in the background after the cell was unloaded.
+    HashSet<StringHash> cancelledLoads_;
+    /// Names of cell content which finished loading after the cell was unloaded, to be released from the resource cache.
+    Vector<String> pendingReleases_;
+    /// Coordinates and removed root nodes of loaded cells which have been unloaded, for sending the unload events.
+    Vector<Pair<IntVector2, SharedPtr<Node> > > unloadedCells_;
+    /// Observer nodes.
+    Vector<WeakPtr<Node> > observers_;
+    /// Cell resource name prefix.
+    String cellPrefix_;
+    /// Cell size.
+    float cellSize_;
+    /// Load distance.
+    float loadDistance_;
+    /// Unload distance.
+    float unloadDistance_;
+    /// Memory budget.
+    unsigned memoryBudget_;
+    /// Memory use of loaded cells.
+    unsigned memoryUse_;
+};
+
+}
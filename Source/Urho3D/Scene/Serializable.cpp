@@ -55,6 +55,248 @@ static unsigned RemapAttributeIndex(const Vector<AttributeInfo>* attributes, con
     return netAttrIndex; // Could not remap
 }
 
+void AttributeAccessor::Read(Serializable* ptr, const AttributeInfo& attr, Deserializer& source)
+{
+    Set(ptr, source.ReadVariant(attr.type_));
+}
+
+bool AttributeAccessor::Write(const Serializable* ptr, const AttributeInfo& attr, Serializer& dest) const
+{
+    Variant value;
+    Get(ptr, value);
+    return dest.WriteVariantData(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, int value)
+{
+    return dest.WriteInt(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, unsigned value)
+{
+    return dest.WriteUInt(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, bool value)
+{
+    return dest.WriteBool(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, float value)
+{
+    return dest.WriteFloat(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, double value)
+{
+    return dest.WriteDouble(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const Vector2& value)
+{
+    return dest.WriteVector2(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const Vector3& value)
+{
+    return dest.WriteVector3(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const Vector4& value)
+{
+    return dest.WriteVector4(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const Quaternion& value)
+{
+    return dest.WriteQuaternion(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const Color& value)
+{
+    return dest.WriteColor(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const String& value)
+{
+    return dest.WriteString(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const StringHash& value)
+{
+    return dest.WriteUInt(value.Value());
+}
+
+bool WriteAttributeValue(Serializer& dest, const PODVector<unsigned char>& value)
+{
+    return dest.WriteBuffer(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const ResourceRef& value)
+{
+    return dest.WriteResourceRef(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const ResourceRefList& value)
+{
+    return dest.WriteResourceRefList(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const VariantVector& value)
+{
+    return dest.WriteVariantVector(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const StringVector& value)
+{
+    return dest.WriteStringVector(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const VariantMap& value)
+{
+    return dest.WriteVariantMap(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const IntRect& value)
+{
+    return dest.WriteIntRect(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const IntVector2& value)
+{
+    return dest.WriteIntVector2(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const Matrix3& value)
+{
+    return dest.WriteMatrix3(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const Matrix3x4& value)
+{
+    return dest.WriteMatrix3x4(value);
+}
+
+bool WriteAttributeValue(Serializer& dest, const Matrix4& value)
+{
+    return dest.WriteMatrix4(value);
+}
+
+void ReadAttributeValue(Deserializer& source, int& value)
+{
+    value = source.ReadInt();
+}
+
+void ReadAttributeValue(Deserializer& source, unsigned& value)
+{
+    value = source.ReadUInt();
+}
+
+void ReadAttributeValue(Deserializer& source, bool& value)
+{
+    value = source.ReadBool();
+}
+
+void ReadAttributeValue(Deserializer& source, float& value)
+{
+    value = source.ReadFloat();
+}
+
+void ReadAttributeValue(Deserializer& source, double& value)
+{
+    value = source.ReadDouble();
+}
+
+void ReadAttributeValue(Deserializer& source, Vector2& value)
+{
+    value = source.ReadVector2();
+}
+
+void ReadAttributeValue(Deserializer& source, Vector3& value)
+{
+    value = source.ReadVector3();
+}
+
+void ReadAttributeValue(Deserializer& source, Vector4& value)
+{
+    value = source.ReadVector4();
+}
+
+void ReadAttributeValue(Deserializer& source, Quaternion& value)
+{
+    value = source.ReadQuaternion();
+}
+
+void ReadAttributeValue(Deserializer& source, Color& value)
+{
+    value = source.ReadColor();
+}
+
+void ReadAttributeValue(Deserializer& source, String& value)
+{
+    value = source.ReadString();
+}
+
+void ReadAttributeValue(Deserializer& source, StringHash& value)
+{
+    value = StringHash(source.ReadUInt());
+}
+
+void ReadAttributeValue(Deserializer& source, PODVector<unsigned char>& value)
+{
+    value = source.ReadBuffer();
+}
+
+void ReadAttributeValue(Deserializer& source, ResourceRef& value)
+{
+    value = source.ReadResourceRef();
+}
+
+void ReadAttributeValue(Deserializer& source, ResourceRefList& value)
+{
+    value = source.ReadResourceRefList();
+}
+
+void ReadAttributeValue(Deserializer& source, VariantVector& value)
+{
+    value = source.ReadVariantVector();
+}
+
+void ReadAttributeValue(Deserializer& source, StringVector& value)
+{
+    value = source.ReadStringVector();
+}
+
+void ReadAttributeValue(Deserializer& source, VariantMap& value)
+{
+    value = source.ReadVariantMap();
+}
+
+void ReadAttributeValue(Deserializer& source, IntRect& value)
+{
+    value = source.ReadIntRect();
+}
+
+void ReadAttributeValue(Deserializer& source, IntVector2& value)
+{
+    value = source.ReadIntVector2();
+}
+
+void ReadAttributeValue(Deserializer& source, Matrix3& value)
+{
+    value = source.ReadMatrix3();
+}
+
+void ReadAttributeValue(Deserializer& source, Matrix3x4& value)
+{
+    value = source.ReadMatrix3x4();
+}
+
+void ReadAttributeValue(Deserializer& source, Matrix4& value)
+{
+    value = source.ReadMatrix4();
+}
+
 Serializable::Serializable(Context* context) :
     Object(context),
     networkState_(0),
@@ -283,6 +525,10 @@ bool Serializable::Load(Deserializer& source, bool setInstanceDefault)
     if (!attributes)
         return true;
 
+    // Accessor attributes can be read directly without converting to a Variant, unless the value needs to be stored, or the
+    // class needs to see the attribute changes in OnSetAttribute()
+    bool direct = !setInstanceDefault && !context_->HasAttributeOverrides(GetType());
+
     for (unsigned i = 0; i < attributes->Size(); ++i)
     {
         const AttributeInfo& attr = attributes->At(i);
@@ -295,6 +541,12 @@ bool Serializable::Load(Deserializer& source, bool setInstanceDefault)
             return false;
         }
 
+        if (attr.accessor_ && direct)
+        {
+            attr.accessor_->Read(this, attr, source);
+            continue;
+        }
+
         Variant varValue = source.ReadVariant(attr.type_);
         OnSetAttribute(attr, varValue);
 
@@ -312,6 +564,7 @@ bool Serializable::Save(Serializer& dest) const
         return true;
 
     Variant value;
+    bool direct = !context_->HasAttributeOverrides(GetType());
 
     for (unsigned i = 0; i < attributes->Size(); ++i)
     {
@@ -319,9 +572,16 @@ bool Serializable::Save(Serializer& dest) const
         if (!(attr.mode_ & AM_FILE))
             continue;
 
-        OnGetAttribute(attr, value);
+        bool success;
+        if (attr.accessor_ && direct)
+            success = attr.accessor_->Write(this, attr, dest);
+        else
+        {
+            OnGetAttribute(attr, value);
+            success = dest.WriteVariantData(value);
+        }
 
-        if (!dest.WriteVariantData(value))
+        if (!success)
         {
             URHO3D_LOGERROR("Could not save " + GetTypeName() + ", writing to stream failed");
             return false;
@@ -830,6 +1090,7 @@ bool Serializable::ReadDeltaUpdate(Deserializer& source)
 
     unsigned long long interceptMask = networkState_ ? networkState_->interceptMask_ : 0;
     unsigned char timeStamp = source.ReadUByte();
+    bool direct = !context_->HasAttributeOverrides(GetType());
     source.Read(attributeBits.data_, (numAttributes + 7) >> 3);
 
     for (unsigned i = 0; i < numAttributes && !source.IsEof(); ++i)
@@ -839,7 +1100,10 @@ bool Serializable::ReadDeltaUpdate(Deserializer& source)
             const AttributeInfo& attr = attributes->At(i);
             if (!(interceptMask & (1ULL << i)))
             {
-                OnSetAttribute(attr, source.ReadVariant(attr.type_));
+                if (attr.accessor_ && direct)
+                    attr.accessor_->Read(this, attr, source);
+                else
+                    OnSetAttribute(attr, source.ReadVariant(attr.type_));
                 changed = true;
             }
             else
@@ -871,6 +1135,7 @@ bool Serializable::ReadLatestDataUpdate(Deserializer& source)
 
     unsigned long long interceptMask = networkState_ ? networkState_->interceptMask_ : 0;
     unsigned char timeStamp = source.ReadUByte();
+    bool direct = !context_->HasAttributeOverrides(GetType());
 
     for (unsigned i = 0; i < numAttributes && !source.IsEof(); ++i)
     {
@@ -879,7 +1144,10 @@ bool Serializable::ReadLatestDataUpdate(Deserializer& source)
         {
             if (!(interceptMask & (1ULL << i)))
             {
-                OnSetAttribute(attr, source.ReadVariant(attr.type_));
+                if (attr.accessor_ && direct)
+                    attr.accessor_->Read(this, attr, source);
+                else
+                    OnSetAttribute(attr, source.ReadVariant(attr.type_));
                 changed = true;
             }
             else
@@ -59,9 +59,9 @@ public:
     virtual const Vector<AttributeInfo>* GetAttributes() const;
     /// Return network replication attribute descriptions, or null if none defined.
     virtual const Vector<AttributeInfo>* GetNetworkAttributes() const;
-    /// Load from binary data. When setInstanceDefault is set to true, after setting the attribute value, store the value as instance's default value. Return true if successful.
+    /// Load from binary data. When setInstanceDefault is set to true, after setting the attribute value, store the value as instance's default value. Return true if successful. Accessor attributes are set directly through their accessor if the class does not override OnSetAttribute() or OnGetAttribute().
     virtual bool Load(Deserializer& source, bool setInstanceDefault = false);
-    /// Save as binary data. Return true if successful.
+    /// Save as binary data. Return true if successful. Accessor attributes are read directly through their accessor if the class does not override OnSetAttribute() or OnGetAttribute().
     virtual bool Save(Serializer& dest) const;
     /// Load from XML data. When setInstanceDefault is set to true, after setting the attribute value, store the value as instance's default value. Return true if successful.
     virtual bool LoadXML(const XMLElement& source, bool setInstanceDefault = false);
@@ -144,6 +144,56 @@ private:
     bool temporary_;
 };
 
+/// Write a typed attribute value to binary data in the same format as Serializer::WriteVariantData(). Return true if successful.
+URHO3D_API bool WriteAttributeValue(Serializer& dest, int value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, unsigned value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, bool value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, float value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, double value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const Vector2& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const Vector3& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const Vector4& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const Quaternion& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const Color& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const String& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const StringHash& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const PODVector<unsigned char>& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const ResourceRef& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const ResourceRefList& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const VariantVector& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const StringVector& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const VariantMap& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const IntRect& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const IntVector2& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const Matrix3& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const Matrix3x4& value);
+URHO3D_API bool WriteAttributeValue(Serializer& dest, const Matrix4& value);
+
+/// Read a typed attribute value from binary data in the same format as Deserializer::ReadVariant().
+URHO3D_API void ReadAttributeValue(Deserializer& source, int& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, unsigned& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, bool& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, float& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, double& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, Vector2& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, Vector3& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, Vector4& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, Quaternion& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, Color& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, String& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, StringHash& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, PODVector<unsigned char>& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, ResourceRef& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, ResourceRefList& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, VariantVector& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, StringVector& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, VariantMap& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, IntRect& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, IntVector2& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, Matrix3& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, Matrix3x4& value);
+URHO3D_API void ReadAttributeValue(Deserializer& source, Matrix4& value);
+
 /// Template implementation of the enum attribute accessor invoke helper class.
 template <typename T, typename U> class EnumAttributeAccessorImpl : public AttributeAccessor
 {
@@ -176,6 +226,24 @@ public:
         (classPtr->*setFunction_)((U)value.GetInt());
     }
 
+    /// Read from binary data and invoke setter function.
+    virtual void Read(Serializable* ptr, const AttributeInfo& attr, Deserializer& source)
+    {
+        assert(ptr);
+        T* classPtr = static_cast<T*>(ptr);
+        int value;
+        ReadAttributeValue(source, value);
+        (classPtr->*setFunction_)((U)value);
+    }
+
+    /// Invoke getter function and write to binary data.
+    virtual bool Write(const Serializable* ptr, const AttributeInfo& attr, Serializer& dest) const
+    {
+        assert(ptr);
+        const T* classPtr = static_cast<const T*>(ptr);
+        return WriteAttributeValue(dest, (int)((classPtr->*getFunction_)()));
+    }
+
     /// Class-specific pointer to getter function.
     GetFunctionPtr getFunction_;
     /// Class-specific pointer to setter function.
@@ -214,6 +282,24 @@ public:
         (*setFunction_)(classPtr, (U)value.GetInt());
     }
 
+    /// Read from binary data and invoke setter function.
+    virtual void Read(Serializable* ptr, const AttributeInfo& attr, Deserializer& source)
+    {
+        assert(ptr);
+        T* classPtr = static_cast<T*>(ptr);
+        int value;
+        ReadAttributeValue(source, value);
+        (*setFunction_)(classPtr, (U)value);
+    }
+
+    /// Invoke getter function and write to binary data.
+    virtual bool Write(const Serializable* ptr, const AttributeInfo& attr, Serializer& dest) const
+    {
+        assert(ptr);
+        const T* classPtr = static_cast<const T*>(ptr);
+        return WriteAttributeValue(dest, (int)((*getFunction_)(classPtr)));
+    }
+
     /// Class-specific pointer to getter function.
     GetFunctionPtr getFunction_;
     /// Class-specific pointer to setter function.
@@ -296,6 +382,24 @@ public:
         (classPtr->*setFunction_)(value.Get<U>());
     }
 
+    /// Read from binary data and invoke setter function.
+    virtual void Read(Serializable* ptr, const AttributeInfo& attr, Deserializer& source)
+    {
+        assert(ptr);
+        T* classPtr = static_cast<T*>(ptr);
+        U value;
+        ReadAttributeValue(source, value);
+        (classPtr->*setFunction_)(value);
+    }
+
+    /// Invoke getter function and write to binary data.
+    virtual bool Write(const Serializable* ptr, const AttributeInfo& attr, Serializer& dest) const
+    {
+        assert(ptr);
+        const T* classPtr = static_cast<const T*>(ptr);
+        return WriteAttributeValue(dest, (classPtr->*getFunction_)());
+    }
+
     /// Class-specific pointer to getter function.
     GetFunctionPtr getFunction_;
     /// Class-specific pointer to setter function.
@@ -334,6 +438,24 @@ public:
         (*setFunction_)(classPtr, value.Get<U>());
     }
 
+    /// Read from binary data and invoke setter function.
+    virtual void Read(Serializable* ptr, const AttributeInfo& attr, Deserializer& source)
+    {
+        assert(ptr);
+        T* classPtr = static_cast<T*>(ptr);
+        U value;
+        ReadAttributeValue(source, value);
+        (*setFunction_)(classPtr, value);
+    }
+
+    /// Invoke getter function and write to binary data.
+    virtual bool Write(const Serializable* ptr, const AttributeInfo& attr, Serializer& dest) const
+    {
+        assert(ptr);
+        const T* classPtr = static_cast<const T*>(ptr);
+        return WriteAttributeValue(dest, (*getFunction_)(classPtr));
+    }
+
     /// Class-specific pointer to getter function.
     GetFunctionPtr getFunction_;
     /// Class-specific pointer to setter function.
@@ -0,0 +1,242 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Scene/Node.h"
+#include "../Scene/TransformStore.h"
+
+#include <cstring>
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+TransformStore::TransformStore() :
+    dirtyBegin_(M_MAX_UNSIGNED),
+    dirtyEnd_(0),
+    numFree_(0),
+    threadedUpdate_(false)
+{
+}
+
+TransformStore::~TransformStore()
+{
+    Clear();
+}
+
+void TransformStore::Insert(Node* node)
+{
+    // Nodes whose parent is the scene are roots, as the scene is assumed to have identity transform
+    Node* parent = node->parent_;
+    unsigned parentIndex = parent && parent->transformStore_ == this ? parent->transformIndex_ : M_MAX_UNSIGNED;
+
+    if (node->transformStore_ == this)
+    {
+        // The children of a stored node are always after it, so only the new parent needs to be checked
+        if (parentIndex == M_MAX_UNSIGNED || parentIndex < node->transformIndex_)
+        {
+            parents_[node->transformIndex_] = parentIndex;
+            return;
+        }
+
+        RemoveHierarchy(node);
+    }
+
+    AddHierarchy(node, parentIndex);
+}
+
+void TransformStore::Remove(Node* node)
+{
+    if (node->transformStore_ != this)
+        return;
+
+    unsigned index = node->transformIndex_;
+    node->worldTransform_ = GetWorldTransform(index);
+    node->worldRotation_ = GetWorldRotation(index);
+    node->dirty_ = dirty_[index] != 0;
+    node->transformStore_ = 0;
+    node->transformIndex_ = M_MAX_UNSIGNED;
+
+    nodes_[index] = 0;
+    parents_[index] = M_MAX_UNSIGNED;
+    dirty_[index] = 0;
+    ++numFree_;
+
+    // Removing nodes in reverse order, as when a scene is cleared, does not need compacting
+    while (nodes_.Size() && !nodes_.Back())
+    {
+        nodes_.Pop();
+        parents_.Pop();
+        dirty_.Pop();
+        --numFree_;
+    }
+}
+
+void TransformStore::Clear()
+{
+    for (unsigned i = 0; i < nodes_.Size(); ++i)
+    {
+        Node* node = nodes_[i];
+        if (node)
+        {
+            node->worldTransform_ = GetWorldTransform(i);
+            node->worldRotation_ = GetWorldRotation(i);
+            node->dirty_ = dirty_[i] != 0;
+            node->transformStore_ = 0;
+            node->transformIndex_ = M_MAX_UNSIGNED;
+        }
+    }
+
+    for (unsigned i = 0; i < worldTransforms_.Size(); ++i)
+    {
+        delete[] worldTransforms_[i];
+        delete[] worldRotations_[i];
+    }
+
+    nodes_.Clear();
+    parents_.Clear();
+    dirty_.Clear();
+    worldTransforms_.Clear();
+    worldRotations_.Clear();
+    dirtyBegin_ = M_MAX_UNSIGNED;
+    dirtyEnd_ = 0;
+    numFree_ = 0;
+}
+
+void TransformStore::Update()
+{
+    if (numFree_ >= TRANSFORM_BLOCK_SIZE && numFree_ > nodes_.Size() / 2)
+        Compact();
+
+    const unsigned char* dirty = dirty_.Buffer();
+    unsigned end = Min(dirtyEnd_, nodes_.Size());
+
+    for (unsigned i = dirtyBegin_; i < end; ++i)
+    {
+        if (!dirty[i])
+        {
+            // Skip clean flags eight at a time
+            if (!(i & 7) && i + 8 <= end)
+            {
+                unsigned long long flags;
+                memcpy(&flags, dirty + i, sizeof flags);
+                if (!flags)
+                    i += 7;
+            }
+            continue;
+        }
+
+        Node* node = nodes_[i];
+        unsigned parentIndex = parents_[i];
+        if (parentIndex == M_MAX_UNSIGNED)
+            SetWorldTransform(i, node->GetTransform(), node->rotation_);
+        // A parent dirtied from a worker thread is outside the dirty range and may still be dirty, so let the node walk up
+        // the hierarchy in that case
+        else if (dirty[parentIndex])
+            node->UpdateWorldTransform();
+        else
+        {
+            SetWorldTransform(i, GetWorldTransform(parentIndex) * node->GetTransform(),
+                GetWorldRotation(parentIndex) * node->rotation_);
+        }
+    }
+
+    dirtyBegin_ = M_MAX_UNSIGNED;
+    dirtyEnd_ = 0;
+}
+
+void TransformStore::AddHierarchy(Node* node, unsigned parentIndex)
+{
+    unsigned index = nodes_.Size();
+    if (index / TRANSFORM_BLOCK_SIZE >= worldTransforms_.Size())
+    {
+        worldTransforms_.Push(new Matrix3x4[TRANSFORM_BLOCK_SIZE]);
+        worldRotations_.Push(new Quaternion[TRANSFORM_BLOCK_SIZE]);
+    }
+
+    nodes_.Push(node);
+    parents_.Push(parentIndex);
+    dirty_.Push(0);
+    SetWorldTransform(index, node->worldTransform_, node->worldRotation_);
+    if (node->dirty_)
+        MarkDirty(index);
+    node->transformStore_ = this;
+    node->transformIndex_ = index;
+
+    const Vector<SharedPtr<Node> >& children = node->GetChildren();
+    for (Vector<SharedPtr<Node> >::ConstIterator i = children.Begin(); i != children.End(); ++i)
+        AddHierarchy(*i, index);
+}
+
+void TransformStore::RemoveHierarchy(Node* node)
+{
+    Remove(node);
+
+    const Vector<SharedPtr<Node> >& children = node->GetChildren();
+    for (Vector<SharedPtr<Node> >::ConstIterator i = children.Begin(); i != children.End(); ++i)
+        RemoveHierarchy(*i);
+}
+
+void TransformStore::Compact()
+{
+    // Parents come before their children, so a parent's new index is always known when its children are moved
+    PODVector<unsigned> newIndices(nodes_.Size());
+    unsigned numNodes = 0;
+
+    for (unsigned i = 0; i < nodes_.Size(); ++i)
+    {
+        Node* node = nodes_[i];
+        if (!node)
+            continue;
+
+        newIndices[i] = numNodes;
+        nodes_[numNodes] = node;
+        parents_[numNodes] = parents_[i] != M_MAX_UNSIGNED ? newIndices[parents_[i]] : M_MAX_UNSIGNED;
+        dirty_[numNodes] = dirty_[i];
+        worldTransforms_[numNodes / TRANSFORM_BLOCK_SIZE][numNodes & (TRANSFORM_BLOCK_SIZE - 1)] = GetWorldTransform(i);
+        worldRotations_[numNodes / TRANSFORM_BLOCK_SIZE][numNodes & (TRANSFORM_BLOCK_SIZE - 1)] = GetWorldRotation(i);
+        node->transformIndex_ = numNodes;
+        ++numNodes;
+    }
+
+    nodes_.Resize(numNodes);
+    parents_.Resize(numNodes);
+    dirty_.Resize(numNodes);
+    numFree_ = 0;
+
+    unsigned numBlocks = (numNodes + TRANSFORM_BLOCK_SIZE - 1) / TRANSFORM_BLOCK_SIZE;
+    for (unsigned i = numBlocks; i < worldTransforms_.Size(); ++i)
+    {
+        delete[] worldTransforms_[i];
+        delete[] worldRotations_[i];
+    }
+    worldTransforms_.Resize(numBlocks);
+    worldRotations_.Resize(numBlocks);
+
+    // The dirty flags have moved, so check all of them
+    dirtyBegin_ = 0;
+    dirtyEnd_ = numNodes;
+}
+
+}
@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2008-2016 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Container/Vector.h"
+#include "../Math/Matrix3x4.h"
+#include "../Math/Quaternion.h"
+
+namespace Urho3D
+{
+
+class Node;
+
+/// Number of nodes per transform store block. Must be a power of two.
+static const unsigned TRANSFORM_BLOCK_SIZE = 1024;
+
+/// Contiguous storage of the world transforms and dirty flags of a scene's nodes, sorted parent-before-child so that all dirty world transforms can be recalculated in one linear pass. The nodes in the store read their world transform from it.
+class URHO3D_API TransformStore
+{
+public:
+    /// Construct.
+    TransformStore();
+    /// Destruct. Return the world transforms to the nodes still in the store.
+    ~TransformStore();
+
+    /// Add a node and its children. If the node is already stored, update its parent, and move it and its children to the end if the parent now comes after it.
+    void Insert(Node* node);
+    /// Remove a node. Its world transform and dirty flag are returned to it.
+    void Remove(Node* node);
+    /// Remove all nodes.
+    void Clear();
+    /// Recalculate the world transforms of the nodes dirtied since the last update. Compact the storage first if many nodes have been removed.
+    void Update();
+    /// Set whether a threaded scene update is going on. Nodes dirtied from worker threads are not tracked in the dirty range, but recalculated on access.
+    void SetThreadedUpdate(bool enable) { threadedUpdate_ = enable; }
+
+    /// Mark a node's world transform dirty.
+    void MarkDirty(unsigned index)
+    {
+        dirty_[index] = 1;
+        if (!threadedUpdate_)
+        {
+            if (index < dirtyBegin_)
+                dirtyBegin_ = index;
+            if (index >= dirtyEnd_)
+                dirtyEnd_ = index + 1;
+        }
+    }
+
+    /// Set a node's world transform and rotation, and clear its dirty flag.
+    void SetWorldTransform(unsigned index, const Matrix3x4& transform, const Quaternion& rotation)
+    {
+        worldTransforms_[index / TRANSFORM_BLOCK_SIZE][index & (TRANSFORM_BLOCK_SIZE - 1)] = transform;
+        worldRotations_[index / TRANSFORM_BLOCK_SIZE][index & (TRANSFORM_BLOCK_SIZE - 1)] = rotation;
+        dirty_[index] = 0;
+    }
+
+    /// Return whether a node's world transform is dirty.
+    bool IsDirty(unsigned index) const { return dirty_[index] != 0; }
+
+    /// Return a node's world transform.
+    const Matrix3x4& GetWorldTransform(unsigned index) const
+    {
+        return worldTransforms_[index / TRANSFORM_BLOCK_SIZE][index & (TRANSFORM_BLOCK_SIZE - 1)];
+    }
+
+    /// Return a node's world rotation.
+    const Quaternion& GetWorldRotation(unsigned index) const
+    {
+        return worldRotations_[index / TRANSFORM_BLOCK_SIZE][index & (TRANSFORM_BLOCK_SIZE - 1)];
+    }
+
+    /// Return number of stored nodes.
+    unsigned GetNumNodes() const { return nodes_.Size() - numFree_; }
+
+private:
+    /// Append a node and its children after the given parent index.
+    void AddHierarchy(Node* node, unsigned parentIndex);
+    /// Remove a node and its children.
+    void RemoveHierarchy(Node* node);
+    /// Remove the slots of removed nodes, keeping the parent-before-child order.
+    void Compact();
+
+    /// Nodes by index, null for the slots of removed nodes.
+    PODVector<Node*> nodes_;
+    /// Parent indices, or M_MAX_UNSIGNED for the nodes whose parent is the scene.
+    PODVector<unsigned> parents_;
+    /// Dirty flags.
+    PODVector<unsigned char> dirty_;
+    /// World transform blocks. Allocated in fixed size blocks so that references returned by the nodes stay valid as nodes are added.
+    PODVector<Matrix3x4*> worldTransforms_;
+    /// World rotation blocks.
+    PODVector<Quaternion*> worldRotations_;
+    /// First index of the dirty range.
+    unsigned dirtyBegin_;
+    /// One past the last index of the dirty range.
+    unsigned dirtyEnd_;
+    /// Number of slots of removed nodes.
+    unsigned numFree_;
+    /// Threaded update flag.
+    bool threadedUpdate_;
+};
+
+}
@@ -304,7 +304,7 @@ void AnimatedSprite2D::UpdateSpineAnimation(float timeStep)
     spSkeleton_updateWorldTransform(skeleton_);
 
     sourceBatchesDirty_ = true;
-    worldBoundingBoxDirty_ = true;
+    MarkWorldBoundingBoxDirty();
 }
 
 void AnimatedSprite2D::UpdateSourceBatchesSpine()
@@ -432,7 +432,7 @@ void AnimatedSprite2D::UpdateSpriterAnimation(float timeStep)
 {
     spriterInstance_->Update(timeStep * speed_);
     sourceBatchesDirty_ = true;
-    worldBoundingBoxDirty_ = true;
+    MarkWorldBoundingBoxDirty();
 }
 
 void AnimatedSprite2D::UpdateSourceBatchesSpriter()
@@ -0,0 +1,149 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMake/Modules/CheckCompilerToolchain.cmake"
+  "/root/repo/CMake/Modules/CheckHost.cmake"
+  "/root/repo/CMake/Modules/FindEsound.cmake"
+  "/root/repo/CMake/Modules/FindMir.cmake"
+  "/root/repo/CMake/Modules/FindNetworkAudioSystem.cmake"
+  "/root/repo/CMake/Modules/FindOSS.cmake"
+  "/root/repo/CMake/Modules/FindPulseAudio.cmake"
+  "/root/repo/CMake/Modules/FindRoarAudio.cmake"
+  "/root/repo/CMake/Modules/FindUrho3D.cmake"
+  "/root/repo/CMake/Modules/FindWayland.cmake"
+  "/root/repo/CMake/Modules/FindaRts.cmake"
+  "/root/repo/CMake/Modules/GenerateExportHeader.cmake"
+  "/root/repo/CMake/Modules/Urho3D-CMake-common.cmake"
+  "/root/repo/CMake/Modules/exportheader.cmake.in"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Docs/CMakeLists.txt"
+  "/root/repo/Source/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/Assimp/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/FreeType/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/JO/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/LZ4/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/PugiXml/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/SDL/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/SDL/cmake/macros.cmake"
+  "/root/repo/Source/ThirdParty/SDL/cmake/sdlchecks.cmake"
+  "/root/repo/Source/ThirdParty/SDL/include/SDL_config.h.cmake"
+  "/root/repo/Source/ThirdParty/STB/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/StanHull/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/rapidjson/CMakeLists.txt"
+  "/root/repo/Source/Tools/AssetImporter/CMakeLists.txt"
+  "/root/repo/Source/Tools/CMakeLists.txt"
+  "/root/repo/Source/Tools/OgreImporter/CMakeLists.txt"
+  "/root/repo/Source/Tools/PackageTool/CMakeLists.txt"
+  "/root/repo/Source/Tools/RampGenerator/CMakeLists.txt"
+  "/root/repo/Source/Tools/RenderBenchmark/CMakeLists.txt"
+  "/root/repo/Source/Tools/SpritePacker/CMakeLists.txt"
+  "/root/repo/Source/Urho3D/CMakeLists.txt"
+  "/root/repo/Source/Urho3D/Urho3D.pc.in"
+  "/root/repo/Source/Urho3D/Urho3DAll.h.in"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindALSA.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/FreeType/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/JO/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/LZ4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/PugiXml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/rapidjson/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/SDL/include/generated/SDL_config.h"
+  "Source/ThirdParty/SDL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/StanHull/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/STB/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Urho3D/Urho3DAll.h"
+  "Source/Urho3D/Urho3D.pc"
+  "Source/Urho3D/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Tools/AssetImporter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/Assimp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Tools/OgreImporter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Tools/PackageTool/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Tools/RampGenerator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Tools/RenderBenchmark/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Tools/SpritePacker/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/DependInfo.cmake"
+  "Source/ThirdParty/JO/CMakeFiles/JO.dir/DependInfo.cmake"
+  "Source/ThirdParty/LZ4/CMakeFiles/LZ4.dir/DependInfo.cmake"
+  "Source/ThirdParty/PugiXml/CMakeFiles/PugiXml.dir/DependInfo.cmake"
+  "Source/ThirdParty/rapidjson/CMakeFiles/rapidjson.dir/DependInfo.cmake"
+  "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/DependInfo.cmake"
+  "Source/ThirdParty/StanHull/CMakeFiles/StanHull.dir/DependInfo.cmake"
+  "Source/ThirdParty/STB/CMakeFiles/STB.dir/DependInfo.cmake"
+  "Source/Urho3D/CMakeFiles/Urho3D.dir/DependInfo.cmake"
+  "Source/Tools/AssetImporter/CMakeFiles/AssetImporter.dir/DependInfo.cmake"
+  "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/DependInfo.cmake"
+  "Source/Tools/OgreImporter/CMakeFiles/OgreImporter.dir/DependInfo.cmake"
+  "Source/Tools/PackageTool/CMakeFiles/PackageTool.dir/DependInfo.cmake"
+  "Source/Tools/RampGenerator/CMakeFiles/RampGenerator.dir/DependInfo.cmake"
+  "Source/Tools/RenderBenchmark/CMakeFiles/RenderBenchmark.dir/DependInfo.cmake"
+  "Source/Tools/SpritePacker/CMakeFiles/SpritePacker.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,191 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/Assimp/contrib/ConvertUTF/ConvertUTF.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/ConvertUTF/ConvertUTF.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/ConvertUTF/ConvertUTF.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/unzip/ioapi.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/unzip/ioapi.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/unzip/ioapi.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/unzip/unzip.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/unzip/unzip.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/unzip/unzip.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/adler32.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/adler32.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/adler32.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/compress.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/compress.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/compress.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/crc32.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/crc32.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/crc32.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/deflate.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/deflate.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/deflate.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/infback.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/infback.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/infback.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/inffast.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/inffast.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/inffast.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/inflate.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/inflate.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/inflate.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/inftrees.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/inftrees.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/inftrees.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/trees.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/trees.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/trees.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/uncompr.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/uncompr.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/uncompr.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/zlib/zutil.c" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/zutil.c.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/zlib/zutil.c.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/3DSConverter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/3DSConverter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/3DSConverter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/3DSExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/3DSExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/3DSExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/3DSLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/3DSLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/3DSLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ACLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ACLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ACLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ASELoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ASELoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ASELoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ASEParser.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ASEParser.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ASEParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/AssbinExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/AssbinExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/AssbinExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/AssbinLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/AssbinLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/AssbinLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Assimp.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Assimp.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Assimp.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/AssimpCExport.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/AssimpCExport.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/AssimpCExport.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/AssxmlExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/AssxmlExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/AssxmlExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/B3DImporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/B3DImporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/B3DImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/BVHLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BVHLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BVHLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/BaseImporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BaseImporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BaseImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/BaseProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BaseProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BaseProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Bitmap.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Bitmap.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Bitmap.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/BlenderBMesh.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderBMesh.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderBMesh.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/BlenderDNA.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderDNA.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderDNA.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/BlenderLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/BlenderModifier.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderModifier.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderModifier.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/BlenderScene.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderScene.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderScene.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/BlenderTessellator.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderTessellator.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/BlenderTessellator.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/COBLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/COBLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/COBLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/CSMLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/CSMLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/CSMLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/CalcTangentsProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/CalcTangentsProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/CalcTangentsProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ColladaExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ColladaExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ColladaExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ColladaLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ColladaLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ColladaLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ColladaParser.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ColladaParser.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ColladaParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ComputeUVMappingProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ComputeUVMappingProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ComputeUVMappingProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ConvertToLHProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ConvertToLHProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ConvertToLHProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/DXFLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DXFLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DXFLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/DeboneProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DeboneProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DeboneProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/DefaultIOStream.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DefaultIOStream.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DefaultIOStream.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/DefaultIOSystem.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DefaultIOSystem.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DefaultIOSystem.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/DefaultLogger.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DefaultLogger.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/DefaultLogger.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Exporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Exporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Exporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXAnimation.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXAnimation.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXAnimation.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXBinaryTokenizer.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXBinaryTokenizer.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXBinaryTokenizer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXConverter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXConverter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXConverter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXDeformer.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXDeformer.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXDeformer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXDocument.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXDocument.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXDocument.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXDocumentUtil.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXDocumentUtil.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXDocumentUtil.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXImporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXImporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXMaterial.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXMaterial.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXMaterial.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXMeshGeometry.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXMeshGeometry.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXMeshGeometry.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXModel.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXModel.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXModel.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXNodeAttribute.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXNodeAttribute.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXNodeAttribute.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXParser.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXParser.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXProperties.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXProperties.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXProperties.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXTokenizer.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXTokenizer.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXTokenizer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FBXUtil.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXUtil.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FBXUtil.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FindDegenerates.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FindDegenerates.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FindDegenerates.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FindInstancesProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FindInstancesProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FindInstancesProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FindInvalidDataProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FindInvalidDataProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FindInvalidDataProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/FixNormalsStep.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FixNormalsStep.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/FixNormalsStep.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/GenFaceNormalsProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/GenFaceNormalsProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/GenFaceNormalsProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/GenVertexNormalsProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/GenVertexNormalsProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/GenVertexNormalsProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/HMPLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/HMPLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/HMPLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IFCBoolean.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCBoolean.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCBoolean.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IFCCurve.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCCurve.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCCurve.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IFCGeometry.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCGeometry.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCGeometry.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IFCLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IFCMaterial.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCMaterial.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCMaterial.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IFCOpenings.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCOpenings.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCOpenings.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IFCProfile.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCProfile.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCProfile.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IFCReaderGen.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCReaderGen.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCReaderGen.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IFCUtil.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCUtil.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IFCUtil.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IRRLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IRRLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IRRLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IRRMeshLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IRRMeshLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IRRMeshLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/IRRShared.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IRRShared.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/IRRShared.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Importer.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Importer.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Importer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ImporterRegistry.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ImporterRegistry.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ImporterRegistry.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ImproveCacheLocality.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ImproveCacheLocality.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ImproveCacheLocality.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/JoinVerticesProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/JoinVerticesProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/JoinVerticesProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/LWOAnimation.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWOAnimation.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWOAnimation.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/LWOBLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWOBLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWOBLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/LWOLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWOLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWOLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/LWOMaterial.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWOMaterial.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWOMaterial.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/LWSLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWSLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LWSLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/LimitBoneWeightsProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LimitBoneWeightsProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/LimitBoneWeightsProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MD2Loader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MD2Loader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MD2Loader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MD3Loader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MD3Loader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MD3Loader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MD5Loader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MD5Loader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MD5Loader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MD5Parser.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MD5Parser.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MD5Parser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MDCLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MDCLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MDCLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MDLLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MDLLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MDLLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MDLMaterialLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MDLMaterialLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MDLMaterialLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MS3DLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MS3DLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MS3DLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MakeVerboseFormat.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MakeVerboseFormat.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MakeVerboseFormat.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/MaterialSystem.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MaterialSystem.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/MaterialSystem.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/NDOLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/NDOLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/NDOLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/NFFLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/NFFLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/NFFLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OFFLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OFFLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OFFLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ObjExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ObjExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ObjExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ObjFileImporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ObjFileImporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ObjFileImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ObjFileMtlImporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ObjFileMtlImporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ObjFileMtlImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ObjFileParser.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ObjFileParser.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ObjFileParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OgreBinarySerializer.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreBinarySerializer.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreBinarySerializer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OgreImporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreImporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OgreMaterial.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreMaterial.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreMaterial.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OgreStructs.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreStructs.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreStructs.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OgreXmlSerializer.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreXmlSerializer.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OgreXmlSerializer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OpenGEXExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OpenGEXExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OpenGEXExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OpenGEXImporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OpenGEXImporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OpenGEXImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OptimizeGraph.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OptimizeGraph.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OptimizeGraph.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/OptimizeMeshes.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OptimizeMeshes.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/OptimizeMeshes.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/PlyExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PlyExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PlyExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/PlyLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PlyLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PlyLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/PlyParser.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PlyParser.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PlyParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/PostStepRegistry.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PostStepRegistry.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PostStepRegistry.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/PretransformVertices.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PretransformVertices.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/PretransformVertices.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ProcessHelper.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ProcessHelper.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ProcessHelper.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Q3BSPFileImporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Q3BSPFileImporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Q3BSPFileImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Q3BSPFileParser.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Q3BSPFileParser.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Q3BSPFileParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Q3BSPZipArchive.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Q3BSPZipArchive.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Q3BSPZipArchive.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Q3DLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Q3DLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Q3DLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/RawLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/RawLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/RawLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/RemoveComments.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/RemoveComments.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/RemoveComments.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/RemoveRedundantMaterials.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/RemoveRedundantMaterials.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/RemoveRedundantMaterials.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/RemoveVCProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/RemoveVCProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/RemoveVCProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/SGSpatialSort.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SGSpatialSort.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SGSpatialSort.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/SMDLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SMDLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SMDLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/STEPFileEncoding.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/STEPFileEncoding.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/STEPFileEncoding.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/STEPFileReader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/STEPFileReader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/STEPFileReader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/STLExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/STLExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/STLExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/STLLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/STLLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/STLLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/SceneCombiner.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SceneCombiner.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SceneCombiner.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ScenePreprocessor.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ScenePreprocessor.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ScenePreprocessor.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/SkeletonMeshBuilder.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SkeletonMeshBuilder.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SkeletonMeshBuilder.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/SortByPTypeProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SortByPTypeProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SortByPTypeProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/SpatialSort.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SpatialSort.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SpatialSort.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/SplitByBoneCountProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SplitByBoneCountProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SplitByBoneCountProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/SplitLargeMeshes.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SplitLargeMeshes.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/SplitLargeMeshes.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/StandardShapes.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/StandardShapes.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/StandardShapes.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/StepExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/StepExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/StepExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Subdivision.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Subdivision.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Subdivision.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/TargetAnimation.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/TargetAnimation.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/TargetAnimation.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/TerragenLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/TerragenLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/TerragenLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/TextureTransform.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/TextureTransform.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/TextureTransform.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/TriangulateProcess.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/TriangulateProcess.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/TriangulateProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/UnrealLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/UnrealLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/UnrealLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/ValidateDataStructure.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ValidateDataStructure.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/ValidateDataStructure.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/Version.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Version.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/Version.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/VertexTriangleAdjacency.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/VertexTriangleAdjacency.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/VertexTriangleAdjacency.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/XFileExporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/XFileExporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/XFileExporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/XFileImporter.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/XFileImporter.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/XFileImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/XFileParser.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/XFileParser.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/XFileParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/code/XGLLoader.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/XGLLoader.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/code/XGLLoader.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/clipper/clipper.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/clipper/clipper.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/clipper/clipper.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/irrXML/irrXML.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/irrXML/irrXML.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/irrXML/irrXML.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/openddlparser/code/DDLNode.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/openddlparser/code/DDLNode.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/openddlparser/code/DDLNode.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/openddlparser/code/OpenDDLParser.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/openddlparser/code/OpenDDLParser.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/openddlparser/code/OpenDDLParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/openddlparser/code/Value.cpp" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/openddlparser/code/Value.cpp.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/openddlparser/code/Value.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/poly2tri/poly2tri/common/shapes.cc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/common/shapes.cc.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/common/shapes.cc.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/poly2tri/poly2tri/sweep/advancing_front.cc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/advancing_front.cc.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/advancing_front.cc.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/poly2tri/poly2tri/sweep/cdt.cc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/cdt.cc.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/cdt.cc.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/poly2tri/poly2tri/sweep/sweep.cc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/sweep.cc.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/sweep.cc.o.d"
+  "/root/repo/Source/ThirdParty/Assimp/contrib/poly2tri/poly2tri/sweep/sweep_context.cc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/sweep_context.cc.o" "gcc" "Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/sweep_context.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/Source/Urho3D/CMakeFiles/Urho3D.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,353 @@
+file(REMOVE_RECURSE
+  "../../../bin/libAssimp.pdb"
+  "CMakeFiles/Assimp.dir/code/3DSConverter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/3DSConverter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/3DSExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/3DSExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/3DSLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/3DSLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ACLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ACLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ASELoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ASELoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ASEParser.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ASEParser.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/AssbinExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/AssbinExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/AssbinLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/AssbinLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Assimp.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Assimp.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/AssimpCExport.cpp.o"
+  "CMakeFiles/Assimp.dir/code/AssimpCExport.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/AssxmlExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/AssxmlExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/B3DImporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/B3DImporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/BVHLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/BVHLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/BaseImporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/BaseImporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/BaseProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/BaseProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Bitmap.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Bitmap.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/BlenderBMesh.cpp.o"
+  "CMakeFiles/Assimp.dir/code/BlenderBMesh.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/BlenderDNA.cpp.o"
+  "CMakeFiles/Assimp.dir/code/BlenderDNA.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/BlenderLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/BlenderLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/BlenderModifier.cpp.o"
+  "CMakeFiles/Assimp.dir/code/BlenderModifier.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/BlenderScene.cpp.o"
+  "CMakeFiles/Assimp.dir/code/BlenderScene.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/BlenderTessellator.cpp.o"
+  "CMakeFiles/Assimp.dir/code/BlenderTessellator.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/COBLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/COBLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/CSMLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/CSMLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/CalcTangentsProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/CalcTangentsProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ColladaExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ColladaExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ColladaLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ColladaLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ColladaParser.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ColladaParser.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ComputeUVMappingProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ComputeUVMappingProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ConvertToLHProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ConvertToLHProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/DXFLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/DXFLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/DeboneProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/DeboneProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/DefaultIOStream.cpp.o"
+  "CMakeFiles/Assimp.dir/code/DefaultIOStream.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/DefaultIOSystem.cpp.o"
+  "CMakeFiles/Assimp.dir/code/DefaultIOSystem.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/DefaultLogger.cpp.o"
+  "CMakeFiles/Assimp.dir/code/DefaultLogger.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Exporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Exporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXAnimation.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXAnimation.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXBinaryTokenizer.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXBinaryTokenizer.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXConverter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXConverter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXDeformer.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXDeformer.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXDocument.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXDocument.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXDocumentUtil.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXDocumentUtil.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXImporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXImporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXMaterial.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXMaterial.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXMeshGeometry.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXMeshGeometry.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXModel.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXModel.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXNodeAttribute.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXNodeAttribute.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXParser.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXParser.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXProperties.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXProperties.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXTokenizer.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXTokenizer.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FBXUtil.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FBXUtil.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FindDegenerates.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FindDegenerates.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FindInstancesProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FindInstancesProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FindInvalidDataProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FindInvalidDataProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/FixNormalsStep.cpp.o"
+  "CMakeFiles/Assimp.dir/code/FixNormalsStep.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/GenFaceNormalsProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/GenFaceNormalsProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/GenVertexNormalsProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/GenVertexNormalsProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/HMPLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/HMPLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IFCBoolean.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IFCBoolean.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IFCCurve.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IFCCurve.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IFCGeometry.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IFCGeometry.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IFCLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IFCLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IFCMaterial.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IFCMaterial.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IFCOpenings.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IFCOpenings.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IFCProfile.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IFCProfile.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IFCReaderGen.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IFCReaderGen.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IFCUtil.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IFCUtil.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IRRLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IRRLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IRRMeshLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IRRMeshLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/IRRShared.cpp.o"
+  "CMakeFiles/Assimp.dir/code/IRRShared.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Importer.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Importer.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ImporterRegistry.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ImporterRegistry.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ImproveCacheLocality.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ImproveCacheLocality.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/JoinVerticesProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/JoinVerticesProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/LWOAnimation.cpp.o"
+  "CMakeFiles/Assimp.dir/code/LWOAnimation.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/LWOBLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/LWOBLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/LWOLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/LWOLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/LWOMaterial.cpp.o"
+  "CMakeFiles/Assimp.dir/code/LWOMaterial.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/LWSLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/LWSLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/LimitBoneWeightsProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/LimitBoneWeightsProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MD2Loader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MD2Loader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MD3Loader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MD3Loader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MD5Loader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MD5Loader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MD5Parser.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MD5Parser.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MDCLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MDCLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MDLLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MDLLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MDLMaterialLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MDLMaterialLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MS3DLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MS3DLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MakeVerboseFormat.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MakeVerboseFormat.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/MaterialSystem.cpp.o"
+  "CMakeFiles/Assimp.dir/code/MaterialSystem.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/NDOLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/NDOLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/NFFLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/NFFLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OFFLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OFFLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ObjExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ObjExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ObjFileImporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ObjFileImporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ObjFileMtlImporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ObjFileMtlImporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ObjFileParser.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ObjFileParser.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OgreBinarySerializer.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OgreBinarySerializer.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OgreImporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OgreImporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OgreMaterial.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OgreMaterial.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OgreStructs.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OgreStructs.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OgreXmlSerializer.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OgreXmlSerializer.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OpenGEXExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OpenGEXExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OpenGEXImporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OpenGEXImporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OptimizeGraph.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OptimizeGraph.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/OptimizeMeshes.cpp.o"
+  "CMakeFiles/Assimp.dir/code/OptimizeMeshes.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/PlyExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/PlyExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/PlyLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/PlyLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/PlyParser.cpp.o"
+  "CMakeFiles/Assimp.dir/code/PlyParser.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/PostStepRegistry.cpp.o"
+  "CMakeFiles/Assimp.dir/code/PostStepRegistry.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/PretransformVertices.cpp.o"
+  "CMakeFiles/Assimp.dir/code/PretransformVertices.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ProcessHelper.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ProcessHelper.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Q3BSPFileImporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Q3BSPFileImporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Q3BSPFileParser.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Q3BSPFileParser.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Q3BSPZipArchive.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Q3BSPZipArchive.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Q3DLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Q3DLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/RawLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/RawLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/RemoveComments.cpp.o"
+  "CMakeFiles/Assimp.dir/code/RemoveComments.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/RemoveRedundantMaterials.cpp.o"
+  "CMakeFiles/Assimp.dir/code/RemoveRedundantMaterials.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/RemoveVCProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/RemoveVCProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/SGSpatialSort.cpp.o"
+  "CMakeFiles/Assimp.dir/code/SGSpatialSort.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/SMDLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/SMDLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/STEPFileEncoding.cpp.o"
+  "CMakeFiles/Assimp.dir/code/STEPFileEncoding.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/STEPFileReader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/STEPFileReader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/STLExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/STLExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/STLLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/STLLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/SceneCombiner.cpp.o"
+  "CMakeFiles/Assimp.dir/code/SceneCombiner.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ScenePreprocessor.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ScenePreprocessor.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/SkeletonMeshBuilder.cpp.o"
+  "CMakeFiles/Assimp.dir/code/SkeletonMeshBuilder.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/SortByPTypeProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/SortByPTypeProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/SpatialSort.cpp.o"
+  "CMakeFiles/Assimp.dir/code/SpatialSort.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/SplitByBoneCountProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/SplitByBoneCountProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/SplitLargeMeshes.cpp.o"
+  "CMakeFiles/Assimp.dir/code/SplitLargeMeshes.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/StandardShapes.cpp.o"
+  "CMakeFiles/Assimp.dir/code/StandardShapes.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/StepExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/StepExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Subdivision.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Subdivision.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/TargetAnimation.cpp.o"
+  "CMakeFiles/Assimp.dir/code/TargetAnimation.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/TerragenLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/TerragenLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/TextureTransform.cpp.o"
+  "CMakeFiles/Assimp.dir/code/TextureTransform.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/TriangulateProcess.cpp.o"
+  "CMakeFiles/Assimp.dir/code/TriangulateProcess.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/UnrealLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/UnrealLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/ValidateDataStructure.cpp.o"
+  "CMakeFiles/Assimp.dir/code/ValidateDataStructure.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/Version.cpp.o"
+  "CMakeFiles/Assimp.dir/code/Version.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/VertexTriangleAdjacency.cpp.o"
+  "CMakeFiles/Assimp.dir/code/VertexTriangleAdjacency.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/XFileExporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/XFileExporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/XFileImporter.cpp.o"
+  "CMakeFiles/Assimp.dir/code/XFileImporter.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/XFileParser.cpp.o"
+  "CMakeFiles/Assimp.dir/code/XFileParser.cpp.o.d"
+  "CMakeFiles/Assimp.dir/code/XGLLoader.cpp.o"
+  "CMakeFiles/Assimp.dir/code/XGLLoader.cpp.o.d"
+  "CMakeFiles/Assimp.dir/contrib/ConvertUTF/ConvertUTF.c.o"
+  "CMakeFiles/Assimp.dir/contrib/ConvertUTF/ConvertUTF.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/clipper/clipper.cpp.o"
+  "CMakeFiles/Assimp.dir/contrib/clipper/clipper.cpp.o.d"
+  "CMakeFiles/Assimp.dir/contrib/irrXML/irrXML.cpp.o"
+  "CMakeFiles/Assimp.dir/contrib/irrXML/irrXML.cpp.o.d"
+  "CMakeFiles/Assimp.dir/contrib/openddlparser/code/DDLNode.cpp.o"
+  "CMakeFiles/Assimp.dir/contrib/openddlparser/code/DDLNode.cpp.o.d"
+  "CMakeFiles/Assimp.dir/contrib/openddlparser/code/OpenDDLParser.cpp.o"
+  "CMakeFiles/Assimp.dir/contrib/openddlparser/code/OpenDDLParser.cpp.o.d"
+  "CMakeFiles/Assimp.dir/contrib/openddlparser/code/Value.cpp.o"
+  "CMakeFiles/Assimp.dir/contrib/openddlparser/code/Value.cpp.o.d"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/common/shapes.cc.o"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/common/shapes.cc.o.d"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/advancing_front.cc.o"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/advancing_front.cc.o.d"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/cdt.cc.o"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/cdt.cc.o.d"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/sweep.cc.o"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/sweep.cc.o.d"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/sweep_context.cc.o"
+  "CMakeFiles/Assimp.dir/contrib/poly2tri/poly2tri/sweep/sweep_context.cc.o.d"
+  "CMakeFiles/Assimp.dir/contrib/unzip/ioapi.c.o"
+  "CMakeFiles/Assimp.dir/contrib/unzip/ioapi.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/unzip/unzip.c.o"
+  "CMakeFiles/Assimp.dir/contrib/unzip/unzip.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/adler32.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/adler32.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/compress.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/compress.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/crc32.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/crc32.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/deflate.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/deflate.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/infback.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/infback.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/inffast.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/inffast.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/inflate.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/inflate.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/inftrees.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/inftrees.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/trees.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/trees.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/uncompr.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/uncompr.c.o.d"
+  "CMakeFiles/Assimp.dir/contrib/zlib/zutil.c.o"
+  "CMakeFiles/Assimp.dir/contrib/zlib/zutil.c.o.d"
+  "libAssimp.a"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/Assimp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/libJO.pdb"
+  "CMakeFiles/JO.dir/jo_jpeg.cpp.o"
+  "CMakeFiles/JO.dir/jo_jpeg.cpp.o.d"
+  "libJO.a"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/JO.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
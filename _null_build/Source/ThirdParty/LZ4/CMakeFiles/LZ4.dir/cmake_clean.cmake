@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../bin/libLZ4.pdb"
+  "CMakeFiles/LZ4.dir/lz4.c.o"
+  "CMakeFiles/LZ4.dir/lz4.c.o.d"
+  "CMakeFiles/LZ4.dir/lz4hc.c.o"
+  "CMakeFiles/LZ4.dir/lz4hc.c.o.d"
+  "libLZ4.a"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/LZ4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/libPugiXml.pdb"
+  "CMakeFiles/PugiXml.dir/src/pugixml.cpp.o"
+  "CMakeFiles/PugiXml.dir/src/pugixml.cpp.o.d"
+  "libPugiXml.a"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PugiXml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,128 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/SDL/src/SDL.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/SDL_assert.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL_assert.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL_assert.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/SDL_error.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL_error.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL_error.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/SDL_hints.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL_hints.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL_hints.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/SDL_log.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL_log.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/SDL_log.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/atomic/SDL_atomic.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/atomic/SDL_atomic.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/atomic/SDL_atomic.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/atomic/SDL_spinlock.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/atomic/SDL_spinlock.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/atomic/SDL_spinlock.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/audio/SDL_audio.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_audio.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_audio.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/audio/SDL_audiocvt.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_audiocvt.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_audiocvt.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/audio/SDL_audiodev.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_audiodev.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_audiodev.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/audio/SDL_audiotypecvt.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_audiotypecvt.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_audiotypecvt.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/audio/SDL_mixer.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_mixer.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_mixer.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/audio/SDL_wave.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_wave.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/SDL_wave.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/audio/disk/SDL_diskaudio.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/disk/SDL_diskaudio.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/disk/SDL_diskaudio.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/audio/dsp/SDL_dspaudio.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/dsp/SDL_dspaudio.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/dsp/SDL_dspaudio.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/audio/dummy/SDL_dummyaudio.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/dummy/SDL_dummyaudio.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/audio/dummy/SDL_dummyaudio.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/core/linux/SDL_dbus.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/core/linux/SDL_dbus.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/core/linux/SDL_dbus.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/core/linux/SDL_evdev.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/core/linux/SDL_evdev.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/core/linux/SDL_evdev.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/core/linux/SDL_ibus.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/core/linux/SDL_ibus.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/core/linux/SDL_ibus.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/core/linux/SDL_udev.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/core/linux/SDL_udev.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/core/linux/SDL_udev.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/cpuinfo/SDL_cpuinfo.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/cpuinfo/SDL_cpuinfo.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/cpuinfo/SDL_cpuinfo.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/events/SDL_clipboardevents.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_clipboardevents.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_clipboardevents.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/events/SDL_dropevents.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_dropevents.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_dropevents.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/events/SDL_events.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_events.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_events.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/events/SDL_gesture.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_gesture.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_gesture.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/events/SDL_keyboard.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_keyboard.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_keyboard.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/events/SDL_mouse.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_mouse.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_mouse.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/events/SDL_quit.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_quit.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_quit.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/events/SDL_touch.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_touch.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_touch.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/events/SDL_windowevents.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_windowevents.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/events/SDL_windowevents.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/file/SDL_rwops.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/file/SDL_rwops.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/file/SDL_rwops.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/filesystem/unix/SDL_sysfilesystem.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/filesystem/unix/SDL_sysfilesystem.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/filesystem/unix/SDL_sysfilesystem.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/haptic/SDL_haptic.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/haptic/SDL_haptic.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/haptic/SDL_haptic.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/haptic/linux/SDL_syshaptic.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/haptic/linux/SDL_syshaptic.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/haptic/linux/SDL_syshaptic.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/joystick/SDL_gamecontroller.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/joystick/SDL_gamecontroller.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/joystick/SDL_gamecontroller.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/joystick/SDL_joystick.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/joystick/SDL_joystick.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/joystick/SDL_joystick.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/joystick/linux/SDL_sysjoystick.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/joystick/linux/SDL_sysjoystick.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/joystick/linux/SDL_sysjoystick.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/e_atan2.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_atan2.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_atan2.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/e_log.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_log.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_log.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/e_pow.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_pow.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_pow.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/e_rem_pio2.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_rem_pio2.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_rem_pio2.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/e_sqrt.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_sqrt.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/e_sqrt.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/k_cos.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/k_cos.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/k_cos.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/k_rem_pio2.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/k_rem_pio2.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/k_rem_pio2.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/k_sin.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/k_sin.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/k_sin.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/k_tan.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/k_tan.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/k_tan.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/s_atan.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_atan.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_atan.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/s_copysign.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_copysign.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_copysign.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/s_cos.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_cos.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_cos.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/s_fabs.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_fabs.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_fabs.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/s_floor.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_floor.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_floor.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/s_scalbn.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_scalbn.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_scalbn.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/s_sin.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_sin.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_sin.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/libm/s_tan.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_tan.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/libm/s_tan.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/loadso/dlopen/SDL_sysloadso.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/loadso/dlopen/SDL_sysloadso.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/loadso/dlopen/SDL_sysloadso.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/power/SDL_power.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/power/SDL_power.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/power/SDL_power.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/power/linux/SDL_syspower.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/power/linux/SDL_syspower.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/power/linux/SDL_syspower.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/stdlib/SDL_getenv.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_getenv.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_getenv.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/stdlib/SDL_iconv.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_iconv.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_iconv.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/stdlib/SDL_malloc.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_malloc.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_malloc.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/stdlib/SDL_qsort.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_qsort.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_qsort.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/stdlib/SDL_stdlib.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_stdlib.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_stdlib.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/stdlib/SDL_string.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_string.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/stdlib/SDL_string.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/thread/SDL_thread.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/SDL_thread.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/SDL_thread.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/thread/pthread/SDL_syscond.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_syscond.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_syscond.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/thread/pthread/SDL_sysmutex.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_sysmutex.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_sysmutex.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/thread/pthread/SDL_syssem.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_syssem.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_syssem.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/thread/pthread/SDL_systhread.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_systhread.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_systhread.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/thread/pthread/SDL_systls.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_systls.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/thread/pthread/SDL_systls.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/timer/SDL_timer.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/timer/SDL_timer.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/timer/SDL_timer.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/timer/unix/SDL_systimer.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/timer/unix/SDL_systimer.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/timer/unix/SDL_systimer.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_RLEaccel.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_RLEaccel.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_RLEaccel.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_blit.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_blit_0.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_0.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_0.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_blit_1.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_1.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_1.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_blit_A.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_A.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_A.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_blit_N.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_N.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_N.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_blit_auto.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_auto.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_auto.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_blit_copy.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_copy.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_copy.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_blit_slow.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_slow.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_blit_slow.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_bmp.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_bmp.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_bmp.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_clipboard.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_clipboard.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_clipboard.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_egl.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_egl.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_egl.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_fillrect.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_fillrect.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_fillrect.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_pixels.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_pixels.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_pixels.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_rect.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_rect.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_rect.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_shape.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_shape.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_shape.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_stretch.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_stretch.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_stretch.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_surface.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_surface.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_surface.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/SDL_video.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_video.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/SDL_video.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/dummy/SDL_nullevents.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/dummy/SDL_nullevents.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/dummy/SDL_nullevents.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/dummy/SDL_nullframebuffer.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/dummy/SDL_nullframebuffer.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/dummy/SDL_nullframebuffer.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/dummy/SDL_nullvideo.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/dummy/SDL_nullvideo.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/dummy/SDL_nullvideo.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11clipboard.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11clipboard.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11clipboard.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11dyn.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11dyn.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11dyn.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11events.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11events.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11events.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11framebuffer.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11framebuffer.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11framebuffer.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11keyboard.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11keyboard.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11keyboard.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11messagebox.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11messagebox.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11messagebox.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11modes.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11modes.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11modes.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11mouse.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11mouse.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11mouse.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11opengl.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11opengl.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11opengl.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11opengles.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11opengles.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11opengles.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11shape.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11shape.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11shape.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11touch.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11touch.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11touch.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11video.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11video.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11video.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11window.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11window.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11window.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/SDL_x11xinput2.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11xinput2.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/SDL_x11xinput2.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/edid-parse.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/edid-parse.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/edid-parse.c.o.d"
+  "/root/repo/Source/ThirdParty/SDL/src/video/x11/imKStoUCS.c" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/imKStoUCS.c.o" "gcc" "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/src/video/x11/imKStoUCS.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/libStanHull.pdb"
+  "CMakeFiles/StanHull.dir/hull.cpp.o"
+  "CMakeFiles/StanHull.dir/hull.cpp.o.d"
+  "libStanHull.a"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StanHull.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/Tools/AssetImporter/AssetImporter.cpp" "Source/Tools/AssetImporter/CMakeFiles/AssetImporter.dir/AssetImporter.cpp.o" "gcc" "Source/Tools/AssetImporter/CMakeFiles/AssetImporter.dir/AssetImporter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/Source/Urho3D/CMakeFiles/Urho3D.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/Assimp/CMakeFiles/Assimp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tool/AssetImporter"
+  "../../../bin/tool/AssetImporter.pdb"
+  "CMakeFiles/AssetImporter.dir/AssetImporter.cpp.o"
+  "CMakeFiles/AssetImporter.dir/AssetImporter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AssetImporter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
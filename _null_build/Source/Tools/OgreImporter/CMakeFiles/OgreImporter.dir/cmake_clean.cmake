@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tool/OgreImporter"
+  "../../../bin/tool/OgreImporter.pdb"
+  "CMakeFiles/OgreImporter.dir/OgreImporter.cpp.o"
+  "CMakeFiles/OgreImporter.dir/OgreImporter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OgreImporter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
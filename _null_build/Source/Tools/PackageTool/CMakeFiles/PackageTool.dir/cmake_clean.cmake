@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tool/PackageTool"
+  "../../../bin/tool/PackageTool.pdb"
+  "CMakeFiles/PackageTool.dir/PackageTool.cpp.o"
+  "CMakeFiles/PackageTool.dir/PackageTool.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PackageTool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tool/RampGenerator"
+  "../../../bin/tool/RampGenerator.pdb"
+  "CMakeFiles/RampGenerator.dir/RampGenerator.cpp.o"
+  "CMakeFiles/RampGenerator.dir/RampGenerator.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RampGenerator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/RenderBenchmark"
+  "../../../bin/RenderBenchmark.pdb"
+  "CMakeFiles/RenderBenchmark.dir/RenderBenchmark.cpp.o"
+  "CMakeFiles/RenderBenchmark.dir/RenderBenchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RenderBenchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tool/SpritePacker"
+  "../../../bin/tool/SpritePacker.pdb"
+  "CMakeFiles/SpritePacker.dir/SpritePacker.cpp.o"
+  "CMakeFiles/SpritePacker.dir/SpritePacker.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SpritePacker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,200 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/Urho3D/Audio/Audio.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/Audio.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/Audio.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/BufferedSoundStream.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/BufferedSoundStream.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/BufferedSoundStream.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/OggVorbisSoundStream.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/OggVorbisSoundStream.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/OggVorbisSoundStream.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/Sound.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/Sound.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/Sound.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/SoundListener.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundListener.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundListener.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/SoundSource.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundSource.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundSource.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/SoundSource3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundSource3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundSource3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/SoundStream.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundStream.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundStream.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/Allocator.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Allocator.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Allocator.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/HashBase.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/HashBase.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/HashBase.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/RefCounted.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/RefCounted.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/RefCounted.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/Str.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Str.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Str.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/Swap.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Swap.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Swap.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/VectorBase.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/VectorBase.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/VectorBase.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Condition.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Condition.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Condition.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Context.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Context.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Context.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/EventProfiler.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/EventProfiler.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/EventProfiler.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/MiniDump.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/MiniDump.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/MiniDump.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Mutex.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Mutex.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Mutex.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Object.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Object.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Object.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/ProcessUtils.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/ProcessUtils.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/ProcessUtils.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Profiler.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Profiler.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Profiler.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Spline.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Spline.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Spline.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/StringUtils.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/StringUtils.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/StringUtils.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Thread.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Thread.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Thread.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Timer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Timer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Timer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Variant.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Variant.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Variant.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/WorkQueue.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/WorkQueue.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/WorkQueue.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/Application.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Application.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Application.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/Console.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Console.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Console.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/DebugHud.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/DebugHud.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/DebugHud.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/Engine.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Engine.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Engine.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/AnimatedModel.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimatedModel.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimatedModel.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Animation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Animation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Animation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/AnimationController.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimationController.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimationController.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/AnimationState.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimationState.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimationState.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Batch.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Batch.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Batch.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/BillboardSet.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/BillboardSet.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/BillboardSet.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Camera.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Camera.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Camera.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ConstantBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ConstantBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ConstantBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/CustomGeometry.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/CustomGeometry.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/CustomGeometry.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/DebugRenderer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DebugRenderer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DebugRenderer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/DecalSet.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DecalSet.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DecalSet.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Drawable.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Drawable.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Drawable.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/GPUObject.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GPUObject.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GPUObject.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Geometry.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Geometry.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Geometry.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Graphics.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Graphics.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Graphics.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/GraphicsDefs.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GraphicsDefs.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GraphicsDefs.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ImpostorSet.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ImpostorSet.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ImpostorSet.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/IndexBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/IndexBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/IndexBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Light.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Light.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Light.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Material.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Material.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Material.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/MeshOptimization.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/MeshOptimization.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/MeshOptimization.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Model.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Model.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Model.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullConstantBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullConstantBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullConstantBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullGraphics.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphics.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphics.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullGraphicsImpl.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphicsImpl.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphicsImpl.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullIndexBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullIndexBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullIndexBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullRenderSurface.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullRenderSurface.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullRenderSurface.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullShaderVariation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullShaderVariation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullShaderVariation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTexture.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTexture2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTexture2DArray.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2DArray.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2DArray.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTexture3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTextureCube.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTextureCube.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTextureCube.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullVertexBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullVertexBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullVertexBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/OcclusionBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/OcclusionBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/OcclusionBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Octree.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Octree.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Octree.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/OctreeQuery.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/OctreeQuery.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/OctreeQuery.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ParticleEffect.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ParticleEffect.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ParticleEffect.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ParticleEmitter.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ParticleEmitter.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ParticleEmitter.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/RenderPath.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RenderPath.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RenderPath.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/RenderSurface.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RenderSurface.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RenderSurface.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Renderer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Renderer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Renderer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/RibbonTrail.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RibbonTrail.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RibbonTrail.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Shader.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Shader.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Shader.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ShaderPrecache.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderPrecache.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderPrecache.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ShaderVariation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderVariation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderVariation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Skeleton.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Skeleton.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Skeleton.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Skybox.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Skybox.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Skybox.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/StaticModel.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/StaticModel.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/StaticModel.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/StaticModelGroup.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/StaticModelGroup.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/StaticModelGroup.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Tangent.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Tangent.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Tangent.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Technique.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Technique.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Technique.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Terrain.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Terrain.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Terrain.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/TerrainPatch.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/TerrainPatch.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/TerrainPatch.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Texture.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Texture2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Texture2DArray.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture2DArray.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture2DArray.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Texture3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/TextureCube.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/TextureCube.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/TextureCube.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/VertexBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/VertexBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/VertexBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/View.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/View.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/View.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Viewport.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Viewport.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Viewport.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Zone.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Zone.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Zone.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/Compression.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Compression.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Compression.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/Deserializer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Deserializer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Deserializer.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/File.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/File.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/File.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/FileSystem.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/FileSystem.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/FileSystem.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/FileWatcher.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/FileWatcher.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/FileWatcher.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/Log.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Log.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Log.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/MemoryBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/MemoryBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/MemoryBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/NamedPipe.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/NamedPipe.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/NamedPipe.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/PackageFile.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/PackageFile.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/PackageFile.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/Serializer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Serializer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Serializer.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/VectorBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/VectorBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/VectorBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Input/Controls.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Input/Controls.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Input/Controls.cpp.o.d"
+  "/root/repo/Source/Urho3D/Input/Input.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Input/Input.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Input/Input.cpp.o.d"
+  "/root/repo/Source/Urho3D/LibraryInfo.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/LibraryInfo.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/LibraryInfo.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/AreaAllocator.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/AreaAllocator.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/AreaAllocator.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/BoundingBox.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/BoundingBox.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/BoundingBox.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Color.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Color.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Color.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Frustum.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Frustum.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Frustum.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/MathDefs.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/MathDefs.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/MathDefs.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Matrix2.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix2.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix2.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Matrix3.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix3.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix3.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Matrix3x4.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix3x4.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix3x4.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Matrix4.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix4.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix4.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Plane.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Plane.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Plane.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Polyhedron.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Polyhedron.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Polyhedron.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Quaternion.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Quaternion.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Quaternion.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Random.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Random.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Random.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Ray.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Ray.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Ray.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Rect.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Rect.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Rect.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Sphere.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Sphere.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Sphere.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/StringHash.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/StringHash.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/StringHash.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Vector2.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector2.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector2.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Vector3.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector3.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector3.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Vector4.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector4.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector4.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/BackgroundLoader.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/BackgroundLoader.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/BackgroundLoader.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/Decompress.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Decompress.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Decompress.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/Image.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Image.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Image.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/JSONFile.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONFile.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONFile.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/JSONValue.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONValue.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONValue.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/Localization.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Localization.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Localization.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/PListFile.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/PListFile.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/PListFile.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/Resource.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Resource.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Resource.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/ResourceCache.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/ResourceCache.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/ResourceCache.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/XMLElement.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLElement.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLElement.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/XMLFile.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLFile.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLFile.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Animatable.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Animatable.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Animatable.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Component.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Component.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Component.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/LogicComponent.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/LogicComponent.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/LogicComponent.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Node.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Node.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Node.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/ObjectAnimation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ObjectAnimation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ObjectAnimation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Prefab.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Prefab.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Prefab.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Scene.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Scene.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Scene.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/SceneResolver.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SceneResolver.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SceneResolver.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/SceneStreamer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SceneStreamer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SceneStreamer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Serializable.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Serializable.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Serializable.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/SmoothedTransform.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SmoothedTransform.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SmoothedTransform.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/SplinePath.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SplinePath.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SplinePath.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/TransformStore.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/TransformStore.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/TransformStore.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/UnknownComponent.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/UnknownComponent.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/UnknownComponent.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/ValueAnimation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ValueAnimation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ValueAnimation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/ValueAnimationInfo.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ValueAnimationInfo.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ValueAnimationInfo.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/BorderImage.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/BorderImage.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/BorderImage.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Button.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Button.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Button.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/CheckBox.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/CheckBox.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/CheckBox.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Cursor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Cursor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Cursor.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/DropDownList.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/DropDownList.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/DropDownList.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/FileSelector.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FileSelector.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FileSelector.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Font.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Font.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Font.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/FontFace.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFace.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFace.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/FontFaceBitmap.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFaceBitmap.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFaceBitmap.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/FontFaceFreeType.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFaceFreeType.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFaceFreeType.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/LineEdit.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/LineEdit.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/LineEdit.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/ListView.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ListView.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ListView.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Menu.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Menu.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Menu.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/MessageBox.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/MessageBox.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/MessageBox.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/ScrollBar.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ScrollBar.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ScrollBar.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/ScrollView.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ScrollView.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ScrollView.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Slider.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Slider.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Slider.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Sprite.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Sprite.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Sprite.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Text.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Text.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Text.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Text3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Text3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Text3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/ToolTip.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ToolTip.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ToolTip.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/UI.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UI.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UI.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/UIBatch.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIBatch.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIBatch.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/UIElement.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIElement.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIElement.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/View3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/View3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/View3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Window.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Window.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Window.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
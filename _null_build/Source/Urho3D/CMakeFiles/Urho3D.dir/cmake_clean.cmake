@@ -0,0 +1,375 @@
+file(REMOVE_RECURSE
+  "../../bin/libUrho3D.pdb"
+  "../../lib/libUrho3D.a"
+  "CMakeFiles/Urho3D.dir/Audio/Audio.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/Audio.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/BufferedSoundStream.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/BufferedSoundStream.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/OggVorbisSoundStream.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/OggVorbisSoundStream.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/Sound.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/Sound.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/SoundListener.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/SoundListener.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/SoundSource.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/SoundSource.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/SoundSource3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/SoundSource3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/SoundStream.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/SoundStream.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/Allocator.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/Allocator.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/HashBase.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/HashBase.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/RefCounted.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/RefCounted.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/Str.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/Str.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/Swap.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/Swap.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/VectorBase.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/VectorBase.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Condition.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Condition.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Context.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Context.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/EventProfiler.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/EventProfiler.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/MiniDump.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/MiniDump.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Mutex.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Mutex.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Object.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Object.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/ProcessUtils.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/ProcessUtils.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Profiler.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Profiler.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Spline.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Spline.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/StringUtils.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/StringUtils.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Thread.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Thread.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Timer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Timer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Variant.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Variant.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/WorkQueue.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/WorkQueue.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/Application.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/Application.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/Console.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/Console.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/DebugHud.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/DebugHud.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/Engine.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/Engine.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimatedModel.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimatedModel.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Animation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Animation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimationController.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimationController.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimationState.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimationState.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Batch.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Batch.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/BillboardSet.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/BillboardSet.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Camera.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Camera.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ConstantBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ConstantBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/CustomGeometry.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/CustomGeometry.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/DebugRenderer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/DebugRenderer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/DecalSet.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/DecalSet.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Drawable.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Drawable.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/GPUObject.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/GPUObject.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Geometry.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Geometry.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Graphics.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Graphics.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/GraphicsDefs.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/GraphicsDefs.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ImpostorSet.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ImpostorSet.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/IndexBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/IndexBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Light.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Light.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Material.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Material.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/MeshOptimization.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/MeshOptimization.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Model.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Model.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullConstantBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullConstantBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphics.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphics.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphicsImpl.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphicsImpl.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullIndexBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullIndexBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullRenderSurface.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullRenderSurface.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullShaderVariation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullShaderVariation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2DArray.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2DArray.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTextureCube.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTextureCube.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullVertexBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullVertexBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/OcclusionBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/OcclusionBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Octree.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Octree.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/OctreeQuery.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/OctreeQuery.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ParticleEffect.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ParticleEffect.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ParticleEmitter.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ParticleEmitter.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/RenderPath.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/RenderPath.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/RenderSurface.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/RenderSurface.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Renderer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Renderer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/RibbonTrail.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/RibbonTrail.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Shader.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Shader.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderPrecache.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderPrecache.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderVariation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderVariation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Skeleton.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Skeleton.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Skybox.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Skybox.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/StaticModel.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/StaticModel.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/StaticModelGroup.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/StaticModelGroup.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Tangent.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Tangent.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Technique.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Technique.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Terrain.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Terrain.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/TerrainPatch.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/TerrainPatch.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture2DArray.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture2DArray.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/TextureCube.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/TextureCube.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/VertexBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/VertexBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/View.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/View.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Viewport.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Viewport.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Zone.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Zone.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/Compression.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/Compression.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/Deserializer.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/Deserializer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/File.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/File.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/FileSystem.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/FileSystem.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/FileWatcher.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/FileWatcher.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/Log.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/Log.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/MemoryBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/MemoryBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/NamedPipe.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/NamedPipe.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/PackageFile.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/PackageFile.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/Serializer.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/Serializer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/VectorBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/VectorBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Input/Controls.cpp.o"
+  "CMakeFiles/Urho3D.dir/Input/Controls.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Input/Input.cpp.o"
+  "CMakeFiles/Urho3D.dir/Input/Input.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/LibraryInfo.cpp.o"
+  "CMakeFiles/Urho3D.dir/LibraryInfo.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/AreaAllocator.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/AreaAllocator.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/BoundingBox.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/BoundingBox.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Color.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Color.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Frustum.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Frustum.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/MathDefs.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/MathDefs.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Matrix2.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Matrix2.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Matrix3.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Matrix3.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Matrix3x4.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Matrix3x4.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Matrix4.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Matrix4.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Plane.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Plane.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Polyhedron.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Polyhedron.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Quaternion.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Quaternion.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Random.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Random.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Ray.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Ray.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Rect.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Rect.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Sphere.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Sphere.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/StringHash.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/StringHash.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Vector2.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Vector2.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Vector3.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Vector3.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Vector4.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Vector4.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/BackgroundLoader.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/BackgroundLoader.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/Decompress.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/Decompress.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/Image.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/Image.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/JSONFile.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/JSONFile.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/JSONValue.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/JSONValue.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/Localization.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/Localization.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/PListFile.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/PListFile.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/Resource.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/Resource.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/ResourceCache.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/ResourceCache.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/XMLElement.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/XMLElement.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/XMLFile.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/XMLFile.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Animatable.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Animatable.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Component.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Component.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/LogicComponent.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/LogicComponent.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Node.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Node.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/ObjectAnimation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/ObjectAnimation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Prefab.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Prefab.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Scene.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Scene.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/SceneResolver.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/SceneResolver.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/SceneStreamer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/SceneStreamer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Serializable.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Serializable.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/SmoothedTransform.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/SmoothedTransform.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/SplinePath.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/SplinePath.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/TransformStore.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/TransformStore.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/UnknownComponent.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/UnknownComponent.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/ValueAnimation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/ValueAnimation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/ValueAnimationInfo.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/ValueAnimationInfo.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/BorderImage.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/BorderImage.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Button.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Button.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/CheckBox.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/CheckBox.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Cursor.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Cursor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/DropDownList.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/DropDownList.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/FileSelector.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/FileSelector.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Font.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Font.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/FontFace.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/FontFace.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/FontFaceBitmap.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/FontFaceBitmap.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/FontFaceFreeType.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/FontFaceFreeType.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/LineEdit.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/LineEdit.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/ListView.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/ListView.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Menu.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Menu.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/MessageBox.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/MessageBox.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/ScrollBar.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/ScrollBar.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/ScrollView.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/ScrollView.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Slider.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Slider.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Sprite.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Sprite.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Text.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Text.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Text3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Text3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/ToolTip.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/ToolTip.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/UI.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/UI.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/UIBatch.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/UIBatch.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/UIElement.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/UIElement.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/View3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/View3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Window.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Window.cpp.o.d"
+  "Precompiled.h.Release.pch.trigger"
+  "librevision.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Urho3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
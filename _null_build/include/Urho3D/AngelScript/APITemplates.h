@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/AngelScript/APITemplates.h
\ No newline at end of file
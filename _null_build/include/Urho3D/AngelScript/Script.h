@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/AngelScript/Script.h
\ No newline at end of file
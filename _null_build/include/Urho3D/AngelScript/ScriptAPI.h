@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/AngelScript/ScriptAPI.h
\ No newline at end of file
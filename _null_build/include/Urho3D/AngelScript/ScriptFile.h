@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/AngelScript/ScriptFile.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/AngelScript/ScriptInstance.h
\ No newline at end of file
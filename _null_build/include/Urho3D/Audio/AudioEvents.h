@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Audio/AudioEvents.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Audio/SoundListener.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Audio/SoundSource.h
\ No newline at end of file
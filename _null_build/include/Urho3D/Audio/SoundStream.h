@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Audio/SoundStream.h
\ No newline at end of file
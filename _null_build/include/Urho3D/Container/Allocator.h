@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/Allocator.h
\ No newline at end of file
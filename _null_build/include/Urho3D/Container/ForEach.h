@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/ForEach.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/Hash.h
\ No newline at end of file
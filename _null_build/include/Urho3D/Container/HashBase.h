@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/HashBase.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/HashMap.h
\ No newline at end of file
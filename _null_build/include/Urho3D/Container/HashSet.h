@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/HashSet.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/LinkedList.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/ListBase.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/Sort.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Container/Vector.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/Attribute.h
\ No newline at end of file
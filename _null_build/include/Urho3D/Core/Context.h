@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/Context.h
\ No newline at end of file
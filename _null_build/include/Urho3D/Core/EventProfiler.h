@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/EventProfiler.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/MiniDump.h
\ No newline at end of file
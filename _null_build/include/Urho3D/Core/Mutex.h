@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/Mutex.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/Object.h
\ No newline at end of file
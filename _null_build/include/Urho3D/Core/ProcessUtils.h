@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/ProcessUtils.h
\ No newline at end of file
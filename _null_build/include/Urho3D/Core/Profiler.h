@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/Profiler.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/StringUtils.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/Thread.h
\ No newline at end of file
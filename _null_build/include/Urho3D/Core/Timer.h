@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/Timer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Core/Variant.h
\ No newline at end of file
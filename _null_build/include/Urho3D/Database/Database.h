@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Database/Database.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Database/DatabaseEvents.h
\ No newline at end of file
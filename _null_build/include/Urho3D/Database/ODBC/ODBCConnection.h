@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Database/ODBC/ODBCConnection.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Database/ODBC/ODBCResult.h
\ No newline at end of file
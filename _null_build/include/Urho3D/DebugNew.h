@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/DebugNew.h
\ No newline at end of file
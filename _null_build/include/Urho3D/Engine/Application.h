@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Engine/Application.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Engine/DebugHud.h
\ No newline at end of file
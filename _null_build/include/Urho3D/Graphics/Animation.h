@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Animation.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Batch.h
\ No newline at end of file
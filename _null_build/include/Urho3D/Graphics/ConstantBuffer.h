@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/ConstantBuffer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/DecalSet.h
\ No newline at end of file
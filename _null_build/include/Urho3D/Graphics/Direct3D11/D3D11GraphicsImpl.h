@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Direct3D11/D3D11GraphicsImpl.h
\ No newline at end of file
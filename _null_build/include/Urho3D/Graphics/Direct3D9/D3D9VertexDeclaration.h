@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Direct3D9/D3D9VertexDeclaration.h
\ No newline at end of file
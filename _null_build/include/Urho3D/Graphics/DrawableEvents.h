@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/DrawableEvents.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Geometry.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Graphics.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/GraphicsDefs.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Null/NullGraphicsImpl.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Octree.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/OpenGL/OGLShaderProgram.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/ParticleEffect.h
\ No newline at end of file
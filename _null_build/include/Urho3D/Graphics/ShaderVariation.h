@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/ShaderVariation.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Skeleton.h
\ No newline at end of file
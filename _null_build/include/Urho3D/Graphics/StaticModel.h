@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/StaticModel.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/StaticModelGroup.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Tangent.h
\ No newline at end of file
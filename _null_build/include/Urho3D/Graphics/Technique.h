@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Technique.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Texture2D.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/Texture3D.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/TextureCube.h
\ No newline at end of file
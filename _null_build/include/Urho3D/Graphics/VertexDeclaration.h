@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Graphics/VertexDeclaration.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/IO/FileWatcher.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/IO/Serializer.h
\ No newline at end of file
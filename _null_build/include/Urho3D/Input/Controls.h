@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Input/Controls.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Input/Input.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Input/InputEvents.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/LibraryInfo.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/LuaScript/LuaScriptEventInvoker.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/LuaScript/LuaScriptEventListener.h
\ No newline at end of file
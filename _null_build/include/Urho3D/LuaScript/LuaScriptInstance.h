@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/LuaScript/LuaScriptInstance.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/LuaScript/ToluaUtils.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/AreaAllocator.h
\ No newline at end of file
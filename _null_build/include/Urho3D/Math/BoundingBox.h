@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/BoundingBox.h
\ No newline at end of file
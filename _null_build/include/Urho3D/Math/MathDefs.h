@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/MathDefs.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Matrix3.h
\ No newline at end of file
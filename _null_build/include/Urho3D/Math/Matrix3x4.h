@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Matrix3x4.h
\ No newline at end of file
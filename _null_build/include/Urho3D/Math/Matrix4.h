@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Matrix4.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Plane.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Polyhedron.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Quaternion.h
\ No newline at end of file
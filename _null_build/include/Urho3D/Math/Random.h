@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Random.h
\ No newline at end of file
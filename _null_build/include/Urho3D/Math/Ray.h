@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Ray.h
\ No newline at end of file
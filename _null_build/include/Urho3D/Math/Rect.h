@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Rect.h
\ No newline at end of file
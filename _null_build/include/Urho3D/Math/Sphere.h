@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Sphere.h
\ No newline at end of file
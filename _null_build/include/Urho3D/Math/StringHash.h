@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/StringHash.h
\ No newline at end of file
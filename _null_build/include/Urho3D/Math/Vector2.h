@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Vector2.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Math/Vector3.h
\ No newline at end of file
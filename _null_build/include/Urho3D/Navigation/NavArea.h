@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Navigation/NavArea.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Navigation/Navigable.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Navigation/NavigationEvents.h
\ No newline at end of file
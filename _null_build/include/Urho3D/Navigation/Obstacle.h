@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Navigation/Obstacle.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Navigation/OffMeshConnection.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Network/Network.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Network/NetworkEvents.h
\ No newline at end of file
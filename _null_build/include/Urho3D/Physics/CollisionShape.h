@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Physics/CollisionShape.h
\ No newline at end of file
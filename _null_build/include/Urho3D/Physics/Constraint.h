@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Physics/Constraint.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Physics/PhysicsEvents.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Physics/PhysicsUtils.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Physics/PhysicsWorld.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Physics/RigidBody.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Precompiled.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Resource/Image.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Resource/JSONFile.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Resource/JSONValue.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Resource/Localization.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Resource/PListFile.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Resource/Resource.h
\ No newline at end of file
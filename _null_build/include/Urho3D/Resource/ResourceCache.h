@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Resource/ResourceCache.h
\ No newline at end of file
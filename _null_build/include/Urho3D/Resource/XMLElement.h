@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Resource/XMLElement.h
\ No newline at end of file
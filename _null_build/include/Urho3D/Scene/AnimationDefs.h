@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/AnimationDefs.h
\ No newline at end of file
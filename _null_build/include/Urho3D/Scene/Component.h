@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/Component.h
\ No newline at end of file
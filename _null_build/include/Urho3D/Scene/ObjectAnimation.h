@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/ObjectAnimation.h
\ No newline at end of file
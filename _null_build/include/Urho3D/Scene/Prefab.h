@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/Prefab.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/ReplicationState.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/SceneEvents.h
\ No newline at end of file
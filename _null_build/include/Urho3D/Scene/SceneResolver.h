@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/SceneResolver.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/SceneStreamer.h
\ No newline at end of file
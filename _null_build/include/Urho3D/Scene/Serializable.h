@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/Serializable.h
\ No newline at end of file
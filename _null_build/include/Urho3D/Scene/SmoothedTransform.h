@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/SmoothedTransform.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/SplinePath.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/TransformStore.h
\ No newline at end of file
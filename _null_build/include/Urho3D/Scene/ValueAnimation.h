@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Scene/ValueAnimation.h
\ No newline at end of file
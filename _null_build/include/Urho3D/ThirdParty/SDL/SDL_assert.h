@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/SDL/include/SDL_assert.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/_null_build/Source/ThirdParty/SDL/include/generated/SDL_config.h
\ No newline at end of file
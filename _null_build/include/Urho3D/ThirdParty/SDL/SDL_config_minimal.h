@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/SDL/include/SDL_config_minimal.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/SDL/include/SDL_copying.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/SDL/include/SDL_mouse.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/SDL/include/SDL_opengl_glext.h
\ No newline at end of file
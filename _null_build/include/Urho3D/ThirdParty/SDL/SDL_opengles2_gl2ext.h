@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/SDL/include/SDL_opengles2_gl2ext.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/SDL/include/SDL_types.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/SDL/include/begin_code.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/SDL/include/close_code.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/STB/./stb_image.h
\ No newline at end of file
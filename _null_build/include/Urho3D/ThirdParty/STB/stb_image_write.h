@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/STB/./stb_image_write.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/STB/./stb_rect_pack.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/STB/./stb_vorbis.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/FreeType/include/ft2build.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/ThirdParty/rapidjson/include/rapidjson/filereadstream.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/Cursor.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/DropDownList.h
\ No newline at end of file
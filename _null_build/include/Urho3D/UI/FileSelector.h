@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/FileSelector.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/ListView.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/Menu.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/ScrollBar.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/Sprite.h
\ No newline at end of file
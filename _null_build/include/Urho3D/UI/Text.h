@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/Text.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/UI.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/UIEvents.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/View3D.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/UI/Window.h
\ No newline at end of file
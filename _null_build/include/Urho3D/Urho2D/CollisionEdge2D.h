@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Urho2D/CollisionEdge2D.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Urho2D/CollisionShape2D.h
\ No newline at end of file
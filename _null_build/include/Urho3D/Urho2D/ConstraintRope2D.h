@@ -0,0 +1 @@
+/root/repo/Source/Urho3D/Urho2D/ConstraintRope2D.h
\ No newline at end of file
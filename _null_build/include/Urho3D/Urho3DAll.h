@@ -0,0 +1 @@
+/root/repo/_null_build/Source/Urho3D/Urho3DAll.h
\ No newline at end of file
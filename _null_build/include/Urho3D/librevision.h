@@ -0,0 +1 @@
+/root/repo/_null_build/Source/Urho3D/librevision.h
\ No newline at end of file
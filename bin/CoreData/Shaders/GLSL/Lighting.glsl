@@ -162,6 +162,52 @@ float GetIntensity(vec3 color)
     return dot(color, vec3(0.299, 0.587, 0.114));
 }
 
+#ifdef CLUSTERED
+#define MAXCLUSTERLIGHTS 32
+
+vec4 GetClusterTexel(float index)
+{
+    float y = floor(index * cClusterTexSize.z);
+    float x = index - y * cClusterTexSize.x;
+    return texture2D(sClusterBuffer, (vec2(x, y) + 0.5) * cClusterTexSize.zw);
+}
+
+vec3 GetClusteredLighting(vec3 worldPos, vec3 normal, vec3 diffColor, vec3 specColor, float specularPower)
+{
+    // Find the cluster from the view space position
+    vec3 viewPos = (vec4(worldPos, 1.0) * cClusterView).xyz;
+    vec2 ndc = viewPos.xy * cClusterProj.xy / viewPos.z + cClusterProj.zw;
+    vec2 tile = clamp(floor((ndc * 0.5 + 0.5) * cClusterGrid.xy), vec2(0.0, 0.0), cClusterGrid.xy - 1.0);
+    float slice = clamp(floor(log(viewPos.z * cClusterDepth.x) * cClusterDepth.y), 0.0, cClusterGrid.z - 1.0);
+    vec4 cluster = GetClusterTexel((slice * cClusterGrid.y + tile.y) * cClusterGrid.x + tile.x);
+
+    vec3 eyeVec = cCameraPosPS - worldPos;
+    vec3 lighting = vec3(0.0, 0.0, 0.0);
+
+    for (int i = 0; i < MAXCLUSTERLIGHTS; ++i)
+    {
+        if (float(i) >= cluster.y)
+            break;
+
+        float lightIndex = GetClusterTexel(cluster.x + float(i)).x;
+        vec4 lightPos = GetClusterTexel(lightIndex);
+        vec4 lightColor = GetClusterTexel(lightIndex + 1.0);
+        vec4 lightSpot = GetClusterTexel(lightIndex + 2.0);
+
+        vec3 lightVec = (lightPos.xyz - worldPos) * lightPos.w;
+        float lightDist = length(lightVec);
+        vec3 lightDir = lightVec / max(lightDist, 0.0001);
+        float spotAtten = clamp(dot(lightDir, lightSpot.xyz) - lightSpot.w, 0.0, 1.0);
+        float diff = max(dot(normal, lightDir), 0.0) * spotAtten * texture2D(sLightRampMap, vec2(lightDist, 0.0)).r;
+        float spec = GetSpecular(normal, eyeVec, lightDir, specularPower);
+
+        lighting += diff * lightColor.rgb * (diffColor + spec * specColor * lightColor.a);
+    }
+
+    return lighting;
+}
+#endif
+
 #ifdef SHADOW
 
 #if defined(DIRLIGHT) && (!defined(GL_ES) || defined(WEBGL))
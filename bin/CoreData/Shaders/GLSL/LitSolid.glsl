@@ -228,6 +228,11 @@ void PS()
             finalColor += lightInput.rgb * diffColor.rgb + lightSpecColor * specColor;
         #endif
 
+        #ifdef CLUSTERED
+            // Add the lights of the pixel's light cluster
+            finalColor += GetClusteredLighting(vWorldPos.xyz, normal, diffColor.rgb, specColor, cMatSpecColor.a);
+        #endif
+
         #ifdef ENVCUBEMAP
             finalColor += cMatEnvMapColor * textureCube(sEnvCubeMap, reflect(vReflectionVec, normal)).rgb;
         #endif
@@ -15,6 +15,9 @@ uniform samplerCube sLightCubeMap;
     uniform sampler2D sNormalBuffer;
     uniform sampler2D sDepthBuffer;
     uniform sampler2D sLightBuffer;
+    #ifdef CLUSTERED
+        uniform sampler2D sClusterBuffer;
+    #endif
     #ifdef VSM_SHADOW
         uniform sampler2D sShadowMap;
     #else
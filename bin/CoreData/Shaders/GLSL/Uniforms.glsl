@@ -83,6 +83,13 @@ uniform mat4 cLightMatricesPS[4];
 #ifdef VSM_SHADOW
 uniform vec2 cVSMShadowParams;
 #endif
+#ifdef CLUSTERED
+uniform mat4 cClusterView;
+uniform vec4 cClusterProj;
+uniform vec4 cClusterGrid;
+uniform vec2 cClusterDepth;
+uniform vec4 cClusterTexSize;
+#endif
 #endif
 
 #else
@@ -167,6 +174,13 @@ uniform CameraPS
     vec2 cGBufferInvSize;
     float cNearClipPS;
     float cFarClipPS;
+#ifdef CLUSTERED
+    mat4 cClusterView;
+    vec4 cClusterProj;
+    vec4 cClusterGrid;
+    vec2 cClusterDepth;
+    vec4 cClusterTexSize;
+#endif
 };
 
 uniform ZonePS
@@ -173,6 +173,52 @@ float GetIntensity(float3 color)
     return dot(color, float3(0.299, 0.587, 0.114));
 }
 
+#ifdef CLUSTERED
+#define MAXCLUSTERLIGHTS 32
+
+float4 GetClusterTexel(float index)
+{
+    float y = floor(index * cClusterTexSize.z);
+    float x = index - y * cClusterTexSize.x;
+    return Sample2DLod0(ClusterBuffer, (float2(x, y) + 0.5) * cClusterTexSize.zw);
+}
+
+float3 GetClusteredLighting(float3 worldPos, float3 normal, float3 diffColor, float3 specColor, float specularPower)
+{
+    // Find the cluster from the view space position
+    float3 viewPos = mul(float4(worldPos, 1.0), cClusterView);
+    float2 ndc = viewPos.xy * cClusterProj.xy / viewPos.z + cClusterProj.zw;
+    float2 tile = clamp(floor((ndc * 0.5 + 0.5) * cClusterGrid.xy), 0.0, cClusterGrid.xy - 1.0);
+    float slice = clamp(floor(log(viewPos.z * cClusterDepth.x) * cClusterDepth.y), 0.0, cClusterGrid.z - 1.0);
+    float4 cluster = GetClusterTexel((slice * cClusterGrid.y + tile.y) * cClusterGrid.x + tile.x);
+
+    float3 eyeVec = cCameraPosPS - worldPos;
+    float3 lighting = 0.0;
+
+    for (int i = 0; i < MAXCLUSTERLIGHTS; ++i)
+    {
+        if (i >= cluster.y)
+            break;
+
+        float lightIndex = GetClusterTexel(cluster.x + i).x;
+        float4 lightPos = GetClusterTexel(lightIndex);
+        float4 lightColor = GetClusterTexel(lightIndex + 1.0);
+        float4 lightSpot = GetClusterTexel(lightIndex + 2.0);
+
+        float3 lightVec = (lightPos.xyz - worldPos) * lightPos.w;
+        float lightDist = length(lightVec);
+        float3 lightDir = lightVec / max(lightDist, 0.0001);
+        float spotAtten = saturate(dot(lightDir, lightSpot.xyz) - lightSpot.w);
+        float diff = saturate(dot(normal, lightDir)) * spotAtten * Sample2DLod0(LightRampMap, float2(lightDist, 0.0)).r;
+        float spec = GetSpecular(normal, eyeVec, lightDir, specularPower);
+
+        lighting += diff * lightColor.rgb * (diffColor + spec * specColor * lightColor.a);
+    }
+
+    return lighting;
+}
+#endif
+
 #ifdef SHADOW
 
 #ifdef DIRLIGHT
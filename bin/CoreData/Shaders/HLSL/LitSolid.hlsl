@@ -302,6 +302,11 @@ void PS(
             finalColor += lightInput.rgb * diffColor.rgb + lightSpecColor * specColor;
         #endif
 
+        #ifdef CLUSTERED
+            // Add the lights of the pixel's light cluster
+            finalColor += GetClusteredLighting(iWorldPos.xyz, normal, diffColor.rgb, specColor, cMatSpecColor.a);
+        #endif
+
         #ifdef ENVCUBEMAP
             finalColor += cMatEnvMapColor * SampleCube(EnvCubeMap, reflect(iReflectionVec, normal)).rgb;
         #endif
@@ -32,6 +32,7 @@ samplerCUBE sFaceSelectCubeMap : register(s11);
 samplerCUBE sIndirectionCubeMap : register(s12);
 sampler2D sDepthBuffer : register(s13);
 sampler2D sLightBuffer : register(s14);
+sampler2D sClusterBuffer : register(s14);
 samplerCUBE sZoneCubeMap : register(s15);
 sampler3D sZoneVolumeMap : register(s15);
 
@@ -65,6 +66,7 @@ TextureCube tFaceSelectCubeMap : register(t11);
 TextureCube tIndirectionCubeMap : register(t12);
 Texture2D tDepthBuffer : register(t13);
 Texture2D tLightBuffer : register(t14);
+Texture2D tClusterBuffer : register(t14);
 TextureCube tZoneCubeMap : register(t15);
 Texture3D tZoneVolumeMap : register(t15);
 
@@ -91,6 +93,7 @@ SamplerState sFaceSelectCubeMap : register(s11);
 SamplerState sIndirectionCubeMap : register(s12);
 SamplerState sDepthBuffer : register(s13);
 SamplerState sLightBuffer : register(s14);
+SamplerState sClusterBuffer : register(s14);
 SamplerState sZoneCubeMap : register(s15);
 SamplerState sZoneVolumeMap : register(s15);
 
@@ -72,6 +72,13 @@ uniform float4x4 cLightMatricesPS[4];
 #ifdef VSM_SHADOW
 uniform float2 cVSMShadowParams;
 #endif
+#ifdef CLUSTERED
+uniform float4x3 cClusterView;
+uniform float4 cClusterProj;
+uniform float4 cClusterGrid;
+uniform float2 cClusterDepth;
+uniform float4 cClusterTexSize;
+#endif
 #endif
 
 #else
@@ -156,6 +163,13 @@ cbuffer CameraPS : register(b1)
     float2 cGBufferInvSize;
     float cNearClipPS;
     float cFarClipPS;
+#ifdef CLUSTERED
+    float4x3 cClusterView;
+    float4 cClusterProj;
+    float4 cClusterGrid;
+    float2 cClusterDepth;
+    float4 cClusterTexSize;
+#endif
 }
 
 cbuffer ZonePS : register(b2)
@@ -4,6 +4,7 @@
 --     - Competing with http://yosoygames.com.ar/wp/2013/07/ogre-2-0-is-up-to-3x-faster/ :)
 --     - Allowing examination of performance hotspots in the rendering code
 --     - Optionally speeding up rendering by grouping objects with the StaticModelGroup component
+--     - Optionally updating world transforms in one linear pass over the flattened node hierarchy
 
 require "LuaScripts/Utilities/Sample"
 
@@ -112,7 +113,8 @@ function CreateInstructions()
     local instructionText = ui.root:CreateChild("Text")
     instructionText:SetText("Use WASD keys and mouse to move\n"..
         "Space to toggle animation\n"..
-        "G to toggle object group optimization")
+        "G to toggle object group optimization\n"..
+        "T to toggle linear transform update")
     instructionText:SetFont(cache:GetResource("Font", "Fonts/Anonymous Pro.ttf"), 15)
     -- The text has multiple rows. Center them in relation to each other
     instructionText.textAlignment = HA_CENTER
@@ -193,6 +195,11 @@ function HandleUpdate(eventType, eventData)
         CreateScene()
     end
 
+    -- Toggle updating world transforms in one linear pass instead of lazily on access
+    if input:GetKeyPress(KEY_T) then
+        scene_.linearTransformUpdate = not scene_.linearTransformUpdate
+    end
+
     -- Move the camera, scale movement with time step
     MoveCamera(timeStep)
 
@@ -4,6 +4,7 @@
 //     - Competing with http://yosoygames.com.ar/wp/2013/07/ogre-2-0-is-up-to-3x-faster/ :)
 //     - Allowing examination of performance hotspots in the rendering code
 //     - Optionally speeding up rendering by grouping objects with the StaticModelGroup component
+//     - Optionally updating world transforms in one linear pass over the flattened node hierarchy
 
 #include "Scripts/Utilities/Sample.as"
 
@@ -126,7 +127,8 @@ void CreateInstructions()
     instructionText.text =
         "Use WASD keys and mouse to move\n"
         "Space to toggle animation\n"
-        "G to toggle object group optimization";
+        "G to toggle object group optimization\n"
+        "T to toggle linear transform update";
     instructionText.SetFont(cache.GetResource("Font", "Fonts/Anonymous Pro.ttf"), 15);
     // The text has multiple rows. Center them in relation to each other
     instructionText.textAlignment = HA_CENTER;
@@ -207,6 +209,10 @@ void HandleUpdate(StringHash eventType, VariantMap& eventData)
         CreateScene();
     }
 
+    // Toggle updating world transforms in one linear pass instead of lazily on access
+    if (input.keyPress[KEY_T])
+        scene_.linearTransformUpdate = !scene_.linearTransformUpdate;
+
     // Move the camera, scale movement with time step
     MoveCamera(timeStep);
 